@@ -59,6 +59,12 @@ function(ADD_FEATURE_DEFINITIONS)
     add_definitions(-DODE_NULL_TEST_SINK=0)
   endif()
 
+  if(OFFSCREEN_TESTS)
+    add_definitions(-DODE_TEST_OFFSCREEN=1)
+  else()
+    add_definitions(-DODE_TEST_OFFSCREEN=0)
+  endif()
+
   if(MULTITHREADING)
     # add_definitions(-DODE_MULTITHREADING=1)
     add_definitions(-DODE_MULTITHREADING=0)
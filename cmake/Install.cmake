@@ -75,6 +75,12 @@ function(CREATE_ANTHEM_SCRIPTS_INSTALL_TARGET)
       FILES_MATCHING PATTERN "*.lua")
 endfunction()
 
+function(CREATE_ANTHEM_ASSETS_INSTALL_TARGET)
+  install(DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/assets/anthem
+      DESTINATION assets
+      FILES_MATCHING PATTERN "*.png")
+endfunction()
+
 function(CREATE_ANTHEM_LIB_SCRIPTS_INSTALL_TARGET)
   # install(DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/script/lib/anthem
   #     DESTINATION ${CMAKE_INSTALL_PREFIX}/${ODE_LIB_SCRIPT_DIR_NAME}
@@ -107,6 +113,7 @@ function(CREATE_INSTALL_TARGETS)
   endif()
   create_ode_scripts_install_target()
   create_anthem_scripts_install_target()
+  create_anthem_assets_install_target()
   create_anthem_lib_scripts_install_target()
   if(ODE_BUILD_TEST)
     create_anthem_test_executable_install_target()
@@ -0,0 +1,130 @@
+/// The declaration and the definition of the allocator that aligns the
+/// memory for the SIMD kernels.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_ALIGNED_ALLOCATOR_H
+#define ODE_ALIGNED_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace ode
+{
+  ///
+  /// The type of the allocators that give memory aligned to the given
+  /// boundary so that the SIMD kernels can use the aligned loads and stores.
+  ///
+  /// \tparam T the type of the allocated objects.
+  /// \tparam Alignment the alignment of the memory in bytes.
+  ///
+  template <typename T, std::size_t Alignment = 32>
+  struct aligned_allocator
+  {
+    static_assert(
+        Alignment >= alignof(T) && 0 == (Alignment & (Alignment - 1)),
+        "The alignment must be a power of two and at least that of the type");
+
+    ///
+    /// The type of the allocated objects.
+    ///
+    using value_type = T;
+
+    ///
+    /// The type of the allocator for another type of objects.
+    ///
+    /// \tparam U the other type.
+    ///
+    template <typename U>
+    struct rebind
+    {
+      ///
+      /// The type of the allocator.
+      ///
+      using other = aligned_allocator<U, Alignment>;
+    };
+
+    ///
+    /// Constructs an object of the type \c aligned_allocator.
+    ///
+    aligned_allocator() noexcept = default;
+
+    ///
+    /// Constructs an object of the type \c aligned_allocator from an
+    /// allocator for another type of objects.
+    ///
+    /// \tparam U the other type.
+    ///
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept
+    {
+    }
+
+    ///
+    /// Allocates aligned memory for the given number of objects.
+    ///
+    /// \param n the number of the objects.
+    ///
+    /// \return A pointer to the memory.
+    ///
+    T* allocate(const std::size_t n)
+    {
+      return static_cast<T*>(
+          ::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    ///
+    /// Frees memory given by this allocator.
+    ///
+    /// \param p the pointer to the memory.
+    ///
+    void deallocate(T* p, const std::size_t) noexcept
+    {
+      ::operator delete(p, std::align_val_t{Alignment});
+    }
+  };
+
+  ///
+  /// Tells whether or not the given allocators can free the memory of each
+  /// other, which they always can.
+  ///
+  /// \return \c true.
+  ///
+  template <typename T, typename U, std::size_t Alignment>
+  constexpr bool operator==(
+      const aligned_allocator<T, Alignment>&,
+      const aligned_allocator<U, Alignment>&) noexcept
+  {
+    return true;
+  }
+
+  ///
+  /// Tells whether or not the given allocators can't free the memory of each
+  /// other, which they always can.
+  ///
+  /// \return \c false.
+  ///
+  template <typename T, typename U, std::size_t Alignment>
+  constexpr bool operator!=(
+      const aligned_allocator<T, Alignment>&,
+      const aligned_allocator<U, Alignment>&) noexcept
+  {
+    return false;
+  }
+
+  ///
+  /// The type of the vectors whose elements are aligned for the SIMD
+  /// kernels.
+  ///
+  /// \tparam T the type of the elements.
+  ///
+  template <typename T>
+  using aligned_vector = std::vector<T, aligned_allocator<T>>;
+
+} // namespace ode
+
+#endif // !ODE_ALIGNED_ALLOCATOR_H
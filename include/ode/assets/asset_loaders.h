@@ -0,0 +1,96 @@
+/// The declarations of the types of the common assets and the functions
+/// which request them from an asset manager.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_ASSETS_ASSET_LOADERS_H
+#define ODE_ASSETS_ASSET_LOADERS_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "ode/assets/asset_manager.h"
+#include "ode/systems/graphics/image.h"
+#include "ode/systems/graphics/texture_cache.h"
+
+namespace ode
+{
+  ///
+  /// The type of the texture assets.
+  ///
+  struct texture_asset final
+  {
+    ///
+    /// The name of the OpenGL texture.
+    ///
+    std::uint32_t texture = 0;
+
+    ///
+    /// The width of the texture in pixels.
+    ///
+    int width = 0;
+
+    ///
+    /// The height of the texture in pixels.
+    ///
+    int height = 0;
+
+    ///
+    /// The decoded image, which is emptied when it is uploaded.
+    ///
+    image pixels{};
+  };
+
+  ///
+  /// The type of the Lua script assets which are compiled into bytecode.
+  ///
+  struct script_asset final
+  {
+    ///
+    /// The name of the script file.
+    ///
+    std::string filename;
+
+    ///
+    /// The compiled script.
+    ///
+    std::string bytecode;
+  };
+
+  ///
+  /// Requests a texture which is decoded from an image file. The texture is
+  /// uploaded through the given texture cache, so the textures requested by
+  /// different asset managers are shared.
+  ///
+  /// \param assets the asset manager.
+  /// \param cache the texture cache, which must outlive the texture.
+  /// \param filename the name of the image file.
+  /// \param colour_key the colour that is made transparent, if any.
+  ///
+  /// \return The handle of the texture.
+  ///
+  asset_handle<texture_asset> request_texture(
+      asset_manager& assets,
+      texture_cache& cache,
+      const std::string& filename,
+      const std::optional<std::uint32_t> colour_key = std::nullopt);
+
+  ///
+  /// Requests a Lua script which is compiled into bytecode on a worker
+  /// thread. The compiled script can be run with \c lua::try_load_bytecode.
+  ///
+  /// \param assets the asset manager.
+  /// \param filename the name of the script file.
+  ///
+  /// \return The handle of the script.
+  ///
+  asset_handle<script_asset> request_script(
+      asset_manager& assets, const std::string& filename);
+
+} // namespace ode
+
+#endif // !ODE_ASSETS_ASSET_LOADERS_H
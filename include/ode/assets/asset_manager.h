@@ -0,0 +1,476 @@
+/// The declaration of the asset manager which decodes the assets on worker
+/// threads and uploads them on the main thread.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_ASSETS_ASSET_MANAGER_H
+#define ODE_ASSETS_ASSET_MANAGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gsl/assert"
+
+#include "ode/__config"
+#include "ode/assets/assets_config.h"
+#include "ode/framework/job_system.h"
+#include "ode/framework/message_queue.h"
+
+namespace ode
+{
+  ///
+  /// The states of the assets.
+  ///
+  enum class asset_state
+  {
+    ///
+    /// The asset is being decoded or waits to be uploaded.
+    ///
+    pending,
+
+    ///
+    /// The asset is decoded and uploaded and can be used.
+    ///
+    ready,
+
+    ///
+    /// The asset can't be loaded.
+    ///
+    failed
+  };
+
+  namespace detail
+  {
+    ///
+    /// The variable whose address identifies the type of the assets in an
+    /// asset manager.
+    ///
+    /// \tparam T the type of the asset.
+    ///
+    template <typename T> inline constexpr char asset_type_tag = 0;
+  } // namespace detail
+
+  ///
+  /// The type of the handles which refer to the assets in an asset manager.
+  ///
+  /// \tparam T the type of the asset.
+  ///
+  template <typename T> struct asset_handle final
+  {
+    ///
+    /// The index of the asset in the asset manager.
+    ///
+    std::size_t id = 0;
+
+    ///
+    /// The generation of the slot of the asset, which tells the handles of
+    /// the released assets apart from the handles of the new ones.
+    ///
+    std::uint32_t generation = 0;
+  };
+
+  ///
+  /// The type of the asset managers which load assets without blocking the
+  /// frames. An asset is decoded on the threads of a job system, for example
+  /// from a file, and the decoded asset is uploaded, for example to the GPU,
+  /// on the thread which calls \c update. Only as many uploads are done on
+  /// each frame as fit in the upload budget.
+  ///
+  /// The assets are identified by keys, and requesting an asset with a key
+  /// that is already requested gives a new reference to the same asset. The
+  /// asset manager itself must only be used on a single thread, which is
+  /// usually the thread of the OpenGL context.
+  ///
+  class asset_manager final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c asset_manager.
+    ///
+    /// \param jobs the job system on which the assets are decoded.
+    /// \param upload_budget the number of the bytes uploaded on each frame.
+    ///
+    explicit asset_manager(
+        job_system& jobs,
+        const std::size_t upload_budget = asset_upload_budget);
+
+    ///
+    /// Constructs an object of the type \c asset_manager by copying the given
+    /// object of the type \c asset_manager.
+    ///
+    /// \param a an \c asset_manager from which the new one is constructed.
+    ///
+    asset_manager(const asset_manager& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c asset_manager by moving the given
+    /// object of the type \c asset_manager.
+    ///
+    /// \param a an \c asset_manager from which the new one is constructed.
+    ///
+    asset_manager(asset_manager&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c asset_manager and unloads the
+    /// assets that are still loaded. The decoding jobs that are still running
+    /// are left to finish, and their results are dropped.
+    ///
+    ~asset_manager();
+
+    ///
+    /// Assigns the given object of the type \c asset_manager to this one by
+    /// copying.
+    ///
+    /// \param a an \c asset_manager from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    asset_manager& operator=(const asset_manager& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c asset_manager to this one by
+    /// moving.
+    ///
+    /// \param a an \c asset_manager from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    asset_manager& operator=(asset_manager&& a) = delete;
+
+    ///
+    /// Requests an asset. If the asset with the given key is already
+    /// requested, a new reference to it is given and the functions aren't
+    /// used. The asset must then have been requested with the same type.
+    ///
+    /// \tparam T the type of the asset.
+    /// \tparam Decode the type of the decoding function.
+    /// \tparam Upload the type of the uploading function.
+    /// \tparam Unload the type of the unloading function.
+    ///
+    /// \param key the key of the asset.
+    /// \param decode the function which returns the asset as an
+    /// \c std::optional<T>. It is called on a worker thread, so it must not
+    /// touch the OpenGL context or any Lua state of the main thread.
+    /// \param upload the function which is called with a reference to the
+    /// decoded asset on the thread that calls \c update. It returns the
+    /// number of the bytes it uploaded.
+    /// \param unload the function which is called with a reference to the
+    /// uploaded asset when it is released.
+    ///
+    /// \return The handle of the asset.
+    ///
+    template <typename T, typename Decode, typename Upload, typename Unload>
+    asset_handle<T> request(
+        const std::string& key, Decode decode, Upload upload, Unload unload)
+    {
+      if (const auto it = ids.find(key); ids.end() != it)
+      {
+        auto& e = entries[it->second];
+        Expects(&detail::asset_type_tag<T> == e.type);
+        ++e.references;
+        return {it->second, e.generation};
+      }
+
+      const auto id = add_entry(
+          key,
+          &detail::asset_type_tag<T>,
+          [upload](void* p) mutable -> std::size_t {
+            return upload(*static_cast<T*>(p));
+          },
+          [unload](void* p) mutable { unload(*static_cast<T*>(p)); });
+
+      submit(id, [decode]() mutable -> std::shared_ptr<void> {
+        std::optional<T> t = decode();
+
+        if (!t)
+        {
+          return nullptr;
+        }
+
+        return std::make_shared<T>(std::move(*t));
+      });
+
+      return {id, entries[id].generation};
+    }
+
+    ///
+    /// Requests an asset that needs no unloading. If the asset with the
+    /// given key is already requested, a new reference to it is given and
+    /// the functions aren't used.
+    ///
+    /// \tparam T the type of the asset.
+    /// \tparam Decode the type of the decoding function.
+    /// \tparam Upload the type of the uploading function.
+    ///
+    /// \param key the key of the asset.
+    /// \param decode the function which returns the asset as an
+    /// \c std::optional<T> on a worker thread.
+    /// \param upload the function which uploads the decoded asset and returns
+    /// the number of the bytes it uploaded.
+    ///
+    /// \return The handle of the asset.
+    ///
+    template <typename T, typename Decode, typename Upload>
+    asset_handle<T>
+    request(const std::string& key, Decode decode, Upload upload)
+    {
+      return request<T>(key, std::move(decode), std::move(upload), [](T&) {});
+    }
+
+    ///
+    /// Removes a reference to an asset and unloads the asset if it was the
+    /// last one.
+    ///
+    /// \tparam T the type of the asset.
+    ///
+    /// \param handle the handle of the asset.
+    ///
+    template <typename T> void release(const asset_handle<T>& handle)
+    {
+      release(handle.id, handle.generation);
+    }
+
+    ///
+    /// Gives the state of an asset.
+    ///
+    /// \tparam T the type of the asset.
+    ///
+    /// \param handle the handle of the asset, which must not be released.
+    ///
+    /// \return The state of the asset.
+    ///
+    template <typename T>
+    asset_state get_state(const asset_handle<T>& handle) const
+        ODE_CONTRACT_NOEXCEPT
+    {
+      return get_entry(handle.id, handle.generation).state;
+    }
+
+    ///
+    /// Gives an asset if it is ready.
+    ///
+    /// \tparam T the type of the asset.
+    ///
+    /// \param handle the handle of the asset, which must not be released.
+    ///
+    /// \return A pointer to the asset or \c nullptr if the asset isn't ready.
+    ///
+    template <typename T>
+    const T* get(const asset_handle<T>& handle) const ODE_CONTRACT_NOEXCEPT
+    {
+      const auto& e = get_entry(handle.id, handle.generation);
+
+      Expects(&detail::asset_type_tag<T> == e.type);
+
+      if (asset_state::ready != e.state)
+      {
+        return nullptr;
+      }
+
+      return static_cast<const T*>(e.value.get());
+    }
+
+    ///
+    /// Takes the assets which are decoded and uploads them until the upload
+    /// budget is spent. This must be called once on each frame on the thread
+    /// that owns the asset manager.
+    ///
+    /// \return The number of the assets which became ready or failed.
+    ///
+    std::size_t update();
+
+    ///
+    /// Blocks until all of the requested assets are ready or failed. This
+    /// waits for all of the jobs of the job system and ignores the upload
+    /// budget, so it should only be used on loading screens and in tests.
+    ///
+    void finish();
+
+    ///
+    /// Gives the number of the assets which are not yet ready or failed.
+    ///
+    /// \return The number of the assets.
+    ///
+    std::size_t get_pending_count() const noexcept;
+
+  private:
+    ///
+    /// The type of the slots of the assets.
+    ///
+    struct entry final
+    {
+      ///
+      /// The key of the asset.
+      ///
+      std::string key;
+
+      ///
+      /// The tag of the type of the asset.
+      ///
+      const void* type;
+
+      ///
+      /// The state of the asset.
+      ///
+      asset_state state;
+
+      ///
+      /// The number of the references to the asset. A slot with no
+      /// references is free.
+      ///
+      std::size_t references;
+
+      ///
+      /// The generation of the slot.
+      ///
+      std::uint32_t generation;
+
+      ///
+      /// The decoded asset.
+      ///
+      std::shared_ptr<void> value;
+
+      ///
+      /// The function which uploads the asset.
+      ///
+      std::function<std::size_t(void*)> upload;
+
+      ///
+      /// The function which unloads the asset.
+      ///
+      std::function<void(void*)> unload;
+    };
+
+    ///
+    /// The type of the decoded assets which are passed from the worker
+    /// threads.
+    ///
+    struct decoded_asset final
+    {
+      ///
+      /// The index of the asset.
+      ///
+      std::size_t id;
+
+      ///
+      /// The generation of the slot of the asset when it was requested.
+      ///
+      std::uint32_t generation;
+
+      ///
+      /// The decoded asset or \c nullptr if the decoding failed.
+      ///
+      std::shared_ptr<void> value;
+    };
+
+    ///
+    /// Adds a pending asset to a free slot.
+    ///
+    /// \param key the key of the asset.
+    /// \param type the tag of the type of the asset.
+    /// \param upload the function which uploads the asset.
+    /// \param unload the function which unloads the asset.
+    ///
+    /// \return The index of the slot.
+    ///
+    std::size_t add_entry(
+        const std::string& key,
+        const void* type,
+        std::function<std::size_t(void*)> upload,
+        std::function<void(void*)> unload);
+
+    ///
+    /// Submits the decoding of an asset to the job system.
+    ///
+    /// \param id the index of the asset.
+    /// \param decode the function which decodes the asset.
+    ///
+    void submit(
+        const std::size_t id, std::function<std::shared_ptr<void>()> decode);
+
+    ///
+    /// Removes a reference to an asset.
+    ///
+    /// \param id the index of the asset.
+    /// \param generation the generation of the handle.
+    ///
+    void release(const std::size_t id, const std::uint32_t generation);
+
+    ///
+    /// Gives the slot of an asset.
+    ///
+    /// \param id the index of the asset.
+    /// \param generation the generation of the handle.
+    ///
+    /// \return A reference to the slot.
+    ///
+    const entry& get_entry(
+        const std::size_t id,
+        const std::uint32_t generation) const ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Takes the decoded assets and uploads them.
+    ///
+    /// \param budget the number of the bytes that may be uploaded.
+    ///
+    /// \return The number of the assets which became ready or failed.
+    ///
+    std::size_t process(const std::size_t budget);
+
+    ///
+    /// The job system on which the assets are decoded.
+    ///
+    job_system& jobs;
+
+    ///
+    /// The number of the bytes uploaded on each frame.
+    ///
+    std::size_t upload_budget;
+
+    ///
+    /// The slots of the assets.
+    ///
+    std::vector<entry> entries;
+
+    ///
+    /// The indices of the free slots.
+    ///
+    std::vector<std::size_t> free_ids;
+
+    ///
+    /// The indices of the assets by their keys. A failed asset is removed so
+    /// that it can be requested again.
+    ///
+    std::unordered_map<std::string, std::size_t> ids;
+
+    ///
+    /// The assets decoded by the worker threads. The queue is shared with
+    /// the decoding jobs so that the jobs may outlive the asset manager.
+    ///
+    std::shared_ptr<message_queue<decoded_asset>> decoded;
+
+    ///
+    /// The assets which are decoded and wait to be uploaded.
+    ///
+    std::deque<std::pair<std::size_t, std::uint32_t>> uploads;
+
+    ///
+    /// The number of the assets which are not yet ready or failed.
+    ///
+    std::size_t pending;
+  };
+
+} // namespace ode
+
+#endif // !ODE_ASSETS_ASSET_MANAGER_H
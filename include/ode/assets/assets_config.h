@@ -0,0 +1,28 @@
+/// The declarations and the definitions of the asset constants.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_ASSETS_ASSETS_CONFIG_H
+#define ODE_ASSETS_ASSETS_CONFIG_H
+
+#include <cstddef>
+
+namespace ode
+{
+  ///
+  /// The number of the bytes that the asset manager uploads to the GPU on a
+  /// single frame. An asset that is larger than this is still uploaded, but
+  /// no other uploads are done on the same frame.
+  ///
+#ifdef ODE_ASSET_UPLOAD_BUDGET
+  constexpr std::size_t asset_upload_budget = ODE_ASSET_UPLOAD_BUDGET;
+#else
+  constexpr std::size_t asset_upload_budget = 4 * 1024 * 1024;
+#endif // !defined(ODE_ASSET_UPLOAD_BUDGET)
+
+} // namespace ode
+
+#endif // !ODE_ASSETS_ASSETS_CONFIG_H
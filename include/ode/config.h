@@ -72,6 +72,17 @@ namespace ode
   constexpr bool test_use_null_sink = false;
 #endif // !ODE_TEST_USE_NULL_SINK
 
+  ///
+  /// Whether or not the test window is hidden so that the tests render only
+  /// into offscreen targets. Combined with \c SDL_VIDEODRIVER=offscreen and a
+  /// software renderer, such as llvmpipe, the tests don't need a display.
+  ///
+#if ODE_TEST_OFFSCREEN
+  constexpr bool test_offscreen = true;
+#else
+  constexpr bool test_offscreen = false;
+#endif // !ODE_TEST_OFFSCREEN
+
   ///
   /// The number of systems for which space is reserved in the system container
   /// initialization.
@@ -10,20 +10,49 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <utility>
 
 #include <SDL2/SDL.h>
 
 #include "ode/application.h"
+#include "ode/assets/asset_manager.h"
 #include "ode/config.h"
+#include "ode/framework/frame_metrics.h"
+#include "ode/framework/framework_scene.h"
+#include "ode/framework/job_system.h"
 #include "ode/framework/platform_manager.h"
 #include "ode/framework/state_manager.h"
+#include "ode/gl/gpu_timer.h"
 #include "ode/initialize.h"
+#include "ode/lua/garbage_collector.h"
+#include "ode/lua/reload_service.h"
+#include "ode/lua/scripted_scene.h"
 #include "ode/sdl/initialize_sdl.h"
+#include "ode/systems/graphics/texture_cache.h"
+#include "ode/systems/input/input_handler.h"
 #include "ode/type_name.h"
 
 namespace ode
 {
+  namespace detail
+  {
+    ///
+    /// Gives the Lua side of the configuration of the given scene.
+    ///
+    /// \param scene the scene.
+    ///
+    /// \return A pointer to the configuration as a \c lua::scripted_scene or
+    /// \c nullptr if the scene doesn't keep its data in a Lua state.
+    ///
+    inline const lua::scripted_scene* to_scripted_scene(
+        const framework_scene& scene) noexcept
+    {
+      return dynamic_cast<const lua::scripted_scene*>(
+          scene.get_configuration().get());
+    }
+  } // namespace detail
+
   ///
   /// The type of the object which contains the required frameworks of the
   /// application.
@@ -78,7 +107,7 @@ namespace ode
       ODE_TRACE("Initializing the input system");
 
       auto is = app.make_system(system_type::input);
-      system_t& is_ref = add_system(std::move(is));
+      add_system(std::move(is));
 
       ODE_TRACE("Initializing the other systems");
 
@@ -89,9 +118,30 @@ namespace ode
         std::move(os.begin(), os.end(), std::back_inserter(systems));
       }
 
-      pfm = {&is};
+      ih = std::make_unique<input_handler>();
+      pfm = {ih.get()};
+
+      if (!i.replay_file.empty())
+      {
+        pfm.replay(std::make_unique<input_player>(i.replay_file));
+
+        // The session is replayed as fast as possible.
+        SDL_GL_SetSwapInterval(0);
+      }
+      else if (!i.record_file.empty())
+      {
+        pfm.record(std::make_unique<input_recorder>(i.record_file));
+      }
+
       envm = {};
       sm = {};
+      gc = {};
+      rs = std::make_unique<lua::reload_service>();
+      js = std::make_unique<job_system>();
+      tc = std::make_unique<texture_cache>();
+      am = std::make_unique<asset_manager>(*js);
+      gt = std::make_unique<gl::gpu_timer>();
+      fm = {};
 
       ODE_DEBUG("The engine of the application is initialized");
     }
@@ -117,6 +167,13 @@ namespace ode
     ///
     ~engine_framework()
     {
+      // The GPU timer deletes its queries and the asset manager and the
+      // texture cache delete their textures, so they must be destroyed while
+      // the OpenGL context exists.
+      gt.reset();
+      am.reset();
+      tc.reset();
+
       SDL_GL_DeleteContext(gl_context);
 
       w.reset(nullptr);
@@ -159,6 +216,60 @@ namespace ode
       return systems.back();
     }
 
+    ///
+    /// Continues to load the given scene. This should be called once on each
+    /// frame until it returns \c true, after which the scene can be entered.
+    ///
+    /// \param scene the scene which is loaded.
+    ///
+    /// \return \c true if the scene is loaded, otherwise \c false.
+    ///
+    bool load_scene(framework_scene& scene)
+    {
+      auto* cfg = scene.get_configuration().get();
+      return nullptr == cfg || cfg->load(*am, *tc);
+    }
+
+    ///
+    /// Hands the Lua state of the given scene, if it has one, to the garbage
+    /// collector so that the collection of the state is paced, and starts
+    /// reloading the script of the scene and the modules it requires into the
+    /// state when they change.
+    ///
+    /// \param scene the scene which is entered.
+    ///
+    void enter_scene(const framework_scene& scene)
+    {
+      if (const auto* s = detail::to_scripted_scene(scene))
+      {
+        gc.attach(s->get_lua_state());
+        rs->track(s->get_lua_state(), s->get_script_file());
+        rs->watch(s->get_script_root());
+      }
+    }
+
+    ///
+    /// Takes the Lua state of the given scene, if it has one, back from the
+    /// garbage collector and the script-reloading service, and releases the
+    /// assets of the scene. This must be called before the scene is
+    /// destroyed, even if the scene wasn't fully loaded.
+    ///
+    /// \param scene the scene which is left.
+    ///
+    void leave_scene(framework_scene& scene)
+    {
+      if (const auto* s = detail::to_scripted_scene(scene))
+      {
+        rs->untrack(s->get_lua_state());
+        gc.detach(s->get_lua_state());
+      }
+
+      if (auto* cfg = scene.get_configuration().get())
+      {
+        cfg->unload(*am, *tc);
+      }
+    }
+
     ///
     /// Gives a reference to the application.
     ///
@@ -219,6 +330,96 @@ namespace ode
       return sm;
     }
 
+    ///
+    /// Gives a reference to the garbage collector which paces the collection
+    /// of the Lua states of the application.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the garbage collector.
+    ///
+    inline lua::garbage_collector& collector()
+    {
+      return gc;
+    }
+
+    ///
+    /// Gives a reference to the service which reloads the changed Lua scripts
+    /// of the application.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the script-reloading service.
+    ///
+    inline lua::reload_service& scripts()
+    {
+      return *rs;
+    }
+
+    ///
+    /// Gives a reference to the asset manager which loads the assets of the
+    /// scenes without blocking the frames.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the asset manager.
+    ///
+    inline asset_manager& assets()
+    {
+      return *am;
+    }
+
+    ///
+    /// Gives a reference to the texture cache which shares the textures of
+    /// the scenes.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the texture cache.
+    ///
+    inline texture_cache& textures()
+    {
+      return *tc;
+    }
+
+    ///
+    /// Gives a reference to the timer which measures the GPU time of the
+    /// rendering passes.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the GPU timer.
+    ///
+    inline gl::gpu_timer& timer()
+    {
+      return *gt;
+    }
+
+    ///
+    /// Gives a reference to the input handler which publishes the input
+    /// snapshots of the update ticks.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the input handler.
+    ///
+    inline input_handler& input()
+    {
+      return *ih;
+    }
+
+    ///
+    /// Gives a reference to the metrics of the latest frame.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the frame metrics.
+    ///
+    inline frame_metrics& metrics()
+    {
+      return fm;
+    }
+
   private:
     ///
     /// The application implementation object.
@@ -240,6 +441,12 @@ namespace ode
     ///
     std::vector<system_t> systems;
 
+    ///
+    /// The input handler, which is held through a pointer so that the
+    /// platform manager can point to it.
+    ///
+    std::unique_ptr<input_handler> ih;
+
     ///
     /// The platform manager.
     ///
@@ -254,6 +461,41 @@ namespace ode
     /// The state manager which distributes the state changes.
     ///
     state_manager sm;
+
+    ///
+    /// The garbage collector of the Lua states.
+    ///
+    lua::garbage_collector gc;
+
+    ///
+    /// The service which reloads the changed Lua scripts.
+    ///
+    std::unique_ptr<lua::reload_service> rs;
+
+    ///
+    /// The job system on which the assets are decoded.
+    ///
+    std::unique_ptr<job_system> js;
+
+    ///
+    /// The texture cache which shares the textures of the scenes.
+    ///
+    std::unique_ptr<texture_cache> tc;
+
+    ///
+    /// The asset manager which loads the assets of the scenes.
+    ///
+    std::unique_ptr<asset_manager> am;
+
+    ///
+    /// The timer which measures the GPU time of the rendering passes.
+    ///
+    std::unique_ptr<gl::gpu_timer> gt;
+
+    ///
+    /// The metrics of the latest frame.
+    ///
+    frame_metrics fm;
   };
 
   ///
@@ -37,6 +37,19 @@ namespace ode
     /// The name of the window.
     ///
     const std::string window_name = "null"s;
+
+    ///
+    /// The name of the file to which the input of the session is recorded,
+    /// or an empty string if the input isn't recorded.
+    ///
+    const std::string record_file = ""s;
+
+    ///
+    /// The name of the file from which a recorded session is replayed, or an
+    /// empty string if the live input is used. The session is replayed in a
+    /// hidden window as fast as possible.
+    ///
+    const std::string replay_file = ""s;
   };
 } // namespace ode
 
@@ -0,0 +1,214 @@
+/// The declaration of the watcher which detects changes in files.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FILESYSTEM_FILE_WATCHER_H
+#define ODE_FILESYSTEM_FILE_WATCHER_H
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ode::filesystem
+{
+  ///
+  /// The type of the object which detects modifications of the watched
+  /// files. On Linux the detection uses \c inotify on the directories of the
+  /// watched files, and on the other systems, or if \c inotify can't be
+  /// initialized, the modification times of the files are polled.
+  ///
+  /// The object must only be used on a single thread.
+  ///
+  class file_watcher final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c file_watcher.
+    ///
+    file_watcher();
+
+    ///
+    /// Constructs an object of the type \c file_watcher by copying the given
+    /// object of the type \c file_watcher.
+    ///
+    /// \param a a \c file_watcher from which the new one is constructed.
+    ///
+    file_watcher(const file_watcher& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c file_watcher by moving the given
+    /// object of the type \c file_watcher.
+    ///
+    /// \param a a \c file_watcher from which the new one is constructed.
+    ///
+    file_watcher(file_watcher&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c file_watcher.
+    ///
+    ~file_watcher();
+
+    ///
+    /// Assigns the given object of the type \c file_watcher to this one by
+    /// copying.
+    ///
+    /// \param a a \c file_watcher from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    file_watcher& operator=(const file_watcher& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c file_watcher to this one by
+    /// moving.
+    ///
+    /// \param a a \c file_watcher from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    file_watcher& operator=(file_watcher&& a) = delete;
+
+    ///
+    /// Starts watching the given file.
+    ///
+    /// \param filename the name of the file.
+    ///
+    /// \return \c true if the file is watched, otherwise \c false.
+    ///
+    bool add(std::string_view filename);
+
+    ///
+    /// Starts watching the files in the given directory and in its
+    /// subdirectories, including the files and the subdirectories created
+    /// after this call.
+    ///
+    /// \param directory the name of the directory.
+    ///
+    /// \return \c true if the directory is watched, otherwise \c false.
+    ///
+    bool add_directory(std::string_view directory);
+
+    ///
+    /// Waits for modifications of the watched files.
+    ///
+    /// \param timeout the maximum time to wait.
+    ///
+    /// \return The names of the modified files as they were given to \c add,
+    /// or the normalized paths of the files found through \c add_directory.
+    /// Each file is listed only once.
+    ///
+    std::vector<std::string> poll(std::chrono::milliseconds timeout);
+
+    ///
+    /// Tells whether or not the watcher uses the notifications of the
+    /// operating system instead of polling.
+    ///
+    /// \return A \c bool.
+    ///
+    inline bool is_notified() const noexcept
+    {
+      return notify_fd >= 0;
+    }
+
+  private:
+    ///
+    /// Starts receiving the notifications of the operating system for the
+    /// given directory unless they are already received.
+    ///
+    /// \param directory the normalized path of the directory.
+    ///
+    /// \return \c true if the directory is watched, otherwise \c false.
+    ///
+    bool watch(const std::filesystem::path& directory);
+
+    ///
+    /// Tells whether or not the given directory is in one of the directories
+    /// given to \c add_directory.
+    ///
+    /// \param directory the normalized path of the directory.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_in_roots(const std::filesystem::path& directory) const;
+
+    ///
+    /// Records the modification time of the given file and tells whether
+    /// the file has changed since it was last recorded.
+    ///
+    /// \param normalized the normalized path of the file.
+    /// \param time the current modification time of the file.
+    ///
+    /// \return \c true if the file is new or modified, otherwise \c false.
+    ///
+    bool record(
+        const std::string& normalized,
+        std::filesystem::file_time_type time);
+
+    ///
+    /// Gives the name by which the given file is reported.
+    ///
+    /// \param normalized the normalized path of the file.
+    ///
+    /// \return The name given to \c add or the normalized path.
+    ///
+    std::string name_of(const std::string& normalized) const;
+
+    ///
+    /// Reads the pending notifications of the operating system.
+    ///
+    /// \param timeout the maximum time to wait.
+    ///
+    /// \return The names of the modified files.
+    ///
+    std::vector<std::string> read_notifications(
+        std::chrono::milliseconds timeout);
+
+    ///
+    /// Compares the modification times of the watched files to the recorded
+    /// ones.
+    ///
+    /// \param timeout the time to wait before the comparison.
+    ///
+    /// \return The names of the modified files.
+    ///
+    std::vector<std::string> read_modification_times(
+        std::chrono::milliseconds timeout);
+
+    ///
+    /// The file descriptor of the notification instance or -1 if the
+    /// modification times are polled.
+    ///
+    int notify_fd;
+
+    ///
+    /// The watched directories by their watch descriptors.
+    ///
+    std::unordered_map<int, std::filesystem::path> directories;
+
+    ///
+    /// The normalized paths of the directories given to \c add_directory.
+    ///
+    std::vector<std::filesystem::path> roots;
+
+    ///
+    /// The watched files by their normalized paths mapped to the names given
+    /// to \c add.
+    ///
+    std::unordered_map<std::string, std::string> files;
+
+    ///
+    /// The latest known modification times of the watched files, including
+    /// the files in the directories given to \c add_directory.
+    ///
+    std::unordered_map<std::string, std::filesystem::file_time_type> times;
+  };
+
+} // namespace ode::filesystem
+
+#endif // !ODE_FILESYSTEM_FILE_WATCHER_H
@@ -0,0 +1,540 @@
+/// The declarations of the types of the objects which write and read the
+/// flat binary layout of the saves and the snapshots.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_BINARY_STREAM_H
+#define ODE_FRAMEWORK_BINARY_STREAM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ode
+{
+  ///
+  /// Whether or not the processor stores the integers in little-endian
+  /// order, in which case the values are copied as they are.
+  ///
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  constexpr bool little_endian_host = false;
+#else
+  constexpr bool little_endian_host = true;
+#endif
+
+  namespace detail
+  {
+    ///
+    /// Whether or not the values of the given type are written as their
+    /// bytes.
+    ///
+    template <typename T>
+    constexpr bool is_binary_scalar =
+        std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+    ///
+    /// Copies the given values between the memory of the processor and the
+    /// little-endian layout, reversing the bytes of each value if the
+    /// processor is big-endian.
+    ///
+    /// \param out a pointer to the memory into which the values are copied.
+    /// \param in a pointer to the values.
+    /// \param count the number of the values.
+    ///
+    template <typename T>
+    void copy_little_endian(
+        void* out, const void* in, const std::size_t count) noexcept
+    {
+      if constexpr (little_endian_host || 1 == sizeof(T))
+      {
+        std::memcpy(out, in, sizeof(T) * count);
+      }
+      else
+      {
+        auto* o = static_cast<std::uint8_t*>(out);
+        const auto* i = static_cast<const std::uint8_t*>(in);
+
+        for (std::size_t n = 0; n < count; ++n)
+        {
+          for (std::size_t b = 0; b < sizeof(T); ++b)
+          {
+            o[n * sizeof(T) + b] = i[n * sizeof(T) + sizeof(T) - 1 - b];
+          }
+        }
+      }
+    }
+  } // namespace detail
+
+  ///
+  /// The type of the objects which append values to a buffer in a flat
+  /// little-endian layout. The buffer is given by the caller so that it can
+  /// be reused, and nothing is allocated for the individual fields once the
+  /// buffer has grown to the size of the data. The writer grows the buffer
+  /// ahead of the data and keeps the size of the data itself, so the buffer
+  /// holds exactly the written data only after the writer is destroyed. The
+  /// arrays of the scalars are copied at once, and the other types are
+  /// written with their \c serialize member functions.
+  ///
+  class binary_writer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c binary_writer.
+    ///
+    /// \param buffer the buffer to which the values are appended.
+    ///
+    explicit binary_writer(std::vector<std::uint8_t>& buffer)
+        : out{buffer}, size{buffer.size()}
+    {
+    }
+
+    ///
+    /// Constructs an object of the type \c binary_writer by copying the
+    /// given object of the type \c binary_writer.
+    ///
+    /// \param a a \c binary_writer from which the new one is constructed.
+    ///
+    binary_writer(const binary_writer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c binary_writer by moving the given
+    /// object of the type \c binary_writer.
+    ///
+    /// \param a a \c binary_writer from which the new one is constructed.
+    ///
+    binary_writer(binary_writer&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c binary_writer and trims the
+    /// buffer to the written data.
+    ///
+    ~binary_writer()
+    {
+      out.resize(size);
+    }
+
+    ///
+    /// Assigns the given object of the type \c binary_writer to this one by
+    /// copying.
+    ///
+    /// \param a a \c binary_writer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    binary_writer& operator=(const binary_writer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c binary_writer to this one by
+    /// moving.
+    ///
+    /// \param a a \c binary_writer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    binary_writer& operator=(binary_writer&& a) = delete;
+
+    ///
+    /// Appends the given value.
+    ///
+    /// \param value the value.
+    ///
+    template <typename T>
+    void write(const T& value)
+    {
+      write_array(&value, 1);
+    }
+
+    ///
+    /// Appends the given values. The scalars are copied at once, and the
+    /// other values are written by calling \c value.serialize(*this).
+    ///
+    /// \param values a pointer to the values.
+    /// \param count the number of the values.
+    ///
+    template <typename T>
+    void write_array(const T* values, const std::size_t count)
+    {
+      if constexpr (std::is_same_v<T, bool>)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          *append(1) = values[i] ? 1 : 0;
+        }
+      }
+      else if constexpr (detail::is_binary_scalar<T>)
+      {
+        detail::copy_little_endian<T>(
+            append(sizeof(T) * count), values, count);
+      }
+      else
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          values[i].serialize(*this);
+        }
+      }
+    }
+
+    ///
+    /// Appends the given values after their number.
+    ///
+    /// \param values the values.
+    ///
+    template <typename T>
+    void write_vector(const std::vector<T>& values)
+    {
+      write(static_cast<std::uint32_t>(values.size()));
+      write_array(values.data(), values.size());
+    }
+
+    ///
+    /// Appends the given string after its length.
+    ///
+    /// \param s the string.
+    ///
+    void write_string(const std::string_view s)
+    {
+      write(static_cast<std::uint32_t>(s.size()));
+
+      if (!s.empty())
+      {
+        std::memcpy(append(s.size()), s.data(), s.size());
+      }
+    }
+
+    ///
+    /// Starts a section which holds the data of one part of the state. The
+    /// sections are prefixed with their sizes so that the readers can skip
+    /// the sections they don't know.
+    ///
+    /// \param tag the tag which tells what the section holds.
+    /// \param version the version of the layout of the section.
+    ///
+    /// \return The marker that is given to \c end_section.
+    ///
+    std::size_t begin_section(
+        const std::uint32_t tag, const std::uint16_t version)
+    {
+      write(tag);
+      write(version);
+
+      const auto marker = size;
+      write(std::uint32_t{0});
+
+      return marker;
+    }
+
+    ///
+    /// Ends the given section by writing its size.
+    ///
+    /// \param marker the marker given by \c begin_section.
+    ///
+    void end_section(const std::size_t marker) noexcept
+    {
+      const auto length =
+          static_cast<std::uint32_t>(size - marker - sizeof(std::uint32_t));
+      detail::copy_little_endian<std::uint32_t>(
+          out.data() + marker, &length, 1);
+    }
+
+    ///
+    /// Gives the number of the bytes in the buffer.
+    ///
+    /// \return The number of the bytes.
+    ///
+    std::size_t get_size() const noexcept
+    {
+      return size;
+    }
+
+  private:
+    ///
+    /// Reserves room for the given number of the bytes at the end of the
+    /// data. The buffer is grown geometrically, so the check is the only
+    /// work for most of the fields.
+    ///
+    /// \param count the number of the bytes.
+    ///
+    /// \return A pointer to the room.
+    ///
+    std::uint8_t* append(const std::size_t count)
+    {
+      if (out.size() - size < count)
+      {
+        out.resize(
+            std::max({out.size() * 2, size + count, std::size_t{256}}));
+      }
+
+      std::uint8_t* const p = out.data() + size;
+      size += count;
+
+      return p;
+    }
+
+    ///
+    /// The buffer to which the values are appended.
+    ///
+    std::vector<std::uint8_t>& out;
+
+    ///
+    /// The number of the bytes of the data in the buffer.
+    ///
+    std::size_t size;
+  };
+
+  struct binary_section;
+
+  ///
+  /// The type of the objects which read values from the flat little-endian
+  /// layout written by \c binary_writer. The reader doesn't throw. Reading
+  /// past the end of the data fails the reader, after which it gives only
+  /// zero values, so the caller can check \c is_ok once after reading a
+  /// whole structure.
+  ///
+  class binary_reader final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c binary_reader.
+    ///
+    /// \param bytes a pointer to the data, which must outlive the reader.
+    /// \param count the number of the bytes in the data.
+    ///
+    binary_reader(const std::uint8_t* bytes, const std::size_t count) noexcept
+        : data{bytes}, size{count}, offset{0}, failed{false}
+    {
+    }
+
+    ///
+    /// Reads a value.
+    ///
+    /// \return The value, or a zero value if the reader has failed.
+    ///
+    template <typename T>
+    T read()
+    {
+      T value{};
+      read_array(&value, 1);
+      return value;
+    }
+
+    ///
+    /// Reads the given number of the values. The scalars are copied at once,
+    /// and the other values are read by calling
+    /// \c value.deserialize(*this).
+    ///
+    /// \param values a pointer to the memory into which the values are read.
+    /// \param count the number of the values.
+    ///
+    /// \return Whether or not the values were read.
+    ///
+    template <typename T>
+    bool read_array(T* values, const std::size_t count)
+    {
+      if constexpr (std::is_same_v<T, bool>)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          values[i] = 0 != read<std::uint8_t>();
+        }
+      }
+      else if constexpr (detail::is_binary_scalar<T>)
+      {
+        if (failed || count > (size - offset) / sizeof(T))
+        {
+          failed = true;
+          return false;
+        }
+
+        detail::copy_little_endian<T>(values, data + offset, count);
+        offset += sizeof(T) * count;
+      }
+      else
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          values[i].deserialize(*this);
+        }
+      }
+
+      return !failed;
+    }
+
+    ///
+    /// Reads values written by \c binary_writer::write_vector into the given
+    /// vector, reusing its memory.
+    ///
+    /// \param values the vector.
+    ///
+    /// \return Whether or not the values were read.
+    ///
+    template <typename T>
+    bool read_vector(std::vector<T>& values)
+    {
+      const auto count = read<std::uint32_t>();
+
+      // Every value takes at least a byte, so a corrupted count fails here
+      // instead of allocating.
+      if (failed || count > size - offset)
+      {
+        failed = true;
+        return false;
+      }
+
+      values.resize(count);
+      return read_array(values.data(), values.size());
+    }
+
+    ///
+    /// Reads a string without copying it.
+    ///
+    /// \return A view to the string in the data, or an empty view if the
+    /// reader has failed.
+    ///
+    std::string_view read_string() noexcept
+    {
+      const auto length = read<std::uint32_t>();
+
+      if (failed || length > size - offset)
+      {
+        failed = true;
+        return {};
+      }
+
+      const std::string_view s{
+          reinterpret_cast<const char*>(data + offset), length};
+      offset += length;
+
+      return s;
+    }
+
+    ///
+    /// Reads the next section.
+    ///
+    /// \return The section, or \c std::nullopt if there are no more
+    /// sections or the data is invalid.
+    ///
+    inline std::optional<binary_section> read_section() noexcept;
+
+    ///
+    /// Tells whether or not all of the reads have succeeded.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_ok() const noexcept
+    {
+      return !failed;
+    }
+
+    ///
+    /// Tells whether or not all of the data has been read.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_at_end() const noexcept
+    {
+      return size == offset;
+    }
+
+    ///
+    /// Gives the number of the bytes that are left.
+    ///
+    /// \return The number of the bytes.
+    ///
+    std::size_t get_remaining() const noexcept
+    {
+      return size - offset;
+    }
+
+  private:
+    ///
+    /// A pointer to the data.
+    ///
+    const std::uint8_t* data;
+
+    ///
+    /// The number of the bytes in the data.
+    ///
+    std::size_t size;
+
+    ///
+    /// The number of the bytes that have been read.
+    ///
+    std::size_t offset;
+
+    ///
+    /// Whether or not a read has gone past the end of the data.
+    ///
+    bool failed;
+  };
+
+  ///
+  /// The type of the sections read by \c binary_reader.
+  ///
+  struct binary_section final
+  {
+    ///
+    /// The tag which tells what the section holds.
+    ///
+    std::uint32_t tag;
+
+    ///
+    /// The version of the layout of the section.
+    ///
+    std::uint16_t version;
+
+    ///
+    /// The reader of the data of the section.
+    ///
+    binary_reader body;
+  };
+
+  std::optional<binary_section> binary_reader::read_section() noexcept
+  {
+    if (failed || is_at_end())
+    {
+      return std::nullopt;
+    }
+
+    const auto tag = read<std::uint32_t>();
+    const auto version = read<std::uint16_t>();
+    const auto length = read<std::uint32_t>();
+
+    if (failed || length > size - offset)
+    {
+      failed = true;
+      return std::nullopt;
+    }
+
+    const binary_reader body{data + offset, length};
+    offset += length;
+
+    return binary_section{tag, version, body};
+  }
+
+  ///
+  /// Makes a tag of a section from its four characters.
+  ///
+  /// \param name the characters.
+  ///
+  /// \return The tag.
+  ///
+  constexpr std::uint32_t make_section_tag(const char (&name)[5]) noexcept
+  {
+    return static_cast<std::uint32_t>(static_cast<std::uint8_t>(name[0])) |
+        static_cast<std::uint32_t>(static_cast<std::uint8_t>(name[1])) << 8 |
+        static_cast<std::uint32_t>(static_cast<std::uint8_t>(name[2])) << 16 |
+        static_cast<std::uint32_t>(static_cast<std::uint8_t>(name[3])) << 24;
+  }
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_BINARY_STREAM_H
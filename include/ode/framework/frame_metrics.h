@@ -0,0 +1,65 @@
+/// The declaration of the type of the metrics collected for each frame.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_FRAME_METRICS_H
+#define ODE_FRAMEWORK_FRAME_METRICS_H
+
+#include <chrono>
+
+namespace ode
+{
+  ///
+  /// The type of the objects which hold the metrics measured during a single
+  /// frame of the main loop.
+  ///
+  struct frame_metrics final
+  {
+    ///
+    /// The number of the game-state updates run during the frame.
+    ///
+    int updates = 0;
+
+    ///
+    /// The CPU time spent in the frame before the buffers are swapped,
+    /// including the updates and the rendering.
+    ///
+    std::chrono::nanoseconds cpu_time = std::chrono::nanoseconds::zero();
+
+    ///
+    /// The GPU time of the rendering passes. The GPU times are read a few
+    /// frames after they are measured, so this is the time of an earlier
+    /// frame.
+    ///
+    std::chrono::nanoseconds gpu_time = std::chrono::nanoseconds::zero();
+
+    ///
+    /// The idle time that was left in the frame after the updates and the
+    /// rendering.
+    ///
+    std::chrono::nanoseconds idle_time = std::chrono::nanoseconds::zero();
+
+    ///
+    /// The time spent in the garbage collection of the Lua states.
+    ///
+    std::chrono::nanoseconds gc_time = std::chrono::nanoseconds::zero();
+
+    ///
+    /// The number of the incremental garbage-collection steps run on the Lua
+    /// states.
+    ///
+    int gc_steps = 0;
+
+    ///
+    /// The number of the garbage-collection cycles of the Lua states
+    /// finished.
+    ///
+    int gc_cycles = 0;
+  };
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_FRAME_METRICS_H
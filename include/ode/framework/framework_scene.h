@@ -91,6 +91,28 @@ namespace ode
     ///
     scene_reference extend(const system_t& sys);
 
+    ///
+    /// Gives the configuration of this scene.
+    ///
+    /// \return A constant reference to the scene configuration.
+    ///
+    inline const scene_configuration_t& get_configuration() const noexcept
+    {
+      return config;
+    }
+
+    ///
+    /// Gives the configuration of this scene.
+    ///
+    /// Remarks: The reference returned by this function is not constant.
+    ///
+    /// \return A reference to the scene configuration.
+    ///
+    inline scene_configuration_t& get_configuration() noexcept
+    {
+      return config;
+    }
+
   private:
     ///
     /// The configuration of this scene.
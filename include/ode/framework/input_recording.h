@@ -0,0 +1,250 @@
+/// The declarations of the types of the objects which record the input events
+/// into a file and play them back.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_INPUT_RECORDING_H
+#define ODE_FRAMEWORK_INPUT_RECORDING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <SDL2/SDL.h>
+
+namespace ode
+{
+  ///
+  /// The initial value of the checksums of the recorded sessions.
+  ///
+  constexpr std::uint64_t input_checksum_seed = 14695981039346656037ull;
+
+  ///
+  /// Folds the given bytes into a checksum with the FNV-1a hash.
+  ///
+  /// \param checksum the current checksum.
+  /// \param data a pointer to the bytes.
+  /// \param size the number of the bytes.
+  ///
+  /// \return The new checksum.
+  ///
+  std::uint64_t fold_checksum(
+      std::uint64_t checksum,
+      const std::uint8_t* data,
+      const std::size_t size) noexcept;
+
+  ///
+  /// Encodes an input event into its compact form. Only the events of the
+  /// keyboard, the mouse, and the controller buttons and axes are encoded.
+  ///
+  /// \param event the event.
+  /// \param out the buffer to which the encoded event is appended.
+  ///
+  /// \return Whether or not the event was encoded.
+  ///
+  bool encode_input_event(
+      const SDL_Event& event, std::vector<std::uint8_t>& out);
+
+  ///
+  /// Decodes an input event from its compact form.
+  ///
+  /// \param data a reference to the pointer to the encoded event, which is
+  /// moved past the event.
+  /// \param end a pointer past the end of the encoded data.
+  ///
+  /// \return The event or \c std::nullopt if the data is invalid.
+  ///
+  std::optional<SDL_Event> decode_input_event(
+      const std::uint8_t*& data, const std::uint8_t* end);
+
+  ///
+  /// The type of the objects which write the input events of a session into
+  /// a file together with the numbers of the ticks in which they occurred.
+  /// The file ends with the number of the ticks in the session and a
+  /// checksum of the events and the final state, which the playback is
+  /// compared against.
+  ///
+  class input_recorder final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c input_recorder.
+    ///
+    /// \param filename the name of the file to which the session is written.
+    ///
+    /// \exception std::runtime_error Thrown if the file can't be opened.
+    ///
+    explicit input_recorder(const std::string& filename);
+
+    ///
+    /// Writes the given event into the file if it is an input event.
+    ///
+    /// \param tick the number of the tick in which the event occurred. The
+    /// ticks must not decrease.
+    /// \param event the event.
+    ///
+    void record(const std::uint64_t tick, const SDL_Event& event);
+
+    ///
+    /// Ends the session and closes the file.
+    ///
+    /// \param ticks the number of the ticks in the session.
+    /// \param state_checksum the checksum of the final state, which is folded
+    /// into the checksum of the events.
+    ///
+    /// \return The checksum of the session.
+    ///
+    std::uint64_t finish(
+        const std::uint64_t ticks, const std::uint64_t state_checksum);
+
+    ///
+    /// Gives the number of the recorded events.
+    ///
+    /// \return The number of the events.
+    ///
+    inline std::size_t get_event_count() const noexcept
+    {
+      return events;
+    }
+
+  private:
+    ///
+    /// The file to which the session is written.
+    ///
+    std::ofstream file;
+
+    ///
+    /// The buffer into which the records are encoded.
+    ///
+    std::vector<std::uint8_t> buffer;
+
+    ///
+    /// The tick of the previous record.
+    ///
+    std::uint64_t previous_tick;
+
+    ///
+    /// The checksum of the recorded events.
+    ///
+    std::uint64_t checksum;
+
+    ///
+    /// The number of the recorded events.
+    ///
+    std::size_t events;
+  };
+
+  ///
+  /// The type of the objects which read a recorded session and give its
+  /// input events back tick by tick.
+  ///
+  class input_player final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c input_player.
+    ///
+    /// \param filename the name of the file of the recorded session.
+    ///
+    /// \exception std::runtime_error Thrown if the file can't be read or it
+    /// isn't a recorded session.
+    ///
+    explicit input_player(const std::string& filename);
+
+    ///
+    /// Gives the next recorded event of the given tick.
+    ///
+    /// \param tick the number of the current tick.
+    ///
+    /// \return The event or \c std::nullopt if there are no more events in
+    /// the tick.
+    ///
+    std::optional<SDL_Event> next(const std::uint64_t tick);
+
+    ///
+    /// Checks whether or not the given tick is past the end of the session.
+    ///
+    /// \param tick the number of the tick.
+    ///
+    /// \return \c true if the session has ended, otherwise \c false.
+    ///
+    inline bool is_finished(const std::uint64_t tick) const noexcept
+    {
+      return tick >= ticks;
+    }
+
+    ///
+    /// Compares the played session against the recorded one.
+    ///
+    /// \param state_checksum the checksum of the final state.
+    ///
+    /// \return The checksum of the played session.
+    ///
+    std::uint64_t finish(const std::uint64_t state_checksum) const noexcept;
+
+    ///
+    /// Gives the checksum of the recorded session.
+    ///
+    /// \return The checksum.
+    ///
+    inline std::uint64_t get_recorded_checksum() const noexcept
+    {
+      return recorded_checksum;
+    }
+
+    ///
+    /// Gives the number of the ticks in the session.
+    ///
+    /// \return The number of the ticks.
+    ///
+    inline std::uint64_t get_tick_count() const noexcept
+    {
+      return ticks;
+    }
+
+  private:
+    ///
+    /// The contents of the file.
+    ///
+    std::vector<std::uint8_t> data;
+
+    ///
+    /// The offset of the next record in the data.
+    ///
+    std::size_t offset;
+
+    ///
+    /// The offset of the end of the records.
+    ///
+    std::size_t end;
+
+    ///
+    /// The tick of the next record.
+    ///
+    std::uint64_t next_tick;
+
+    ///
+    /// The number of the ticks in the session.
+    ///
+    std::uint64_t ticks;
+
+    ///
+    /// The checksum of the played events.
+    ///
+    std::uint64_t checksum;
+
+    ///
+    /// The checksum of the recorded session.
+    ///
+    std::uint64_t recorded_checksum;
+  };
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_INPUT_RECORDING_H
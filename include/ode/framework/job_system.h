@@ -0,0 +1,167 @@
+/// The declaration of the job system which runs work on a pool of worker
+/// threads.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_JOB_SYSTEM_H
+#define ODE_FRAMEWORK_JOB_SYSTEM_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ode/framework/message_queue.h"
+
+namespace ode
+{
+  ///
+  /// The type of the job systems which run independent jobs on a pool of
+  /// worker threads. The jobs are taken from a single queue in the order in
+  /// which they are submitted, but they may finish in any order. The jobs
+  /// must not touch the OpenGL context or the Lua states of the main thread,
+  /// and their results should be handed back through a \c message_queue.
+  ///
+  class job_system final
+  {
+  public:
+    ///
+    /// The type of the jobs which are run by the job system.
+    ///
+    using job_t = std::function<void()>;
+
+    ///
+    /// Constructs an object of the type \c job_system and starts the worker
+    /// threads.
+    ///
+    /// \param thread_count the number of the worker threads. If zero is
+    /// given, the number of the hardware threads minus the main thread is
+    /// used.
+    ///
+    explicit job_system(std::size_t thread_count = 0);
+
+    ///
+    /// Constructs an object of the type \c job_system by copying the given
+    /// object of the type \c job_system.
+    ///
+    /// \param a a \c job_system from which the new one is constructed.
+    ///
+    job_system(const job_system& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c job_system by moving the given
+    /// object of the type \c job_system.
+    ///
+    /// \param a a \c job_system from which the new one is constructed.
+    ///
+    job_system(job_system&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c job_system. The jobs which are
+    /// already submitted are finished before the worker threads are joined.
+    ///
+    ~job_system();
+
+    ///
+    /// Assigns the given object of the type \c job_system to this one by
+    /// copying.
+    ///
+    /// \param a a \c job_system from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    job_system& operator=(const job_system& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c job_system to this one by
+    /// moving.
+    ///
+    /// \param a a \c job_system from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    job_system& operator=(job_system&& a) = delete;
+
+    ///
+    /// Submits the given job to be run on a worker thread.
+    ///
+    /// \param job the job.
+    ///
+    void submit(job_t job);
+
+    ///
+    /// Blocks until all of the submitted jobs are finished.
+    ///
+    void wait();
+
+    ///
+    /// Runs the given function once for each index of a batch and blocks
+    /// until the whole batch is finished. The worker threads and the calling
+    /// thread take the indices from the batch, so the function doesn't wait
+    /// for the other jobs and it can be called from a job without a deadlock.
+    /// If the function throws, the first exception is rethrown after the
+    /// batch is finished.
+    ///
+    /// \param count the number of the indices in the batch.
+    /// \param f the function, which is given the index.
+    ///
+    void run_batch(
+        const std::size_t count,
+        const std::function<void(std::size_t)>& f);
+
+    ///
+    /// Gives the number of the worker threads.
+    ///
+    /// \return The number of the threads.
+    ///
+    std::size_t get_thread_count() const noexcept;
+
+  private:
+    ///
+    /// Runs the jobs on a worker thread until the queue is closed.
+    ///
+    /// \param index the index of the worker thread.
+    ///
+    void run(const std::size_t index);
+
+    ///
+    /// Marks a job as finished and wakes up the threads waiting for the
+    /// jobs.
+    ///
+    void finish_job();
+
+    ///
+    /// The jobs which are waiting to be run.
+    ///
+    message_queue<job_t> jobs;
+
+    ///
+    /// The worker threads.
+    ///
+    std::vector<std::thread> threads;
+
+    ///
+    /// The mutex which guards the number of the unfinished jobs.
+    ///
+    std::mutex pending_mutex;
+
+    ///
+    /// The condition variable which signals that all of the jobs are
+    /// finished.
+    ///
+    std::condition_variable pending_condition;
+
+    ///
+    /// The number of the jobs which are submitted but not yet finished.
+    ///
+    std::size_t pending_jobs;
+  };
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_JOB_SYSTEM_H
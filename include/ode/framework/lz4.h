@@ -0,0 +1,68 @@
+/// The declarations of the functions which compress and decompress data in
+/// the LZ4 block format.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_LZ4_H
+#define ODE_FRAMEWORK_LZ4_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ode
+{
+  ///
+  /// Gives the largest size that the given number of the bytes can have
+  /// after compression.
+  ///
+  /// \param size the number of the bytes.
+  ///
+  /// \return The number of the bytes.
+  ///
+  constexpr std::size_t lz4_compress_bound(const std::size_t size) noexcept
+  {
+    return size + size / 255 + 16;
+  }
+
+  ///
+  /// Compresses the given data into a single block of the LZ4 block format.
+  /// The compressor favours speed over ratio, so it finds the matches with a
+  /// single hash table of the recent positions.
+  ///
+  /// \param in a pointer to the data.
+  /// \param size the number of the bytes in the data.
+  /// \param out the buffer to which the compressed block is appended.
+  ///
+  /// \return The number of the bytes appended.
+  ///
+  std::size_t lz4_compress(
+      const std::uint8_t* in,
+      const std::size_t size,
+      std::vector<std::uint8_t>& out);
+
+  ///
+  /// Decompresses a block of the LZ4 block format. The block is validated
+  /// while it is decompressed, so corrupted data is never read or written
+  /// out of bounds.
+  ///
+  /// \param in a pointer to the compressed block.
+  /// \param size the number of the bytes in the block.
+  /// \param out a pointer to the memory into which the data is written.
+  /// \param out_size the number of the bytes in the decompressed data.
+  ///
+  /// \return \c true if the block was valid and decompressed into exactly
+  /// \c out_size bytes, otherwise \c false.
+  ///
+  bool lz4_decompress(
+      const std::uint8_t* in,
+      const std::size_t size,
+      std::uint8_t* out,
+      const std::size_t out_size) noexcept;
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_LZ4_H
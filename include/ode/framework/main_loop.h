@@ -8,11 +8,11 @@
 #ifndef ODE_FRAMEWORK_MAIN_LOOP_H
 #define ODE_FRAMEWORK_MAIN_LOOP_H
 
-#if ODE_STD_CLOCK
-#  include <chrono>
-#endif // ODE_STD_CLOCK
+#include <algorithm>
+#include <chrono>
 
 #include "ode/engine_framework.h"
+#include "ode/framework/frame_metrics.h"
 #include "ode/framework/framework_scene.h"
 #include "ode/framework/platform_manager.h"
 #include "ode/framework/scheduler.h"
@@ -51,7 +51,10 @@ namespace ode
   ///
   /// \param engine an rvalue reference of the engine framework.
   ///
-  template <typename A> void main_loop(engine_framework<A>&& engine)
+  /// \return \c false if a replayed session didn't match its recording,
+  /// otherwise \c true.
+  ///
+  template <typename A> bool main_loop(engine_framework<A>&& engine)
   {
 #if ODE_STD_CLOCK
 
@@ -64,6 +67,10 @@ namespace ode
     framework_scene current_scene =
         std::move(framework.application().first_scene());
 
+    // The scene is entered only when its assets are loaded, which may take
+    // several frames.
+    bool scene_loaded = false;
+
     state current_state{};
     state previous_state{};
 
@@ -83,6 +90,8 @@ namespace ode
 
     while (framework.environment().should_execute())
     {
+      frame_metrics metrics{};
+
 #if ODE_STD_CLOCK
 
       auto dt = clock::now() - t;
@@ -111,10 +120,32 @@ namespace ode
 
 #endif // !ODE_STD_CLOCK
 
+      framework.assets().update();
+
+      if (!scene_loaded && framework.load_scene(current_scene))
+      {
+        framework.enter_scene(current_scene);
+        scene_loaded = true;
+      }
+
+      // A replayed session runs a single update in each frame without waiting
+      // for the clock so that it runs as fast as possible.
+      if (framework.platform().is_replaying())
+      {
+        delay = time_step;
+      }
+
       while (delay >= time_step)
       {
         delay -= time_step;
 
+        // The reloaded scripts would change the replayed session, so they
+        // are only applied when the input is live.
+        if (!framework.platform().is_replaying())
+        {
+          framework.scripts().apply();
+        }
+
         framework.platform().poll_events(framework.environment());
 
         ODE_TRACE("Updating the game state");
@@ -124,6 +155,8 @@ namespace ode
 
         framework.state().distribute_state(current_state);
 
+        ++metrics.updates;
+
       } // while (delay >= time_step)
 
 #if ODE_STD_CLOCK
@@ -149,12 +182,68 @@ namespace ode
 
       // render_state(interpolated_state);
 
+      framework.timer().begin_frame();
+
       // TODO This is a temporary solution.
+      framework.timer().begin("clear");
       glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+      framework.timer().end();
+
+      // The CPU time is measured before the swap as the swap may wait for
+      // the GPU.
+#if ODE_STD_CLOCK
+
+      metrics.cpu_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          clock::now() - t);
+
+#else
+
+      metrics.cpu_time = std::chrono::milliseconds{SDL_GetTicks() - t};
+
+#endif // !ODE_STD_CLOCK
 
       SDL_GL_SwapWindow(framework.window());
 
+      metrics.gpu_time = framework.timer().get_frame_time();
+
+      // The time left before the next update is due is given to the garbage
+      // collector of the Lua states so that the collection doesn't cause
+      // pauses in the middle of the frames.
+#if ODE_STD_CLOCK
+
+      const auto frame_time = clock::now() - t;
+      const auto slack = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          time_step - delay - frame_time);
+
+#else
+
+      const Sint64 frame_time = SDL_GetTicks() - t;
+      const auto slack = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::milliseconds{
+              static_cast<Sint64>(time_step) - delay - frame_time});
+
+#endif // !ODE_STD_CLOCK
+
+      metrics.idle_time = std::max(slack, std::chrono::nanoseconds::zero());
+
+      const auto gc_statistics = framework.collector().step(metrics.idle_time);
+
+      metrics.gc_time = gc_statistics.time;
+      metrics.gc_steps = gc_statistics.steps;
+      metrics.gc_cycles = gc_statistics.cycles;
+
+      ODE_TRACE(
+          "The garbage collection took {} ns in {} steps",
+          metrics.gc_time.count(),
+          metrics.gc_steps);
+
+      framework.metrics() = metrics;
+
     } // while (!quit)
+
+    framework.leave_scene(current_scene);
+
+    return framework.platform().finish(current_state);
   }
 
 } // namespace ode
@@ -0,0 +1,203 @@
+/// The declaration of the typed message queue which is used to move data
+/// between threads.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_MESSAGE_QUEUE_H
+#define ODE_FRAMEWORK_MESSAGE_QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace ode
+{
+  ///
+  /// The type of the thread-safe first-in-first-out queue which passes
+  /// messages of a single type between threads. Any number of threads may
+  /// push and pop the messages. The Lua states, for example, never share
+  /// tables with each other, and all of the data must instead be converted to
+  /// objects of the type \c T which are moved through a queue.
+  ///
+  /// \tparam T the type of the messages.
+  ///
+  template <typename T> class message_queue final
+  {
+  public:
+    ///
+    /// The type of the messages in the queue.
+    ///
+    using value_type = T;
+
+    ///
+    /// Constructs an object of the type \c message_queue.
+    ///
+    message_queue() = default;
+
+    ///
+    /// Constructs an object of the type \c message_queue by copying the given
+    /// object of the type \c message_queue.
+    ///
+    /// \param a a \c message_queue from which the new one is constructed.
+    ///
+    message_queue(const message_queue& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c message_queue by moving the given
+    /// object of the type \c message_queue.
+    ///
+    /// \param a a \c message_queue from which the new one is constructed.
+    ///
+    message_queue(message_queue&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c message_queue.
+    ///
+    ~message_queue() = default;
+
+    ///
+    /// Assigns the given object of the type \c message_queue to this one by
+    /// copying.
+    ///
+    /// \param a a \c message_queue from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    message_queue& operator=(const message_queue& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c message_queue to this one by
+    /// moving.
+    ///
+    /// \param a a \c message_queue from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    message_queue& operator=(message_queue&& a) = delete;
+
+    ///
+    /// Adds the given message to the back of the queue. The message is
+    /// dropped if the queue is closed.
+    ///
+    /// \param message the message.
+    ///
+    /// \return \c true if the message was added, otherwise \c false.
+    ///
+    bool push(T message)
+    {
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        if (closed)
+        {
+          return false;
+        }
+
+        messages.push_back(std::move(message));
+      }
+
+      condition.notify_one();
+
+      return true;
+    }
+
+    ///
+    /// Removes the message at the front of the queue without blocking.
+    ///
+    /// \return The message or an empty \c std::optional if the queue is empty.
+    ///
+    std::optional<T> try_pop()
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+
+      if (messages.empty())
+      {
+        return std::nullopt;
+      }
+
+      auto message = std::move(messages.front());
+      messages.pop_front();
+
+      return message;
+    }
+
+    ///
+    /// Removes the message at the front of the queue and blocks until there
+    /// is a message to remove or the queue is closed.
+    ///
+    /// \return The message or an empty \c std::optional if the queue was
+    /// closed and no messages are left.
+    ///
+    std::optional<T> pop()
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+
+      condition.wait(lock, [this] { return closed || !messages.empty(); });
+
+      if (messages.empty())
+      {
+        return std::nullopt;
+      }
+
+      auto message = std::move(messages.front());
+      messages.pop_front();
+
+      return message;
+    }
+
+    ///
+    /// Closes the queue so that no new messages are accepted and wakes up all
+    /// of the threads waiting for messages. The messages already in the queue
+    /// can still be removed.
+    ///
+    void close()
+    {
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        closed = true;
+      }
+
+      condition.notify_all();
+    }
+
+    ///
+    /// Tells whether or not the queue is empty.
+    ///
+    /// \return A \c bool.
+    ///
+    bool empty() const
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      return messages.empty();
+    }
+
+  private:
+    ///
+    /// The mutex which guards the queue.
+    ///
+    mutable std::mutex mutex;
+
+    ///
+    /// The condition variable which signals new messages.
+    ///
+    std::condition_variable condition;
+
+    ///
+    /// The messages in the queue.
+    ///
+    std::deque<T> messages;
+
+    ///
+    /// Whether or not the queue is closed.
+    ///
+    bool closed = false;
+  };
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_MESSAGE_QUEUE_H
@@ -8,9 +8,14 @@
 #ifndef ODE_FRAMEWORK_PLATFORM_MANAGER_H
 #define ODE_FRAMEWORK_PLATFORM_MANAGER_H
 
+#include <cstdint>
+#include <memory>
+
 #include "ode/__config"
 #include "ode/framework/environment_manager.h"
-#include "ode/systems/system_t.h"
+#include "ode/framework/input_recording.h"
+#include "ode/framework/state.h"
+#include "ode/systems/input/input_handler.h"
 
 namespace ode
 {
@@ -50,9 +55,10 @@ namespace ode
     ///
     /// Constructs an object of the type \c platform_manager.
     ///
-    /// \param is a pointer to the input system.
+    /// \param ih a pointer to the input handler to which the input events are
+    /// forwarded.
     ///
-    platform_manager(system_t* is);
+    platform_manager(input_handler* ih);
 
     ///
     /// Constructs an object of the type \c platform_manager by copying the
@@ -60,7 +66,7 @@ namespace ode
     ///
     /// \param a a \c platform_manager from which the new one is constructed.
     ///
-    platform_manager(const platform_manager& a) = default;
+    platform_manager(const platform_manager& a) = delete;
 
     ///
     /// Constructs an object of the type \c platform_manager by moving the
@@ -83,7 +89,7 @@ namespace ode
     ///
     /// \return A reference to \c *this.
     ///
-    platform_manager& operator=(const platform_manager& a) = default;
+    platform_manager& operator=(const platform_manager& a) = delete;
 
     ///
     /// Assigns the given object of the type \c platform_manager to this one by
@@ -96,7 +102,12 @@ namespace ode
     platform_manager& operator=(platform_manager&& a) = default;
 
     ///
-    /// Polls all of the current system events waiting and forwards them.
+    /// Polls all of the current system events waiting and forwards them. The
+    /// input events are forwarded to the input handler, which then publishes
+    /// the input snapshot of the tick. While a session is replayed, the live
+    /// input events are ignored and the recorded events of the tick are
+    /// forwarded instead, and the termination is scheduled when the session
+    /// ends.
     ///
     /// Remarks: The reference to the environment manager which is passed to
     /// the function is not constant and, thus, modifies the original
@@ -106,11 +117,72 @@ namespace ode
     ///
     void poll_events(environment_manager& env);
 
+    ///
+    /// Starts writing the input events of each tick into a recording.
+    ///
+    /// \param r the recorder.
+    ///
+    void record(std::unique_ptr<input_recorder> r);
+
+    ///
+    /// Starts replaying a recorded session instead of the live input.
+    ///
+    /// \param p the player of the session.
+    ///
+    void replay(std::unique_ptr<input_player> p);
+
+    ///
+    /// Ends the recording or the replay. The recording is written with the
+    /// checksum of the final state, and the replay is compared against the
+    /// recorded checksum.
+    ///
+    /// \param s the final state.
+    ///
+    /// \return \c false if a replay didn't match its recording, otherwise
+    /// \c true.
+    ///
+    bool finish(const state& s);
+
+    ///
+    /// Checks whether or not a recorded session is replayed.
+    ///
+    /// \return \c true if a session is replayed, otherwise \c false.
+    ///
+    inline bool is_replaying() const noexcept
+    {
+      return nullptr != player;
+    }
+
+    ///
+    /// Gives the number of the ticks for which the events have been polled.
+    ///
+    /// \return The number of the ticks.
+    ///
+    inline std::uint64_t get_tick() const noexcept
+    {
+      return tick;
+    }
+
   private:
     ///
-    /// A pointer to the input system.
+    /// A pointer to the input handler.
+    ///
+    input_handler* input = nullptr;
+
+    ///
+    /// The recorder of the input events, if the session is recorded.
+    ///
+    std::unique_ptr<input_recorder> recorder{};
+
+    ///
+    /// The player of the recorded session, if a session is replayed.
+    ///
+    std::unique_ptr<input_player> player{};
+
+    ///
+    /// The number of the ticks for which the events have been polled.
     ///
-    system_t* input_system;
+    std::uint64_t tick = 0;
   };
 
 } // namespace ode
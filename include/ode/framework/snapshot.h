@@ -0,0 +1,334 @@
+/// The declarations of the types and the functions which save the game
+/// state into snapshots and load it back.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_SNAPSHOT_H
+#define ODE_FRAMEWORK_SNAPSHOT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ode/framework/job_system.h"
+#include "ode/framework/state.h"
+
+namespace ode
+{
+  ///
+  /// The version of the layout of the state in the snapshots. It must be
+  /// increased whenever the layout written by \c state::serialize changes,
+  /// and \c state::deserialize must keep reading the older versions that
+  /// are still supported.
+  ///
+  constexpr std::uint16_t state_schema_version = 1;
+
+  ///
+  /// The ways in which the data of the snapshots can be compressed.
+  ///
+  enum class snapshot_compression : std::uint8_t
+  {
+    none,
+    lz4
+  };
+
+  ///
+  /// The type of the objects which encode the state into snapshots. The
+  /// snapshot starts with a header that tells its format and compression,
+  /// and its data is a list of sections, each with its own version, so that
+  /// the parts of the state can change their layouts independently. The
+  /// buffers of the encoder are reused, so encoding the same state again
+  /// doesn't allocate.
+  ///
+  class snapshot_encoder final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c snapshot_encoder.
+    ///
+    snapshot_encoder() = default;
+
+    ///
+    /// Constructs an object of the type \c snapshot_encoder by copying the
+    /// given object of the type \c snapshot_encoder.
+    ///
+    /// \param a a \c snapshot_encoder from which the new one is
+    /// constructed.
+    ///
+    snapshot_encoder(const snapshot_encoder& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c snapshot_encoder by moving the
+    /// given object of the type \c snapshot_encoder.
+    ///
+    /// \param a a \c snapshot_encoder from which the new one is
+    /// constructed.
+    ///
+    snapshot_encoder(snapshot_encoder&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c snapshot_encoder.
+    ///
+    ~snapshot_encoder() = default;
+
+    ///
+    /// Assigns the given object of the type \c snapshot_encoder to this one
+    /// by copying.
+    ///
+    /// \param a a \c snapshot_encoder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    snapshot_encoder& operator=(const snapshot_encoder& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c snapshot_encoder to this one
+    /// by moving.
+    ///
+    /// \param a a \c snapshot_encoder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    snapshot_encoder& operator=(snapshot_encoder&& a) = default;
+
+    ///
+    /// Encodes the given state.
+    ///
+    /// \param s the state.
+    /// \param compression the compression of the data.
+    ///
+    /// \return A reference to the snapshot, which is valid until the next
+    /// call.
+    ///
+    const std::vector<std::uint8_t>& encode(
+        const state& s,
+        const snapshot_compression compression = snapshot_compression::lz4);
+
+  private:
+    ///
+    /// The uncompressed data of the snapshot.
+    ///
+    std::vector<std::uint8_t> body;
+
+    ///
+    /// The snapshot.
+    ///
+    std::vector<std::uint8_t> out;
+  };
+
+  ///
+  /// The type of the objects which decode the state from snapshots. The
+  /// buffer into which the data is decompressed is reused.
+  ///
+  class snapshot_decoder final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c snapshot_decoder.
+    ///
+    snapshot_decoder() = default;
+
+    ///
+    /// Constructs an object of the type \c snapshot_decoder by copying the
+    /// given object of the type \c snapshot_decoder.
+    ///
+    /// \param a a \c snapshot_decoder from which the new one is
+    /// constructed.
+    ///
+    snapshot_decoder(const snapshot_decoder& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c snapshot_decoder by moving the
+    /// given object of the type \c snapshot_decoder.
+    ///
+    /// \param a a \c snapshot_decoder from which the new one is
+    /// constructed.
+    ///
+    snapshot_decoder(snapshot_decoder&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c snapshot_decoder.
+    ///
+    ~snapshot_decoder() = default;
+
+    ///
+    /// Assigns the given object of the type \c snapshot_decoder to this one
+    /// by copying.
+    ///
+    /// \param a a \c snapshot_decoder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    snapshot_decoder& operator=(const snapshot_decoder& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c snapshot_decoder to this one
+    /// by moving.
+    ///
+    /// \param a a \c snapshot_decoder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    snapshot_decoder& operator=(snapshot_decoder&& a) = default;
+
+    ///
+    /// Decodes a state from the given snapshot. The sections that the
+    /// decoder doesn't know are skipped.
+    ///
+    /// \param data a pointer to the snapshot.
+    /// \param size the number of the bytes in the snapshot.
+    ///
+    /// \return The state.
+    ///
+    /// \exception std::runtime_error Thrown if the snapshot is invalid or
+    /// it was written by a newer version of the layout.
+    ///
+    state decode(const std::uint8_t* data, const std::size_t size);
+
+  private:
+    ///
+    /// The decompressed data of the snapshot.
+    ///
+    std::vector<std::uint8_t> body;
+  };
+
+  ///
+  /// Saves the given state into a file. The snapshot is written into a
+  /// temporary file first and moved over the old file only when it is
+  /// complete, so a crash never leaves a partial save behind.
+  ///
+  /// \param filename the name of the file.
+  /// \param s the state.
+  /// \param compression the compression of the data.
+  ///
+  /// \exception std::runtime_error Thrown if the file can't be written.
+  ///
+  void save_snapshot(
+      const std::string& filename,
+      const state& s,
+      const snapshot_compression compression = snapshot_compression::lz4);
+
+  ///
+  /// Loads a state from a file.
+  ///
+  /// \param filename the name of the file.
+  ///
+  /// \return The state.
+  ///
+  /// \exception std::runtime_error Thrown if the file can't be read or it
+  /// isn't a valid snapshot.
+  ///
+  state load_snapshot(const std::string& filename);
+
+  ///
+  /// The type of the objects which save snapshots on the threads of a job
+  /// system. The state is copied when the save is requested, so the game
+  /// loop can go on changing its own state while the copy is encoded,
+  /// compressed, and written.
+  ///
+  class snapshot_writer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c snapshot_writer.
+    ///
+    /// \param job_threads the job system on which the snapshots are saved.
+    ///
+    explicit snapshot_writer(job_system& job_threads);
+
+    ///
+    /// Constructs an object of the type \c snapshot_writer by copying the
+    /// given object of the type \c snapshot_writer.
+    ///
+    /// \param a a \c snapshot_writer from which the new one is constructed.
+    ///
+    snapshot_writer(const snapshot_writer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c snapshot_writer by moving the
+    /// given object of the type \c snapshot_writer.
+    ///
+    /// \param a a \c snapshot_writer from which the new one is constructed.
+    ///
+    snapshot_writer(snapshot_writer&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c snapshot_writer. The saves that
+    /// are still running are finished by the job system.
+    ///
+    ~snapshot_writer() = default;
+
+    ///
+    /// Assigns the given object of the type \c snapshot_writer to this one
+    /// by copying.
+    ///
+    /// \param a a \c snapshot_writer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    snapshot_writer& operator=(const snapshot_writer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c snapshot_writer to this one
+    /// by moving.
+    ///
+    /// \param a a \c snapshot_writer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    snapshot_writer& operator=(snapshot_writer&& a) = delete;
+
+    ///
+    /// Starts saving the given state into a file.
+    ///
+    /// \param s the copy of the state, which isn't changed while it is
+    /// saved.
+    /// \param filename the name of the file.
+    /// \param compression the compression of the data.
+    ///
+    void save(
+        state s,
+        std::string filename,
+        const snapshot_compression compression = snapshot_compression::lz4);
+
+    ///
+    /// Gives the number of the saves that haven't finished.
+    ///
+    /// \return The number of the saves.
+    ///
+    std::size_t get_pending_count() const noexcept;
+
+    ///
+    /// Gives the number of the saves that have failed.
+    ///
+    /// \return The number of the saves.
+    ///
+    std::size_t get_failed_count() const noexcept;
+
+  private:
+    ///
+    /// The job system on which the snapshots are saved.
+    ///
+    job_system& jobs;
+
+    ///
+    /// The number of the saves that haven't finished. It is shared with the
+    /// jobs so that the jobs may outlive the writer.
+    ///
+    std::shared_ptr<std::atomic<std::size_t>> pending;
+
+    ///
+    /// The number of the saves that have failed.
+    ///
+    std::shared_ptr<std::atomic<std::size_t>> failed;
+  };
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_SNAPSHOT_H
@@ -0,0 +1,269 @@
+/// The declaration of the lock-free queue between a single producer thread
+/// and a single consumer thread.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_FRAMEWORK_SPSC_QUEUE_H
+#define ODE_FRAMEWORK_SPSC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  ///
+  /// The type of the bounded first-in-first-out queues which pass values
+  /// from a single producer thread to a single consumer thread without
+  /// locks. The memory of the queue is allocated when it is constructed, so
+  /// neither of the sides allocates, blocks, or makes system calls, and the
+  /// consumer may be a real-time thread such as the audio callback.
+  ///
+  /// The positions of the producer and the consumer only grow, and they are
+  /// kept on separate cache lines so that the two threads don't invalidate
+  /// each other's lines on every operation.
+  ///
+  /// \tparam T the type of the values. The values are copied, so the type
+  /// should be trivially copyable.
+  ///
+  template <typename T> class spsc_queue final
+  {
+    static_assert(
+        std::is_trivially_copyable_v<T>,
+        "The values are copied into the queue by the producer");
+
+  public:
+    ///
+    /// The type of the values in the queue.
+    ///
+    using value_type = T;
+
+    ///
+    /// Constructs an object of the type \c spsc_queue.
+    ///
+    /// \param capacity the least number of the values that the queue holds.
+    /// The capacity is rounded up to a power of two.
+    ///
+    explicit spsc_queue(const std::size_t capacity)
+        : values(round_capacity(capacity)),
+          mask{values.size() - 1},
+          head{0},
+          tail{0}
+    {
+    }
+
+    ///
+    /// Constructs an object of the type \c spsc_queue by copying the given
+    /// object of the type \c spsc_queue.
+    ///
+    /// \param a an \c spsc_queue from which the new one is constructed.
+    ///
+    spsc_queue(const spsc_queue& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c spsc_queue by moving the given
+    /// object of the type \c spsc_queue.
+    ///
+    /// \param a an \c spsc_queue from which the new one is constructed.
+    ///
+    spsc_queue(spsc_queue&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c spsc_queue.
+    ///
+    ~spsc_queue() = default;
+
+    ///
+    /// Assigns the given object of the type \c spsc_queue to this one by
+    /// copying.
+    ///
+    /// \param a an \c spsc_queue from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    spsc_queue& operator=(const spsc_queue& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c spsc_queue to this one by
+    /// moving.
+    ///
+    /// \param a an \c spsc_queue from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    spsc_queue& operator=(spsc_queue&& a) = delete;
+
+    ///
+    /// Adds the given value to the back of the queue. This function may only
+    /// be called by the producer.
+    ///
+    /// \param value the value.
+    ///
+    /// \return \c true if the value was added, or \c false if the queue is
+    /// full.
+    ///
+    bool try_push(const T& value) noexcept
+    {
+      return 1 == push(&value, 1);
+    }
+
+    ///
+    /// Adds as many of the given values to the back of the queue as fit in
+    /// it. This function may only be called by the producer.
+    ///
+    /// \param first a pointer to the first value.
+    /// \param count the number of the values.
+    ///
+    /// \return The number of the values added.
+    ///
+    std::size_t push(const T* first, const std::size_t count) noexcept
+    {
+      const auto t = tail.load(std::memory_order_relaxed);
+      const auto h = head.load(std::memory_order_acquire);
+      const auto n = std::min(count, values.size() - (t - h));
+
+      // The values may wrap around the end of the storage.
+      const auto start = t & mask;
+      const auto before_end = std::min(n, values.size() - start);
+
+      std::copy_n(first, before_end, values.data() + start);
+      std::copy_n(first + before_end, n - before_end, values.data());
+
+      tail.store(t + n, std::memory_order_release);
+
+      return n;
+    }
+
+    ///
+    /// Removes the value at the front of the queue. This function may only
+    /// be called by the consumer.
+    ///
+    /// \return The value or an empty \c std::optional if the queue is empty.
+    ///
+    std::optional<T> try_pop() noexcept
+    {
+      T value;
+
+      if (0 == pop(&value, 1))
+      {
+        return std::nullopt;
+      }
+
+      return value;
+    }
+
+    ///
+    /// Removes at most the given number of the values from the front of the
+    /// queue. This function may only be called by the consumer.
+    ///
+    /// \param first a pointer to the memory into which the values are
+    /// copied.
+    /// \param count the largest number of the values to remove.
+    ///
+    /// \return The number of the values removed.
+    ///
+    std::size_t pop(T* first, const std::size_t count) noexcept
+    {
+      const auto h = head.load(std::memory_order_relaxed);
+      const auto t = tail.load(std::memory_order_acquire);
+      const auto n = std::min(count, static_cast<std::size_t>(t - h));
+
+      const auto start = h & mask;
+      const auto before_end = std::min(n, values.size() - start);
+
+      std::copy_n(values.data() + start, before_end, first);
+      std::copy_n(values.data(), n - before_end, first + before_end);
+
+      head.store(h + n, std::memory_order_release);
+
+      return n;
+    }
+
+    ///
+    /// Gives the number of the values in the queue. The number may already
+    /// be out of date when it is returned if the other side is running.
+    ///
+    /// \return The number of the values.
+    ///
+    std::size_t size() const noexcept
+    {
+      const auto h = head.load(std::memory_order_acquire);
+      const auto t = tail.load(std::memory_order_acquire);
+      return static_cast<std::size_t>(t - h);
+    }
+
+    ///
+    /// Tells whether or not the queue is empty. The result may already be out
+    /// of date when it is returned if the other side is running.
+    ///
+    /// \return A \c bool.
+    ///
+    bool empty() const noexcept
+    {
+      return 0 == size();
+    }
+
+    ///
+    /// Gives the number of the values that the queue holds.
+    ///
+    /// \return The capacity of the queue.
+    ///
+    std::size_t get_capacity() const noexcept
+    {
+      return values.size();
+    }
+
+  private:
+    ///
+    /// Rounds the given capacity up to a power of two.
+    ///
+    /// \param capacity the capacity.
+    ///
+    /// \return The rounded capacity.
+    ///
+    static std::size_t round_capacity(const std::size_t capacity)
+    {
+      Expects(0 < capacity);
+
+      std::size_t rounded = 1;
+
+      while (rounded < capacity)
+      {
+        rounded <<= 1;
+      }
+
+      return rounded;
+    }
+
+    ///
+    /// The storage of the values.
+    ///
+    std::vector<T> values;
+
+    ///
+    /// The mask that gives the index of a position in the storage.
+    ///
+    std::size_t mask;
+
+    ///
+    /// The position of the next value to remove, written by the consumer.
+    ///
+    alignas(64) std::atomic<std::size_t> head;
+
+    ///
+    /// The position of the next value to add, written by the producer.
+    ///
+    alignas(64) std::atomic<std::size_t> tail;
+  };
+
+} // namespace ode
+
+#endif // !ODE_FRAMEWORK_SPSC_QUEUE_H
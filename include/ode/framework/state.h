@@ -8,6 +8,10 @@
 #ifndef ODE_FRAMEWORK_STATE_H
 #define ODE_FRAMEWORK_STATE_H
 
+#include <cstdint>
+
+#include "ode/framework/binary_stream.h"
+
 namespace ode
 {
   ///
@@ -60,6 +64,42 @@ namespace ode
     /// \return A reference to \c *this.
     ///
     state& operator=(state&& a) = default;
+
+    ///
+    /// Folds the data of the state into the given checksum so that the
+    /// replays of the recorded sessions can be compared. The state holds no
+    /// data yet, so the checksum is given as it is.
+    ///
+    /// \param seed the current checksum.
+    ///
+    /// \return The new checksum.
+    ///
+    constexpr std::uint64_t checksum(const std::uint64_t seed) const noexcept
+    {
+      return seed;
+    }
+
+    ///
+    /// Writes the data of the state into a snapshot. The state holds no data
+    /// yet, so nothing is written and the writer of the snapshot is unused.
+    ///
+    void serialize(binary_writer&) const
+    {
+    }
+
+    ///
+    /// Reads the data of the state from a snapshot. The state holds no data
+    /// yet, so the version of the layout in which the state was written is
+    /// unused.
+    ///
+    /// \param reader the reader of the snapshot.
+    ///
+    /// \return \c true if the state was read, otherwise \c false.
+    ///
+    bool deserialize(binary_reader& reader, const std::uint16_t)
+    {
+      return reader.is_ok();
+    }
   };
 
 } // namespace ode
@@ -0,0 +1,183 @@
+/// The declarations of the snapshot of the capabilities of the OpenGL context
+/// and the functions which create and give it.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_GL_CAPABILITIES_H
+#define ODE_GL_CAPABILITIES_H
+
+#include <string>
+#include <unordered_set>
+
+namespace ode::gl
+{
+  ///
+  /// The type of the objects which hold the capabilities of the OpenGL
+  /// context. The capabilities are queried once after the context is created
+  /// so that the renderers can choose their fast paths without asking the
+  /// driver again.
+  ///
+  struct capabilities final
+  {
+    ///
+    /// The vendor of the OpenGL implementation.
+    ///
+    std::string vendor{};
+
+    ///
+    /// The renderer of the OpenGL implementation.
+    ///
+    std::string renderer{};
+
+    ///
+    /// The version string of the OpenGL implementation.
+    ///
+    std::string version{};
+
+    ///
+    /// The version string of the OpenGL shading language.
+    ///
+    std::string shading_language_version{};
+
+    ///
+    /// The major version of the context.
+    ///
+    int major_version = 0;
+
+    ///
+    /// The minor version of the context.
+    ///
+    int minor_version = 0;
+
+    ///
+    /// The version of the OpenGL shading language in the form used by the
+    /// \c #version directive, for example 150 or 460.
+    ///
+    int shading_language_number = 0;
+
+    ///
+    /// The names of the extensions supported by the context.
+    ///
+    std::unordered_set<std::string> extensions{};
+
+    ///
+    /// The largest width and height of a texture.
+    ///
+    int max_texture_size = 0;
+
+    ///
+    /// The largest size of a uniform block in bytes.
+    ///
+    int max_uniform_block_size = 0;
+
+    ///
+    /// The number of the texture units that the shaders can use in total.
+    ///
+    int max_texture_units = 0;
+
+    ///
+    /// The number of the vertex attributes.
+    ///
+    int max_vertex_attributes = 0;
+
+    ///
+    /// The largest number of the samples in a multisampled framebuffer.
+    ///
+    int max_samples = 0;
+
+    ///
+    /// Whether or not the buffers can have immutable storage that stays
+    /// mapped while it is used.
+    ///
+    bool persistent_mapping = false;
+
+    ///
+    /// Whether or not the objects can be modified without binding them.
+    ///
+    bool direct_state_access = false;
+
+    ///
+    /// Whether or not the instanced draw calls are supported.
+    ///
+    bool instancing = false;
+
+    ///
+    /// Whether or not the time-elapsed queries are supported.
+    ///
+    bool timer_query = false;
+
+    ///
+    /// Whether or not the linked programs can be retrieved as binaries.
+    ///
+    bool program_binary = false;
+
+    ///
+    /// Whether or not the driver can compile the shaders in parallel through
+    /// \c GL_KHR_parallel_shader_compile.
+    ///
+    bool parallel_shader_compile_khr = false;
+
+    ///
+    /// Whether or not the driver can compile the shaders in parallel through
+    /// \c GL_ARB_parallel_shader_compile.
+    ///
+    bool parallel_shader_compile_arb = false;
+
+    ///
+    /// Checks whether or not the context supports the given extension.
+    ///
+    /// \param name the name of the extension, for example
+    /// \c GL_ARB_buffer_storage.
+    ///
+    /// \return \c true if the extension is supported, otherwise \c false.
+    ///
+    inline bool has_extension(const std::string& name) const
+    {
+      return 0 != extensions.count(name);
+    }
+
+    ///
+    /// Checks whether or not the version of the context is at least the given
+    /// version.
+    ///
+    /// \param major the major version.
+    /// \param minor the minor version.
+    ///
+    /// \return \c true if the version is at least the given one, otherwise
+    /// \c false.
+    ///
+    constexpr bool has_version(const int major, const int minor) const noexcept
+    {
+      return major < major_version ||
+          (major == major_version && minor <= minor_version);
+    }
+  };
+
+  ///
+  /// Queries the capabilities of the current OpenGL context.
+  ///
+  /// \return The capabilities.
+  ///
+  capabilities query_capabilities();
+
+  ///
+  /// Queries the capabilities of the current OpenGL context and stores them
+  /// as the snapshot given by \c get_capabilities. This should be called once
+  /// after the context is created and the functions are loaded.
+  ///
+  void load_capabilities();
+
+  ///
+  /// Gives the snapshot of the capabilities of the OpenGL context. Every
+  /// capability is off until \c load_capabilities is called.
+  ///
+  /// \return A reference to the capabilities.
+  ///
+  const capabilities& get_capabilities() noexcept;
+
+} // namespace ode::gl
+
+#endif // !ODE_GL_CAPABILITIES_H
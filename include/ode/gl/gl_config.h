@@ -46,6 +46,16 @@ namespace ode
   constexpr bool disable_gl_calls = false;
 #endif // !ODE_DISABLE_GL_CALLS
 
+  ///
+  /// The number of the frames for which the GPU timer queries are kept
+  /// before their results are read.
+  ///
+#ifdef ODE_GPU_TIMER_LATENCY
+  constexpr int gpu_timer_latency = ODE_GPU_TIMER_LATENCY;
+#else
+  constexpr int gpu_timer_latency = 3;
+#endif // !defined(ODE_GPU_TIMER_LATENCY)
+
   ///
   /// The minimum major version number of OpenGL that is required to use all
   /// features of the application.
@@ -0,0 +1,228 @@
+/// The declaration of the type of the timers which measure the GPU time of
+/// the rendering passes.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_GL_GPU_TIMER_H
+#define ODE_GL_GPU_TIMER_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "ode/__config"
+#include "ode/gl/gl_config.h"
+
+namespace ode::gl
+{
+  ///
+  /// The type of the objects which hold the GPU time of a rendering pass.
+  ///
+  struct gpu_pass_time final
+  {
+    ///
+    /// The name of the pass.
+    ///
+    std::string name;
+
+    ///
+    /// The time that the GPU spent in the pass.
+    ///
+    std::chrono::nanoseconds time;
+  };
+
+  ///
+  /// The type of the timers which measure the GPU time of the rendering
+  /// passes with \c GL_TIME_ELAPSED queries. The queries of each frame are
+  /// kept in a ring and read only after the given number of frames so that
+  /// reading them doesn't stall the pipeline, and thus the results lag
+  /// behind the current frame. The time queries need OpenGL 3.3 or
+  /// \c GL_ARB_timer_query, and without them the timer measures nothing.
+  ///
+  /// Only one pass can be measured at a time, so the passes can't be nested.
+  ///
+  class gpu_timer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c gpu_timer.
+    ///
+    /// \param latency the number of the frames after which the results of
+    /// the queries are read.
+    ///
+    explicit gpu_timer(
+        const std::size_t latency = gpu_timer_latency) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Constructs an object of the type \c gpu_timer by copying the given
+    /// object of the type \c gpu_timer.
+    ///
+    /// \param a a \c gpu_timer from which the new one is constructed.
+    ///
+    gpu_timer(const gpu_timer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c gpu_timer by moving the given
+    /// object of the type \c gpu_timer.
+    ///
+    /// \param a a \c gpu_timer from which the new one is constructed.
+    ///
+    gpu_timer(gpu_timer&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c gpu_timer and deletes its queries.
+    ///
+    ~gpu_timer();
+
+    ///
+    /// Assigns the given object of the type \c gpu_timer to this one by
+    /// copying.
+    ///
+    /// \param a a \c gpu_timer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    gpu_timer& operator=(const gpu_timer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c gpu_timer to this one by
+    /// moving.
+    ///
+    /// \param a a \c gpu_timer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    gpu_timer& operator=(gpu_timer&& a) = delete;
+
+    ///
+    /// Starts a new frame. The results of the oldest frame in the ring are
+    /// read if the GPU has finished it, and its queries are reused for the
+    /// new frame.
+    ///
+    void begin_frame();
+
+    ///
+    /// Starts measuring a pass. No other pass may be measured at the same
+    /// time.
+    ///
+    /// \param name the name of the pass.
+    ///
+    void begin(std::string_view name) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Stops measuring the current pass.
+    ///
+    void end() ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Tells whether or not the driver supports the time queries.
+    ///
+    /// \return A \c bool.
+    ///
+    inline bool is_supported() const noexcept
+    {
+      return supported;
+    }
+
+    ///
+    /// Gives the GPU times of the passes of the latest frame whose results
+    /// have been read.
+    ///
+    /// \return A reference to the pass times.
+    ///
+    inline const std::vector<gpu_pass_time>& get_passes() const noexcept
+    {
+      return passes;
+    }
+
+    ///
+    /// Gives the total GPU time of the passes of the latest frame whose
+    /// results have been read.
+    ///
+    /// \return The GPU time.
+    ///
+    std::chrono::nanoseconds get_frame_time() const noexcept;
+
+    ///
+    /// Gives the number of the frames whose results were not ready when they
+    /// were due to be read and were therefore dropped.
+    ///
+    /// \return The number of the dropped frames.
+    ///
+    inline std::size_t get_dropped_count() const noexcept
+    {
+      return dropped_count;
+    }
+
+  private:
+    ///
+    /// The type of the objects which hold the queries of a single frame.
+    ///
+    struct frame final
+    {
+      ///
+      /// The names of the passes.
+      ///
+      std::vector<std::string> names;
+
+      ///
+      /// The query objects, which are reused in the later frames.
+      ///
+      std::vector<GLuint> queries;
+
+      ///
+      /// The number of the queries used in the frame.
+      ///
+      std::size_t count = 0;
+    };
+
+    ///
+    /// Reads the results of the given frame.
+    ///
+    /// \param f the frame.
+    ///
+    /// \return Whether or not the results were available.
+    ///
+    bool read(const frame& f);
+
+    ///
+    /// The frames in the ring.
+    ///
+    std::vector<frame> frames;
+
+    ///
+    /// The index of the current frame.
+    ///
+    std::size_t current;
+
+    ///
+    /// The GPU times of the latest frame whose results have been read.
+    ///
+    std::vector<gpu_pass_time> passes;
+
+    ///
+    /// Whether or not a pass is being measured.
+    ///
+    bool active;
+
+    ///
+    /// Whether or not the driver supports the time queries.
+    ///
+    bool supported;
+
+    ///
+    /// The number of the frames whose results were dropped.
+    ///
+    std::size_t dropped_count;
+  };
+
+} // namespace ode::gl
+
+#endif // !ODE_GL_GPU_TIMER_H
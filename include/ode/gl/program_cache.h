@@ -0,0 +1,273 @@
+/// The declaration of the type of the caches which compile the shader
+/// programs and keep their binaries between the runs of the program.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_GL_PROGRAM_CACHE_H
+#define ODE_GL_PROGRAM_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace ode::gl
+{
+  ///
+  /// The type of the caches which compile and link the shader programs and
+  /// share them between their users. The programs are requested up front and
+  /// collected later, so the driver can compile them in parallel if it
+  /// supports \c GL_KHR_parallel_shader_compile or
+  /// \c GL_ARB_parallel_shader_compile.
+  ///
+  /// If the cache is given a directory and the driver supports program
+  /// binaries, the linked programs are written into the directory with
+  /// \c glGetProgramBinary. The binaries are keyed by the hash of the shader
+  /// sources and by the OpenGL renderer and version, and a binary that the
+  /// driver rejects is replaced by compiling the sources again.
+  ///
+  class program_cache final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c program_cache.
+    ///
+    /// \param directory the directory into which the program binaries are
+    /// written. The binaries aren't kept if the directory is empty.
+    ///
+    explicit program_cache(std::string directory = {});
+
+    ///
+    /// Constructs an object of the type \c program_cache by copying the given
+    /// object of the type \c program_cache.
+    ///
+    /// \param a a \c program_cache from which the new one is constructed.
+    ///
+    program_cache(const program_cache& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c program_cache by moving the given
+    /// object of the type \c program_cache.
+    ///
+    /// \param a a \c program_cache from which the new one is constructed.
+    ///
+    program_cache(program_cache&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c program_cache and deletes the
+    /// shader programs in it.
+    ///
+    ~program_cache();
+
+    ///
+    /// Assigns the given object of the type \c program_cache to this one by
+    /// copying.
+    ///
+    /// \param a a \c program_cache from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    program_cache& operator=(const program_cache& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c program_cache to this one by
+    /// moving.
+    ///
+    /// \param a a \c program_cache from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    program_cache& operator=(program_cache&& a) = delete;
+
+    ///
+    /// Requests the shader program made of the given shaders. The program is
+    /// loaded from its binary if there is a valid one, and otherwise the
+    /// driver starts compiling it. If the same sources have already been
+    /// requested, the earlier program is shared.
+    ///
+    /// \param vertex_source the source code of the vertex shader.
+    /// \param fragment_source the source code of the fragment shader.
+    /// \param attributes the names of the vertex attributes, which are bound
+    /// to the locations in the given order.
+    ///
+    /// \return The ID of the program in the cache.
+    ///
+    std::size_t request(
+        std::string_view vertex_source,
+        std::string_view fragment_source,
+        std::initializer_list<const char*> attributes = {});
+
+    ///
+    /// Tells whether or not the shader program with the given ID can be got
+    /// without waiting for the driver.
+    ///
+    /// \param id the ID of the program.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_ready(const std::size_t id) const;
+
+    ///
+    /// Gives the shader program with the given ID, waiting for the driver to
+    /// finish it if it is still being compiled. The binary of a newly
+    /// compiled program is written into the directory of the cache.
+    ///
+    /// \param id the ID of the program.
+    ///
+    /// \return The name of the shader program.
+    ///
+    /// \exception std::runtime_error Thrown if the shaders can't be compiled
+    /// or the program can't be linked.
+    ///
+    GLuint get(const std::size_t id);
+
+    ///
+    /// Tells whether or not the driver supports program binaries.
+    ///
+    /// \return A \c bool.
+    ///
+    inline bool has_binary_support() const noexcept
+    {
+      return binary_support;
+    }
+
+    ///
+    /// Gives the number of the shader programs in the cache.
+    ///
+    /// \return The number of the programs.
+    ///
+    inline std::size_t get_program_count() const noexcept
+    {
+      return entries.size();
+    }
+
+    ///
+    /// Gives the number of the shader programs that have been compiled from
+    /// their sources.
+    ///
+    /// \return The number of the compiled programs.
+    ///
+    inline std::size_t get_compile_count() const noexcept
+    {
+      return compile_count;
+    }
+
+    ///
+    /// Gives the number of the shader programs that have been loaded from
+    /// their binaries.
+    ///
+    /// \return The number of the loaded programs.
+    ///
+    inline std::size_t get_binary_count() const noexcept
+    {
+      return binary_count;
+    }
+
+  private:
+    ///
+    /// The states of the shader programs in the cache.
+    ///
+    enum class program_state
+    {
+      compiling,
+      ready,
+      failed
+    };
+
+    ///
+    /// The type of the objects which hold a shader program in the cache.
+    ///
+    struct entry final
+    {
+      ///
+      /// The hash of the sources of the program.
+      ///
+      std::uint64_t hash;
+
+      ///
+      /// The name of the shader program.
+      ///
+      GLuint program;
+
+      ///
+      /// The state of the program.
+      ///
+      program_state state;
+    };
+
+    ///
+    /// Gives the name of the file which holds the binary of the program with
+    /// the given hash.
+    ///
+    /// \param hash the hash of the sources of the program.
+    ///
+    /// \return The name of the file.
+    ///
+    std::string get_binary_filename(const std::uint64_t hash) const;
+
+    ///
+    /// Loads the shader program with the given hash from its binary.
+    ///
+    /// \param hash the hash of the sources of the program.
+    ///
+    /// \return The name of the shader program or \c 0 if there is no binary
+    /// or the driver rejects it.
+    ///
+    GLuint load_binary(const std::uint64_t hash) const;
+
+    ///
+    /// Writes the binary of the given shader program into the directory of
+    /// the cache.
+    ///
+    /// \param hash the hash of the sources of the program.
+    /// \param program the name of the shader program.
+    ///
+    void save_binary(const std::uint64_t hash, const GLuint program) const;
+
+    ///
+    /// The directory into which the program binaries are written.
+    ///
+    std::string directory;
+
+    ///
+    /// The OpenGL renderer and version with which the binaries are made.
+    ///
+    std::string driver;
+
+    ///
+    /// Whether or not the driver supports program binaries.
+    ///
+    bool binary_support;
+
+    ///
+    /// The shader programs in the cache.
+    ///
+    std::vector<entry> entries;
+
+    ///
+    /// The IDs of the shader programs by the hashes of their sources.
+    ///
+    std::unordered_map<std::uint64_t, std::size_t> ids;
+
+    ///
+    /// The number of the programs compiled from their sources.
+    ///
+    std::size_t compile_count;
+
+    ///
+    /// The number of the programs loaded from their binaries.
+    ///
+    std::size_t binary_count;
+  };
+
+} // namespace ode::gl
+
+#endif // !ODE_GL_PROGRAM_CACHE_H
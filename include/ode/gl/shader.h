@@ -0,0 +1,98 @@
+/// The declarations of the utility functions for compiling OpenGL shaders
+/// and linking shader programs.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_GL_SHADER_H
+#define ODE_GL_SHADER_H
+
+#include <initializer_list>
+
+#include <glad/glad.h>
+
+namespace ode::gl
+{
+  ///
+  /// Compiles a shader.
+  ///
+  /// \param type the type of the shader, for example \c GL_VERTEX_SHADER.
+  /// \param source the source code of the shader.
+  ///
+  /// \return The name of the shader.
+  ///
+  /// \exception std::runtime_error Thrown if the shader can't be compiled.
+  ///
+  GLuint compile_shader(const GLenum type, const char* source);
+
+  ///
+  /// Compiles the given shaders and links them into a shader program.
+  ///
+  /// \param vertex_source the source code of the vertex shader.
+  /// \param fragment_source the source code of the fragment shader.
+  /// \param attributes the names of the vertex attributes, which are bound
+  /// to the locations in the given order.
+  ///
+  /// \return The name of the shader program.
+  ///
+  /// \exception std::runtime_error Thrown if the shaders can't be compiled
+  /// or the program can't be linked.
+  ///
+  GLuint make_program(
+      const char* vertex_source,
+      const char* fragment_source,
+      std::initializer_list<const char*> attributes = {});
+
+  ///
+  /// Starts compiling the given shaders and linking them into a shader
+  /// program without waiting for the driver to finish. The status of the
+  /// shaders isn't queried, so the driver can compile them in the background
+  /// if it supports \c GL_KHR_parallel_shader_compile or
+  /// \c GL_ARB_parallel_shader_compile. The program must be passed to
+  /// \c finish_program before it is used.
+  ///
+  /// \param vertex_source the source code of the vertex shader.
+  /// \param fragment_source the source code of the fragment shader.
+  /// \param attributes the names of the vertex attributes, which are bound
+  /// to the locations in the given order.
+  /// \param retrievable whether or not the binary of the program is going to
+  /// be retrieved with \c glGetProgramBinary.
+  ///
+  /// \return The name of the shader program.
+  ///
+  GLuint begin_program(
+      const char* vertex_source,
+      const char* fragment_source,
+      std::initializer_list<const char*> attributes = {},
+      const bool retrievable = false);
+
+  ///
+  /// Tells whether or not the driver has finished compiling and linking the
+  /// given shader program. If the driver supports neither
+  /// \c GL_KHR_parallel_shader_compile nor
+  /// \c GL_ARB_parallel_shader_compile, the program is always reported as
+  /// complete.
+  ///
+  /// \param program the name of the shader program.
+  ///
+  /// \return A \c bool.
+  ///
+  bool is_program_complete(const GLuint program);
+
+  ///
+  /// Waits for the driver to finish the shader program started with
+  /// \c begin_program, checks that it was linked, and deletes its shaders.
+  /// The program is deleted if it can't be linked.
+  ///
+  /// \param program the name of the shader program.
+  ///
+  /// \exception std::runtime_error Thrown if the shaders can't be compiled
+  /// or the program can't be linked.
+  ///
+  void finish_program(const GLuint program);
+
+} // namespace ode::gl
+
+#endif // !ODE_GL_SHADER_H
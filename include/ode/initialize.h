@@ -8,8 +8,10 @@
 #ifndef ODE_INITIALIZE_H
 #define ODE_INITIALIZE_H
 
+#include <glad/glad.h>
+
 #include "ode/execution_info.h"
-#include "ode/gl/data.h"
+#include "ode/gl/capabilities.h"
 #include "ode/logger.h"
 #include "ode/sdl/opengl.h"
 #include "ode/window_t.h"
@@ -48,12 +50,8 @@ namespace ode
     auto context = sdl::create_gl_context(window);
 
     ODE_DEBUG("OpenGL is loaded");
-    ODE_DEBUG("The OpenGL vendor is {}", gl::get_vendor());
-    ODE_DEBUG("The OpenGL renderer is {}", gl::get_renderer());
-    ODE_DEBUG("The OpenGL version is {}", gl::get_version());
-    ODE_DEBUG(
-        "The OpenGL shading language version is {}",
-        gl::get_shading_language_version());
+
+    gl::load_capabilities();
 
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
@@ -0,0 +1,169 @@
+/// The declaration of the service which executes Lua workloads in isolated
+/// Lua states on worker threads.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_LUA_EXECUTION_SERVICE_H
+#define ODE_LUA_EXECUTION_SERVICE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ode/lua/state_t.h"
+
+namespace ode::lua
+{
+  ///
+  /// The type of the service which shards independent Lua workloads across a
+  /// number of isolated Lua states. Each of the states is owned by a worker
+  /// thread of its own, and the jobs submitted to a shard are always executed
+  /// in order on the state of that shard. The states never share tables, and
+  /// data between them should be moved by using objects of the type
+  /// \c message_queue.
+  ///
+  class execution_service final
+  {
+  public:
+    ///
+    /// The type of the jobs which are executed by the service.
+    ///
+    using job_t = std::function<void(const state_ptr_t)>;
+
+    ///
+    /// The type of the functions which are used to initialize the Lua state
+    /// of each shard on its worker thread.
+    ///
+    using initializer_t = std::function<void(const state_ptr_t)>;
+
+    ///
+    /// Constructs an object of the type \c execution_service and starts the
+    /// worker threads.
+    ///
+    /// \param shard_count the number of the Lua states and worker threads. If
+    /// zero is given, the number of the hardware threads is used.
+    /// \param initializer the function which is called for each new Lua state
+    /// on its worker thread before any jobs are executed. If empty, the
+    /// standard libraries are opened.
+    ///
+    explicit execution_service(
+        std::size_t shard_count = 0, initializer_t initializer = {});
+
+    ///
+    /// Constructs an object of the type \c execution_service by copying the
+    /// given object of the type \c execution_service.
+    ///
+    /// \param a an \c execution_service from which the new one is
+    /// constructed.
+    ///
+    execution_service(const execution_service& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c execution_service by moving the
+    /// given object of the type \c execution_service.
+    ///
+    /// \param a an \c execution_service from which the new one is
+    /// constructed.
+    ///
+    execution_service(execution_service&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c execution_service. The jobs which
+    /// are already submitted are finished before the worker threads are
+    /// joined.
+    ///
+    ~execution_service();
+
+    ///
+    /// Assigns the given object of the type \c execution_service to this one
+    /// by copying.
+    ///
+    /// \param a an \c execution_service from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    execution_service& operator=(const execution_service& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c execution_service to this one
+    /// by moving.
+    ///
+    /// \param a an \c execution_service from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    execution_service& operator=(execution_service&& a) = delete;
+
+    ///
+    /// Submits the given job to be executed on the Lua state of the given
+    /// shard.
+    ///
+    /// \param shard the index of the shard. The index is wrapped around the
+    /// number of the shards so that, for example, entity or region
+    /// identifiers can be used directly.
+    /// \param job the job.
+    ///
+    void submit(std::size_t shard, job_t job);
+
+    ///
+    /// Submits the given job to be executed once on the Lua state of every
+    /// shard.
+    ///
+    /// \param job the job.
+    ///
+    void broadcast(const job_t& job);
+
+    ///
+    /// Blocks until all of the submitted jobs are executed.
+    ///
+    void wait();
+
+    ///
+    /// Gives the number of the shards in the service.
+    ///
+    /// \return The number of the shards.
+    ///
+    std::size_t get_shard_count() const noexcept;
+
+  private:
+    ///
+    /// The type of the worker which owns a thread and a Lua state.
+    ///
+    class worker;
+
+    ///
+    /// Marks a job as finished and wakes up the threads waiting for the jobs.
+    ///
+    void finish_job();
+
+    ///
+    /// The workers of the service.
+    ///
+    std::vector<std::unique_ptr<worker>> workers;
+
+    ///
+    /// The mutex which guards the number of the unfinished jobs.
+    ///
+    std::mutex pending_mutex;
+
+    ///
+    /// The condition variable which signals that all of the jobs are
+    /// finished.
+    ///
+    std::condition_variable pending_condition;
+
+    ///
+    /// The number of the jobs which are submitted but not yet finished.
+    ///
+    std::size_t pending_jobs;
+  };
+
+} // namespace ode::lua
+
+#endif // !ODE_LUA_EXECUTION_SERVICE_H
@@ -0,0 +1,168 @@
+/// The declaration of the pacer which runs the garbage collection of Lua
+/// states in bounded increments.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_LUA_GARBAGE_COLLECTOR_H
+#define ODE_LUA_GARBAGE_COLLECTOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "ode/lua/state_t.h"
+
+namespace ode::lua
+{
+  ///
+  /// The type of the objects which describe the garbage-collection work done
+  /// during a single frame.
+  ///
+  struct gc_statistics final
+  {
+    ///
+    /// The time spent in the garbage collection.
+    ///
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+
+    ///
+    /// The number of the incremental steps run.
+    ///
+    int steps = 0;
+
+    ///
+    /// The number of the garbage-collection cycles finished.
+    ///
+    int cycles = 0;
+  };
+
+  ///
+  /// The type of the object which takes over the garbage collection of the
+  /// attached Lua states. The automatic collector of each attached state is
+  /// stopped, and the collection is instead run in bounded incremental steps
+  /// during the idle time of the frames so that the collection pauses don't
+  /// land in the middle of the frames.
+  ///
+  /// The Lua states must only be used on the thread that runs the steps.
+  ///
+  class garbage_collector final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c garbage_collector.
+    ///
+    garbage_collector();
+
+    ///
+    /// Constructs an object of the type \c garbage_collector by copying the
+    /// given object of the type \c garbage_collector.
+    ///
+    /// \param a a \c garbage_collector from which the new one is constructed.
+    ///
+    garbage_collector(const garbage_collector& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c garbage_collector by moving the
+    /// given object of the type \c garbage_collector.
+    ///
+    /// \param a a \c garbage_collector from which the new one is constructed.
+    ///
+    garbage_collector(garbage_collector&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c garbage_collector.
+    ///
+    ~garbage_collector() = default;
+
+    ///
+    /// Assigns the given object of the type \c garbage_collector to this one
+    /// by copying.
+    ///
+    /// \param a a \c garbage_collector from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    garbage_collector& operator=(const garbage_collector& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c garbage_collector to this one
+    /// by moving.
+    ///
+    /// \param a a \c garbage_collector from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    garbage_collector& operator=(garbage_collector&& a) = default;
+
+    ///
+    /// Stops the automatic garbage collection of the given Lua state and
+    /// makes this collector responsible for it.
+    ///
+    /// \param state the Lua state.
+    ///
+    void attach(const state_ptr_t state);
+
+    ///
+    /// Gives the garbage collection of the given Lua state back to its
+    /// automatic collector.
+    ///
+    /// \param state the Lua state.
+    ///
+    void detach(const state_ptr_t state);
+
+    ///
+    /// Runs incremental garbage-collection steps on the attached Lua states in
+    /// turns until the given time budget is used. A state is no longer
+    /// stepped during the call once it finishes a cycle, and the states which
+    /// haven't grown since their latest cycle aren't stepped at all, so the
+    /// function returns early when no state has anything more to collect.
+    /// Otherwise at least \c gc_minimum_steps steps are run regardless of the
+    /// budget.
+    ///
+    /// \param budget the time which may be used for the collection.
+    ///
+    /// \return The statistics of the collection work done.
+    ///
+    gc_statistics step(std::chrono::nanoseconds budget) noexcept;
+
+    ///
+    /// Gives the number of the attached Lua states.
+    ///
+    /// \return The number of the states.
+    ///
+    inline std::size_t get_state_count() const noexcept
+    {
+      return states.size();
+    }
+
+  private:
+    ///
+    /// The attached Lua states.
+    ///
+    std::vector<lua_State*> states;
+
+    ///
+    /// The memory in use, in kilobytes, by each of the attached Lua states
+    /// after its latest finished cycle, or -1 if the state is in the middle of
+    /// a cycle.
+    ///
+    std::vector<int> collected_sizes;
+
+    ///
+    /// Whether or not each of the attached Lua states is done during the
+    /// current step.
+    ///
+    std::vector<bool> completed;
+
+    ///
+    /// The index of the state on which the next step is run.
+    ///
+    std::size_t cursor;
+  };
+
+} // namespace ode::lua
+
+#endif // !ODE_LUA_GARBAGE_COLLECTOR_H
@@ -15,6 +15,37 @@ namespace ode::lua
   ///
   constexpr int stack_top = -1;
 
+  ///
+  /// The amount of work, in kilobytes of allocation, which a single
+  /// incremental garbage-collection step of a Lua state performs.
+  ///
+#ifdef ODE_LUA_GC_STEP_SIZE
+  constexpr int gc_step_size = ODE_LUA_GC_STEP_SIZE;
+#else
+  constexpr int gc_step_size = 16;
+#endif // !defined(ODE_LUA_GC_STEP_SIZE)
+
+  ///
+  /// The number of incremental garbage-collection steps which are run on
+  /// every frame even if there is no idle time left. This keeps the memory of
+  /// the Lua states bounded when the frames are over budget.
+  ///
+#ifdef ODE_LUA_GC_MINIMUM_STEPS
+  constexpr int gc_minimum_steps = ODE_LUA_GC_MINIMUM_STEPS;
+#else
+  constexpr int gc_minimum_steps = 1;
+#endif // !defined(ODE_LUA_GC_MINIMUM_STEPS)
+
+  ///
+  /// The interval, in milliseconds, in which the script-reloading service
+  /// checks the changes in the watched Lua scripts.
+  ///
+#ifdef ODE_LUA_RELOAD_POLL_INTERVAL
+  constexpr int reload_poll_interval = ODE_LUA_RELOAD_POLL_INTERVAL;
+#else
+  constexpr int reload_poll_interval = 100;
+#endif // !defined(ODE_LUA_RELOAD_POLL_INTERVAL)
+
 } // namespace ode::lua
 
 #endif // !ODE_LUA_LUA_CONFIG_H
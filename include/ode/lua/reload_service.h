@@ -0,0 +1,207 @@
+/// The declaration of the service which reloads changed Lua scripts while the
+/// program runs.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_LUA_RELOAD_SERVICE_H
+#define ODE_LUA_RELOAD_SERVICE_H
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ode/framework/message_queue.h"
+#include "ode/lua/state_t.h"
+
+namespace ode::lua
+{
+  ///
+  /// The type of the service which reloads the Lua scripts that change on
+  /// disk into the Lua states that have loaded them. A worker thread watches
+  /// the tracked scripts and compiles the changed ones into bytecode, and the
+  /// compiled chunks are run in the Lua states only when \c apply is called
+  /// so that the states change at a tick boundary. Only the changed scripts
+  /// are reloaded, and a script that fails to compile or run is reported
+  /// without affecting the states.
+  ///
+  /// The service can also watch a whole script directory so that the
+  /// modules which the tracked states have loaded with \c require are
+  /// reloaded too, including the modules created after the directory was
+  /// given to the service.
+  ///
+  /// The worker thread is started when the first script or directory is
+  /// given to the service.
+  ///
+  class reload_service final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c reload_service.
+    ///
+    reload_service();
+
+    ///
+    /// Constructs an object of the type \c reload_service by copying the given
+    /// object of the type \c reload_service.
+    ///
+    /// \param a a \c reload_service from which the new one is constructed.
+    ///
+    reload_service(const reload_service& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c reload_service by moving the given
+    /// object of the type \c reload_service.
+    ///
+    /// \param a a \c reload_service from which the new one is constructed.
+    ///
+    reload_service(reload_service&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c reload_service and stops the worker
+    /// thread.
+    ///
+    ~reload_service();
+
+    ///
+    /// Assigns the given object of the type \c reload_service to this one by
+    /// copying.
+    ///
+    /// \param a a \c reload_service from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    reload_service& operator=(const reload_service& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c reload_service to this one by
+    /// moving.
+    ///
+    /// \param a a \c reload_service from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    reload_service& operator=(reload_service&& a) = delete;
+
+    ///
+    /// Marks the given script as loaded into the given Lua state so that the
+    /// script is reloaded into the state when it changes. The script is
+    /// compared against its contents at the time of this call, so it should
+    /// be called right after the script is loaded.
+    ///
+    /// \param state the Lua state.
+    /// \param filename the name of the script file.
+    ///
+    void track(const state_ptr_t state, std::string_view filename);
+
+    ///
+    /// Stops reloading any scripts into the given Lua state. This must be
+    /// called before the state is closed.
+    ///
+    /// \param state the Lua state.
+    ///
+    void untrack(const state_ptr_t state);
+
+    ///
+    /// Starts watching the scripts in the given directory and in its
+    /// subdirectories. When one of them changes, it's reloaded into the
+    /// tracked states in which \c package.loaded has a module that
+    /// \c package.searchpath resolves to the script, and the module is
+    /// updated in place if both the old and the new module are tables.
+    ///
+    /// \param root the name of the directory.
+    ///
+    void watch(std::string_view root);
+
+    ///
+    /// Runs the scripts that have been recompiled since the last call in the
+    /// Lua states which have loaded them.
+    ///
+    /// \return The number of the scripts reloaded into at least one state.
+    ///
+    std::size_t apply();
+
+  private:
+    ///
+    /// The type of the objects which hold a script sent to the worker to be
+    /// watched.
+    ///
+    struct tracked_script final
+    {
+      ///
+      /// The name of the script file.
+      ///
+      std::string filename;
+
+      ///
+      /// The hash of the contents of the script when it was tracked.
+      ///
+      std::size_t hash;
+    };
+
+    ///
+    /// The type of the objects which hold a compiled script.
+    ///
+    struct compiled_script final
+    {
+      ///
+      /// The name of the script file.
+      ///
+      std::string filename;
+
+      ///
+      /// The bytecode of the script.
+      ///
+      std::string bytecode;
+    };
+
+    ///
+    /// Starts the worker thread unless it's already running.
+    ///
+    void start();
+
+    ///
+    /// Runs the worker which watches and compiles the scripts.
+    ///
+    void run();
+
+    ///
+    /// The scripts which are sent to the worker to be watched.
+    ///
+    message_queue<tracked_script> requests;
+
+    ///
+    /// The directories which are sent to the worker to be watched.
+    ///
+    message_queue<std::string> roots;
+
+    ///
+    /// The scripts which the worker has compiled.
+    ///
+    message_queue<compiled_script> compiled;
+
+    ///
+    /// The Lua states into which each of the scripts is loaded.
+    ///
+    std::unordered_map<std::string, std::vector<lua_State*>> modules;
+
+    ///
+    /// Whether or not the worker thread should keep running.
+    ///
+    std::atomic<bool> running;
+
+    ///
+    /// The worker thread.
+    ///
+    std::thread worker;
+  };
+
+} // namespace ode::lua
+
+#endif // !ODE_LUA_RELOAD_SERVICE_H
@@ -0,0 +1,194 @@
+/// The declarations of the types which hold either the result of a Lua
+/// operation or the error that it produced.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_LUA_RESULT_H
+#define ODE_LUA_RESULT_H
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include "gsl/assert"
+
+#include "ode/__config"
+
+namespace ode::lua
+{
+  ///
+  /// The type of the objects which describe an error produced by a Lua
+  /// operation.
+  ///
+  struct error final
+  {
+    ///
+    /// The status code given by the Lua API, for example \c LUA_ERRRUN.
+    ///
+    int code;
+
+    ///
+    /// The error message, including the stack traceback if the error was
+    /// raised while running Lua code.
+    ///
+    std::string message;
+  };
+
+  ///
+  /// The type of the objects which hold either the value produced by a Lua
+  /// operation or the error that occurred during it.
+  ///
+  /// \tparam T the type of the value.
+  ///
+  template <typename T> class result final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c result which holds the given
+    /// value.
+    ///
+    /// \param t the value.
+    ///
+    result(T t) : content{std::in_place_index<0>, std::move(t)}
+    {
+    }
+
+    ///
+    /// Constructs an object of the type \c result which holds the given
+    /// error.
+    ///
+    /// \param e the error.
+    ///
+    result(error e) : content{std::in_place_index<1>, std::move(e)}
+    {
+    }
+
+    ///
+    /// Tells whether or not the object holds a value.
+    ///
+    /// \return A \c bool.
+    ///
+    inline bool has_value() const noexcept
+    {
+      return 0 == content.index();
+    }
+
+    ///
+    /// Tells whether or not the object holds a value.
+    ///
+    /// \return A \c bool.
+    ///
+    inline explicit operator bool() const noexcept
+    {
+      return has_value();
+    }
+
+    ///
+    /// Gives the value held by the object. The object must hold a value.
+    ///
+    /// \return A reference to the value.
+    ///
+    inline const T& get_value() const ODE_CONTRACT_NOEXCEPT
+    {
+      Expects(has_value());
+      return *std::get_if<0>(&content);
+    }
+
+    ///
+    /// Gives the value held by the object or the given value if the object
+    /// holds an error.
+    ///
+    /// \param t the value to use if the object holds an error.
+    ///
+    /// \return The value.
+    ///
+    inline T get_value_or(T t) const
+    {
+      return has_value() ? *std::get_if<0>(&content) : std::move(t);
+    }
+
+    ///
+    /// Gives the error held by the object. The object must hold an error.
+    ///
+    /// \return A reference to the error.
+    ///
+    inline const error& get_error() const ODE_CONTRACT_NOEXCEPT
+    {
+      Expects(!has_value());
+      return *std::get_if<1>(&content);
+    }
+
+  private:
+    ///
+    /// The value or the error.
+    ///
+    std::variant<T, error> content;
+  };
+
+  ///
+  /// The type of the objects which hold the error that occurred during a Lua
+  /// operation that produces no value.
+  ///
+  template <> class result<void> final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c result which holds no error.
+    ///
+    result() = default;
+
+    ///
+    /// Constructs an object of the type \c result which holds the given
+    /// error.
+    ///
+    /// \param e the error.
+    ///
+    result(error e) : content{std::move(e)}
+    {
+    }
+
+    ///
+    /// Tells whether or not the operation succeeded.
+    ///
+    /// \return A \c bool.
+    ///
+    inline bool has_value() const noexcept
+    {
+      return !content.has_value();
+    }
+
+    ///
+    /// Tells whether or not the operation succeeded.
+    ///
+    /// \return A \c bool.
+    ///
+    inline explicit operator bool() const noexcept
+    {
+      return has_value();
+    }
+
+    ///
+    /// Gives the error held by the object. The object must hold an error.
+    ///
+    /// \return A reference to the error.
+    ///
+    inline const error& get_error() const ODE_CONTRACT_NOEXCEPT
+    {
+      Expects(!has_value());
+      return *content;
+    }
+
+  private:
+    ///
+    /// The error, if any.
+    ///
+    std::optional<error> content;
+  };
+
+} // namespace ode::lua
+
+#endif // !ODE_LUA_RESULT_H
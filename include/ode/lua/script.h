@@ -8,9 +8,11 @@
 #ifndef ODE_LUA_SCRIPT_H
 #define ODE_LUA_SCRIPT_H
 
+#include <string>
 #include <string_view>
 
 #include "ode/__config"
+#include "ode/lua/result.h"
 #include "ode/lua/state_t.h"
 
 namespace ode::lua
@@ -26,6 +28,48 @@ namespace ode::lua
   int load_script_file(const state_ptr_t state, std::string_view filename)
       ODE_CONTRACT_NOEXCEPT;
 
+  ///
+  /// Loads a Lua script from the given file without asserting that the
+  /// loading succeeds. The script is run in protected mode, and the stack of
+  /// the Lua state is left as it was.
+  ///
+  /// \param state the Lua state.
+  /// \param filename the name of the file.
+  ///
+  /// \return An object of the type \c result which holds the error if the
+  /// script can't be loaded or run.
+  ///
+  result<void> try_load_script_file(
+      const state_ptr_t state, std::string_view filename);
+
+  ///
+  /// Compiles a Lua script from the given file into bytecode in a Lua state
+  /// of its own. The function doesn't touch any existing Lua state, so it
+  /// may be called on any thread.
+  ///
+  /// \param filename the name of the file.
+  ///
+  /// \return An object of the type \c result which holds the bytecode or the
+  /// error if the script can't be compiled.
+  ///
+  result<std::string> compile_script_file(std::string_view filename);
+
+  ///
+  /// Runs a Lua chunk which is compiled into bytecode. The chunk is run in
+  /// protected mode, and the stack of the Lua state is left as it was.
+  ///
+  /// \param state the Lua state.
+  /// \param bytecode the compiled chunk.
+  /// \param chunkname the name of the chunk used in the error messages.
+  ///
+  /// \return An object of the type \c result which holds the error if the
+  /// chunk can't be loaded or run.
+  ///
+  result<void> try_load_bytecode(
+      const state_ptr_t state,
+      std::string_view bytecode,
+      std::string_view chunkname);
+
 } // namespace ode::lua
 
 #endif // !ODE_LUA_SCRIPT_H
@@ -0,0 +1,101 @@
+/// The declaration of the type of the scene configurations which keep their
+/// data in a Lua state.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_LUA_SCRIPTED_SCENE_H
+#define ODE_LUA_SCRIPTED_SCENE_H
+
+#include <string>
+
+#include <lua.hpp>
+
+namespace ode::lua
+{
+  ///
+  /// The type of the objects which give the engine the Lua state of a scene.
+  /// A scene configuration which loads its data from Lua derives from this
+  /// type in addition to \c scene_configuration, and the engine hands the
+  /// state and the script to its Lua services while the scene runs. The
+  /// generic scene types don't depend on Lua.
+  ///
+  class scripted_scene
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c scripted_scene.
+    ///
+    scripted_scene() = default;
+
+    ///
+    /// Constructs an object of the type \c scripted_scene by copying the
+    /// given object of the type \c scripted_scene.
+    ///
+    /// \param a a \c scripted_scene from which the new one is constructed.
+    ///
+    scripted_scene(const scripted_scene& a) = default;
+
+    ///
+    /// Constructs an object of the type \c scripted_scene by moving the given
+    /// object of the type \c scripted_scene.
+    ///
+    /// \param a a \c scripted_scene from which the new one is constructed.
+    ///
+    scripted_scene(scripted_scene&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c scripted_scene.
+    ///
+    virtual ~scripted_scene() = default;
+
+    ///
+    /// Assigns the given object of the type \c scripted_scene to this one by
+    /// copying.
+    ///
+    /// \param a a \c scripted_scene from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    scripted_scene& operator=(const scripted_scene& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c scripted_scene to this one by
+    /// moving.
+    ///
+    /// \param a a \c scripted_scene from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    scripted_scene& operator=(scripted_scene&& a) = default;
+
+    ///
+    /// Gives the Lua state into which the scene has loaded its data. The
+    /// state must live as long as the scene.
+    ///
+    /// \return A pointer to the Lua state.
+    ///
+    virtual lua_State* get_lua_state() const noexcept = 0;
+
+    ///
+    /// Gives the name of the script file which the scene has loaded into its
+    /// Lua state.
+    ///
+    /// \return The name of the script file.
+    ///
+    virtual std::string get_script_file() const = 0;
+
+    ///
+    /// Gives the name of the directory from which the scene loads the
+    /// modules required by its script.
+    ///
+    /// \return The name of the script directory.
+    ///
+    virtual std::string get_script_root() const = 0;
+  };
+
+} // namespace ode::lua
+
+#endif // !ODE_LUA_SCRIPTED_SCENE_H
@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "ode/__config"
+#include "ode/lua/result.h"
 #include "ode/lua/state_t.h"
 
 namespace ode::lua
@@ -29,6 +30,21 @@ namespace ode::lua
   bool to_stack(const state_ptr_t state, std::string_view var)
       ODE_CONTRACT_NOEXCEPT;
 
+  ///
+  /// Puts a Lua variable to the top of the Lua stack without asserting that
+  /// the variable exists. The path is looked up in protected mode, so an
+  /// error raised by an \c __index metamethod on the path is returned
+  /// instead of aborting. If the variable or any of the tables on its path
+  /// is missing, or the lookup fails, the stack is left as it was.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param var the name of the variable to put to the top of the stack.
+  ///
+  /// \return An object of the type \c result which holds the error if the
+  /// variable wasn't put to the top of the stack.
+  ///
+  result<void> try_to_stack(const state_ptr_t state, std::string_view var);
+
   namespace detail
   {
     inline void push(const state_ptr_t state, bool b) noexcept
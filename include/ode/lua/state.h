@@ -8,6 +8,7 @@
 #ifndef ODE_LUA_STATE_H
 #define ODE_LUA_STATE_H
 
+#include "ode/lua/result.h"
 #include "ode/lua/state_t.h"
 
 namespace ode::lua
@@ -26,6 +27,29 @@ namespace ode::lua
   ///
   void clean(const state_ptr_t state) noexcept;
 
+  ///
+  /// Adds the stack traceback to the error message on the top of the stack of
+  /// the given Lua state. This is the message handler which is given to
+  /// \c lua_pcall by the protected calls. It's a plain C function, so pushing
+  /// it to the stack doesn't allocate any memory.
+  ///
+  /// \param state the Lua state.
+  ///
+  /// \return The number of the values returned to Lua.
+  ///
+  int message_handler(lua_State* state);
+
+  ///
+  /// Creates an error object from the error message on the top of the stack
+  /// of the given Lua state. The message is not popped.
+  ///
+  /// \param state the Lua state.
+  /// \param code the status code given by the Lua API.
+  ///
+  /// \return An object of the type \c error.
+  ///
+  error make_error(const state_ptr_t state, const int code);
+
 } // namespace ode::lua
 
 #endif // !ODE_LUA_STATE_H
@@ -0,0 +1,67 @@
+/// The declaration of the Lua userdata traits of the tile layers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_LUA_TILE_LAYER_USERDATA_H
+#define ODE_LUA_TILE_LAYER_USERDATA_H
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include <lua.hpp>
+
+#include "ode/lua/userdata.h"
+#include "ode/systems/graphics/tile_layer.h"
+
+namespace ode::lua
+{
+  namespace detail
+  {
+    inline void check_tile(const tile_layer& layer, const int x, const int y)
+    {
+      if (0 > x || layer.get_width() <= x || 0 > y || layer.get_height() <= y)
+      {
+        throw std::out_of_range{"The tile is outside of the layer"};
+      }
+    }
+
+    inline std::uint32_t get_tile(
+        const tile_layer& layer, const int x, const int y)
+    {
+      check_tile(layer, x, y);
+      return layer.get(x, y);
+    }
+
+    inline void set_tile(
+        tile_layer& layer, const int x, const int y, const std::uint32_t gid)
+    {
+      check_tile(layer, x, y);
+      layer.set(x, y, gid);
+    }
+  } // namespace detail
+
+  ///
+  /// The traits which expose the tile layers to Lua so that the scripts can
+  /// read and change the tiles of a map in place. The coordinates outside of
+  /// the layer are raised as Lua errors instead of violating the contracts
+  /// of \c tile_layer.
+  ///
+  template <> struct userdata_traits<tile_layer>
+  {
+    static constexpr const char* name = "tile_layer";
+
+    static constexpr std::array methods{
+        luaL_Reg{"new", &construct<tile_layer, int, int>},
+        luaL_Reg{"get_width", &bind<&tile_layer::get_width>},
+        luaL_Reg{"get_height", &bind<&tile_layer::get_height>},
+        luaL_Reg{"get", &bind<&detail::get_tile>},
+        luaL_Reg{"set", &bind<&detail::set_tile>}};
+  };
+
+} // namespace ode::lua
+
+#endif // !ODE_LUA_TILE_LAYER_USERDATA_H
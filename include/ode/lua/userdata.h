@@ -0,0 +1,617 @@
+/// The declarations of the utilities for exposing C++ objects to Lua as
+/// userdata.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_LUA_USERDATA_H
+#define ODE_LUA_USERDATA_H
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ode/lua/lua_config.h"
+#include "ode/lua/state_t.h"
+
+namespace ode::lua
+{
+  ///
+  /// The type of the traits which describe how objects of the type \c T are
+  /// exposed to Lua. The template must be specialized for each exposed type,
+  /// and the specialization must have a static member \c name, which is the
+  /// name of the type in Lua, and a static \c constexpr array \c methods of
+  /// \c luaL_Reg objects, which are usually created by using \c bind.
+  ///
+  /// \tparam T the exposed type.
+  ///
+  template <typename T> struct userdata_traits;
+
+  ///
+  /// Tells whether or not objects of the type \c T are exposed to Lua.
+  ///
+  /// \tparam T the type.
+  ///
+  template <typename T, typename = void> struct is_userdata : std::false_type
+  {
+  };
+
+  template <typename T>
+  struct is_userdata<T, std::void_t<decltype(userdata_traits<T>::name)>>
+      : std::true_type
+  {
+  };
+
+  template <typename T> inline constexpr bool is_userdata_v =
+      is_userdata<T>::value;
+
+  namespace detail
+  {
+    template <typename T> struct userdata_header final
+    {
+      T* object;
+      bool owned;
+    };
+
+    // Only the address of the key is used. The address identifies the cached
+    // metatable of the type in the registry of the Lua state.
+    template <typename T> inline char metatable_key = 0;
+
+    template <typename T> int collect_userdata(lua_State* state)
+    {
+      auto* header =
+          static_cast<userdata_header<T>*>(lua_touserdata(state, 1));
+
+      if (nullptr != header && header->owned && nullptr != header->object)
+      {
+        header->object->~T();
+        header->object = nullptr;
+      }
+
+      return 0;
+    }
+
+    template <typename T> void push_metatable(lua_State* state)
+    {
+      if (LUA_TTABLE ==
+          lua_rawgetp(state, LUA_REGISTRYINDEX, &metatable_key<T>))
+      {
+        return;
+      }
+
+      lua_pop(state, 1);
+
+      using traits = userdata_traits<T>;
+
+      lua_createtable(state, 0, 3);
+      lua_createtable(state, 0, static_cast<int>(traits::methods.size()));
+
+      for (const auto& method : traits::methods)
+      {
+        lua_pushcfunction(state, method.func);
+        lua_setfield(state, stack_top - 1, method.name);
+      }
+
+      // The methods are looked up from a plain table so that the lookups
+      // don't need to call back to C++.
+      lua_setfield(state, stack_top - 1, "__index");
+
+      lua_pushcfunction(state, &collect_userdata<T>);
+      lua_setfield(state, stack_top - 1, "__gc");
+
+      lua_pushstring(state, traits::name);
+      lua_setfield(state, stack_top - 1, "__name");
+
+      lua_pushvalue(state, stack_top);
+      lua_rawsetp(state, LUA_REGISTRYINDEX, &metatable_key<T>);
+    }
+  } // namespace detail
+
+  ///
+  /// Gives a pointer to the object of the type \c T which is held by the
+  /// userdata at the given index of the stack.
+  ///
+  /// \tparam T the type of the object.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param index the index of the userdata.
+  ///
+  /// \return A pointer to the object or \c nullptr if the value at the index
+  /// is not userdata of the type \c T.
+  ///
+  template <typename T>
+  T* to_userdata(const state_ptr_t state, const int index)
+  {
+    auto* header =
+        static_cast<detail::userdata_header<T>*>(lua_touserdata(state, index));
+
+    if (nullptr == header || 0 == lua_getmetatable(state, index))
+    {
+      return nullptr;
+    }
+
+    detail::push_metatable<T>(state);
+
+    const bool matches = 1 == lua_rawequal(state, stack_top, stack_top - 1);
+
+    lua_pop(state, 2);
+
+    return matches ? header->object : nullptr;
+  }
+
+  ///
+  /// Constructs an object of the type \c T in a new full userdata which is
+  /// pushed to the stack. The object is owned by Lua and destructed when the
+  /// userdata is collected.
+  ///
+  /// \tparam T the type of the object.
+  /// \tparam Args the types of the constructor parameters.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param args the constructor parameters.
+  ///
+  /// \return A reference to the new object.
+  ///
+  template <typename T, typename... Args>
+  T& emplace_userdata(const state_ptr_t state, Args&&... args)
+  {
+    using U = std::remove_cv_t<T>;
+
+    static_assert(is_userdata_v<U>, "The type is not exposed to Lua");
+
+    using header_t = detail::userdata_header<U>;
+
+    constexpr std::size_t space = alignof(U) - 1 + sizeof(U);
+
+    void* memory = lua_newuserdata(state, sizeof(header_t) + space);
+    auto* header = new (memory) header_t{nullptr, true};
+
+    // The metatable is set before the object is constructed so that the
+    // collection of the userdata is safe even if the constructor throws.
+    detail::push_metatable<U>(state);
+    lua_setmetatable(state, stack_top - 1);
+
+    void* storage = static_cast<char*>(memory) + sizeof(header_t);
+    std::size_t remaining = space;
+    std::align(alignof(U), sizeof(U), storage, remaining);
+
+    header->object = new (storage) U(std::forward<Args>(args)...);
+
+    return *header->object;
+  }
+
+  ///
+  /// Pushes a copy of the given object to the stack as a full userdata.
+  ///
+  /// \tparam T the type of the object.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param t the object.
+  ///
+  template <typename T>
+  void push_userdata(const state_ptr_t state, T&& t)
+  {
+    emplace_userdata<std::remove_cv_t<std::remove_reference_t<T>>>(
+        state, std::forward<T>(t));
+  }
+
+  ///
+  /// Pushes a reference to the given object to the stack. The object is not
+  /// owned by Lua, and it must outlive all of the uses of the reference in
+  /// Lua. The reference is stored in a small full userdata so that it has
+  /// the metatable of the type \c T. If the pointer is \c nullptr, \c nil is
+  /// pushed. Lua doesn't keep the constness of the object, so the methods
+  /// that modify the object must not be called on a reference to a constant
+  /// object.
+  ///
+  /// \tparam T the type of the object.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param t a pointer to the object.
+  ///
+  template <typename T>
+  void push_reference(const state_ptr_t state, T* const t)
+  {
+    using U = std::remove_cv_t<T>;
+
+    static_assert(is_userdata_v<U>, "The type is not exposed to Lua");
+
+    if (nullptr == t)
+    {
+      lua_pushnil(state);
+      return;
+    }
+
+    using header_t = detail::userdata_header<U>;
+
+    void* memory = lua_newuserdata(state, sizeof(header_t));
+    new (memory) header_t{const_cast<U*>(t), false};
+
+    detail::push_metatable<U>(state);
+    lua_setmetatable(state, stack_top - 1);
+  }
+
+  ///
+  /// Pushes the given pointer to the stack as a light userdata. Light
+  /// userdata have no metatable and no methods, and they are meant for
+  /// opaque handles which are only passed back to C++.
+  ///
+  /// \tparam T the type of the object.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param t a pointer to the object.
+  ///
+  template <typename T>
+  inline void push_light(const state_ptr_t state, T* const t) noexcept
+  {
+    lua_pushlightuserdata(state, const_cast<std::remove_cv_t<T>*>(t));
+  }
+
+  ///
+  /// Gives the pointer held by the light userdata at the given index of the
+  /// stack.
+  ///
+  /// \tparam T the type of the object.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param index the index of the light userdata.
+  ///
+  /// \return The pointer or \c nullptr if the value at the index is not a
+  /// light userdata.
+  ///
+  template <typename T>
+  inline T* to_light(const state_ptr_t state, const int index) noexcept
+  {
+    if (LUA_TLIGHTUSERDATA != lua_type(state, index))
+    {
+      return nullptr;
+    }
+
+    return static_cast<T*>(lua_touserdata(state, index));
+  }
+
+  namespace detail
+  {
+    template <typename T> using bare_t =
+        std::remove_cv_t<std::remove_reference_t<T>>;
+
+    template <typename T> struct function_traits;
+
+    template <typename R, typename... Args>
+    struct function_traits<R (*)(Args...)>
+    {
+      using class_type = void;
+      using return_type = R;
+      using argument_types = std::tuple<Args...>;
+    };
+
+    template <typename R, typename... Args>
+    struct function_traits<R (*)(Args...) noexcept>
+        : function_traits<R (*)(Args...)>
+    {
+    };
+
+    template <typename C, typename R, typename... Args>
+    struct function_traits<R (C::*)(Args...)>
+    {
+      using class_type = C;
+      using return_type = R;
+      using argument_types = std::tuple<Args...>;
+    };
+
+    template <typename C, typename R, typename... Args>
+    struct function_traits<R (C::*)(Args...) const>
+        : function_traits<R (C::*)(Args...)>
+    {
+    };
+
+    template <typename C, typename R, typename... Args>
+    struct function_traits<R (C::*)(Args...) noexcept>
+        : function_traits<R (C::*)(Args...)>
+    {
+    };
+
+    template <typename C, typename R, typename... Args>
+    struct function_traits<R (C::*)(Args...) const noexcept>
+        : function_traits<R (C::*)(Args...)>
+    {
+    };
+
+    template <typename A>
+    bool is_argument(lua_State* state, const int index) noexcept
+    {
+      using U = bare_t<A>;
+
+      if constexpr (std::is_same_v<U, bool>)
+      {
+        return true;
+      }
+      else if constexpr (std::is_integral_v<U>)
+      {
+        // A number with a fractional part can't be given as an integer.
+        int isnum = 0;
+        lua_tointegerx(state, index, &isnum);
+        return 0 != isnum;
+      }
+      else if constexpr (std::is_floating_point_v<U>)
+      {
+        return 1 == lua_isnumber(state, index);
+      }
+      else if constexpr (std::is_same_v<U, std::string>)
+      {
+        return 1 == lua_isstring(state, index);
+      }
+      else if constexpr (std::is_pointer_v<U>)
+      {
+        return lua_isnil(state, index) ||
+            nullptr != to_userdata<bare_t<std::remove_pointer_t<U>>>(
+                           state, index);
+      }
+      else
+      {
+        return nullptr != to_userdata<U>(state, index);
+      }
+    }
+
+    template <typename A>
+    decltype(auto) to_argument(lua_State* state, const int index)
+    {
+      using U = bare_t<A>;
+
+      if constexpr (std::is_same_v<U, bool>)
+      {
+        return static_cast<bool>(lua_toboolean(state, index));
+      }
+      else if constexpr (std::is_integral_v<U>)
+      {
+        return static_cast<U>(lua_tointeger(state, index));
+      }
+      else if constexpr (std::is_floating_point_v<U>)
+      {
+        return static_cast<U>(lua_tonumber(state, index));
+      }
+      else if constexpr (std::is_same_v<U, std::string>)
+      {
+        std::size_t length = 0;
+        const char* s = lua_tolstring(state, index, &length);
+        return std::string{s, length};
+      }
+      else if constexpr (std::is_pointer_v<U>)
+      {
+        return to_userdata<bare_t<std::remove_pointer_t<U>>>(state, index);
+      }
+      else
+      {
+        return *to_userdata<U>(state, index);
+      }
+    }
+
+    template <typename... Args, std::size_t... Is>
+    int find_bad_argument(
+        lua_State* state,
+        const int first,
+        std::index_sequence<Is...>) noexcept
+    {
+      int bad = 0;
+
+      // The arguments are checked in order and the first bad one is kept.
+      ((bad = 0 == bad && !is_argument<Args>(state, first + int{Is})
+                ? first + int{Is}
+                : bad),
+       ...);
+
+      return bad;
+    }
+
+    template <typename R> void push_result(lua_State* state, R&& r)
+    {
+      using U = bare_t<R>;
+
+      if constexpr (std::is_same_v<U, bool>)
+      {
+        lua_pushboolean(state, r);
+      }
+      else if constexpr (std::is_integral_v<U>)
+      {
+        lua_pushinteger(state, static_cast<lua_Integer>(r));
+      }
+      else if constexpr (std::is_floating_point_v<U>)
+      {
+        lua_pushnumber(state, static_cast<lua_Number>(r));
+      }
+      else if constexpr (std::is_same_v<U, std::string>)
+      {
+        lua_pushlstring(state, r.data(), r.size());
+      }
+      else if constexpr (std::is_pointer_v<U>)
+      {
+        push_reference(state, r);
+      }
+      else if constexpr (std::is_lvalue_reference_v<R>)
+      {
+        push_reference(state, &r);
+      }
+      else
+      {
+        push_userdata(state, std::forward<R>(r));
+      }
+    }
+
+    template <auto F, typename... Args, std::size_t... Is>
+    int invoke(lua_State* state, std::index_sequence<Is...> indices)
+    {
+      using traits = function_traits<decltype(F)>;
+      using C = typename traits::class_type;
+      using R = typename traits::return_type;
+
+      constexpr int first = std::is_void_v<C> ? 1 : 2;
+
+      if constexpr (!std::is_void_v<C>)
+      {
+        if (nullptr == to_userdata<C>(state, 1))
+        {
+          return luaL_argerror(state, 1, userdata_traits<C>::name);
+        }
+      }
+
+      if (const int bad = find_bad_argument<Args...>(state, first, indices);
+          0 != bad)
+      {
+        return luaL_argerror(state, bad, "the argument has a wrong type");
+      }
+
+      // No C++ objects may be alive when a Lua error is raised as the error
+      // unwinds the stack without running the destructors.
+      bool failed = false;
+
+      try
+      {
+        if constexpr (std::is_void_v<C>)
+        {
+          if constexpr (std::is_void_v<R>)
+          {
+            F(to_argument<Args>(state, first + int{Is})...);
+          }
+          else
+          {
+            push_result<R>(
+                state, F(to_argument<Args>(state, first + int{Is})...));
+          }
+        }
+        else
+        {
+          C* self = to_userdata<C>(state, 1);
+
+          if constexpr (std::is_void_v<R>)
+          {
+            (self->*F)(to_argument<Args>(state, first + int{Is})...);
+          }
+          else
+          {
+            push_result<R>(
+                state,
+                (self->*F)(to_argument<Args>(state, first + int{Is})...));
+          }
+        }
+      }
+      catch (const std::exception& e)
+      {
+        lua_pushstring(state, e.what());
+        failed = true;
+      }
+
+      if (failed)
+      {
+        return lua_error(state);
+      }
+
+      return std::is_void_v<R> ? 0 : 1;
+    }
+
+    template <auto F, typename... Args>
+    int invoke_with(lua_State* state, std::tuple<Args...>*)
+    {
+      return invoke<F, Args...>(state, std::index_sequence_for<Args...>{});
+    }
+
+    template <typename T, typename... Args, std::size_t... Is>
+    int construct(lua_State* state, std::index_sequence<Is...> indices)
+    {
+      if (const int bad = find_bad_argument<Args...>(state, 1, indices);
+          0 != bad)
+      {
+        return luaL_argerror(state, bad, "the argument has a wrong type");
+      }
+
+      bool failed = false;
+
+      try
+      {
+        emplace_userdata<T>(state, to_argument<Args>(state, 1 + int{Is})...);
+      }
+      catch (const std::exception& e)
+      {
+        lua_pushstring(state, e.what());
+        failed = true;
+      }
+
+      if (failed)
+      {
+        return lua_error(state);
+      }
+
+      return 1;
+    }
+  } // namespace detail
+
+  ///
+  /// Generates a Lua C function which calls the given function. If the
+  /// function is a member function, the object is taken from the first
+  /// parameter so that it can be called with the method syntax in Lua. The
+  /// parameters and the return value may be of the types \c bool,
+  /// \c std::string, any arithmetic type, or any type exposed to Lua by
+  /// specializing \c userdata_traits.
+  ///
+  /// Wrong argument types and exceptions thrown by the function are raised
+  /// as Lua errors.
+  ///
+  /// \tparam F a pointer to the function.
+  ///
+  /// \param state a pointer to the Lua state.
+  ///
+  /// \return The number of the values returned to Lua.
+  ///
+  template <auto F> int bind(lua_State* state)
+  {
+    using arguments =
+        typename detail::function_traits<decltype(F)>::argument_types;
+    return detail::invoke_with<F>(state, static_cast<arguments*>(nullptr));
+  }
+
+  ///
+  /// Generates a Lua C function which constructs an object of the type \c T
+  /// owned by Lua.
+  ///
+  /// \tparam T the type of the object.
+  /// \tparam Args the types of the constructor parameters.
+  ///
+  /// \param state a pointer to the Lua state.
+  ///
+  /// \return The number of the values returned to Lua.
+  ///
+  template <typename T, typename... Args> int construct(lua_State* state)
+  {
+    return detail::construct<T, Args...>(
+        state, std::index_sequence_for<Args...>{});
+  }
+
+  ///
+  /// Exposes the type \c T to the Lua state by setting the table of its
+  /// methods as a global variable with the name of the type. This is only
+  /// needed if the scripts call the methods as functions, for example to
+  /// construct new objects.
+  ///
+  /// \tparam T the type.
+  ///
+  /// \param state a pointer to the Lua state.
+  ///
+  template <typename T> void register_userdata(const state_ptr_t state)
+  {
+    static_assert(is_userdata_v<T>, "The type is not exposed to Lua");
+
+    detail::push_metatable<T>(state);
+    lua_getfield(state, stack_top, "__index");
+    lua_setglobal(state, userdata_traits<T>::name);
+    lua_pop(state, 1);
+  }
+
+} // namespace ode::lua
+
+#endif // !ODE_LUA_USERDATA_H
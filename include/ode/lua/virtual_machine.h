@@ -10,13 +10,19 @@
 
 #include <cstddef>
 
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "gsl/assert"
 
 #include "ode/logger.h"
 #include "ode/lua/lua_config.h"
+#include "ode/lua/result.h"
 #include "ode/lua/stack.h"
 #include "ode/lua/state.h"
 
@@ -201,10 +207,204 @@ namespace ode::lua
 
     push(state, std::forward<Args>(args)...);
 
-    lua_call(state, n_args, n_ret);
+    const auto call_error = lua_pcall(state, n_args, n_ret, 0);
+
+    Ensures(LUA_OK == call_error);
 
     return detail::pop_value<Types...>(state);
   }
+
+  namespace detail
+  {
+    template <typename T>
+    inline std::optional<T> try_read(const state_ptr_t state, const int index)
+    {
+      if constexpr (std::is_same_v<std::remove_cv_t<T>, bool>)
+      {
+        if (1 != lua_isboolean(state, index))
+        {
+          return std::nullopt;
+        }
+
+        return static_cast<bool>(lua_toboolean(state, index));
+      }
+      else if constexpr (std::is_same_v<std::remove_cv_t<T>, float>)
+      {
+        if (1 != lua_isnumber(state, index))
+        {
+          return std::nullopt;
+        }
+
+        return static_cast<float>(lua_tonumber(state, index));
+      }
+      else if constexpr (std::is_same_v<std::remove_cv_t<T>, int>)
+      {
+        int is_integer = 0;
+        const auto value = lua_tointegerx(state, index, &is_integer);
+
+        if (0 == is_integer || std::numeric_limits<int>::min() > value ||
+            std::numeric_limits<int>::max() < value)
+        {
+          return std::nullopt;
+        }
+
+        return static_cast<int>(value);
+      }
+      else if constexpr (std::is_same_v<std::remove_cv_t<T>, std::string>)
+      {
+        if (1 != lua_isstring(state, index))
+        {
+          return std::nullopt;
+        }
+
+        return std::string{lua_tostring(state, index)};
+      }
+      else
+      {
+        static_assert(
+            !std::is_same_v<T, T>, "The type can't be read from Lua");
+      }
+    }
+
+    template <typename... Types, std::size_t... Is>
+    inline std::optional<std::tuple<Types...>> try_read_values(
+        const state_ptr_t state,
+        const int index,
+        std::index_sequence<Is...>)
+    {
+      std::tuple<std::optional<Types>...> values{
+          try_read<Types>(state, index + static_cast<int>(Is))...};
+
+      if (!(std::get<Is>(values).has_value() && ...))
+      {
+        return std::nullopt;
+      }
+
+      return std::make_tuple(std::move(*std::get<Is>(values))...);
+    }
+
+    inline error make_type_error(std::string_view name)
+    {
+      return error{
+          LUA_ERRRUN,
+          "The value of '" + std::string{name} + "' has a wrong type"};
+    }
+  } // namespace detail
+
+  ///
+  /// Gets a variable from a Lua virtual machine without asserting that the
+  /// variable exists. The stack of the Lua state is left as it was.
+  ///
+  /// \tparam T the type of the variable.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param var the name of the variable.
+  ///
+  /// \return An object of the type \c result which holds the value of the
+  /// variable or the error if the variable is missing or has a wrong type.
+  ///
+  template <typename T>
+  inline result<T> try_get(const state_ptr_t state, std::string_view var)
+  {
+    const int top = lua_gettop(state);
+
+    if (auto found = try_to_stack(state, var); !found)
+    {
+      return found.get_error();
+    }
+
+    auto value = detail::try_read<T>(state, stack_top);
+
+    lua_settop(state, top);
+
+    if (!value)
+    {
+      return detail::make_type_error(var);
+    }
+
+    return std::move(*value);
+  }
+
+  ///
+  /// Calls a Lua function in protected mode. Instead of asserting, any error
+  /// raised by the function is returned together with the stack traceback,
+  /// and the stack of the Lua state is left as it was.
+  ///
+  /// \tparam Types the types of the return values.
+  /// \tparam Args the types of the function parameters.
+  ///
+  /// \param state a pointer to the Lua state.
+  /// \param name the name of the Lua function.
+  /// \param args the parameters of the Lua function.
+  ///
+  /// \return An object of the type \c result which holds the return value of
+  /// the Lua function or the error that occurred.
+  ///
+  template <typename... Types, typename... Args>
+  inline result<detail::pop_t<Types...>> try_call(
+      const state_ptr_t state, std::string_view name, Args&&... args)
+  {
+    const int top = lua_gettop(state);
+    const int handler = top + 1;
+
+    lua_pushcfunction(state, message_handler);
+
+    if (auto found = try_to_stack(state, name); !found)
+    {
+      lua_settop(state, top);
+      return found.get_error();
+    }
+
+    if constexpr (sizeof...(Args) > 0)
+    {
+      push(state, std::forward<Args>(args)...);
+    }
+
+    const int n_ret = sizeof...(Types);
+    const int n_args = sizeof...(Args);
+
+    const auto call_error = lua_pcall(state, n_args, n_ret, handler);
+
+    if (LUA_OK != call_error)
+    {
+      auto e = make_error(state, call_error);
+      lua_settop(state, top);
+      return e;
+    }
+
+    if constexpr (0 == sizeof...(Types))
+    {
+      lua_settop(state, top);
+      return {};
+    }
+    else if constexpr (1 == sizeof...(Types))
+    {
+      auto value = detail::try_read<Types...>(state, stack_top);
+
+      lua_settop(state, top);
+
+      if (!value)
+      {
+        return detail::make_type_error(name);
+      }
+
+      return std::move(*value);
+    }
+    else
+    {
+      auto values = detail::try_read_values<Types...>(
+          state, handler + 1, std::index_sequence_for<Types...>{});
+
+      lua_settop(state, top);
+
+      if (!values)
+      {
+        return detail::make_type_error(name);
+      }
+
+      return std::move(*values);
+    }
+  }
 } // namespace ode::lua
 
 #endif // !ODE_LUA_VIRTUAL_MACHINE_H
@@ -0,0 +1,334 @@
+/// The declarations and the definitions of the streams which pack values
+/// into bits for the replication of the state.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_NET_BIT_STREAM_H
+#define ODE_NET_BIT_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gsl/assert"
+
+namespace ode::net
+{
+  ///
+  /// Maps the given signed value to an unsigned one so that the values near
+  /// zero, either positive or negative, become small.
+  ///
+  /// \param value the signed value.
+  ///
+  /// \return The unsigned value.
+  ///
+  constexpr std::uint32_t zigzag_encode(const std::int32_t value) noexcept
+  {
+    return (static_cast<std::uint32_t>(value) << 1) ^
+        static_cast<std::uint32_t>(value >> 31);
+  }
+
+  ///
+  /// Maps the given unsigned value that was given by \c zigzag_encode back
+  /// to the signed value.
+  ///
+  /// \param value the unsigned value.
+  ///
+  /// \return The signed value.
+  ///
+  constexpr std::int32_t zigzag_decode(const std::uint32_t value) noexcept
+  {
+    return static_cast<std::int32_t>(value >> 1) ^
+        -static_cast<std::int32_t>(value & 1);
+  }
+
+  ///
+  /// The type of the objects which append values of arbitrary widths in bits
+  /// to a buffer. The bits are written from the least significant bit of
+  /// each byte, and the last byte is written when the writer is flushed.
+  ///
+  class bit_writer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c bit_writer.
+    ///
+    /// \param buffer the buffer to which the bytes are appended.
+    ///
+    explicit bit_writer(std::vector<std::uint8_t>& buffer) noexcept
+        : out{buffer}, bits{0}, count{0}
+    {
+    }
+
+    ///
+    /// Constructs an object of the type \c bit_writer by copying the given
+    /// object of the type \c bit_writer.
+    ///
+    /// \param a a \c bit_writer from which the new one is constructed.
+    ///
+    bit_writer(const bit_writer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c bit_writer by moving the given
+    /// object of the type \c bit_writer.
+    ///
+    /// \param a a \c bit_writer from which the new one is constructed.
+    ///
+    bit_writer(bit_writer&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c bit_writer. The bits that haven't
+    /// been flushed are written to the buffer.
+    ///
+    ~bit_writer()
+    {
+      flush();
+    }
+
+    ///
+    /// Assigns the given object of the type \c bit_writer to this one by
+    /// copying.
+    ///
+    /// \param a a \c bit_writer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    bit_writer& operator=(const bit_writer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c bit_writer to this one by
+    /// moving.
+    ///
+    /// \param a a \c bit_writer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    bit_writer& operator=(bit_writer&& a) = delete;
+
+    ///
+    /// Writes the lowest bits of the given value.
+    ///
+    /// \param value the value.
+    /// \param width the number of the bits, at most 32.
+    ///
+    void write(const std::uint32_t value, const int width)
+    {
+      Expects(0 <= width && 32 >= width);
+
+      if (0 == width)
+      {
+        return;
+      }
+
+      const auto mask = 32 == width ? ~std::uint64_t{0}
+                                    : (std::uint64_t{1} << width) - 1;
+
+      bits |= (value & mask) << count;
+      count += width;
+
+      while (8 <= count)
+      {
+        out.push_back(static_cast<std::uint8_t>(bits));
+        bits >>= 8;
+        count -= 8;
+      }
+    }
+
+    ///
+    /// Writes a single bit.
+    ///
+    /// \param value the bit.
+    ///
+    void write_bit(const bool value)
+    {
+      write(value ? 1 : 0, 1);
+    }
+
+    ///
+    /// Writes the given value with a width that depends on its magnitude.
+    /// A value below 16 takes 5 bits, a value below 256 takes 10 bits, a
+    /// value below 65536 takes 19 bits, and the others take 35 bits.
+    ///
+    /// \param value the value.
+    ///
+    void write_varint(const std::uint32_t value)
+    {
+      if (16 > value)
+      {
+        write(0, 1);
+        write(value, 4);
+      }
+      else if (256 > value)
+      {
+        write(1, 2);
+        write(value, 8);
+      }
+      else if (65536 > value)
+      {
+        write(3, 3);
+        write(value, 16);
+      }
+      else
+      {
+        write(7, 3);
+        write(value, 32);
+      }
+    }
+
+    ///
+    /// Writes the bits that don't fill a whole byte yet, padded with zeros.
+    ///
+    void flush()
+    {
+      if (0 < count)
+      {
+        out.push_back(static_cast<std::uint8_t>(bits));
+        bits = 0;
+        count = 0;
+      }
+    }
+
+  private:
+    ///
+    /// The buffer to which the bytes are appended.
+    ///
+    std::vector<std::uint8_t>& out;
+
+    ///
+    /// The bits that haven't been written to the buffer.
+    ///
+    std::uint64_t bits;
+
+    ///
+    /// The number of the bits that haven't been written to the buffer.
+    ///
+    int count;
+  };
+
+  ///
+  /// The type of the objects which read values written by a \c bit_writer.
+  /// Reading past the end of the data doesn't fail immediately but gives
+  /// zeros and marks the reader as failed, so the reader only needs to be
+  /// checked after the values have been read.
+  ///
+  class bit_reader final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c bit_reader.
+    ///
+    /// \param data a pointer to the data.
+    /// \param size the number of the bytes in the data.
+    ///
+    bit_reader(const std::uint8_t* data, const std::size_t size) noexcept
+        : begin{data}, end{data + size}, bits{0}, count{0}, ok{true}
+    {
+    }
+
+    ///
+    /// Reads a value.
+    ///
+    /// \param width the number of the bits, at most 32.
+    ///
+    /// \return The value, or zero if the data has ended.
+    ///
+    std::uint32_t read(const int width)
+    {
+      Expects(0 <= width && 32 >= width);
+
+      while (count < width)
+      {
+        if (begin == end)
+        {
+          ok = false;
+          return 0;
+        }
+
+        bits |= std::uint64_t{*begin++} << count;
+        count += 8;
+      }
+
+      const auto mask = 32 == width ? ~std::uint64_t{0}
+                                    : (std::uint64_t{1} << width) - 1;
+      const auto value = static_cast<std::uint32_t>(bits & mask);
+
+      bits >>= width;
+      count -= width;
+
+      return value;
+    }
+
+    ///
+    /// Reads a single bit.
+    ///
+    /// \return The bit.
+    ///
+    bool read_bit()
+    {
+      return 0 != read(1);
+    }
+
+    ///
+    /// Reads a value written by \c bit_writer::write_varint.
+    ///
+    /// \return The value.
+    ///
+    std::uint32_t read_varint()
+    {
+      if (!read_bit())
+      {
+        return read(4);
+      }
+
+      if (!read_bit())
+      {
+        return read(8);
+      }
+
+      return read(read_bit() ? 32 : 16);
+    }
+
+    ///
+    /// Tells whether all of the reads have been within the data.
+    ///
+    /// \return \c true if the reads have succeeded, otherwise \c false.
+    ///
+    bool is_ok() const noexcept
+    {
+      return ok;
+    }
+
+  private:
+    ///
+    /// A pointer to the next byte that is read.
+    ///
+    const std::uint8_t* begin;
+
+    ///
+    /// A pointer past the last byte of the data.
+    ///
+    const std::uint8_t* end;
+
+    ///
+    /// The bits that have been read from the data but not returned.
+    ///
+    std::uint64_t bits;
+
+    ///
+    /// The number of the bits that have been read from the data but not
+    /// returned.
+    ///
+    int count;
+
+    ///
+    /// Whether all of the reads have been within the data.
+    ///
+    bool ok;
+  };
+
+} // namespace ode::net
+
+#endif // !ODE_NET_BIT_STREAM_H
@@ -0,0 +1,125 @@
+/// The declarations of the types which encode the changes between two
+/// replication frames into bit-packed deltas and decode them back.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_NET_DELTA_CODEC_H
+#define ODE_NET_DELTA_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ode/net/replication_frame.h"
+
+namespace ode::net
+{
+  ///
+  /// The type of the objects which encode a replication frame as the
+  /// changes from an earlier frame. For each component the delta lists the
+  /// entities that have lost the component, the entities that have gained
+  /// it with all of their fields, and the entities whose fields have
+  /// changed. The unchanged entities are skipped in runs, and each changed
+  /// field is written as the zigzag-encoded difference of the quantized
+  /// values with a width that depends on its magnitude, so a frame in which
+  /// little moves takes only a few bytes.
+  ///
+  /// A frame is encoded in full by encoding it against an empty frame. The
+  /// buffers of the encoder are reused.
+  ///
+  class delta_encoder final
+  {
+  public:
+    ///
+    /// Encodes the changes between the given frames.
+    ///
+    /// \param baseline the frame that the receiver already has.
+    /// \param current the frame that is sent.
+    /// \param out the buffer to which the delta is appended.
+    ///
+    void encode(
+        const replication_frame& baseline,
+        const replication_frame& current,
+        std::vector<std::uint8_t>& out);
+
+  private:
+    ///
+    /// The indices of the entities that have lost a component in the
+    /// baseline.
+    ///
+    std::vector<std::size_t> removed;
+
+    ///
+    /// The indices of the entities that have gained a component in the
+    /// current frame.
+    ///
+    std::vector<std::size_t> added;
+
+    ///
+    /// The indices of the entities that have a component in both frames,
+    /// first in the baseline and then in the current frame.
+    ///
+    std::vector<std::pair<std::size_t, std::size_t>> kept;
+  };
+
+  ///
+  /// The type of the objects which apply the deltas written by a
+  /// \c delta_encoder. The decoder rejects the deltas that are truncated or
+  /// otherwise inconsistent with the baseline instead of throwing, as they
+  /// come from another process. The buffers of the decoder are reused.
+  ///
+  class delta_decoder final
+  {
+  public:
+    ///
+    /// Decodes a frame from the given delta.
+    ///
+    /// \param baseline the frame against which the delta was encoded.
+    /// \param data a pointer to the delta.
+    /// \param size the number of the bytes in the delta.
+    /// \param out the frame into which the result is written, which must
+    /// not be the baseline.
+    ///
+    /// \return \c true if the delta was valid, otherwise \c false.
+    ///
+    bool decode(
+        const replication_frame& baseline,
+        const std::uint8_t* data,
+        const std::size_t size,
+        replication_frame& out);
+
+  private:
+    ///
+    /// Whether each entity of the baseline has lost the component.
+    ///
+    std::vector<bool> removed;
+
+    ///
+    /// The entities that have the component in both frames.
+    ///
+    std::vector<std::uint32_t> kept_entities;
+
+    ///
+    /// The quantized values of the entities that have the component in both
+    /// frames.
+    ///
+    std::vector<std::uint32_t> kept_values;
+
+    ///
+    /// The entities that have gained the component.
+    ///
+    std::vector<std::uint32_t> added_entities;
+
+    ///
+    /// The quantized values of the entities that have gained the component.
+    ///
+    std::vector<std::uint32_t> added_values;
+  };
+
+} // namespace ode::net
+
+#endif // !ODE_NET_DELTA_CODEC_H
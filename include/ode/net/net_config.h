@@ -0,0 +1,65 @@
+/// The declarations and the definitions of the constants of the state
+/// replication.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_NET_NET_CONFIG_H
+#define ODE_NET_NET_CONFIG_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ode::net
+{
+  ///
+  /// The number of the bytes that may wait to be sent to a single
+  /// subscriber. A subscriber that falls further behind stops receiving the
+  /// deltas and is sent a full frame when it has caught up.
+  ///
+#ifdef ODE_REPLICATION_MAX_PENDING_BYTES
+  constexpr std::size_t replication_max_pending_bytes =
+      ODE_REPLICATION_MAX_PENDING_BYTES;
+#else
+  constexpr std::size_t replication_max_pending_bytes = 1 << 20;
+#endif // !defined(ODE_REPLICATION_MAX_PENDING_BYTES)
+
+  ///
+  /// The largest message that a client accepts from the server.
+  ///
+#ifdef ODE_REPLICATION_MAX_MESSAGE_SIZE
+  constexpr std::size_t replication_max_message_size =
+      ODE_REPLICATION_MAX_MESSAGE_SIZE;
+#else
+  constexpr std::size_t replication_max_message_size = 1 << 26;
+#endif // !defined(ODE_REPLICATION_MAX_MESSAGE_SIZE)
+
+  ///
+  /// The number of the bytes in the header of a message, which holds the
+  /// size of the data, the number of the frame, and the kind of the
+  /// message.
+  ///
+  constexpr std::size_t replication_header_size = 9;
+
+  ///
+  /// The kinds of the messages that the server sends.
+  ///
+  enum class replication_message : std::uint8_t
+  {
+    ///
+    /// The changes from the previous frame.
+    ///
+    delta,
+
+    ///
+    /// The full frame, which is sent to the new subscribers and to the ones
+    /// that have fallen behind.
+    ///
+    keyframe
+  };
+
+} // namespace ode::net
+
+#endif // !ODE_NET_NET_CONFIG_H
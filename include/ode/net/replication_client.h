@@ -0,0 +1,217 @@
+/// The declaration of the client which receives the replicated state from a
+/// local server.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_NET_REPLICATION_CLIENT_H
+#define ODE_NET_REPLICATION_CLIENT_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ode/net/delta_codec.h"
+#include "ode/net/net_config.h"
+#include "ode/net/replication_frame.h"
+
+namespace ode::net
+{
+  ///
+  /// The type of the objects which connect to a \c replication_server and
+  /// rebuild the replicated frames from the messages that it sends. The
+  /// client starts from the full frame that the server sends first and
+  /// applies the deltas that follow it.
+  ///
+  /// The object must only be used on a single thread, and it never blocks
+  /// except in \c wait. The client is only available on Linux.
+  ///
+  class replication_client final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c replication_client and connects
+    /// it to the given socket.
+    ///
+    /// \param socket_path the path of the socket of the server.
+    /// \param client_schema the schema of the components, which must be
+    /// built like the one of the server and outlive the client.
+    ///
+    /// \exception std::runtime_error Thrown if the client can't connect or
+    /// the system isn't supported.
+    ///
+    replication_client(
+        const std::string& socket_path,
+        const replication_schema& client_schema);
+
+    ///
+    /// Constructs an object of the type \c replication_client by copying
+    /// the given object of the type \c replication_client.
+    ///
+    /// \param a a \c replication_client from which the new one is
+    /// constructed.
+    ///
+    replication_client(const replication_client& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c replication_client by moving the
+    /// given object of the type \c replication_client.
+    ///
+    /// \param a a \c replication_client from which the new one is
+    /// constructed.
+    ///
+    replication_client(replication_client&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c replication_client.
+    ///
+    ~replication_client();
+
+    ///
+    /// Assigns the given object of the type \c replication_client to this
+    /// one by copying.
+    ///
+    /// \param a a \c replication_client from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    replication_client& operator=(const replication_client& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c replication_client to this
+    /// one by moving.
+    ///
+    /// \param a a \c replication_client from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    replication_client& operator=(replication_client&& a) = delete;
+
+    ///
+    /// Waits until the server has sent data or the given time has passed.
+    ///
+    /// \param timeout the longest time to wait.
+    ///
+    /// \return \c true if there is data to receive, otherwise \c false.
+    ///
+    bool wait(const std::chrono::milliseconds timeout);
+
+    ///
+    /// Reads the data that the server has sent and applies the complete
+    /// messages.
+    ///
+    /// \return The number of the frames that were applied.
+    ///
+    std::size_t receive();
+
+    ///
+    /// Tells whether the client is still connected to the server.
+    ///
+    /// \return \c true if the client is connected, otherwise \c false.
+    ///
+    bool is_connected() const noexcept;
+
+    ///
+    /// Gives the last frame that has been received.
+    ///
+    /// \return A reference to the frame.
+    ///
+    const replication_frame& get_frame() const noexcept;
+
+    ///
+    /// Gives the number of the last frame that has been received.
+    ///
+    /// \return The number of the frame, or zero if no frame has been
+    /// received.
+    ///
+    std::uint32_t get_frame_number() const noexcept;
+
+    ///
+    /// Gives the number of the bytes that have been received.
+    ///
+    /// \return The number of the bytes.
+    ///
+    std::uint64_t get_bytes_received() const noexcept;
+
+  private:
+    ///
+    /// Applies a message.
+    ///
+    /// \param kind the kind of the message.
+    /// \param number the number of the frame in the message.
+    /// \param data a pointer to the data of the message.
+    /// \param size the number of the bytes in the data.
+    ///
+    /// \return \c true if a frame was applied, otherwise \c false.
+    ///
+    bool apply(
+        const replication_message kind,
+        const std::uint32_t number,
+        const std::uint8_t* data,
+        const std::size_t size);
+
+    ///
+    /// Closes the socket.
+    ///
+    void close() noexcept;
+
+    ///
+    /// The socket.
+    ///
+    int fd;
+
+    ///
+    /// The last frame that has been received.
+    ///
+    replication_frame frame;
+
+    ///
+    /// The frame into which the next message is decoded.
+    ///
+    replication_frame next;
+
+    ///
+    /// The empty frame against which the full frames are decoded.
+    ///
+    replication_frame empty;
+
+    ///
+    /// The decoder of the deltas.
+    ///
+    delta_decoder decoder;
+
+    ///
+    /// The bytes that have been read but don't form a complete message
+    /// yet.
+    ///
+    std::vector<std::uint8_t> incoming;
+
+    ///
+    /// The buffer into which the socket is read.
+    ///
+    std::vector<std::uint8_t> chunk;
+
+    ///
+    /// The number of the last frame that has been received.
+    ///
+    std::uint32_t frame_number;
+
+    ///
+    /// The number of the bytes that have been received.
+    ///
+    std::uint64_t bytes_received;
+
+    ///
+    /// Whether the client has the last frame, so that it can apply the
+    /// next delta.
+    ///
+    bool synced;
+  };
+
+} // namespace ode::net
+
+#endif // !ODE_NET_REPLICATION_CLIENT_H
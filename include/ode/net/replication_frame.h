@@ -0,0 +1,234 @@
+/// The declarations of the types which describe the replicated components
+/// and hold the quantized values of the components in a single frame.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_NET_REPLICATION_FRAME_H
+#define ODE_NET_REPLICATION_FRAME_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ode::net
+{
+  ///
+  /// The type of the objects which tell how a field of a component is
+  /// quantized before it is sent. The value is clamped to the range and
+  /// mapped to an integer of the given number of bits, so the precision of
+  /// the field is the length of the range divided by 2 to the power of the
+  /// bits.
+  ///
+  struct replicated_field final
+  {
+    ///
+    /// The smallest value of the field.
+    ///
+    float min;
+
+    ///
+    /// The largest value of the field.
+    ///
+    float max;
+
+    ///
+    /// The number of the bits in the quantized value, between 1 and 32.
+    ///
+    int bits;
+  };
+
+  ///
+  /// Quantizes the given value of a field.
+  ///
+  /// \param value the value.
+  /// \param field the field.
+  ///
+  /// \return The quantized value.
+  ///
+  std::uint32_t quantize(const float value, const replicated_field& field);
+
+  ///
+  /// Gives the value of a field from the given quantized value.
+  ///
+  /// \param value the quantized value.
+  /// \param field the field.
+  ///
+  /// \return The value.
+  ///
+  float dequantize(const std::uint32_t value, const replicated_field& field);
+
+  ///
+  /// The type of the objects which describe the components that are
+  /// replicated. The server and the clients must build the same schema, as
+  /// the components are identified by their indices in it.
+  ///
+  class replication_schema final
+  {
+  public:
+    ///
+    /// Adds a component to the schema.
+    ///
+    /// \param fields the fields of the component.
+    ///
+    /// \return The index of the component.
+    ///
+    std::size_t add_component(std::vector<replicated_field> fields);
+
+    ///
+    /// Gives the number of the components in the schema.
+    ///
+    /// \return The number of the components.
+    ///
+    std::size_t get_component_count() const noexcept;
+
+    ///
+    /// Gives the fields of the given component.
+    ///
+    /// \param component the index of the component.
+    ///
+    /// \return A reference to the fields.
+    ///
+    const std::vector<replicated_field>& get_fields(
+        const std::size_t component) const;
+
+  private:
+    ///
+    /// The fields of the components.
+    ///
+    std::vector<std::vector<replicated_field>> components;
+  };
+
+  ///
+  /// The type of the objects which hold the quantized values of the
+  /// replicated components in a single frame. Each component is a table of
+  /// the entities that have it, sorted by the identifiers of the entities,
+  /// so two frames can be compared by walking the tables side by side.
+  ///
+  /// The game fills a frame from its state after each update and passes it
+  /// to the replication server. The buffers are reused when the frame is
+  /// cleared, so filling a frame of the same size again doesn't allocate.
+  ///
+  class replication_frame final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c replication_frame.
+    ///
+    /// \param frame_schema the complete schema of the components, which
+    /// must outlive the frame.
+    ///
+    explicit replication_frame(const replication_schema& frame_schema);
+
+    ///
+    /// Removes all of the entities from the frame.
+    ///
+    void clear() noexcept;
+
+    ///
+    /// Adds an entity that has the given component. The entities must be
+    /// added to each component in the increasing order of their
+    /// identifiers.
+    ///
+    /// \param component the index of the component.
+    /// \param entity the identifier of the entity.
+    /// \param values a pointer to the values of the fields of the
+    /// component, which are quantized.
+    ///
+    void add(
+        const std::size_t component,
+        const std::uint32_t entity,
+        const float* values);
+
+    ///
+    /// Adds an entity that has the given component from quantized values.
+    /// The entities must be added to each component in the increasing order
+    /// of their identifiers.
+    ///
+    /// \param component the index of the component.
+    /// \param entity the identifier of the entity.
+    /// \param values a pointer to the quantized values of the fields of the
+    /// component.
+    ///
+    void add_quantized(
+        const std::size_t component,
+        const std::uint32_t entity,
+        const std::uint32_t* values);
+
+    ///
+    /// Gives the schema of the components.
+    ///
+    /// \return A reference to the schema.
+    ///
+    const replication_schema& get_schema() const noexcept;
+
+    ///
+    /// Gives the entities that have the given component.
+    ///
+    /// \param component the index of the component.
+    ///
+    /// \return A reference to the identifiers of the entities in increasing
+    /// order.
+    ///
+    const std::vector<std::uint32_t>& get_entities(
+        const std::size_t component) const;
+
+    ///
+    /// Gives the quantized values of the fields of a component.
+    ///
+    /// \param component the index of the component.
+    /// \param index the index of the entity in the component.
+    ///
+    /// \return A pointer to the quantized values.
+    ///
+    const std::uint32_t* get_values(
+        const std::size_t component, const std::size_t index) const;
+
+    ///
+    /// Gives the value of a field of a component.
+    ///
+    /// \param component the index of the component.
+    /// \param index the index of the entity in the component.
+    /// \param field the index of the field.
+    ///
+    /// \return The dequantized value.
+    ///
+    float get_value(
+        const std::size_t component,
+        const std::size_t index,
+        const std::size_t field) const;
+
+  private:
+    ///
+    /// The type of the tables of the components.
+    ///
+    struct component_table final
+    {
+      ///
+      /// The entities that have the component.
+      ///
+      std::vector<std::uint32_t> entities;
+
+      ///
+      /// The quantized values of the fields of the entities, one entity
+      /// after another.
+      ///
+      std::vector<std::uint32_t> values;
+    };
+
+    ///
+    /// The schema of the components.
+    ///
+    const replication_schema* schema;
+
+    ///
+    /// The tables of the components.
+    ///
+    std::vector<component_table> components;
+  };
+
+} // namespace ode::net
+
+#endif // !ODE_NET_REPLICATION_FRAME_H
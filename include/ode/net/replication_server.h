@@ -0,0 +1,324 @@
+/// The declaration of the server which sends the replicated state to local
+/// subscribers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_NET_REPLICATION_SERVER_H
+#define ODE_NET_REPLICATION_SERVER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ode/net/delta_codec.h"
+#include "ode/net/net_config.h"
+#include "ode/net/replication_frame.h"
+
+namespace ode::net
+{
+  ///
+  /// The type of the objects which send the frames of the replicated state
+  /// to the subscribers that connect to a UNIX domain socket, such as
+  /// spectators and the clients of a local multiplayer game.
+  ///
+  /// The game thread publishes a frame after each update. The frame is
+  /// encoded once as a delta from the previous one, and a full frame is
+  /// encoded too when a subscriber is waiting for one, so the cost on the
+  /// game thread doesn't grow with the number of the subscribers. The
+  /// messages are handed to a dedicated thread which accepts the
+  /// subscribers and writes to their sockets with \c epoll, so a slow
+  /// subscriber never blocks the game. A subscriber that falls too far
+  /// behind stops receiving the deltas until it can be sent a full frame.
+  ///
+  /// The server is only available on Linux.
+  ///
+  class replication_server final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c replication_server and starts
+    /// listening on the given socket.
+    ///
+    /// \param socket_path the path of the socket. An old socket at the path
+    /// is removed.
+    /// \param server_schema the schema of the components, which must
+    /// outlive the server.
+    ///
+    /// \exception std::runtime_error Thrown if the socket can't be created
+    /// or the system isn't supported.
+    ///
+    replication_server(
+        const std::string& socket_path,
+        const replication_schema& server_schema);
+
+    ///
+    /// Constructs an object of the type \c replication_server by copying
+    /// the given object of the type \c replication_server.
+    ///
+    /// \param a a \c replication_server from which the new one is
+    /// constructed.
+    ///
+    replication_server(const replication_server& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c replication_server by moving the
+    /// given object of the type \c replication_server.
+    ///
+    /// \param a a \c replication_server from which the new one is
+    /// constructed.
+    ///
+    replication_server(replication_server&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c replication_server. The
+    /// subscribers are disconnected and the socket is removed.
+    ///
+    ~replication_server();
+
+    ///
+    /// Assigns the given object of the type \c replication_server to this
+    /// one by copying.
+    ///
+    /// \param a a \c replication_server from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    replication_server& operator=(const replication_server& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c replication_server to this
+    /// one by moving.
+    ///
+    /// \param a a \c replication_server from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    replication_server& operator=(replication_server&& a) = delete;
+
+    ///
+    /// Sends the given frame to the subscribers. The function must be
+    /// called on a single thread.
+    ///
+    /// \param frame the frame.
+    ///
+    void publish(const replication_frame& frame);
+
+    ///
+    /// Gives the number of the connected subscribers.
+    ///
+    /// \return The number of the subscribers.
+    ///
+    std::size_t get_subscriber_count() const noexcept;
+
+    ///
+    /// Gives the number of the bytes that have been sent to all of the
+    /// subscribers.
+    ///
+    /// \return The number of the bytes.
+    ///
+    std::uint64_t get_bytes_sent() const noexcept;
+
+    ///
+    /// Gives the number of the last published frame.
+    ///
+    /// \return The number of the frame, or zero if no frame has been
+    /// published.
+    ///
+    std::uint32_t get_frame_number() const noexcept;
+
+  private:
+    ///
+    /// The type of the messages that the game thread hands to the thread of
+    /// the sockets.
+    ///
+    struct outgoing_frame final
+    {
+      ///
+      /// The delta from the previous frame.
+      ///
+      std::shared_ptr<const std::vector<std::uint8_t>> delta;
+
+      ///
+      /// The full frame, or null if no subscriber was waiting for one.
+      ///
+      std::shared_ptr<const std::vector<std::uint8_t>> keyframe;
+    };
+
+    ///
+    /// The type of the connections of the subscribers.
+    ///
+    struct subscriber final
+    {
+      ///
+      /// The bytes that haven't been sent.
+      ///
+      std::vector<std::uint8_t> pending;
+
+      ///
+      /// The number of the bytes at the front of the pending bytes that
+      /// have been sent.
+      ///
+      std::size_t sent;
+
+      ///
+      /// Whether the subscriber has the previous frame and can be sent the
+      /// deltas.
+      ///
+      bool synced;
+
+      ///
+      /// Whether the thread waits until the socket can be written.
+      ///
+      bool writing;
+    };
+
+    ///
+    /// Builds a message.
+    ///
+    /// \param kind the kind of the message.
+    /// \param baseline the frame against which the frame is encoded.
+    /// \param frame the frame.
+    ///
+    /// \return The message.
+    ///
+    std::shared_ptr<const std::vector<std::uint8_t>> make_message(
+        const replication_message kind,
+        const replication_frame& baseline,
+        const replication_frame& frame);
+
+    ///
+    /// Runs the thread of the sockets until the server is destructed.
+    ///
+    void run();
+
+    ///
+    /// Accepts the waiting subscribers.
+    ///
+    void accept_subscribers();
+
+    ///
+    /// Queues the given frame to the subscribers.
+    ///
+    /// \param frame the frame.
+    ///
+    void queue(const outgoing_frame& frame);
+
+    ///
+    /// Writes as many of the pending bytes of the given subscriber as the
+    /// socket accepts.
+    ///
+    /// \param fd the socket of the subscriber.
+    /// \param s the subscriber.
+    ///
+    /// \return \c true if the subscriber is still connected, otherwise
+    /// \c false.
+    ///
+    bool flush(const int fd, subscriber& s);
+
+    ///
+    /// Disconnects the given subscriber.
+    ///
+    /// \param fd the socket of the subscriber.
+    ///
+    void disconnect(const int fd);
+
+    ///
+    /// Closes the sockets of the server.
+    ///
+    void close_sockets() noexcept;
+
+    ///
+    /// The path of the socket.
+    ///
+    std::string path;
+
+    ///
+    /// The frame that was published last.
+    ///
+    replication_frame previous;
+
+    ///
+    /// The empty frame against which the full frames are encoded.
+    ///
+    replication_frame empty;
+
+    ///
+    /// The encoder of the deltas.
+    ///
+    delta_encoder encoder;
+
+    ///
+    /// The number of the last published frame.
+    ///
+    std::uint32_t frame_number;
+
+    ///
+    /// The socket which accepts the subscribers.
+    ///
+    int listen_fd;
+
+    ///
+    /// The \c epoll instance of the thread of the sockets.
+    ///
+    int epoll_fd;
+
+    ///
+    /// The event through which the game thread wakes the thread of the
+    /// sockets.
+    ///
+    int wake_fd;
+
+    ///
+    /// The mutex which protects the frames that haven't been queued.
+    ///
+    std::mutex mutex;
+
+    ///
+    /// The frames that haven't been queued to the subscribers.
+    ///
+    std::vector<outgoing_frame> outbox;
+
+    ///
+    /// The subscribers by their sockets. Only the thread of the sockets
+    /// uses them.
+    ///
+    std::unordered_map<int, subscriber> subscribers;
+
+    ///
+    /// The number of the subscribers that wait for a full frame.
+    ///
+    std::atomic<std::size_t> waiting;
+
+    ///
+    /// The number of the connected subscribers.
+    ///
+    std::atomic<std::size_t> subscriber_count;
+
+    ///
+    /// The number of the bytes that have been sent.
+    ///
+    std::atomic<std::uint64_t> bytes_sent;
+
+    ///
+    /// Whether the thread of the sockets keeps running.
+    ///
+    std::atomic<bool> running;
+
+    ///
+    /// The thread of the sockets.
+    ///
+    std::thread thread;
+  };
+
+} // namespace ode::net
+
+#endif // !ODE_NET_REPLICATION_SERVER_H
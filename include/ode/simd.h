@@ -0,0 +1,81 @@
+/// The declarations of the utilities for selecting the SIMD instruction sets
+/// at runtime.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SIMD_H
+#define ODE_SIMD_H
+
+///
+/// The preprocessor macro which tells whether or not the target is an x86
+/// processor and the x86 SIMD kernels are built.
+/// \def ODE_SIMD_X86
+///
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#  define ODE_SIMD_X86 1
+#else
+#  define ODE_SIMD_X86 0
+#endif // !ODE_SIMD_X86
+
+///
+/// The preprocessor macro which marks a function to be compiled for SSE2
+/// even if the rest of the program isn't. The function may only be called
+/// after \c get_simd_level tells that SSE is supported.
+/// \def ODE_TARGET_SSE
+///
+#if ODE_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#  define ODE_TARGET_SSE __attribute__((target("sse2")))
+#else
+#  define ODE_TARGET_SSE
+#endif // !(ODE_SIMD_X86 && (defined(__GNUC__) || defined(__clang__)))
+
+///
+/// The preprocessor macro which marks a function to be compiled for AVX2
+/// even if the rest of the program isn't. The function may only be called
+/// after \c get_simd_level tells that AVX2 is supported.
+/// \def ODE_TARGET_AVX2
+///
+#if ODE_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#  define ODE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#  define ODE_TARGET_AVX2
+#endif // !(ODE_SIMD_X86 && (defined(__GNUC__) || defined(__clang__)))
+
+namespace ode
+{
+  ///
+  /// The SIMD instruction sets for which the kernels of the engine have
+  /// versions. The levels are ordered so that each of them includes the
+  /// ones before it.
+  ///
+  enum class simd_level
+  {
+    scalar,
+    sse,
+    avx2
+  };
+
+  ///
+  /// Gives the highest SIMD instruction set that both the processor and the
+  /// operating system support. The processor is queried only once.
+  ///
+  /// \return The SIMD level.
+  ///
+  simd_level get_simd_level() noexcept;
+
+  ///
+  /// Gives the name of the given SIMD level for logging.
+  ///
+  /// \param level the SIMD level.
+  ///
+  /// \return The name as a null-terminated string.
+  ///
+  const char* get_simd_level_name(const simd_level level) noexcept;
+
+} // namespace ode
+
+#endif // !ODE_SIMD_H
@@ -0,0 +1,73 @@
+/// The declarations and the definitions of the audio system constants.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_AUDIO_AUDIO_CONFIG_H
+#define ODE_SYSTEMS_AUDIO_AUDIO_CONFIG_H
+
+#include <cstddef>
+
+namespace ode
+{
+  ///
+  /// The sample rate of the mixer in frames per second. The sounds and the
+  /// streams with other rates are resampled before they reach the mixer.
+  ///
+#ifdef ODE_AUDIO_SAMPLE_RATE
+  constexpr int audio_sample_rate = ODE_AUDIO_SAMPLE_RATE;
+#else
+  constexpr int audio_sample_rate = 48000;
+#endif // !defined(ODE_AUDIO_SAMPLE_RATE)
+
+  ///
+  /// The number of the channels that the mixer outputs. The samples of the
+  /// channels are interleaved.
+  ///
+  constexpr int audio_channels = 2;
+
+  ///
+  /// The number of the frames that the audio device requests in a single
+  /// callback.
+  ///
+#ifdef ODE_AUDIO_BUFFER_FRAMES
+  constexpr std::size_t audio_buffer_frames = ODE_AUDIO_BUFFER_FRAMES;
+#else
+  constexpr std::size_t audio_buffer_frames = 512;
+#endif // !defined(ODE_AUDIO_BUFFER_FRAMES)
+
+  ///
+  /// The number of the voices that the mixer plays at the same time.
+  ///
+#ifdef ODE_MAX_AUDIO_VOICES
+  constexpr std::size_t max_audio_voices = ODE_MAX_AUDIO_VOICES;
+#else
+  constexpr std::size_t max_audio_voices = 128;
+#endif // !defined(ODE_MAX_AUDIO_VOICES)
+
+  ///
+  /// The number of the commands that the queue from the game thread to the
+  /// mixer holds.
+  ///
+#ifdef ODE_AUDIO_COMMAND_QUEUE_SIZE
+  constexpr std::size_t audio_command_queue_size =
+      ODE_AUDIO_COMMAND_QUEUE_SIZE;
+#else
+  constexpr std::size_t audio_command_queue_size = 1024;
+#endif // !defined(ODE_AUDIO_COMMAND_QUEUE_SIZE)
+
+  ///
+  /// The number of the decoded frames that a stream keeps ahead of the
+  /// mixer. The stream must be refilled before the mixer plays them all.
+  ///
+#ifdef ODE_AUDIO_STREAM_FRAMES
+  constexpr std::size_t audio_stream_frames = ODE_AUDIO_STREAM_FRAMES;
+#else
+  constexpr std::size_t audio_stream_frames = 16384;
+#endif // !defined(ODE_AUDIO_STREAM_FRAMES)
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_AUDIO_AUDIO_CONFIG_H
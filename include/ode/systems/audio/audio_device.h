@@ -0,0 +1,115 @@
+/// The declaration of the type of the audio devices which play the output of
+/// a mixer through Simple DirectMedia Layer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_AUDIO_AUDIO_DEVICE_H
+#define ODE_SYSTEMS_AUDIO_AUDIO_DEVICE_H
+
+#include <SDL2/SDL.h>
+
+#include "ode/systems/audio/audio_mixer.h"
+
+namespace ode
+{
+  ///
+  /// The type of the audio devices which open an output device of Simple
+  /// DirectMedia Layer and call the mixer from its audio callback. The audio
+  /// subsystem of Simple DirectMedia Layer is initialized by the device, so
+  /// the engine doesn't need audio unless a device is created. The device
+  /// can be tested without sound hardware by setting the environment
+  /// variable \c SDL_AUDIODRIVER to \c dummy, or to \c disk to write the
+  /// output to a file.
+  ///
+  class audio_device final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c audio_device and starts playing
+    /// the output of the given mixer. Throws \c std::runtime_error if the
+    /// device can't be opened.
+    ///
+    /// \param m the mixer, which must outlive the device.
+    ///
+    explicit audio_device(audio_mixer& m);
+
+    ///
+    /// Constructs an object of the type \c audio_device by copying the given
+    /// object of the type \c audio_device.
+    ///
+    /// \param a an \c audio_device from which the new one is constructed.
+    ///
+    audio_device(const audio_device& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c audio_device by moving the given
+    /// object of the type \c audio_device.
+    ///
+    /// \param a an \c audio_device from which the new one is constructed.
+    ///
+    audio_device(audio_device&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c audio_device and closes the
+    /// device.
+    ///
+    ~audio_device();
+
+    ///
+    /// Assigns the given object of the type \c audio_device to this one by
+    /// copying.
+    ///
+    /// \param a an \c audio_device from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_device& operator=(const audio_device& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c audio_device to this one by
+    /// moving.
+    ///
+    /// \param a an \c audio_device from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_device& operator=(audio_device&& a) = delete;
+
+    ///
+    /// Gives the sample rate that the device plays at.
+    ///
+    /// \return The sample rate.
+    ///
+    int get_sample_rate() const noexcept;
+
+    ///
+    /// Gives the number of the frames that the device asks from the mixer at
+    /// once.
+    ///
+    /// \return The number of the frames.
+    ///
+    int get_buffer_frames() const noexcept;
+
+  private:
+    ///
+    /// The mixer.
+    ///
+    audio_mixer& mixer;
+
+    ///
+    /// The ID of the device.
+    ///
+    SDL_AudioDeviceID id;
+
+    ///
+    /// The format that the device was opened with.
+    ///
+    SDL_AudioSpec spec;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_AUDIO_AUDIO_DEVICE_H
@@ -0,0 +1,430 @@
+/// The declaration of the type of the real-time mixers which play the
+/// sounds and the streams.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_AUDIO_AUDIO_MIXER_H
+#define ODE_SYSTEMS_AUDIO_AUDIO_MIXER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ode/framework/spsc_queue.h"
+#include "ode/simd.h"
+#include "ode/systems/audio/audio_config.h"
+#include "ode/systems/audio/audio_stream.h"
+#include "ode/systems/audio/sound_buffer.h"
+
+namespace ode
+{
+  ///
+  /// The type of the real-time mixers which play the sounds and the streams
+  /// in voices and mix them into interleaved stereo samples. The mixer has
+  /// two sides. The game thread starts and controls the voices, and the
+  /// commands are passed to the audio thread through a lock-free queue, so
+  /// the functions of the game thread never wait for the audio thread. The
+  /// audio thread calls \c mix, which doesn't lock, allocate, or make
+  /// system calls, and reports the voices that have ended back through
+  /// another lock-free queue. The game thread keeps the sounds of the voices
+  /// alive until the audio thread has reported that the voices have ended.
+  ///
+  /// The voices are mixed with SSE or AVX2 kernels chosen at runtime.
+  ///
+  class audio_mixer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c audio_mixer.
+    ///
+    /// \param command_capacity the number of the commands that the queue to
+    /// the audio thread holds.
+    ///
+    explicit audio_mixer(
+        const std::size_t command_capacity = audio_command_queue_size);
+
+    ///
+    /// Constructs an object of the type \c audio_mixer by copying the given
+    /// object of the type \c audio_mixer.
+    ///
+    /// \param a an \c audio_mixer from which the new one is constructed.
+    ///
+    audio_mixer(const audio_mixer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c audio_mixer by moving the given
+    /// object of the type \c audio_mixer.
+    ///
+    /// \param a an \c audio_mixer from which the new one is constructed.
+    ///
+    audio_mixer(audio_mixer&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c audio_mixer.
+    ///
+    ~audio_mixer() = default;
+
+    ///
+    /// Assigns the given object of the type \c audio_mixer to this one by
+    /// copying.
+    ///
+    /// \param a an \c audio_mixer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_mixer& operator=(const audio_mixer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c audio_mixer to this one by
+    /// moving.
+    ///
+    /// \param a an \c audio_mixer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_mixer& operator=(audio_mixer&& a) = delete;
+
+    ///
+    /// Starts playing the given sound. The mixer shares the ownership of the
+    /// sound until the voice has ended. This function may only be called on
+    /// the game thread.
+    ///
+    /// \param sound the sound.
+    /// \param volume the volume of the voice.
+    /// \param pan the position of the voice from -1, which is left, to 1,
+    /// which is right.
+    /// \param loop whether or not the sound starts again when it ends.
+    ///
+    /// \return The ID of the voice, or zero if the command queue is full or
+    /// too many voices are playing.
+    ///
+    std::uint32_t play(
+        std::shared_ptr<const sound_buffer> sound,
+        const float volume = 1.0f,
+        const float pan = 0.0f,
+        const bool loop = false);
+
+    ///
+    /// Starts playing the given stream. The stream is refilled by \c update
+    /// while the voice plays, and it must live until the voice has ended.
+    /// This function may only be called on the game thread.
+    ///
+    /// \param stream the stream.
+    /// \param volume the volume of the voice.
+    /// \param pan the position of the voice from -1, which is left, to 1,
+    /// which is right.
+    ///
+    /// \return The ID of the voice, or zero if the command queue is full or
+    /// too many voices are playing.
+    ///
+    std::uint32_t play(
+        audio_stream& stream,
+        const float volume = 1.0f,
+        const float pan = 0.0f);
+
+    ///
+    /// Stops the given voice. This function may only be called on the game
+    /// thread.
+    ///
+    /// \param voice the ID of the voice.
+    ///
+    /// \return \c true if the command was sent, otherwise \c false.
+    ///
+    bool stop(const std::uint32_t voice) noexcept;
+
+    ///
+    /// Sets the volume and the position of the given voice. This function
+    /// may only be called on the game thread.
+    ///
+    /// \param voice the ID of the voice.
+    /// \param volume the volume of the voice.
+    /// \param pan the position of the voice from -1, which is left, to 1,
+    /// which is right.
+    ///
+    /// \return \c true if the command was sent, otherwise \c false.
+    ///
+    bool set_volume(
+        const std::uint32_t voice,
+        const float volume,
+        const float pan = 0.0f) noexcept;
+
+    ///
+    /// Sets the volume by which the mixed samples are multiplied. This
+    /// function may only be called on the game thread.
+    ///
+    /// \param volume the volume.
+    ///
+    /// \return \c true if the command was sent, otherwise \c false.
+    ///
+    bool set_master_volume(const float volume) noexcept;
+
+    ///
+    /// Refills the streams that are playing and removes the voices that have
+    /// ended. This function may only be called on the game thread, and it
+    /// should be called every frame.
+    ///
+    void update();
+
+    ///
+    /// Tells whether or not the given voice is playing as far as the game
+    /// thread knows.
+    ///
+    /// \param voice the ID of the voice.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_playing(const std::uint32_t voice) const noexcept;
+
+    ///
+    /// Gives the number of the voices that are playing as far as the game
+    /// thread knows.
+    ///
+    /// \return The number of the voices.
+    ///
+    std::size_t get_playing_count() const noexcept;
+
+    ///
+    /// Mixes the next frames of the voices. This function may only be
+    /// called on the audio thread.
+    ///
+    /// \param out a pointer to the memory into which the interleaved stereo
+    /// samples are written.
+    /// \param frames the number of the frames to mix.
+    ///
+    void mix(float* out, const std::size_t frames) noexcept;
+
+    ///
+    /// Sets the SIMD instruction set used by the kernels. The level is
+    /// clamped to the best one that the processor supports.
+    ///
+    /// \param level the SIMD level.
+    ///
+    void set_simd_level(const simd_level level) noexcept;
+
+    ///
+    /// Gives the SIMD instruction set used by the kernels.
+    ///
+    /// \return The SIMD level.
+    ///
+    simd_level get_simd_level() const noexcept;
+
+  private:
+    ///
+    /// The kinds of the commands from the game thread to the audio thread.
+    ///
+    enum class command_type : std::uint8_t
+    {
+      play,
+      stop,
+      set_volume,
+      set_master_volume
+    };
+
+    ///
+    /// The type of the commands from the game thread to the audio thread.
+    ///
+    struct command final
+    {
+      ///
+      /// The kind of the command.
+      ///
+      command_type type;
+
+      ///
+      /// Whether or not the sound of the voice starts again when it ends.
+      ///
+      bool loop;
+
+      ///
+      /// The ID of the voice.
+      ///
+      std::uint32_t voice;
+
+      ///
+      /// The samples of the sound of the voice, if it plays a sound.
+      ///
+      const float* samples;
+
+      ///
+      /// The number of the frames of the sound of the voice.
+      ///
+      std::size_t frames;
+
+      ///
+      /// The stream of the voice, if it plays a stream.
+      ///
+      audio_stream* stream;
+
+      ///
+      /// The gain of the left channel, or the master volume.
+      ///
+      float left;
+
+      ///
+      /// The gain of the right channel.
+      ///
+      float right;
+    };
+
+    ///
+    /// The type of the voices on the audio thread.
+    ///
+    struct voice_state final
+    {
+      ///
+      /// The ID of the voice.
+      ///
+      std::uint32_t id;
+
+      ///
+      /// Whether or not the sound starts again when it ends.
+      ///
+      bool loop;
+
+      ///
+      /// The samples of the sound, if the voice plays a sound.
+      ///
+      const float* samples;
+
+      ///
+      /// The number of the frames of the sound.
+      ///
+      std::size_t frames;
+
+      ///
+      /// The index of the next frame of the sound.
+      ///
+      std::size_t position;
+
+      ///
+      /// The stream, if the voice plays a stream.
+      ///
+      audio_stream* stream;
+
+      ///
+      /// The gain of the left channel.
+      ///
+      float left;
+
+      ///
+      /// The gain of the right channel.
+      ///
+      float right;
+    };
+
+    ///
+    /// The type of the voices on the game thread.
+    ///
+    struct playing_voice final
+    {
+      ///
+      /// The ID of the voice.
+      ///
+      std::uint32_t id;
+
+      ///
+      /// The stream of the voice, if it plays a stream.
+      ///
+      audio_stream* stream;
+
+      ///
+      /// The sound of the voice, if it plays a sound.
+      ///
+      std::shared_ptr<const sound_buffer> sound;
+    };
+
+    ///
+    /// Sends a command that starts a voice.
+    ///
+    /// \param c the command.
+    /// \param stream the stream of the voice, if it plays a stream.
+    /// \param sound the sound of the voice, if it plays a sound.
+    ///
+    /// \return The ID of the voice, or zero if the command queue is full or
+    /// too many voices are playing.
+    ///
+    std::uint32_t start(
+        command c,
+        audio_stream* stream,
+        std::shared_ptr<const sound_buffer> sound);
+
+    ///
+    /// Applies the commands that the game thread has sent.
+    ///
+    void apply_commands() noexcept;
+
+    ///
+    /// Mixes the next frames of the voices into the given samples.
+    ///
+    /// \param out a pointer to the samples, which must be zero.
+    /// \param frames the number of the frames, which must not be larger
+    /// than the scratch buffer.
+    /// \param level the SIMD level of the kernels.
+    ///
+    void mix_block(
+        float* out,
+        const std::size_t frames,
+        const simd_level level) noexcept;
+
+    ///
+    /// The queue of the commands from the game thread to the audio thread.
+    ///
+    spsc_queue<command> commands;
+
+    ///
+    /// The queue of the IDs of the voices that have ended from the audio
+    /// thread to the game thread. It holds as many IDs as the game thread
+    /// can have voices, so the audio thread never fails to report a voice.
+    ///
+    spsc_queue<std::uint32_t> ended;
+
+    ///
+    /// The largest number of the voices that the game thread can have.
+    ///
+    std::size_t max_playing;
+
+    ///
+    /// The voices on the audio thread. Only the first \c voice_count of them
+    /// are playing.
+    ///
+    std::vector<voice_state> voices;
+
+    ///
+    /// The number of the voices that are playing on the audio thread.
+    ///
+    std::size_t voice_count;
+
+    ///
+    /// The volume by which the mixed samples are multiplied.
+    ///
+    float master_volume;
+
+    ///
+    /// The memory into which the streams are read on the audio thread.
+    ///
+    std::vector<float> scratch;
+
+    ///
+    /// The SIMD instruction set used by the kernels.
+    ///
+    std::atomic<simd_level> level;
+
+    ///
+    /// The ID of the next voice.
+    ///
+    std::uint32_t next_id;
+
+    ///
+    /// The voices that are playing as far as the game thread knows.
+    ///
+    std::vector<playing_voice> playing;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_AUDIO_AUDIO_MIXER_H
@@ -0,0 +1,137 @@
+/// The declaration of the type of the resamplers which convert the sample
+/// rates of the sounds and the streams to the rate of the mixer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_AUDIO_AUDIO_RESAMPLER_H
+#define ODE_SYSTEMS_AUDIO_AUDIO_RESAMPLER_H
+
+#include <cstddef>
+
+namespace ode
+{
+  ///
+  /// The type of the linear resamplers of interleaved stereo samples. The
+  /// input may be given in blocks of any size, and the resampler carries
+  /// the last frame and the position between the frames from one block to
+  /// the next, so a stream is resampled as if it was a single block.
+  ///
+  /// The resamplers run on the threads that decode the audio, never in the
+  /// audio callback.
+  ///
+  class audio_resampler final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c audio_resampler.
+    ///
+    /// \param source_rate the sample rate of the input.
+    /// \param target_rate the sample rate of the output.
+    ///
+    audio_resampler(const int source_rate, const int target_rate);
+
+    ///
+    /// Constructs an object of the type \c audio_resampler by copying the
+    /// given object of the type \c audio_resampler.
+    ///
+    /// \param a an \c audio_resampler from which the new one is
+    /// constructed.
+    ///
+    audio_resampler(const audio_resampler& a) = default;
+
+    ///
+    /// Constructs an object of the type \c audio_resampler by moving the
+    /// given object of the type \c audio_resampler.
+    ///
+    /// \param a an \c audio_resampler from which the new one is
+    /// constructed.
+    ///
+    audio_resampler(audio_resampler&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c audio_resampler.
+    ///
+    ~audio_resampler() = default;
+
+    ///
+    /// Assigns the given object of the type \c audio_resampler to this one
+    /// by copying.
+    ///
+    /// \param a an \c audio_resampler from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_resampler& operator=(const audio_resampler& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c audio_resampler to this one
+    /// by moving.
+    ///
+    /// \param a an \c audio_resampler from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_resampler& operator=(audio_resampler&& a) = default;
+
+    ///
+    /// Resamples a block of frames.
+    ///
+    /// \param in a pointer to the input samples.
+    /// \param in_frames the number of the input frames.
+    /// \param out a pointer to the memory into which the output samples are
+    /// written.
+    /// \param out_frames the largest number of the output frames.
+    /// \param consumed the number of the input frames that were used. The
+    /// rest of them must be given again in the next block.
+    ///
+    /// \return The number of the output frames.
+    ///
+    std::size_t process(
+        const float* in,
+        const std::size_t in_frames,
+        float* out,
+        const std::size_t out_frames,
+        std::size_t& consumed) noexcept;
+
+    ///
+    /// Forgets the carried frame so that the next block starts a new sound.
+    ///
+    void reset() noexcept;
+
+    ///
+    /// Tells whether or not the sample rates are the same, in which case the
+    /// frames are copied as they are.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_identity() const noexcept;
+
+  private:
+    ///
+    /// The number of the input frames per output frame.
+    ///
+    double step;
+
+    ///
+    /// The position of the next output frame in the input frames, counted
+    /// from the carried frame.
+    ///
+    double phase;
+
+    ///
+    /// The left sample of the carried frame.
+    ///
+    float previous_left;
+
+    ///
+    /// The right sample of the carried frame.
+    ///
+    float previous_right;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_AUDIO_AUDIO_RESAMPLER_H
@@ -0,0 +1,175 @@
+/// The declaration of the type of the streams which decode long tracks
+/// while they are played.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_AUDIO_AUDIO_STREAM_H
+#define ODE_SYSTEMS_AUDIO_AUDIO_STREAM_H
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ode/framework/spsc_queue.h"
+#include "ode/systems/audio/audio_config.h"
+#include "ode/systems/audio/audio_resampler.h"
+#include "ode/systems/audio/wav_decoder.h"
+
+namespace ode
+{
+  ///
+  /// The type of the streams which decode long tracks in blocks while they
+  /// are played. The game thread decodes and resamples the track ahead of
+  /// the mixer into a lock-free queue of samples by calling \c pump, and the
+  /// audio callback takes the samples from the queue, so the callback never
+  /// reads files or allocates memory.
+  ///
+  /// The stream must outlive the voice that plays it.
+  ///
+  class audio_stream final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c audio_stream and fills its queue.
+    /// Throws \c std::runtime_error if the file can't be decoded.
+    ///
+    /// \param filename the name of the WAV file.
+    /// \param looping whether or not the track starts again when it ends.
+    /// \param frames the number of the frames that the stream keeps ahead of
+    /// the mixer.
+    ///
+    explicit audio_stream(
+        const std::string& filename,
+        const bool looping = false,
+        const std::size_t frames = audio_stream_frames);
+
+    ///
+    /// Constructs an object of the type \c audio_stream by copying the given
+    /// object of the type \c audio_stream.
+    ///
+    /// \param a an \c audio_stream from which the new one is constructed.
+    ///
+    audio_stream(const audio_stream& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c audio_stream by moving the given
+    /// object of the type \c audio_stream.
+    ///
+    /// \param a an \c audio_stream from which the new one is constructed.
+    ///
+    audio_stream(audio_stream&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c audio_stream.
+    ///
+    ~audio_stream() = default;
+
+    ///
+    /// Assigns the given object of the type \c audio_stream to this one by
+    /// copying.
+    ///
+    /// \param a an \c audio_stream from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_stream& operator=(const audio_stream& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c audio_stream to this one by
+    /// moving.
+    ///
+    /// \param a an \c audio_stream from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    audio_stream& operator=(audio_stream&& a) = delete;
+
+    ///
+    /// Decodes the track until the queue is full or the track ends. This
+    /// function may only be called on the thread that owns the stream.
+    ///
+    /// \return The number of the frames added to the queue.
+    ///
+    std::size_t pump();
+
+    ///
+    /// Takes the next decoded frames from the queue. This function may only
+    /// be called by the mixer.
+    ///
+    /// \param out a pointer to the memory into which the interleaved stereo
+    /// samples are written.
+    /// \param frames the largest number of the frames to take.
+    ///
+    /// \return The number of the frames taken.
+    ///
+    std::size_t read(float* out, const std::size_t frames) noexcept;
+
+    ///
+    /// Tells whether or not the whole track has been decoded and played.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_finished() const noexcept;
+
+    ///
+    /// Gives the number of the decoded frames in the queue.
+    ///
+    /// \return The number of the frames.
+    ///
+    std::size_t get_queued_frames() const noexcept;
+
+  private:
+    ///
+    /// The decoder of the track.
+    ///
+    wav_decoder decoder;
+
+    ///
+    /// The resampler from the rate of the track to the rate of the mixer.
+    ///
+    audio_resampler resampler;
+
+    ///
+    /// Whether or not the track starts again when it ends.
+    ///
+    bool loop;
+
+    ///
+    /// The frames decoded from the file which haven't been resampled.
+    ///
+    std::vector<float> decoded;
+
+    ///
+    /// The index of the first frame in \c decoded which hasn't been
+    /// resampled.
+    ///
+    std::size_t decoded_offset;
+
+    ///
+    /// The number of the frames in \c decoded.
+    ///
+    std::size_t decoded_frames;
+
+    ///
+    /// The resampled frames before they are added to the queue.
+    ///
+    std::vector<float> resampled;
+
+    ///
+    /// The queue of the samples from the game thread to the mixer.
+    ///
+    spsc_queue<float> samples;
+
+    ///
+    /// Whether or not the whole track has been added to the queue.
+    ///
+    std::atomic<bool> ended;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_AUDIO_AUDIO_STREAM_H
@@ -0,0 +1,108 @@
+/// The declaration of the type of the sounds which are decoded into memory.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_AUDIO_SOUND_BUFFER_H
+#define ODE_SYSTEMS_AUDIO_SOUND_BUFFER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ode
+{
+  ///
+  /// The type of the short sounds which are decoded into memory at once.
+  /// The samples are interleaved stereo samples at the sample rate of the
+  /// mixer, so the mixer plays them without converting them. The sound must
+  /// outlive the voices that play it.
+  ///
+  class sound_buffer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c sound_buffer by decoding the
+    /// given WAV file and resampling it to the rate of the mixer. Throws
+    /// \c std::runtime_error if the file can't be decoded.
+    ///
+    /// \param filename the name of the file.
+    ///
+    explicit sound_buffer(const std::string& filename);
+
+    ///
+    /// Constructs an object of the type \c sound_buffer from the given
+    /// samples.
+    ///
+    /// \param interleaved the interleaved stereo samples at the rate of the
+    /// mixer.
+    ///
+    explicit sound_buffer(std::vector<float> interleaved);
+
+    ///
+    /// Constructs an object of the type \c sound_buffer by copying the given
+    /// object of the type \c sound_buffer.
+    ///
+    /// \param a a \c sound_buffer from which the new one is constructed.
+    ///
+    sound_buffer(const sound_buffer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c sound_buffer by moving the given
+    /// object of the type \c sound_buffer.
+    ///
+    /// \param a a \c sound_buffer from which the new one is constructed.
+    ///
+    sound_buffer(sound_buffer&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c sound_buffer.
+    ///
+    ~sound_buffer() = default;
+
+    ///
+    /// Assigns the given object of the type \c sound_buffer to this one by
+    /// copying.
+    ///
+    /// \param a a \c sound_buffer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    sound_buffer& operator=(const sound_buffer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c sound_buffer to this one by
+    /// moving.
+    ///
+    /// \param a a \c sound_buffer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    sound_buffer& operator=(sound_buffer&& a) = default;
+
+    ///
+    /// Gives the samples of the sound.
+    ///
+    /// \return A pointer to the interleaved stereo samples.
+    ///
+    const float* get_samples() const noexcept;
+
+    ///
+    /// Gives the number of the frames in the sound.
+    ///
+    /// \return The number of the frames.
+    ///
+    std::size_t get_frame_count() const noexcept;
+
+  private:
+    ///
+    /// The interleaved stereo samples of the sound.
+    ///
+    std::vector<float> samples;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_AUDIO_SOUND_BUFFER_H
@@ -0,0 +1,169 @@
+/// The declaration of the type of the decoders which read WAV files in
+/// blocks.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_AUDIO_WAV_DECODER_H
+#define ODE_SYSTEMS_AUDIO_WAV_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ode
+{
+  ///
+  /// The type of the decoders which read the samples of WAV files in blocks
+  /// so that long tracks are never held in memory at once. The decoder
+  /// reads 8-, 16-, and 24-bit integer and 32-bit floating-point samples and
+  /// gives them as interleaved stereo samples in the range from -1 to 1. The
+  /// mono files are played on both of the channels, and only the first two
+  /// channels of the other files are used.
+  ///
+  class wav_decoder final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c wav_decoder and reads the header
+    /// of the given file. Throws \c std::runtime_error if the file can't be
+    /// opened or isn't a supported WAV file.
+    ///
+    /// \param filename the name of the file.
+    ///
+    explicit wav_decoder(const std::string& filename);
+
+    ///
+    /// Constructs an object of the type \c wav_decoder by copying the given
+    /// object of the type \c wav_decoder.
+    ///
+    /// \param a a \c wav_decoder from which the new one is constructed.
+    ///
+    wav_decoder(const wav_decoder& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c wav_decoder by moving the given
+    /// object of the type \c wav_decoder.
+    ///
+    /// \param a a \c wav_decoder from which the new one is constructed.
+    ///
+    wav_decoder(wav_decoder&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c wav_decoder.
+    ///
+    ~wav_decoder() = default;
+
+    ///
+    /// Assigns the given object of the type \c wav_decoder to this one by
+    /// copying.
+    ///
+    /// \param a a \c wav_decoder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    wav_decoder& operator=(const wav_decoder& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c wav_decoder to this one by
+    /// moving.
+    ///
+    /// \param a a \c wav_decoder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    wav_decoder& operator=(wav_decoder&& a) = default;
+
+    ///
+    /// Decodes the next frames of the file.
+    ///
+    /// \param out a pointer to the memory into which the interleaved stereo
+    /// samples are written. There must be room for two samples per frame.
+    /// \param frames the largest number of the frames to decode.
+    ///
+    /// \return The number of the frames decoded, which is less than
+    /// requested only at the end of the file.
+    ///
+    std::size_t read(float* out, const std::size_t frames);
+
+    ///
+    /// Moves the decoder back to the first frame of the file.
+    ///
+    void rewind();
+
+    ///
+    /// Gives the sample rate of the file in frames per second.
+    ///
+    /// \return The sample rate.
+    ///
+    int get_sample_rate() const noexcept;
+
+    ///
+    /// Gives the number of the frames in the file.
+    ///
+    /// \return The number of the frames.
+    ///
+    std::size_t get_frame_count() const noexcept;
+
+    ///
+    /// Gives the number of the frames that have been decoded since the start
+    /// of the file.
+    ///
+    /// \return The number of the frames.
+    ///
+    std::size_t get_position() const noexcept;
+
+  private:
+    ///
+    /// The file.
+    ///
+    std::ifstream file;
+
+    ///
+    /// The offset of the first sample in the file.
+    ///
+    std::streamoff data_offset;
+
+    ///
+    /// The number of the frames in the file.
+    ///
+    std::size_t frame_count;
+
+    ///
+    /// The number of the frames decoded since the start of the file.
+    ///
+    std::size_t position;
+
+    ///
+    /// The sample rate of the file.
+    ///
+    int sample_rate;
+
+    ///
+    /// The number of the channels in the file.
+    ///
+    int channels;
+
+    ///
+    /// The number of the bits in a sample.
+    ///
+    int bits;
+
+    ///
+    /// Whether or not the samples are floating-point numbers.
+    ///
+    bool floating_point;
+
+    ///
+    /// The bytes read from the file for the current block.
+    ///
+    std::vector<std::uint8_t> bytes;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_AUDIO_WAV_DECODER_H
@@ -0,0 +1,382 @@
+/// The declaration of the type of the systems which evaluate the animations
+/// of the tiles and the sprites.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_ANIMATION_SYSTEM_H
+#define ODE_SYSTEMS_GRAPHICS_ANIMATION_SYSTEM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ode/__config"
+#include "ode/systems/graphics/sprite.h"
+#include "ode/systems/graphics/tile_renderer.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe a single frame of an animation
+  /// in the format used by Tiled.
+  ///
+  struct animation_frame final
+  {
+    ///
+    /// The local ID of the tile of the frame in its tileset.
+    ///
+    std::uint32_t tile;
+
+    ///
+    /// The duration of the frame in milliseconds.
+    ///
+    std::uint32_t duration;
+  };
+
+  ///
+  /// The ways in which the sprite clips play their animations.
+  ///
+  enum class animation_playback
+  {
+    ///
+    /// The clip starts from the first frame and loops.
+    ///
+    loop,
+
+    ///
+    /// The clip starts from the first frame and stops on the last frame.
+    ///
+    once,
+
+    ///
+    /// The clip shows the frame that the animation shares with the tiles
+    /// and the other synchronized clips.
+    ///
+    synchronized
+  };
+
+  ///
+  /// The type of the systems which evaluate the animations of the tiles and
+  /// the sprites. The frames of all of the animations are stored in a single
+  /// array, and the shared frame of each of the animations is evaluated once
+  /// per tick however many tiles and clips show it.
+  ///
+  /// The animated tiles aren't written into the tile layers. Instead, the
+  /// system keeps a table that maps each of the global tile IDs to the ID of
+  /// the tile that is currently shown in its place, and the tile renderer
+  /// looks the tiles up from it on the GPU. The table changes only when a
+  /// shared frame changes.
+  ///
+  /// The sprite clips are held in contiguous arrays, indexed by the clip, and
+  /// they are all advanced in a single pass that writes the texture
+  /// coordinates of their current frames into the sprites with the same
+  /// indices.
+  ///
+  class animation_system final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c animation_system.
+    ///
+    animation_system();
+
+    ///
+    /// Constructs an object of the type \c animation_system by copying the
+    /// given object of the type \c animation_system.
+    ///
+    /// \param a an \c animation_system from which the new one is
+    /// constructed.
+    ///
+    animation_system(const animation_system& a) = default;
+
+    ///
+    /// Constructs an object of the type \c animation_system by moving the
+    /// given object of the type \c animation_system.
+    ///
+    /// \param a an \c animation_system from which the new one is
+    /// constructed.
+    ///
+    animation_system(animation_system&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c animation_system.
+    ///
+    ~animation_system() = default;
+
+    ///
+    /// Assigns the given object of the type \c animation_system to this one
+    /// by copying.
+    ///
+    /// \param a an \c animation_system from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    animation_system& operator=(const animation_system& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c animation_system to this one
+    /// by moving.
+    ///
+    /// \param a an \c animation_system from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    animation_system& operator=(animation_system&& a) = default;
+
+    ///
+    /// Adds an animation whose frames are tiles of the given tileset.
+    ///
+    /// \param sequence the frames of the animation. There must be at least
+    /// one frame, and the durations of the frames must be positive.
+    /// \param set the tileset of the frames.
+    ///
+    /// \return The index of the animation.
+    ///
+    std::uint32_t add_animation(
+        const std::vector<animation_frame>& sequence, const tileset& set);
+
+    ///
+    /// Makes the given tile show the shared frame of the given animation.
+    ///
+    /// \param gid the global tile ID of the tile without the flipping flags.
+    /// \param animation the index of the animation.
+    ///
+    void animate_tile(const std::uint32_t gid, const std::uint32_t animation)
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Adds a sprite clip. The clip gets the next free index, which is the
+    /// number of the clips before it was added.
+    ///
+    /// \param animation the index of the animation of the clip.
+    /// \param playback the way in which the clip plays the animation.
+    ///
+    /// \return The index of the clip.
+    ///
+    std::uint32_t add_clip(
+        const std::uint32_t animation,
+        const animation_playback playback = animation_playback::loop)
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Starts the given animation on the given clip from its first frame.
+    ///
+    /// \param clip the index of the clip.
+    /// \param animation the index of the animation.
+    /// \param playback the way in which the clip plays the animation.
+    ///
+    void play(
+        const std::uint32_t clip,
+        const std::uint32_t animation,
+        const animation_playback playback = animation_playback::loop)
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Removes the given clip. The last clip is moved into the place of the
+    /// removed one, so the sprites of the clips must be removed in the same
+    /// way.
+    ///
+    /// \param clip the index of the clip.
+    ///
+    void remove_clip(const std::uint32_t clip) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Advances the shared frames of the animations and updates the tile
+    /// table.
+    ///
+    /// \param delta the time step in milliseconds.
+    ///
+    void update(const std::uint32_t delta);
+
+    ///
+    /// Advances the shared frames of the animations, updates the tile table,
+    /// and advances the clips and writes the texture coordinates of their
+    /// frames into the given sprites.
+    ///
+    /// \param delta the time step in milliseconds.
+    /// \param sprites the sprites of the clips, indexed by the clip. There
+    /// must be at least as many sprites as there are clips.
+    ///
+    void update(const std::uint32_t delta, std::vector<sprite>& sprites);
+
+    ///
+    /// Gives the table that maps the global tile IDs to the IDs of the tiles
+    /// shown in their place. The IDs past the end of the table aren't
+    /// animated.
+    ///
+    /// \return A reference to the table.
+    ///
+    const std::vector<std::uint32_t>& get_tile_table() const noexcept;
+
+    ///
+    /// Tells whether or not the tile table has changed since this function
+    /// was last called and marks it as unchanged.
+    ///
+    /// \return A \c bool.
+    ///
+    bool take_tile_table_changed() noexcept;
+
+    ///
+    /// Gives the global tile ID of the shared frame of the given animation.
+    ///
+    /// \param animation the index of the animation.
+    ///
+    /// \return The global tile ID.
+    ///
+    std::uint32_t get_frame_tile(const std::uint32_t animation) const
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Gives the index of the current frame of the given clip.
+    ///
+    /// \param clip the index of the clip.
+    ///
+    /// \return The index of the frame in the frames of its animation.
+    ///
+    std::uint32_t get_clip_frame(const std::uint32_t clip) const
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Gives the number of the animations.
+    ///
+    /// \return The number of the animations.
+    ///
+    std::size_t get_animation_count() const noexcept;
+
+    ///
+    /// Gives the number of the clips.
+    ///
+    /// \return The number of the clips.
+    ///
+    std::size_t get_clip_count() const noexcept;
+
+  private:
+    ///
+    /// The type of the frames as they are evaluated.
+    ///
+    struct frame_data final
+    {
+      ///
+      /// The time at which the frame ends from the start of its animation in
+      /// milliseconds.
+      ///
+      std::uint32_t end;
+
+      ///
+      /// The global tile ID of the frame.
+      ///
+      std::uint32_t gid;
+
+      ///
+      /// The left texture coordinate of the frame.
+      ///
+      float u0;
+
+      ///
+      /// The top texture coordinate of the frame.
+      ///
+      float v0;
+
+      ///
+      /// The right texture coordinate of the frame.
+      ///
+      float u1;
+
+      ///
+      /// The bottom texture coordinate of the frame.
+      ///
+      float v1;
+    };
+
+    ///
+    /// The type of the tiles that are animated.
+    ///
+    struct animated_tile final
+    {
+      ///
+      /// The global tile ID of the tile.
+      ///
+      std::uint32_t gid;
+
+      ///
+      /// The index of the animation of the tile.
+      ///
+      std::uint32_t animation;
+    };
+
+    ///
+    /// Advances the shared frames and updates the tile table.
+    ///
+    /// \param delta the time step in milliseconds.
+    ///
+    void update_shared(const std::uint32_t delta);
+
+    ///
+    /// The frames of all of the animations.
+    ///
+    std::vector<frame_data> frames;
+
+    ///
+    /// The index of the first frame of each of the animations.
+    ///
+    std::vector<std::uint32_t> first_frames;
+
+    ///
+    /// The length of each of the animations in milliseconds.
+    ///
+    std::vector<std::uint32_t> lengths;
+
+    ///
+    /// The index of the shared frame of each of the animations.
+    ///
+    std::vector<std::uint32_t> shared_frames;
+
+    ///
+    /// The tiles that are animated.
+    ///
+    std::vector<animated_tile> tiles;
+
+    ///
+    /// The table that maps the global tile IDs to the IDs of the tiles shown
+    /// in their place.
+    ///
+    std::vector<std::uint32_t> tile_table;
+
+    ///
+    /// Whether or not the tile table has changed since it was last taken.
+    ///
+    bool tile_table_changed;
+
+    ///
+    /// The time from the start of the system in milliseconds.
+    ///
+    std::uint64_t clock;
+
+    ///
+    /// The animation of each of the clips.
+    ///
+    std::vector<std::uint32_t> clip_animations;
+
+    ///
+    /// The time from the start of the animation of each of the clips in
+    /// milliseconds.
+    ///
+    std::vector<std::uint32_t> clip_times;
+
+    ///
+    /// The index of the current frame of each of the clips.
+    ///
+    std::vector<std::uint32_t> clip_frames;
+
+    ///
+    /// The way in which each of the clips plays its animation.
+    ///
+    std::vector<animation_playback> clip_playbacks;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_ANIMATION_SYSTEM_H
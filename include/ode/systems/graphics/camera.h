@@ -0,0 +1,180 @@
+/// The declaration of the type of the cameras which describe the visible
+/// area of the world.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_CAMERA_H
+#define ODE_SYSTEMS_GRAPHICS_CAMERA_H
+
+#include <array>
+
+#include "ode/__config"
+#include "ode/systems/graphics/rectangle.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe the area of the window to which
+  /// the camera draws, in pixels.
+  ///
+  struct viewport final
+  {
+    ///
+    /// The x coordinate of the lower-left corner of the viewport.
+    ///
+    int x = 0;
+
+    ///
+    /// The y coordinate of the lower-left corner of the viewport.
+    ///
+    int y = 0;
+
+    ///
+    /// The width of the viewport.
+    ///
+    int width = 0;
+
+    ///
+    /// The height of the viewport.
+    ///
+    int height = 0;
+  };
+
+  ///
+  /// The type of the cameras. A camera looks at a point in the world with a
+  /// zoom factor, and the area of the world that it sees has the aspect
+  /// ratio of its viewport. At the zoom factor 1, one unit of the world is
+  /// one pixel.
+  ///
+  class camera final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c camera.
+    ///
+    camera();
+
+    ///
+    /// Constructs an object of the type \c camera.
+    ///
+    /// \param v the viewport of the camera.
+    ///
+    explicit camera(const viewport& v);
+
+    ///
+    /// Constructs an object of the type \c camera by copying the given
+    /// object of the type \c camera.
+    ///
+    /// \param a a \c camera from which the new one is constructed.
+    ///
+    camera(const camera& a) = default;
+
+    ///
+    /// Constructs an object of the type \c camera by moving the given object
+    /// of the type \c camera.
+    ///
+    /// \param a a \c camera from which the new one is constructed.
+    ///
+    camera(camera&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c camera.
+    ///
+    ~camera() = default;
+
+    ///
+    /// Assigns the given object of the type \c camera to this one by
+    /// copying.
+    ///
+    /// \param a a \c camera from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    camera& operator=(const camera& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c camera to this one by moving.
+    ///
+    /// \param a a \c camera from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    camera& operator=(camera&& a) = default;
+
+    ///
+    /// Sets the point in the world at the centre of the view.
+    ///
+    /// \param x the x coordinate of the point.
+    /// \param y the y coordinate of the point.
+    ///
+    void look_at(const float x, const float y) noexcept;
+
+    ///
+    /// Sets the zoom factor of the camera.
+    ///
+    /// \param z the zoom factor, which must be positive.
+    ///
+    void set_zoom(const float z) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Sets the viewport of the camera.
+    ///
+    /// \param v the viewport.
+    ///
+    void set_viewport(const viewport& v) noexcept;
+
+    ///
+    /// Gives the viewport of the camera.
+    ///
+    /// \return A reference to the viewport.
+    ///
+    const viewport& get_viewport() const noexcept;
+
+    ///
+    /// Gives the area of the world that the camera sees.
+    ///
+    /// \return The visible area.
+    ///
+    rectangle get_view() const noexcept;
+
+    ///
+    /// Gives the projection matrix which maps the visible area to the
+    /// viewport.
+    ///
+    /// \return The projection matrix in the column-major order.
+    ///
+    std::array<float, 16> get_projection() const noexcept;
+
+    ///
+    /// Sets the viewport of the camera as the OpenGL viewport.
+    ///
+    void apply() const;
+
+  private:
+    ///
+    /// The viewport of the camera.
+    ///
+    viewport port;
+
+    ///
+    /// The x coordinate of the point at the centre of the view.
+    ///
+    float x;
+
+    ///
+    /// The y coordinate of the point at the centre of the view.
+    ///
+    float y;
+
+    ///
+    /// The zoom factor.
+    ///
+    float zoom;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_CAMERA_H
@@ -0,0 +1,75 @@
+/// The declarations of the functions which submit only the visible parts of
+/// the world for drawing.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_CULLING_H
+#define ODE_SYSTEMS_GRAPHICS_CULLING_H
+
+#include <cstddef>
+#include <vector>
+
+#include "ode/systems/graphics/camera.h"
+#include "ode/systems/graphics/graphics_object.h"
+#include "ode/systems/graphics/sprite_batch.h"
+#include "ode/systems/graphics/tile_layer.h"
+#include "ode/systems/graphics/tile_renderer.h"
+#include "ode/systems/graphics/visibility_grid.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which tell how many objects were submitted for
+  /// drawing and how many were culled.
+  ///
+  struct culling_statistics final
+  {
+    ///
+    /// The number of the objects added to the sprite batch.
+    ///
+    std::size_t submitted = 0;
+
+    ///
+    /// The number of the objects that weren't visible.
+    ///
+    std::size_t culled = 0;
+  };
+
+  ///
+  /// Adds the graphics objects which are visible to the given camera to the
+  /// sprite batch. The IDs in the grid must be the indices of the objects.
+  ///
+  /// \param view_camera the camera.
+  /// \param grid the visibility grid which contains the objects.
+  /// \param objects the graphics objects.
+  /// \param batch the sprite batch to which the visible objects are added.
+  ///
+  /// \return The numbers of the submitted and the culled objects.
+  ///
+  culling_statistics submit_visible(
+      const camera& view_camera,
+      const visibility_grid& grid,
+      const std::vector<graphics_object>& objects,
+      sprite_batch& batch);
+
+  ///
+  /// Gives the range of the tiles of the layer which are visible to the given
+  /// camera when the layer is drawn with its upper-left corner at the origin.
+  ///
+  /// \param view_camera the camera.
+  /// \param layer the tile layer.
+  /// \param set the tileset that gives the size of the tiles.
+  ///
+  /// \return The range of the tiles, clipped to the layer.
+  ///
+  tile_range get_visible_tiles(
+      const camera& view_camera,
+      const tile_layer& layer,
+      const tileset& set) noexcept;
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_CULLING_H
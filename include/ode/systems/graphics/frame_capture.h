@@ -0,0 +1,178 @@
+/// The declaration of the type of the objects which read the rendered frames
+/// back from the GPU.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_FRAME_CAPTURE_H
+#define ODE_SYSTEMS_GRAPHICS_FRAME_CAPTURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "ode/systems/graphics/graphics_config.h"
+#include "ode/systems/graphics/image.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which read the rendered frames back from the
+  /// GPU. The pixels are read into a ring of pixel buffer objects and a
+  /// fence is placed after each read, so capturing a frame doesn't wait for
+  /// the GPU and the pixels are copied out only after the GPU has finished
+  /// writing them. The frames are given in the order in which they are
+  /// captured with their top row first.
+  ///
+  class frame_capture final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c frame_capture.
+    ///
+    /// \param width the width of the captured frames in pixels.
+    /// \param height the height of the captured frames in pixels.
+    /// \param buffer_count the number of the pixel buffers, which is the
+    /// number of the frames that can be waiting to be read at once.
+    ///
+    frame_capture(
+        const int width,
+        const int height,
+        const std::size_t buffer_count = frame_capture_buffers);
+
+    ///
+    /// Constructs an object of the type \c frame_capture by copying the given
+    /// object of the type \c frame_capture.
+    ///
+    /// \param a a \c frame_capture from which the new one is constructed.
+    ///
+    frame_capture(const frame_capture& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c frame_capture by moving the given
+    /// object of the type \c frame_capture.
+    ///
+    /// \param a a \c frame_capture from which the new one is constructed.
+    ///
+    frame_capture(frame_capture&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c frame_capture and deletes its
+    /// buffers and fences.
+    ///
+    ~frame_capture();
+
+    ///
+    /// Assigns the given object of the type \c frame_capture to this one by
+    /// copying.
+    ///
+    /// \param a a \c frame_capture from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    frame_capture& operator=(const frame_capture& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c frame_capture to this one by
+    /// moving.
+    ///
+    /// \param a a \c frame_capture from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    frame_capture& operator=(frame_capture&& a) = delete;
+
+    ///
+    /// Starts reading the pixels of the framebuffer that is bound for
+    /// reading into the next free pixel buffer.
+    ///
+    /// \return Whether or not the frame was captured. A frame isn't captured
+    /// if all of the buffers hold frames that haven't been read yet.
+    ///
+    bool capture();
+
+    ///
+    /// Gives the oldest captured frame if the GPU has finished writing it.
+    /// This never waits for the GPU.
+    ///
+    /// \return The frame or \c std::nullopt if there is no frame ready.
+    ///
+    std::optional<image> poll();
+
+    ///
+    /// Gives the oldest captured frame, waiting for the GPU to finish it if
+    /// necessary.
+    ///
+    /// \return The frame or \c std::nullopt if no frame has been captured.
+    ///
+    std::optional<image> wait();
+
+    ///
+    /// Gives the number of the captured frames that haven't been read.
+    ///
+    /// \return The number of the frames.
+    ///
+    inline std::size_t get_pending_count() const noexcept
+    {
+      return pending;
+    }
+
+  private:
+    ///
+    /// The type of the objects which hold a pixel buffer in the ring.
+    ///
+    struct slot final
+    {
+      ///
+      /// The name of the pixel buffer object.
+      ///
+      GLuint buffer;
+
+      ///
+      /// The fence placed after the pixels were read into the buffer.
+      ///
+      GLsync fence;
+    };
+
+    ///
+    /// Copies the oldest captured frame out of its buffer and frees the
+    /// buffer.
+    ///
+    /// \return The frame or \c std::nullopt if the buffer can't be mapped.
+    ///
+    std::optional<image> read();
+
+    ///
+    /// The width of the frames in pixels.
+    ///
+    int width;
+
+    ///
+    /// The height of the frames in pixels.
+    ///
+    int height;
+
+    ///
+    /// The pixel buffers.
+    ///
+    std::vector<slot> slots;
+
+    ///
+    /// The index of the buffer that holds the oldest captured frame.
+    ///
+    std::size_t first;
+
+    ///
+    /// The number of the captured frames that haven't been read.
+    ///
+    std::size_t pending;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_FRAME_CAPTURE_H
@@ -0,0 +1,119 @@
+/// The declarations and the definitions of the graphics system constants.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_GRAPHICS_CONFIG_H
+#define ODE_SYSTEMS_GRAPHICS_GRAPHICS_CONFIG_H
+
+#include <cstddef>
+
+namespace ode
+{
+  ///
+  /// The maximum number of the sprites drawn with a single draw call. The
+  /// sprites are drawn with 16-bit indices, so a draw call can't address
+  /// more than 65536 vertices.
+  ///
+#ifdef ODE_SPRITE_BATCH_SIZE
+  constexpr std::size_t sprite_batch_size = ODE_SPRITE_BATCH_SIZE;
+#else
+  constexpr std::size_t sprite_batch_size = 16384;
+#endif // !defined(ODE_SPRITE_BATCH_SIZE)
+
+  static_assert(
+      sprite_batch_size > 0 && sprite_batch_size * 4 <= 65536,
+      "The sprite batch size must fit in 16-bit indices");
+
+  ///
+  /// The number of the sprites which fit in a single region of the vertex
+  /// buffer of the sprite renderer. The sprites beyond this are written in
+  /// additional passes.
+  ///
+#ifdef ODE_SPRITE_BUFFER_SIZE
+  constexpr std::size_t sprite_buffer_size = ODE_SPRITE_BUFFER_SIZE;
+#else
+  constexpr std::size_t sprite_buffer_size = 65536;
+#endif // !defined(ODE_SPRITE_BUFFER_SIZE)
+
+  static_assert(
+      sprite_buffer_size >= sprite_batch_size,
+      "A region of the sprite buffer must hold at least one draw call");
+
+  ///
+  /// The number of the regions in the persistently mapped vertex buffer of
+  /// the sprite renderer. The CPU writes to one region while the GPU may
+  /// still read the others.
+  ///
+#ifdef ODE_SPRITE_BUFFER_REGIONS
+  constexpr std::size_t sprite_buffer_regions = ODE_SPRITE_BUFFER_REGIONS;
+#else
+  constexpr std::size_t sprite_buffer_regions = 3;
+#endif // !defined(ODE_SPRITE_BUFFER_REGIONS)
+
+  ///
+  /// The width and the height, in tiles, of the chunks in which the changed
+  /// tiles of the tile layers are uploaded to the GPU.
+  ///
+#ifdef ODE_TILE_CHUNK_SIZE
+  constexpr int tile_chunk_size = ODE_TILE_CHUNK_SIZE;
+#else
+  constexpr int tile_chunk_size = 32;
+#endif // !defined(ODE_TILE_CHUNK_SIZE)
+
+  ///
+  /// The width, in texels, of the textures into which the tables of the
+  /// animated tiles are uploaded. The tables are wrapped into rows so that
+  /// the global tile IDs don't run over the size limits of the textures.
+  ///
+#ifdef ODE_TILE_TABLE_WIDTH
+  constexpr int tile_table_width = ODE_TILE_TABLE_WIDTH;
+#else
+  constexpr int tile_table_width = 256;
+#endif // !defined(ODE_TILE_TABLE_WIDTH)
+
+  ///
+  /// The default width and height, in the world units, of the cells of the
+  /// visibility grids.
+  ///
+#ifdef ODE_VISIBILITY_CELL_SIZE
+  constexpr float visibility_cell_size = ODE_VISIBILITY_CELL_SIZE;
+#else
+  constexpr float visibility_cell_size = 256.0f;
+#endif // !defined(ODE_VISIBILITY_CELL_SIZE)
+
+  ///
+  /// The width and the height, in pixels, of the pages of the texture
+  /// atlases. The images larger than this are given pages of their own.
+  ///
+#ifdef ODE_TEXTURE_ATLAS_SIZE
+  constexpr int texture_atlas_size = ODE_TEXTURE_ATLAS_SIZE;
+#else
+  constexpr int texture_atlas_size = 2048;
+#endif // !defined(ODE_TEXTURE_ATLAS_SIZE)
+
+  ///
+  /// The number of the empty pixels left between the images in the texture
+  /// atlases so that the filtering doesn't blend the neighbouring images.
+  ///
+#ifdef ODE_TEXTURE_ATLAS_PADDING
+  constexpr int texture_atlas_padding = ODE_TEXTURE_ATLAS_PADDING;
+#else
+  constexpr int texture_atlas_padding = 1;
+#endif // !defined(ODE_TEXTURE_ATLAS_PADDING)
+
+  ///
+  /// The number of the pixel buffers into which the captured frames are read
+  /// so that the frames can be read back without waiting for the GPU.
+  ///
+#ifdef ODE_FRAME_CAPTURE_BUFFERS
+  constexpr std::size_t frame_capture_buffers = ODE_FRAME_CAPTURE_BUFFERS;
+#else
+  constexpr std::size_t frame_capture_buffers = 3;
+#endif // !defined(ODE_FRAME_CAPTURE_BUFFERS)
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_GRAPHICS_CONFIG_H
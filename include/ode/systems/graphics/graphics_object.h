@@ -8,6 +8,8 @@
 #ifndef ODE_SYSTEMS_GRAPHICS_GRAPHICS_OBJECT_H
 #define ODE_SYSTEMS_GRAPHICS_GRAPHICS_OBJECT_H
 
+#include "ode/systems/graphics/rectangle.h"
+#include "ode/systems/graphics/sprite.h"
 #include "ode/systems/object.h"
 #include "ode/systems/system_type.h"
 
@@ -29,6 +31,16 @@ namespace ode
     ///
     graphics_object() = default;
 
+    ///
+    /// Constructs an object of the type \c graphics_object which is drawn as
+    /// the given sprite.
+    ///
+    /// \param s the sprite.
+    ///
+    explicit graphics_object(const sprite& s) : spr{s}
+    {
+    }
+
     ///
     /// Constructs an object of the type \c graphics_object by copying the
     /// given object of the type \c graphics_object.
@@ -69,6 +81,42 @@ namespace ode
     /// \return A reference to \c *this.
     ///
     graphics_object& operator=(graphics_object&& a) = default;
+
+    ///
+    /// Gives the sprite as which the object is drawn.
+    ///
+    /// \return A reference to the sprite.
+    ///
+    inline const sprite& get_sprite() const noexcept
+    {
+      return spr;
+    }
+
+    ///
+    /// Sets the sprite as which the object is drawn.
+    ///
+    /// \param s the sprite.
+    ///
+    inline void set_sprite(const sprite& s) noexcept
+    {
+      spr = s;
+    }
+
+    ///
+    /// Gives the bounds of the object in the world.
+    ///
+    /// \return The bounding rectangle of the sprite of the object.
+    ///
+    inline rectangle get_bounds() const noexcept
+    {
+      return {spr.x, spr.y, spr.x + spr.width, spr.y + spr.height};
+    }
+
+  private:
+    ///
+    /// The sprite as which the object is drawn.
+    ///
+    sprite spr;
   };
 
 } // namespace ode
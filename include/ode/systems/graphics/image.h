@@ -0,0 +1,132 @@
+/// The declarations of the type of the decoded images and the functions
+/// which decode and edit them.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_IMAGE_H
+#define ODE_SYSTEMS_GRAPHICS_IMAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ode
+{
+  ///
+  /// The type of the decoded images. The pixels are stored row by row from
+  /// the top with four 8-bit channels, red, green, blue, and alpha, in each
+  /// pixel.
+  ///
+  struct image final
+  {
+    ///
+    /// The width of the image in pixels.
+    ///
+    int width = 0;
+
+    ///
+    /// The height of the image in pixels.
+    ///
+    int height = 0;
+
+    ///
+    /// The channels of the pixels.
+    ///
+    std::vector<std::uint8_t> pixels{};
+  };
+
+  ///
+  /// Creates a transparent image of the given size.
+  ///
+  /// \param width the width of the image in pixels.
+  /// \param height the height of the image in pixels.
+  ///
+  /// \return The image.
+  ///
+  image make_image(const int width, const int height);
+
+  ///
+  /// Decodes an image file.
+  ///
+  /// \param filename the name of the file.
+  ///
+  /// \return The image or \c std::nullopt if the file can't be decoded.
+  ///
+  std::optional<image> load_image(const std::string& filename);
+
+  ///
+  /// Decodes an image from the contents of an image file in memory.
+  ///
+  /// \param data the contents of the file.
+  /// \param size the size of the contents in bytes.
+  ///
+  /// \return The image or \c std::nullopt if the data can't be decoded.
+  ///
+  std::optional<image> load_image(
+      const std::uint8_t* data, const std::size_t size);
+
+  ///
+  /// Parses a colour written as a hexadecimal string, for example
+  /// \c "#ff00ff", as the colours are written in the Tiled maps.
+  ///
+  /// \param s the string.
+  ///
+  /// \return The colour as \c 0xRRGGBB or \c std::nullopt if the string
+  /// isn't a colour.
+  ///
+  std::optional<std::uint32_t> parse_colour(std::string_view s) noexcept;
+
+  ///
+  /// Makes the pixels of the given colour transparent.
+  ///
+  /// \param img the image.
+  /// \param colour the colour as \c 0xRRGGBB.
+  ///
+  /// \return The number of the pixels made transparent.
+  ///
+  std::size_t apply_colour_key(image& img, const std::uint32_t colour) noexcept;
+
+  ///
+  /// Copies an image into another image. The source image must fit in the
+  /// target image at the given position.
+  ///
+  /// \param source the image to copy.
+  /// \param target the image to which the source is copied.
+  /// \param x the column of the target to which the left edge of the source
+  /// is copied.
+  /// \param y the row of the target to which the top edge of the source is
+  /// copied.
+  ///
+  void blit(const image& source, image& target, const int x, const int y);
+
+  ///
+  /// Writes an image into a PNG file.
+  ///
+  /// \param img the image.
+  /// \param filename the name of the file.
+  ///
+  /// \return Whether or not the file was written.
+  ///
+  bool save_image(const image& img, const std::string& filename);
+
+  ///
+  /// Writes the pixels of an image into a file as they are, without a
+  /// header. This is faster than writing a PNG file when many frames are
+  /// dumped.
+  ///
+  /// \param img the image.
+  /// \param filename the name of the file.
+  ///
+  /// \return Whether or not the file was written.
+  ///
+  bool save_raw_image(const image& img, const std::string& filename);
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_IMAGE_H
@@ -0,0 +1,248 @@
+/// The declaration of the type of the particle systems.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_PARTICLE_SYSTEM_H
+#define ODE_SYSTEMS_GRAPHICS_PARTICLE_SYSTEM_H
+
+#include <cstddef>
+
+#include "ode/aligned_allocator.h"
+#include "ode/simd.h"
+#include "ode/systems/graphics/sprite.h"
+#include "ode/systems/graphics/sprite_batch.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe a single particle when it is
+  /// emitted or read back.
+  ///
+  struct particle final
+  {
+    ///
+    /// The x coordinate of the centre of the particle.
+    ///
+    float x = 0.0f;
+
+    ///
+    /// The y coordinate of the centre of the particle.
+    ///
+    float y = 0.0f;
+
+    ///
+    /// The velocity of the particle along the x axis, in units per second.
+    ///
+    float velocity_x = 0.0f;
+
+    ///
+    /// The velocity of the particle along the y axis, in units per second.
+    ///
+    float velocity_y = 0.0f;
+
+    ///
+    /// The time that the particle has left to live, in seconds.
+    ///
+    float lifetime = 0.0f;
+  };
+
+  ///
+  /// The type of the particle systems. The particles are stored as a
+  /// structure of arrays, so the positions, the velocities, and the
+  /// lifetimes are each in an aligned array of their own, and the update
+  /// runs a SIMD kernel over the arrays. The kernel is chosen at runtime by
+  /// the instruction sets of the processor. The expired particles are
+  /// removed by compacting the arrays, which keeps the order of the living
+  /// particles.
+  ///
+  /// All of the particles of a system are drawn as copies of the same
+  /// sprite centred at their positions.
+  ///
+  class particle_system final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c particle_system.
+    ///
+    /// \param capacity the maximum number of the living particles.
+    /// \param appearance the sprite by which the particles are drawn. Its
+    /// position is ignored.
+    ///
+    particle_system(const std::size_t capacity, const sprite& appearance);
+
+    ///
+    /// Constructs an object of the type \c particle_system by copying the
+    /// given object of the type \c particle_system.
+    ///
+    /// \param a a \c particle_system from which the new one is constructed.
+    ///
+    particle_system(const particle_system& a) = default;
+
+    ///
+    /// Constructs an object of the type \c particle_system by moving the
+    /// given object of the type \c particle_system.
+    ///
+    /// \param a a \c particle_system from which the new one is constructed.
+    ///
+    particle_system(particle_system&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c particle_system.
+    ///
+    ~particle_system() = default;
+
+    ///
+    /// Assigns the given object of the type \c particle_system to this one
+    /// by copying.
+    ///
+    /// \param a a \c particle_system from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    particle_system& operator=(const particle_system& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c particle_system to this one
+    /// by moving.
+    ///
+    /// \param a a \c particle_system from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    particle_system& operator=(particle_system&& a) = default;
+
+    ///
+    /// Adds a particle to the system.
+    ///
+    /// \param p the particle.
+    ///
+    /// \return Whether or not the particle was added. It isn't if the system
+    /// is full or the lifetime of the particle isn't positive.
+    ///
+    bool emit(const particle& p) noexcept;
+
+    ///
+    /// Removes all of the particles.
+    ///
+    void clear() noexcept;
+
+    ///
+    /// Moves the particles, ages them, and removes the ones that expire.
+    ///
+    /// \param delta the time step in seconds.
+    ///
+    void update(const float delta) noexcept;
+
+    ///
+    /// Adds the sprites of the living particles to the given batch.
+    ///
+    /// \param batch the sprite batch.
+    ///
+    void draw(sprite_batch& batch) const;
+
+    ///
+    /// Sets the acceleration applied to all of the particles.
+    ///
+    /// \param x the acceleration along the x axis, in units per second
+    /// squared.
+    /// \param y the acceleration along the y axis, in units per second
+    /// squared.
+    ///
+    void set_gravity(const float x, const float y) noexcept;
+
+    ///
+    /// Sets the SIMD level of the kernel that updates the particles. A level
+    /// higher than the processor supports is lowered to the supported one.
+    ///
+    /// \param level the SIMD level.
+    ///
+    void set_simd_level(const simd_level level) noexcept;
+
+    ///
+    /// Gives the SIMD level of the kernel that updates the particles.
+    ///
+    /// \return The SIMD level.
+    ///
+    simd_level get_simd_level() const noexcept;
+
+    ///
+    /// Gives the number of the living particles.
+    ///
+    /// \return The number of the particles.
+    ///
+    std::size_t get_count() const noexcept;
+
+    ///
+    /// Gives the maximum number of the living particles.
+    ///
+    /// \return The capacity.
+    ///
+    std::size_t get_capacity() const noexcept;
+
+    ///
+    /// Gives the particle at the given index.
+    ///
+    /// \param i the index of the particle.
+    ///
+    /// \return The particle.
+    ///
+    particle get(const std::size_t i) const;
+
+  private:
+    ///
+    /// The x coordinates of the particles.
+    ///
+    aligned_vector<float> xs;
+
+    ///
+    /// The y coordinates of the particles.
+    ///
+    aligned_vector<float> ys;
+
+    ///
+    /// The velocities of the particles along the x axis.
+    ///
+    aligned_vector<float> velocities_x;
+
+    ///
+    /// The velocities of the particles along the y axis.
+    ///
+    aligned_vector<float> velocities_y;
+
+    ///
+    /// The remaining lifetimes of the particles.
+    ///
+    aligned_vector<float> lifetimes;
+
+    ///
+    /// The number of the living particles.
+    ///
+    std::size_t count;
+
+    ///
+    /// The sprite by which the particles are drawn.
+    ///
+    sprite appearance;
+
+    ///
+    /// The acceleration along the x axis.
+    ///
+    float gravity_x;
+
+    ///
+    /// The acceleration along the y axis.
+    ///
+    float gravity_y;
+
+    ///
+    /// The SIMD level of the kernel that updates the particles.
+    ///
+    simd_level level;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_PARTICLE_SYSTEM_H
@@ -0,0 +1,57 @@
+/// The declaration of the type of the axis-aligned rectangles.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_RECTANGLE_H
+#define ODE_SYSTEMS_GRAPHICS_RECTANGLE_H
+
+namespace ode
+{
+  ///
+  /// The type of the axis-aligned rectangles in the world coordinates, in
+  /// which the y axis points down.
+  ///
+  struct rectangle final
+  {
+    ///
+    /// The x coordinate of the left edge of the rectangle.
+    ///
+    float left = 0.0f;
+
+    ///
+    /// The y coordinate of the top edge of the rectangle.
+    ///
+    float top = 0.0f;
+
+    ///
+    /// The x coordinate of the right edge of the rectangle.
+    ///
+    float right = 0.0f;
+
+    ///
+    /// The y coordinate of the bottom edge of the rectangle.
+    ///
+    float bottom = 0.0f;
+  };
+
+  ///
+  /// Tells whether or not the given rectangles overlap. Rectangles that only
+  /// touch each other don't overlap.
+  ///
+  /// \param a the first rectangle.
+  /// \param b the second rectangle.
+  ///
+  /// \return A \c bool.
+  ///
+  constexpr bool intersects(const rectangle& a, const rectangle& b) noexcept
+  {
+    return a.left < b.right && b.left < a.right && a.top < b.bottom &&
+        b.top < a.bottom;
+  }
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_RECTANGLE_H
@@ -0,0 +1,206 @@
+/// The declarations of the types of the recorded draw commands and the
+/// buffers into which they are recorded.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_RENDER_COMMAND_H
+#define ODE_SYSTEMS_GRAPHICS_RENDER_COMMAND_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe a single recorded draw call. The
+  /// command holds only the names of the OpenGL objects and the ranges of the
+  /// buffers, so it can be recorded without an OpenGL context. The uniforms
+  /// of the program must be set before the commands are submitted.
+  ///
+  struct render_command final
+  {
+    ///
+    /// The key by which the commands are sorted before they are submitted.
+    ///
+    std::uint64_t key;
+
+    ///
+    /// The name of the shader program.
+    ///
+    std::uint32_t program;
+
+    ///
+    /// The name of the vertex array object.
+    ///
+    std::uint32_t vertex_array;
+
+    ///
+    /// The name of the texture bound to the first texture unit, or \c 0 if
+    /// the draw call uses no texture.
+    ///
+    std::uint32_t texture;
+
+    ///
+    /// The kind of the primitives, for example \c GL_TRIANGLES.
+    ///
+    std::uint32_t mode;
+
+    ///
+    /// The type of the indices, for example \c GL_UNSIGNED_SHORT, or \c 0 if
+    /// the draw call isn't indexed.
+    ///
+    std::uint32_t index_type;
+
+    ///
+    /// The first vertex or, if the draw call is indexed, the byte offset of
+    /// the first index in the index buffer.
+    ///
+    std::uint32_t first;
+
+    ///
+    /// The number of the vertices or the indices.
+    ///
+    std::uint32_t count;
+
+    ///
+    /// The number of the instances.
+    ///
+    std::uint32_t instance_count;
+
+    ///
+    /// The value added to the indices of an indexed draw call.
+    ///
+    std::int32_t base_vertex;
+  };
+
+  ///
+  /// Makes the sort key of a command. The commands are ordered first by
+  /// their layer, then by their program and texture so that the state
+  /// changes are grouped, and last by their depth within the same state.
+  ///
+  /// \param layer the layer of the command.
+  /// \param program the shader program of the command.
+  /// \param texture the texture of the command.
+  /// \param depth the order of the commands with the same state.
+  ///
+  /// \return The sort key.
+  ///
+  constexpr std::uint64_t make_sort_key(
+      const std::uint8_t layer,
+      const std::uint32_t program,
+      const std::uint32_t texture,
+      const std::uint16_t depth) noexcept
+  {
+    return static_cast<std::uint64_t>(layer) << 56 |
+           static_cast<std::uint64_t>(program & 0xffffu) << 40 |
+           static_cast<std::uint64_t>(texture & 0xffffffu) << 16 |
+           static_cast<std::uint64_t>(depth);
+  }
+
+  ///
+  /// The type of the linear buffers into which the draw commands are
+  /// recorded. A buffer is meant to be used by a single thread, and the
+  /// memory it allocates is kept when it is cleared.
+  ///
+  class command_buffer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c command_buffer.
+    ///
+    command_buffer() = default;
+
+    ///
+    /// Constructs an object of the type \c command_buffer by copying the
+    /// given object of the type \c command_buffer.
+    ///
+    /// \param a a \c command_buffer from which the new one is constructed.
+    ///
+    command_buffer(const command_buffer& a) = default;
+
+    ///
+    /// Constructs an object of the type \c command_buffer by moving the given
+    /// object of the type \c command_buffer.
+    ///
+    /// \param a a \c command_buffer from which the new one is constructed.
+    ///
+    command_buffer(command_buffer&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c command_buffer.
+    ///
+    ~command_buffer() = default;
+
+    ///
+    /// Assigns the given object of the type \c command_buffer to this one by
+    /// copying.
+    ///
+    /// \param a a \c command_buffer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    command_buffer& operator=(const command_buffer& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c command_buffer to this one by
+    /// moving.
+    ///
+    /// \param a a \c command_buffer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    command_buffer& operator=(command_buffer&& a) = default;
+
+    ///
+    /// Records a command into the buffer.
+    ///
+    /// \param command the command.
+    ///
+    inline void push(const render_command& command)
+    {
+      commands.push_back(command);
+    }
+
+    ///
+    /// Removes the commands from the buffer.
+    ///
+    inline void clear() noexcept
+    {
+      commands.clear();
+    }
+
+    ///
+    /// Gives the commands in the buffer in the order in which they were
+    /// recorded.
+    ///
+    /// \return A reference to the commands.
+    ///
+    inline const std::vector<render_command>& get_commands() const noexcept
+    {
+      return commands;
+    }
+
+    ///
+    /// Gives the number of the commands in the buffer.
+    ///
+    /// \return The number of the commands.
+    ///
+    inline std::size_t size() const noexcept
+    {
+      return commands.size();
+    }
+
+  private:
+    ///
+    /// The recorded commands.
+    ///
+    std::vector<render_command> commands;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_RENDER_COMMAND_H
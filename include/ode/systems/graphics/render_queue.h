@@ -0,0 +1,174 @@
+/// The declaration of the type of the queues which sort the recorded draw
+/// commands and submit them to OpenGL.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_RENDER_QUEUE_H
+#define ODE_SYSTEMS_GRAPHICS_RENDER_QUEUE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "ode/systems/graphics/render_command.h"
+#include "ode/systems/graphics/render_state_cache.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which hold the statistics of a submission of
+  /// the draw commands.
+  ///
+  struct render_statistics final
+  {
+    ///
+    /// The number of the draw calls.
+    ///
+    std::size_t draws;
+
+    ///
+    /// The number of the state changes that were issued.
+    ///
+    std::size_t state_changes;
+
+    ///
+    /// The number of the redundant state changes that were skipped.
+    ///
+    std::size_t skipped_changes;
+  };
+
+  ///
+  /// Sorts the given commands by their keys with a stable radix sort. The
+  /// passes over the bytes in which all of the keys are equal are skipped.
+  ///
+  /// \param commands the commands.
+  /// \param scratch the buffer which is used during the sort.
+  ///
+  void sort_commands(
+      std::vector<render_command>& commands,
+      std::vector<render_command>& scratch);
+
+  ///
+  /// The type of the queues which collect the draw commands of a frame. Each
+  /// thread that records commands uses its own command buffer, so the
+  /// recording needs no locks. The buffers are merged and sorted by their
+  /// keys when the queue is submitted, and the commands are issued through a
+  /// state cache that skips the redundant bindings.
+  ///
+  class render_queue final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c render_queue.
+    ///
+    /// \param buffer_count the number of the command buffers.
+    ///
+    explicit render_queue(const std::size_t buffer_count = 1);
+
+    ///
+    /// Constructs an object of the type \c render_queue by copying the given
+    /// object of the type \c render_queue.
+    ///
+    /// \param a a \c render_queue from which the new one is constructed.
+    ///
+    render_queue(const render_queue& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c render_queue by moving the given
+    /// object of the type \c render_queue.
+    ///
+    /// \param a a \c render_queue from which the new one is constructed.
+    ///
+    render_queue(render_queue&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c render_queue.
+    ///
+    ~render_queue() = default;
+
+    ///
+    /// Assigns the given object of the type \c render_queue to this one by
+    /// copying.
+    ///
+    /// \param a a \c render_queue from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    render_queue& operator=(const render_queue& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c render_queue to this one by
+    /// moving.
+    ///
+    /// \param a a \c render_queue from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    render_queue& operator=(render_queue&& a) = default;
+
+    ///
+    /// Gives the command buffer with the given index. Each of the buffers
+    /// must be used by at most one thread at a time.
+    ///
+    /// \param index the index of the buffer.
+    ///
+    /// \return A reference to the buffer.
+    ///
+    command_buffer& get_buffer(const std::size_t index);
+
+    ///
+    /// Gives the number of the command buffers.
+    ///
+    /// \return The number of the buffers.
+    ///
+    inline std::size_t get_buffer_count() const noexcept
+    {
+      return buffers.size();
+    }
+
+    ///
+    /// Merges the command buffers and sorts the commands by their keys. The
+    /// commands with equal keys are kept in the order of the buffers and the
+    /// order in which they were recorded.
+    ///
+    /// \return A reference to the sorted commands.
+    ///
+    const std::vector<render_command>& sort();
+
+    ///
+    /// Sorts the recorded commands, issues them to OpenGL through the given
+    /// state cache, and clears the command buffers.
+    ///
+    /// \param state the state cache.
+    ///
+    /// \return The statistics of the submission.
+    ///
+    render_statistics submit(render_state_cache& state);
+
+    ///
+    /// Removes the commands from the command buffers.
+    ///
+    void clear() noexcept;
+
+  private:
+    ///
+    /// The command buffers.
+    ///
+    std::vector<command_buffer> buffers;
+
+    ///
+    /// The merged commands.
+    ///
+    std::vector<render_command> commands;
+
+    ///
+    /// The buffer which is used while the commands are sorted.
+    ///
+    std::vector<render_command> scratch;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_RENDER_QUEUE_H
@@ -0,0 +1,151 @@
+/// The declaration of the type of the caches which skip the redundant
+/// OpenGL state changes.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_RENDER_STATE_CACHE_H
+#define ODE_SYSTEMS_GRAPHICS_RENDER_STATE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ode
+{
+  ///
+  /// The type of the caches which remember the OpenGL objects that are
+  /// bound and issue the OpenGL calls only when the bound objects change.
+  /// The cache assumes that nothing else changes the bindings, so it must be
+  /// invalidated after the OpenGL calls made outside of it.
+  ///
+  class render_state_cache final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c render_state_cache.
+    ///
+    render_state_cache();
+
+    ///
+    /// Constructs an object of the type \c render_state_cache by copying the
+    /// given object of the type \c render_state_cache.
+    ///
+    /// \param a a \c render_state_cache from which the new one is
+    /// constructed.
+    ///
+    render_state_cache(const render_state_cache& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c render_state_cache by moving the
+    /// given object of the type \c render_state_cache.
+    ///
+    /// \param a a \c render_state_cache from which the new one is
+    /// constructed.
+    ///
+    render_state_cache(render_state_cache&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c render_state_cache.
+    ///
+    ~render_state_cache() = default;
+
+    ///
+    /// Assigns the given object of the type \c render_state_cache to this
+    /// one by copying.
+    ///
+    /// \param a a \c render_state_cache from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    render_state_cache& operator=(const render_state_cache& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c render_state_cache to this
+    /// one by moving.
+    ///
+    /// \param a a \c render_state_cache from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    render_state_cache& operator=(render_state_cache&& a) = delete;
+
+    ///
+    /// Makes the given shader program current.
+    ///
+    /// \param program the name of the shader program.
+    ///
+    void use_program(const std::uint32_t program);
+
+    ///
+    /// Binds the given vertex array object.
+    ///
+    /// \param vertex_array the name of the vertex array object.
+    ///
+    void bind_vertex_array(const std::uint32_t vertex_array);
+
+    ///
+    /// Binds the given texture to the first texture unit.
+    ///
+    /// \param texture the name of the texture.
+    ///
+    void bind_texture(const std::uint32_t texture);
+
+    ///
+    /// Forgets the bound objects so that the next calls bind them again.
+    ///
+    void invalidate() noexcept;
+
+    ///
+    /// Gives the number of the OpenGL calls that the cache has issued.
+    ///
+    /// \return The number of the state changes.
+    ///
+    inline std::size_t get_change_count() const noexcept
+    {
+      return change_count;
+    }
+
+    ///
+    /// Gives the number of the redundant OpenGL calls that the cache has
+    /// skipped.
+    ///
+    /// \return The number of the skipped state changes.
+    ///
+    inline std::size_t get_skip_count() const noexcept
+    {
+      return skip_count;
+    }
+
+  private:
+    ///
+    /// The current shader program, if it is known.
+    ///
+    std::optional<std::uint32_t> program;
+
+    ///
+    /// The bound vertex array object, if it is known.
+    ///
+    std::optional<std::uint32_t> vertex_array;
+
+    ///
+    /// The texture bound to the first texture unit, if it is known.
+    ///
+    std::optional<std::uint32_t> texture;
+
+    ///
+    /// The number of the OpenGL calls that the cache has issued.
+    ///
+    std::size_t change_count;
+
+    ///
+    /// The number of the OpenGL calls that the cache has skipped.
+    ///
+    std::size_t skip_count;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_RENDER_STATE_CACHE_H
@@ -0,0 +1,145 @@
+/// The declaration of the type of the offscreen targets into which the
+/// frames can be rendered.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_RENDER_TARGET_H
+#define ODE_SYSTEMS_GRAPHICS_RENDER_TARGET_H
+
+#include <cstdint>
+
+namespace ode
+{
+  ///
+  /// The type of the offscreen targets into which the frames are rendered
+  /// instead of the window. The target is a framebuffer object with an RGBA8
+  /// colour texture, so the rendering doesn't depend on the window system
+  /// and can be read back even if the window is hidden or the video driver
+  /// has no visible surface.
+  ///
+  class render_target final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c render_target.
+    ///
+    /// \param width the width of the target in pixels.
+    /// \param height the height of the target in pixels.
+    ///
+    /// \exception std::runtime_error Thrown if the framebuffer is
+    /// incomplete.
+    ///
+    render_target(const int width, const int height);
+
+    ///
+    /// Constructs an object of the type \c render_target by copying the given
+    /// object of the type \c render_target.
+    ///
+    /// \param a a \c render_target from which the new one is constructed.
+    ///
+    render_target(const render_target& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c render_target by moving the given
+    /// object of the type \c render_target.
+    ///
+    /// \param a a \c render_target from which the new one is constructed.
+    ///
+    render_target(render_target&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c render_target and deletes its
+    /// framebuffer and texture.
+    ///
+    ~render_target();
+
+    ///
+    /// Assigns the given object of the type \c render_target to this one by
+    /// copying.
+    ///
+    /// \param a a \c render_target from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    render_target& operator=(const render_target& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c render_target to this one by
+    /// moving.
+    ///
+    /// \param a a \c render_target from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    render_target& operator=(render_target&& a) = delete;
+
+    ///
+    /// Binds the target as the framebuffer into which the frames are drawn
+    /// and from which the pixels are read, and sets the viewport to cover
+    /// it.
+    ///
+    void bind() const;
+
+    ///
+    /// Binds the default framebuffer of the window again.
+    ///
+    void unbind() const;
+
+    ///
+    /// Gives the name of the colour texture of the target.
+    ///
+    /// \return The name of the texture.
+    ///
+    inline std::uint32_t get_texture() const noexcept
+    {
+      return texture;
+    }
+
+    ///
+    /// Gives the width of the target.
+    ///
+    /// \return The width in pixels.
+    ///
+    inline int get_width() const noexcept
+    {
+      return width;
+    }
+
+    ///
+    /// Gives the height of the target.
+    ///
+    /// \return The height in pixels.
+    ///
+    inline int get_height() const noexcept
+    {
+      return height;
+    }
+
+  private:
+    ///
+    /// The width of the target in pixels.
+    ///
+    int width;
+
+    ///
+    /// The height of the target in pixels.
+    ///
+    int height;
+
+    ///
+    /// The name of the framebuffer object.
+    ///
+    std::uint32_t framebuffer;
+
+    ///
+    /// The name of the colour texture.
+    ///
+    std::uint32_t texture;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_RENDER_TARGET_H
@@ -0,0 +1,187 @@
+/// The declaration of the type of the packers which place rectangles in the
+/// pages of the texture atlases.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_SKYLINE_PACKER_H
+#define ODE_SYSTEMS_GRAPHICS_SKYLINE_PACKER_H
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "ode/__config"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe an area of an atlas page in
+  /// pixels.
+  ///
+  struct atlas_region final
+  {
+    ///
+    /// The column of the left edge of the area.
+    ///
+    int x = 0;
+
+    ///
+    /// The row of the top edge of the area.
+    ///
+    int y = 0;
+
+    ///
+    /// The width of the area.
+    ///
+    int width = 0;
+
+    ///
+    /// The height of the area.
+    ///
+    int height = 0;
+  };
+
+  ///
+  /// The type of the packers which place rectangles in an area with the
+  /// skyline bottom-left heuristic. The packer keeps the upper edge of the
+  /// used area as a list of horizontal segments and places each rectangle on
+  /// the segment where its bottom edge stays the lowest. The space below the
+  /// overhangs isn't reused, which is a good trade-off for the tileset images
+  /// that have similar sizes.
+  ///
+  class skyline_packer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c skyline_packer.
+    ///
+    /// \param width the width of the area.
+    /// \param height the height of the area.
+    ///
+    skyline_packer(const int width, const int height) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Constructs an object of the type \c skyline_packer by copying the
+    /// given object of the type \c skyline_packer.
+    ///
+    /// \param a a \c skyline_packer from which the new one is constructed.
+    ///
+    skyline_packer(const skyline_packer& a) = default;
+
+    ///
+    /// Constructs an object of the type \c skyline_packer by moving the given
+    /// object of the type \c skyline_packer.
+    ///
+    /// \param a a \c skyline_packer from which the new one is constructed.
+    ///
+    skyline_packer(skyline_packer&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c skyline_packer.
+    ///
+    ~skyline_packer() = default;
+
+    ///
+    /// Assigns the given object of the type \c skyline_packer to this one by
+    /// copying.
+    ///
+    /// \param a a \c skyline_packer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    skyline_packer& operator=(const skyline_packer& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c skyline_packer to this one by
+    /// moving.
+    ///
+    /// \param a a \c skyline_packer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    skyline_packer& operator=(skyline_packer&& a) = default;
+
+    ///
+    /// Places a rectangle in the area.
+    ///
+    /// \param width the width of the rectangle.
+    /// \param height the height of the rectangle.
+    ///
+    /// \return The area given to the rectangle or \c std::nullopt if the
+    /// rectangle doesn't fit.
+    ///
+    std::optional<atlas_region> insert(const int width, const int height);
+
+    ///
+    /// Gives the width of the area.
+    ///
+    /// \return The width.
+    ///
+    int get_width() const noexcept;
+
+    ///
+    /// Gives the height of the area.
+    ///
+    /// \return The height.
+    ///
+    int get_height() const noexcept;
+
+    ///
+    /// Gives the share of the area covered by the rectangles.
+    ///
+    /// \return The share between zero and one.
+    ///
+    float get_occupancy() const noexcept;
+
+  private:
+    ///
+    /// The type of the horizontal segments of the upper edge of the used
+    /// area.
+    ///
+    struct segment final
+    {
+      int x;
+      int y;
+      int width;
+    };
+
+    ///
+    /// Gives the row on which a rectangle would be placed if its left edge
+    /// were on the left edge of the given segment.
+    ///
+    /// \param index the index of the segment.
+    /// \param width the width of the rectangle.
+    /// \param height the height of the rectangle.
+    ///
+    /// \return The row or \c std::nullopt if the rectangle doesn't fit.
+    ///
+    std::optional<int> fit(
+        const std::size_t index, const int width, const int height) const;
+
+    ///
+    /// The width of the area.
+    ///
+    int width;
+
+    ///
+    /// The height of the area.
+    ///
+    int height;
+
+    ///
+    /// The number of the pixels covered by the rectangles.
+    ///
+    long long used;
+
+    ///
+    /// The segments of the upper edge of the used area from left to right.
+    ///
+    std::vector<segment> skyline;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_SKYLINE_PACKER_H
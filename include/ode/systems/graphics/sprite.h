@@ -0,0 +1,112 @@
+/// The declarations of the types of the sprites and their vertices.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_SPRITE_H
+#define ODE_SYSTEMS_GRAPHICS_SPRITE_H
+
+#include <cstdint>
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe a single textured quad that is
+  /// drawn by the sprite renderer.
+  ///
+  struct sprite final
+  {
+    ///
+    /// The name of the OpenGL texture of the sprite.
+    ///
+    std::uint32_t texture = 0;
+
+    ///
+    /// The layer of the sprite. The sprites on the lower layers are drawn
+    /// first.
+    ///
+    std::int16_t layer = 0;
+
+    ///
+    /// The x coordinate of the top-left corner of the sprite.
+    ///
+    float x = 0.0f;
+
+    ///
+    /// The y coordinate of the top-left corner of the sprite.
+    ///
+    float y = 0.0f;
+
+    ///
+    /// The width of the sprite.
+    ///
+    float width = 0.0f;
+
+    ///
+    /// The height of the sprite.
+    ///
+    float height = 0.0f;
+
+    ///
+    /// The left texture coordinate of the sprite.
+    ///
+    float u0 = 0.0f;
+
+    ///
+    /// The top texture coordinate of the sprite.
+    ///
+    float v0 = 0.0f;
+
+    ///
+    /// The right texture coordinate of the sprite.
+    ///
+    float u1 = 1.0f;
+
+    ///
+    /// The bottom texture coordinate of the sprite.
+    ///
+    float v1 = 1.0f;
+
+    ///
+    /// The colour by which the texture of the sprite is multiplied, packed
+    /// as RGBA with red in the lowest byte.
+    ///
+    std::uint32_t colour = 0xffffffff;
+  };
+
+  ///
+  /// The type of the vertices generated for the sprites.
+  ///
+  struct sprite_vertex final
+  {
+    ///
+    /// The x coordinate of the vertex.
+    ///
+    float x;
+
+    ///
+    /// The y coordinate of the vertex.
+    ///
+    float y;
+
+    ///
+    /// The horizontal texture coordinate of the vertex.
+    ///
+    float u;
+
+    ///
+    /// The vertical texture coordinate of the vertex.
+    ///
+    float v;
+
+    ///
+    /// The colour of the vertex, packed as RGBA with red in the lowest byte.
+    ///
+    std::uint32_t colour;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_SPRITE_H
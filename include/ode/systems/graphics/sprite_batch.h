@@ -0,0 +1,174 @@
+/// The declaration of the type of the batches which collect the sprites
+/// drawn during a frame.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_SPRITE_BATCH_H
+#define ODE_SYSTEMS_GRAPHICS_SPRITE_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ode/systems/graphics/sprite.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe a single draw call of sprites.
+  ///
+  struct sprite_draw final
+  {
+    ///
+    /// The name of the OpenGL texture of the sprites.
+    ///
+    std::uint32_t texture;
+
+    ///
+    /// The index of the first vertex of the draw call in the vertices of the
+    /// batch.
+    ///
+    std::size_t first_vertex;
+
+    ///
+    /// The number of the sprites in the draw call.
+    ///
+    std::size_t sprite_count;
+  };
+
+  ///
+  /// The type of the batches which collect the sprites drawn during a frame
+  /// and turn them into vertices and draw calls. The sprites are sorted by
+  /// their layer and texture so that the consecutive sprites with the same
+  /// texture are drawn with a single draw call. The sprites with the same
+  /// layer and texture keep the order in which they are added.
+  ///
+  /// The batch doesn't use OpenGL, and the vertices that it builds are
+  /// uploaded by the sprite renderer.
+  ///
+  class sprite_batch final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c sprite_batch.
+    ///
+    sprite_batch();
+
+    ///
+    /// Constructs an object of the type \c sprite_batch by copying the given
+    /// object of the type \c sprite_batch.
+    ///
+    /// \param a a \c sprite_batch from which the new one is constructed.
+    ///
+    sprite_batch(const sprite_batch& a) = default;
+
+    ///
+    /// Constructs an object of the type \c sprite_batch by moving the given
+    /// object of the type \c sprite_batch.
+    ///
+    /// \param a a \c sprite_batch from which the new one is constructed.
+    ///
+    sprite_batch(sprite_batch&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c sprite_batch.
+    ///
+    ~sprite_batch() = default;
+
+    ///
+    /// Assigns the given object of the type \c sprite_batch to this one by
+    /// copying.
+    ///
+    /// \param a a \c sprite_batch from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    sprite_batch& operator=(const sprite_batch& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c sprite_batch to this one by
+    /// moving.
+    ///
+    /// \param a a \c sprite_batch from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    sprite_batch& operator=(sprite_batch&& a) = default;
+
+    ///
+    /// Removes all of the sprites, the vertices, and the draw calls from the
+    /// batch. The allocated memory is kept for the next frame.
+    ///
+    void clear() noexcept;
+
+    ///
+    /// Adds the given sprite to the batch.
+    ///
+    /// \param s the sprite.
+    ///
+    void add(const sprite& s);
+
+    ///
+    /// Reserves memory for the given number of sprites so that adding many
+    /// sprites at once doesn't reallocate.
+    ///
+    /// \param count the number of the sprites.
+    ///
+    void reserve(const std::size_t count);
+
+    ///
+    /// Sorts the sprites and builds the vertices and the draw calls for
+    /// them.
+    ///
+    void build();
+
+    ///
+    /// Gives the number of the sprites in the batch.
+    ///
+    /// \return The number of the sprites.
+    ///
+    std::size_t get_sprite_count() const noexcept;
+
+    ///
+    /// Gives the vertices built for the sprites.
+    ///
+    /// \return A reference to the vertices.
+    ///
+    const std::vector<sprite_vertex>& get_vertices() const noexcept;
+
+    ///
+    /// Gives the draw calls built for the sprites.
+    ///
+    /// \return A reference to the draw calls.
+    ///
+    const std::vector<sprite_draw>& get_draws() const noexcept;
+
+  private:
+    ///
+    /// The sprites added to the batch.
+    ///
+    std::vector<sprite> sprites;
+
+    ///
+    /// The sort keys of the sprites and the indices of the sprites.
+    ///
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> keys;
+
+    ///
+    /// The vertices built for the sprites.
+    ///
+    std::vector<sprite_vertex> vertices;
+
+    ///
+    /// The draw calls built for the sprites.
+    ///
+    std::vector<sprite_draw> draws;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_SPRITE_BATCH_H
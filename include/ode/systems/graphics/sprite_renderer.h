@@ -0,0 +1,195 @@
+/// The declaration of the type of the renderer which draws batches of
+/// sprites.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_SPRITE_RENDERER_H
+#define ODE_SYSTEMS_GRAPHICS_SPRITE_RENDERER_H
+
+#include <array>
+#include <cstddef>
+
+#include <glad/glad.h>
+
+#include "ode/systems/graphics/graphics_config.h"
+#include "ode/systems/graphics/sprite.h"
+#include "ode/systems/graphics/sprite_batch.h"
+
+namespace ode
+{
+  ///
+  /// Creates an orthographic projection matrix in the column-major order
+  /// used by OpenGL.
+  ///
+  /// \param left the coordinate of the left edge of the view.
+  /// \param right the coordinate of the right edge of the view.
+  /// \param bottom the coordinate of the bottom edge of the view.
+  /// \param top the coordinate of the top edge of the view.
+  ///
+  /// \return The projection matrix.
+  ///
+  std::array<float, 16> make_orthographic(
+      const float left,
+      const float right,
+      const float bottom,
+      const float top) noexcept;
+
+  ///
+  /// The type of the renderer which draws the sprite batches.
+  ///
+  /// The vertices are streamed to the GPU through a vertex buffer which is
+  /// persistently mapped and split into regions guarded by fences if
+  /// \c GL_ARB_buffer_storage is available. Otherwise, the buffer is orphaned
+  /// and mapped again for each pass. Each draw call of the batch is drawn
+  /// from a shared index buffer with a base vertex so that the buffers and
+  /// the vertex layout are bound only once per frame.
+  ///
+  /// The renderer requires a current OpenGL context when it is constructed,
+  /// destructed, and used.
+  ///
+  class sprite_renderer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c sprite_renderer and creates the
+    /// OpenGL objects of it.
+    ///
+    sprite_renderer();
+
+    ///
+    /// Constructs an object of the type \c sprite_renderer by copying the
+    /// given object of the type \c sprite_renderer.
+    ///
+    /// \param a a \c sprite_renderer from which the new one is constructed.
+    ///
+    sprite_renderer(const sprite_renderer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c sprite_renderer by moving the
+    /// given object of the type \c sprite_renderer.
+    ///
+    /// \param a a \c sprite_renderer from which the new one is constructed.
+    ///
+    sprite_renderer(sprite_renderer&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c sprite_renderer and deletes the
+    /// OpenGL objects of it.
+    ///
+    ~sprite_renderer();
+
+    ///
+    /// Assigns the given object of the type \c sprite_renderer to this one by
+    /// copying.
+    ///
+    /// \param a a \c sprite_renderer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    sprite_renderer& operator=(const sprite_renderer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c sprite_renderer to this one by
+    /// moving.
+    ///
+    /// \param a a \c sprite_renderer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    sprite_renderer& operator=(sprite_renderer&& a) = delete;
+
+    ///
+    /// Draws the given batch. The batch must be built before it is drawn.
+    ///
+    /// \param batch the sprite batch.
+    /// \param projection the projection matrix in the column-major order.
+    ///
+    /// \return The number of the draw calls issued.
+    ///
+    std::size_t draw(
+        const sprite_batch& batch, const std::array<float, 16>& projection);
+
+    ///
+    /// Tells whether or not the renderer uses a persistently mapped vertex
+    /// buffer.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_persistent() const noexcept;
+
+  private:
+    ///
+    /// Starts a pass by giving the memory to which the vertices of the pass
+    /// are written.
+    ///
+    /// \return A pointer to the memory or \c nullptr if the buffer can't be
+    /// mapped.
+    ///
+    sprite_vertex* begin_pass();
+
+    ///
+    /// Ends a pass after its draw calls are issued.
+    ///
+    void end_pass();
+
+    ///
+    /// Gives the index of the first vertex of the current pass in the vertex
+    /// buffer.
+    ///
+    /// \return The index of the vertex.
+    ///
+    GLint get_base_vertex() const noexcept;
+
+    ///
+    /// The shader program.
+    ///
+    GLuint program;
+
+    ///
+    /// The location of the projection uniform in the shader program.
+    ///
+    GLint projection_location;
+
+    ///
+    /// The vertex array object.
+    ///
+    GLuint vertex_array;
+
+    ///
+    /// The buffer to which the vertices are streamed.
+    ///
+    GLuint vertex_buffer;
+
+    ///
+    /// The buffer of the indices shared by all of the draw calls.
+    ///
+    GLuint index_buffer;
+
+    ///
+    /// The persistently mapped memory of the vertex buffer, if any.
+    ///
+    sprite_vertex* mapped;
+
+    ///
+    /// The fences which tell when the GPU has finished reading the regions
+    /// of the persistently mapped buffer.
+    ///
+    std::array<GLsync, sprite_buffer_regions> fences;
+
+    ///
+    /// The region of the persistently mapped buffer used by the current pass.
+    ///
+    std::size_t region;
+
+    ///
+    /// Whether or not the vertex buffer is persistently mapped.
+    ///
+    bool persistent;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_SPRITE_RENDERER_H
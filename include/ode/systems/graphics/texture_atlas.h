@@ -0,0 +1,165 @@
+/// The declaration of the type of the builders which lay out images in the
+/// pages of texture atlases.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_TEXTURE_ATLAS_H
+#define ODE_SYSTEMS_GRAPHICS_TEXTURE_ATLAS_H
+
+#include <cstddef>
+#include <vector>
+
+#include "ode/__config"
+#include "ode/systems/graphics/graphics_config.h"
+#include "ode/systems/graphics/image.h"
+#include "ode/systems/graphics/skyline_packer.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which tell where an image was placed in a
+  /// texture atlas.
+  ///
+  struct atlas_entry final
+  {
+    ///
+    /// The index of the page of the atlas.
+    ///
+    std::size_t page = 0;
+
+    ///
+    /// The area of the page that the image covers.
+    ///
+    atlas_region region{};
+  };
+
+  ///
+  /// The type of the builders which lay out images in the pages of a texture
+  /// atlas. The builder only places the images by their sizes, so the
+  /// layout can be computed, and compared against the cached textures,
+  /// before any of the images is decoded. A new page is started when an
+  /// image doesn't fit in the earlier ones, and an image larger than a page
+  /// is given a page of its own size.
+  ///
+  class atlas_builder final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c atlas_builder.
+    ///
+    /// \param page_size the width and the height of the pages.
+    /// \param padding the number of the empty pixels between the images.
+    ///
+    explicit atlas_builder(
+        const int page_size = texture_atlas_size,
+        const int padding = texture_atlas_padding) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Constructs an object of the type \c atlas_builder by copying the given
+    /// object of the type \c atlas_builder.
+    ///
+    /// \param a an \c atlas_builder from which the new one is constructed.
+    ///
+    atlas_builder(const atlas_builder& a) = default;
+
+    ///
+    /// Constructs an object of the type \c atlas_builder by moving the given
+    /// object of the type \c atlas_builder.
+    ///
+    /// \param a an \c atlas_builder from which the new one is constructed.
+    ///
+    atlas_builder(atlas_builder&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c atlas_builder.
+    ///
+    ~atlas_builder() = default;
+
+    ///
+    /// Assigns the given object of the type \c atlas_builder to this one by
+    /// copying.
+    ///
+    /// \param a an \c atlas_builder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    atlas_builder& operator=(const atlas_builder& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c atlas_builder to this one by
+    /// moving.
+    ///
+    /// \param a an \c atlas_builder from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    atlas_builder& operator=(atlas_builder&& a) = default;
+
+    ///
+    /// Places an image of the given size in the atlas.
+    ///
+    /// \param width the width of the image.
+    /// \param height the height of the image.
+    ///
+    /// \return The place of the image.
+    ///
+    atlas_entry add(const int width, const int height);
+
+    ///
+    /// Gives the number of the pages in the atlas.
+    ///
+    /// \return The number of the pages.
+    ///
+    std::size_t get_page_count() const noexcept;
+
+    ///
+    /// Gives the width of the given page.
+    ///
+    /// \param page the index of the page.
+    ///
+    /// \return The width of the page in pixels.
+    ///
+    int get_page_width(const std::size_t page) const ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Gives the height of the given page.
+    ///
+    /// \param page the index of the page.
+    ///
+    /// \return The height of the page in pixels.
+    ///
+    int get_page_height(const std::size_t page) const ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Creates a transparent image of the size of the given page into which
+    /// the images placed on the page can be copied.
+    ///
+    /// \param page the index of the page.
+    ///
+    /// \return The image.
+    ///
+    image make_page_image(const std::size_t page) const;
+
+  private:
+    ///
+    /// The width and the height of the pages.
+    ///
+    int page_size;
+
+    ///
+    /// The number of the empty pixels between the images.
+    ///
+    int padding;
+
+    ///
+    /// The packers of the pages.
+    ///
+    std::vector<skyline_packer> pages;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_TEXTURE_ATLAS_H
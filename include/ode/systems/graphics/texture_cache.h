@@ -0,0 +1,193 @@
+/// The declaration of the type of the caches which share the GPU textures
+/// between their users.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_TEXTURE_CACHE_H
+#define ODE_SYSTEMS_GRAPHICS_TEXTURE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "ode/systems/graphics/image.h"
+
+namespace ode
+{
+  ///
+  /// The type of the caches which keep the GPU textures by the keys given by
+  /// their users and count the references to them. A texture is uploaded
+  /// only when it is first acquired, and it is deleted when the last
+  /// reference to it is released, so the scenes that share images never
+  /// upload them twice.
+  ///
+  class texture_cache final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c texture_cache.
+    ///
+    texture_cache();
+
+    ///
+    /// Constructs an object of the type \c texture_cache by copying the given
+    /// object of the type \c texture_cache.
+    ///
+    /// \param a a \c texture_cache from which the new one is constructed.
+    ///
+    texture_cache(const texture_cache& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c texture_cache by moving the given
+    /// object of the type \c texture_cache.
+    ///
+    /// \param a a \c texture_cache from which the new one is constructed.
+    ///
+    texture_cache(texture_cache&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c texture_cache and deletes the
+    /// textures that are still in it.
+    ///
+    ~texture_cache();
+
+    ///
+    /// Assigns the given object of the type \c texture_cache to this one by
+    /// copying.
+    ///
+    /// \param a a \c texture_cache from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    texture_cache& operator=(const texture_cache& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c texture_cache to this one by
+    /// moving.
+    ///
+    /// \param a a \c texture_cache from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    texture_cache& operator=(texture_cache&& a) = delete;
+
+    ///
+    /// Adds a reference to the texture with the given key. If the texture
+    /// isn't in the cache, its image is loaded with the given function and
+    /// uploaded.
+    ///
+    /// \tparam F the type of the function.
+    ///
+    /// \param key the key of the texture.
+    /// \param load the function which returns the image as an
+    /// \c std::optional<image>. It is called only if the texture isn't in the
+    /// cache.
+    ///
+    /// \return The name of the OpenGL texture or zero if the image can't be
+    /// loaded.
+    ///
+    template <typename F>
+    std::uint32_t acquire(const std::string& key, F&& load)
+    {
+      if (const auto it = entries.find(key); entries.end() != it)
+      {
+        ++it->second.references;
+        return it->second.texture;
+      }
+
+      const std::optional<image> img = load();
+
+      if (!img)
+      {
+        return 0;
+      }
+
+      return insert(key, *img);
+    }
+
+    ///
+    /// Removes a reference to the texture with the given key and deletes the
+    /// texture if it was the last one.
+    ///
+    /// \param key the key of the texture.
+    ///
+    void release(const std::string& key);
+
+    ///
+    /// Tells whether or not the texture with the given key is in the cache.
+    ///
+    /// \param key the key of the texture.
+    ///
+    /// \return A \c bool.
+    ///
+    bool contains(const std::string& key) const;
+
+    ///
+    /// Gives the number of the references to the texture with the given key.
+    ///
+    /// \param key the key of the texture.
+    ///
+    /// \return The number of the references.
+    ///
+    std::size_t get_reference_count(const std::string& key) const;
+
+    ///
+    /// Gives the number of the textures in the cache.
+    ///
+    /// \return The number of the textures.
+    ///
+    std::size_t get_texture_count() const noexcept;
+
+    ///
+    /// Gives the number of the textures uploaded by the cache.
+    ///
+    /// \return The number of the uploads.
+    ///
+    std::size_t get_upload_count() const noexcept;
+
+  private:
+    ///
+    /// The type of the textures in the cache.
+    ///
+    struct entry final
+    {
+      ///
+      /// The name of the OpenGL texture.
+      ///
+      std::uint32_t texture;
+
+      ///
+      /// The number of the references to the texture.
+      ///
+      std::size_t references;
+    };
+
+    ///
+    /// Uploads the given image and adds it to the cache with one reference.
+    ///
+    /// \param key the key of the texture.
+    /// \param img the image.
+    ///
+    /// \return The name of the OpenGL texture.
+    ///
+    std::uint32_t insert(const std::string& key, const image& img);
+
+    ///
+    /// The textures by their keys.
+    ///
+    std::unordered_map<std::string, entry> entries;
+
+    ///
+    /// The number of the textures uploaded.
+    ///
+    std::size_t uploads;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_TEXTURE_CACHE_H
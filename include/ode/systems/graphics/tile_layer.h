@@ -0,0 +1,253 @@
+/// The declaration of the type of the tile layers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_TILE_LAYER_H
+#define ODE_SYSTEMS_GRAPHICS_TILE_LAYER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ode/__config"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe a rectangular range of tiles.
+  ///
+  struct tile_range final
+  {
+    ///
+    /// The column of the first tile in the range.
+    ///
+    int x;
+
+    ///
+    /// The row of the first tile in the range.
+    ///
+    int y;
+
+    ///
+    /// The number of the columns in the range.
+    ///
+    int width;
+
+    ///
+    /// The number of the rows in the range.
+    ///
+    int height;
+  };
+
+  ///
+  /// Tells whether or not the given tile range contains no tiles.
+  ///
+  /// \param r the tile range.
+  ///
+  /// \return A \c bool.
+  ///
+  constexpr bool is_empty(const tile_range& r) noexcept
+  {
+    return r.width <= 0 || r.height <= 0;
+  }
+
+  ///
+  /// The type of the tile layers. A tile layer is a grid of global tile IDs
+  /// in the format used by Tiled, so the value 0 is an empty tile and the
+  /// highest bits of the IDs are the flipping flags.
+  ///
+  /// The layer is split into chunks, and the chunks that have changed since
+  /// they were last uploaded are tracked so that only they are uploaded to
+  /// the GPU. All of the chunks of a new layer are dirty.
+  ///
+  class tile_layer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c tile_layer.
+    ///
+    tile_layer();
+
+    ///
+    /// Constructs an object of the type \c tile_layer with empty tiles.
+    ///
+    /// \param w the width of the layer in tiles.
+    /// \param h the height of the layer in tiles.
+    ///
+    tile_layer(const int w, const int h);
+
+    ///
+    /// Constructs an object of the type \c tile_layer with the given tiles.
+    ///
+    /// \param w the width of the layer in tiles.
+    /// \param h the height of the layer in tiles.
+    /// \param gids the global tile IDs of the tiles, row by row.
+    ///
+    tile_layer(const int w, const int h, std::vector<std::uint32_t> gids);
+
+    ///
+    /// Constructs an object of the type \c tile_layer by copying the given
+    /// object of the type \c tile_layer.
+    ///
+    /// \param a a \c tile_layer from which the new one is constructed.
+    ///
+    tile_layer(const tile_layer& a) = default;
+
+    ///
+    /// Constructs an object of the type \c tile_layer by moving the given
+    /// object of the type \c tile_layer.
+    ///
+    /// \param a a \c tile_layer from which the new one is constructed.
+    ///
+    tile_layer(tile_layer&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c tile_layer.
+    ///
+    ~tile_layer() = default;
+
+    ///
+    /// Assigns the given object of the type \c tile_layer to this one by
+    /// copying.
+    ///
+    /// \param a a \c tile_layer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_layer& operator=(const tile_layer& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c tile_layer to this one by
+    /// moving.
+    ///
+    /// \param a a \c tile_layer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_layer& operator=(tile_layer&& a) = default;
+
+    ///
+    /// Gives the width of the layer in tiles.
+    ///
+    /// \return The width of the layer.
+    ///
+    int get_width() const noexcept;
+
+    ///
+    /// Gives the height of the layer in tiles.
+    ///
+    /// \return The height of the layer.
+    ///
+    int get_height() const noexcept;
+
+    ///
+    /// Gives the global tile ID of the given tile.
+    ///
+    /// \param x the column of the tile.
+    /// \param y the row of the tile.
+    ///
+    /// \return The global tile ID.
+    ///
+    std::uint32_t get(const int x, const int y) const ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Sets the global tile ID of the given tile and marks its chunk as
+    /// dirty if the tile changes.
+    ///
+    /// \param x the column of the tile.
+    /// \param y the row of the tile.
+    /// \param gid the global tile ID.
+    ///
+    void set(const int x, const int y, const std::uint32_t gid)
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Gives the global tile IDs of the layer, row by row.
+    ///
+    /// \return A pointer to the global tile IDs.
+    ///
+    const std::uint32_t* get_data() const noexcept;
+
+    ///
+    /// Gives the tile ranges of the chunks that have changed since this
+    /// function was last called and marks them as clean.
+    ///
+    /// \return The tile ranges of the dirty chunks.
+    ///
+    std::vector<tile_range> take_dirty_chunks();
+
+    ///
+    /// Gives the number of the chunks that have changed since they were last
+    /// taken.
+    ///
+    /// \return The number of the dirty chunks.
+    ///
+    std::size_t get_dirty_chunk_count() const noexcept;
+
+    ///
+    /// Gives the range of the tiles of the layer which overlap the given
+    /// area.
+    ///
+    /// \param left the left edge of the area.
+    /// \param top the top edge of the area.
+    /// \param right the right edge of the area.
+    /// \param bottom the bottom edge of the area.
+    /// \param tile_width the width of the tiles in the units of the area.
+    /// \param tile_height the height of the tiles in the units of the area.
+    ///
+    /// \return The range of the tiles, clipped to the layer.
+    ///
+    tile_range get_visible_range(
+        const float left,
+        const float top,
+        const float right,
+        const float bottom,
+        const float tile_width,
+        const float tile_height) const noexcept;
+
+  private:
+    ///
+    /// Marks the chunk of the given tile as dirty.
+    ///
+    /// \param x the column of the tile.
+    /// \param y the row of the tile.
+    ///
+    void mark_dirty(const int x, const int y);
+
+    ///
+    /// The width of the layer in tiles.
+    ///
+    int width;
+
+    ///
+    /// The height of the layer in tiles.
+    ///
+    int height;
+
+    ///
+    /// The number of the columns of chunks.
+    ///
+    int chunk_columns;
+
+    ///
+    /// The global tile IDs of the layer, row by row.
+    ///
+    std::vector<std::uint32_t> tiles;
+
+    ///
+    /// Whether or not each of the chunks is dirty.
+    ///
+    std::vector<bool> dirty;
+
+    ///
+    /// The indices of the dirty chunks.
+    ///
+    std::vector<int> dirty_chunks;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_TILE_LAYER_H
@@ -0,0 +1,491 @@
+/// The declarations of the types of the renderer which draws tile layers and
+/// the GPU textures of the tile layers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_TILE_RENDERER_H
+#define ODE_SYSTEMS_GRAPHICS_TILE_RENDERER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "ode/systems/graphics/tile_layer.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe the tileset image that the
+  /// tiles of a layer are drawn from.
+  ///
+  struct tileset final
+  {
+    ///
+    /// The name of the OpenGL texture of the tileset image.
+    ///
+    std::uint32_t texture = 0;
+
+    ///
+    /// The global tile ID of the first tile in the tileset.
+    ///
+    std::uint32_t first_gid = 1;
+
+    ///
+    /// The width of the tiles in pixels.
+    ///
+    int tile_width = 0;
+
+    ///
+    /// The height of the tiles in pixels.
+    ///
+    int tile_height = 0;
+
+    ///
+    /// The width of the tileset image in pixels.
+    ///
+    int image_width = 0;
+
+    ///
+    /// The height of the tileset image in pixels.
+    ///
+    int image_height = 0;
+
+    ///
+    /// The column of the left edge of the tileset image in the texture when
+    /// the texture is an atlas page.
+    ///
+    int atlas_x = 0;
+
+    ///
+    /// The row of the top edge of the tileset image in the texture when the
+    /// texture is an atlas page.
+    ///
+    int atlas_y = 0;
+
+    ///
+    /// The width of the texture in pixels or zero if the texture holds only
+    /// the tileset image.
+    ///
+    int texture_width = 0;
+
+    ///
+    /// The height of the texture in pixels or zero if the texture holds only
+    /// the tileset image.
+    ///
+    int texture_height = 0;
+
+    ///
+    /// The space between the tiles in the tileset image in pixels.
+    ///
+    int spacing = 0;
+
+    ///
+    /// The space around the tiles at the edges of the tileset image in
+    /// pixels.
+    ///
+    int margin = 0;
+
+    ///
+    /// The number of the tiles in the tileset or zero if all of the tiles
+    /// that fit in the tileset image are used.
+    ///
+    std::uint32_t tile_count = 0;
+  };
+
+  ///
+  /// Gives the number of the tile columns in the tileset image, taking the
+  /// spacing and the margin into account.
+  ///
+  /// \param set the tileset.
+  ///
+  /// \return The number of the columns, at least one.
+  ///
+  int get_tileset_columns(const tileset& set) noexcept;
+
+  ///
+  /// Gives the number of the tiles in the tileset.
+  ///
+  /// \param set the tileset.
+  ///
+  /// \return The tile count of the tileset if it's given, otherwise the
+  /// number of the tiles that fit in the tileset image.
+  ///
+  std::uint32_t get_tile_count(const tileset& set) noexcept;
+
+  ///
+  /// The type of the integer textures which hold the global tile IDs of a
+  /// tile layer on the GPU.
+  ///
+  class tile_layer_texture final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c tile_layer_texture.
+    ///
+    tile_layer_texture();
+
+    ///
+    /// Constructs an object of the type \c tile_layer_texture by copying the
+    /// given object of the type \c tile_layer_texture.
+    ///
+    /// \param a a \c tile_layer_texture from which the new one is
+    /// constructed.
+    ///
+    tile_layer_texture(const tile_layer_texture& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c tile_layer_texture by moving the
+    /// given object of the type \c tile_layer_texture.
+    ///
+    /// \param a a \c tile_layer_texture from which the new one is
+    /// constructed.
+    ///
+    tile_layer_texture(tile_layer_texture&& a) noexcept;
+
+    ///
+    /// Destructs an object of the type \c tile_layer_texture and deletes the
+    /// texture.
+    ///
+    ~tile_layer_texture();
+
+    ///
+    /// Assigns the given object of the type \c tile_layer_texture to this one
+    /// by copying.
+    ///
+    /// \param a a \c tile_layer_texture from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_layer_texture& operator=(const tile_layer_texture& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c tile_layer_texture to this one
+    /// by moving.
+    ///
+    /// \param a a \c tile_layer_texture from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_layer_texture& operator=(tile_layer_texture&& a) noexcept;
+
+    ///
+    /// Uploads the dirty chunks of the given layer to the texture. The whole
+    /// layer is uploaded if the size of the layer has changed.
+    ///
+    /// \param layer the tile layer.
+    ///
+    /// \return The number of the chunks uploaded.
+    ///
+    std::size_t update(tile_layer& layer);
+
+    ///
+    /// Gives the name of the OpenGL texture.
+    ///
+    /// \return The name of the texture.
+    ///
+    GLuint get_texture() const noexcept;
+
+  private:
+    ///
+    /// The name of the OpenGL texture.
+    ///
+    GLuint texture;
+
+    ///
+    /// The width of the texture in tiles.
+    ///
+    int width;
+
+    ///
+    /// The height of the texture in tiles.
+    ///
+    int height;
+  };
+
+  ///
+  /// The type of the integer textures which hold the tables of the animated
+  /// tiles on the GPU. A table maps each of the global tile IDs to the ID of
+  /// the tile that is drawn in its place, and it is wrapped into rows of
+  /// \c tile_table_width texels.
+  ///
+  class tile_table_texture final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c tile_table_texture.
+    ///
+    tile_table_texture();
+
+    ///
+    /// Constructs an object of the type \c tile_table_texture by copying the
+    /// given object of the type \c tile_table_texture.
+    ///
+    /// \param a a \c tile_table_texture from which the new one is
+    /// constructed.
+    ///
+    tile_table_texture(const tile_table_texture& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c tile_table_texture by moving the
+    /// given object of the type \c tile_table_texture.
+    ///
+    /// \param a a \c tile_table_texture from which the new one is
+    /// constructed.
+    ///
+    tile_table_texture(tile_table_texture&& a) noexcept;
+
+    ///
+    /// Destructs an object of the type \c tile_table_texture and deletes the
+    /// texture.
+    ///
+    ~tile_table_texture();
+
+    ///
+    /// Assigns the given object of the type \c tile_table_texture to this one
+    /// by copying.
+    ///
+    /// \param a a \c tile_table_texture from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_table_texture& operator=(const tile_table_texture& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c tile_table_texture to this one
+    /// by moving.
+    ///
+    /// \param a a \c tile_table_texture from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_table_texture& operator=(tile_table_texture&& a) noexcept;
+
+    ///
+    /// Uploads the given table to the texture.
+    ///
+    /// \param table the global tile IDs of the tiles drawn in the places of
+    /// the tiles, indexed by the global tile ID.
+    ///
+    void update(const std::vector<std::uint32_t>& table);
+
+    ///
+    /// Gives the name of the OpenGL texture.
+    ///
+    /// \return The name of the texture.
+    ///
+    GLuint get_texture() const noexcept;
+
+    ///
+    /// Gives the number of the global tile IDs in the table.
+    ///
+    /// \return The number of the IDs.
+    ///
+    std::size_t get_size() const noexcept;
+
+  private:
+    ///
+    /// The name of the OpenGL texture.
+    ///
+    GLuint texture;
+
+    ///
+    /// The number of the rows in the texture.
+    ///
+    int rows;
+
+    ///
+    /// The number of the global tile IDs in the table.
+    ///
+    std::size_t size;
+  };
+
+  ///
+  /// The type of the renderer which draws the tile layers. The visible range
+  /// of a layer is drawn with a single instanced draw call in which each
+  /// instance is a tile, and the vertex shader reads the global tile ID of
+  /// the tile from the texture of the layer. Thus, the work done on the CPU
+  /// doesn't depend on the size of the layer or the view.
+  ///
+  /// The renderer requires a current OpenGL context when it is constructed,
+  /// destructed, and used.
+  ///
+  class tile_renderer final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c tile_renderer and creates the
+    /// OpenGL objects of it.
+    ///
+    tile_renderer();
+
+    ///
+    /// Constructs an object of the type \c tile_renderer by copying the
+    /// given object of the type \c tile_renderer.
+    ///
+    /// \param a a \c tile_renderer from which the new one is constructed.
+    ///
+    tile_renderer(const tile_renderer& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c tile_renderer by moving the given
+    /// object of the type \c tile_renderer.
+    ///
+    /// \param a a \c tile_renderer from which the new one is constructed.
+    ///
+    tile_renderer(tile_renderer&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c tile_renderer and deletes the
+    /// OpenGL objects of it.
+    ///
+    ~tile_renderer();
+
+    ///
+    /// Assigns the given object of the type \c tile_renderer to this one by
+    /// copying.
+    ///
+    /// \param a a \c tile_renderer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_renderer& operator=(const tile_renderer& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c tile_renderer to this one by
+    /// moving.
+    ///
+    /// \param a a \c tile_renderer from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    tile_renderer& operator=(tile_renderer&& a) = delete;
+
+    ///
+    /// Draws the given range of a tile layer.
+    ///
+    /// \param layer the texture of the tile layer.
+    /// \param set the tileset of the layer.
+    /// \param range the range of the tiles to draw.
+    /// \param projection the projection matrix in the column-major order.
+    /// \param opacity the opacity of the layer.
+    ///
+    /// \return The number of the tiles drawn.
+    ///
+    std::size_t draw(
+        const tile_layer_texture& layer,
+        const tileset& set,
+        const tile_range& range,
+        const std::array<float, 16>& projection,
+        const float opacity = 1.0f);
+
+    ///
+    /// Draws the given range of a tile layer and replaces the animated tiles
+    /// with the tiles given by the table.
+    ///
+    /// \param layer the texture of the tile layer.
+    /// \param set the tileset of the layer.
+    /// \param table the texture of the table of the animated tiles.
+    /// \param range the range of the tiles to draw.
+    /// \param projection the projection matrix in the column-major order.
+    /// \param opacity the opacity of the layer.
+    ///
+    /// \return The number of the tiles drawn.
+    ///
+    std::size_t draw(
+        const tile_layer_texture& layer,
+        const tileset& set,
+        const tile_table_texture& table,
+        const tile_range& range,
+        const std::array<float, 16>& projection,
+        const float opacity = 1.0f);
+
+  private:
+    ///
+    /// The shader program.
+    ///
+    GLuint program;
+
+    ///
+    /// The empty vertex array object which the attributeless draw calls
+    /// require.
+    ///
+    GLuint vertex_array;
+
+    ///
+    /// The location of the projection uniform.
+    ///
+    GLint projection_location;
+
+    ///
+    /// The location of the uniform of the first tile in the range.
+    ///
+    GLint origin_location;
+
+    ///
+    /// The location of the uniform of the number of the columns in the
+    /// range.
+    ///
+    GLint columns_location;
+
+    ///
+    /// The location of the uniform of the size of the tiles.
+    ///
+    GLint tile_size_location;
+
+    ///
+    /// The location of the uniform of the first global tile ID of the
+    /// tileset.
+    ///
+    GLint first_gid_location;
+
+    ///
+    /// The location of the uniform of the number of the columns in the
+    /// tileset.
+    ///
+    GLint tileset_columns_location;
+
+    ///
+    /// The location of the uniform of the number of the tiles in the
+    /// tileset.
+    ///
+    GLint tile_count_location;
+
+    ///
+    /// The location of the uniform of the size of the tiles in the texture
+    /// coordinates of the tileset.
+    ///
+    GLint tile_uv_size_location;
+
+    ///
+    /// The location of the uniform of the distance between the tiles in the
+    /// texture coordinates.
+    ///
+    GLint tile_stride_location;
+
+    ///
+    /// The location of the uniform of the position of the tileset image in
+    /// the texture coordinates of the texture.
+    ///
+    GLint tileset_origin_location;
+
+    ///
+    /// The location of the uniform of the number of the global tile IDs in
+    /// the table of the animated tiles.
+    ///
+    GLint tile_table_size_location;
+
+    ///
+    /// The location of the opacity uniform.
+    ///
+    GLint opacity_location;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_TILE_RENDERER_H
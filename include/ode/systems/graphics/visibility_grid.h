@@ -0,0 +1,220 @@
+/// The declaration of the type of the uniform grids which are used to find
+/// the visible objects.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_GRAPHICS_VISIBILITY_GRID_H
+#define ODE_SYSTEMS_GRAPHICS_VISIBILITY_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ode/__config"
+#include "ode/systems/graphics/graphics_config.h"
+#include "ode/systems/graphics/rectangle.h"
+
+namespace ode
+{
+  ///
+  /// The type of the uniform grids over the bounds of the objects in the
+  /// world. The grid covers a fixed area of the world, and the objects
+  /// outside of it are kept in the cells on its edges. An object is in all of
+  /// the cells that its bounds overlap, so a query visits only the cells
+  /// which overlap the view and tests the bounds of the objects in them.
+  ///
+  /// The objects are identified by the IDs given by the user, for example
+  /// their indices in a container. The queries reuse the memory of the grid,
+  /// so a grid must not be queried from multiple threads at the same time.
+  ///
+  class visibility_grid final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c visibility_grid.
+    ///
+    /// \param area the area of the world covered by the grid.
+    /// \param cell_size the width and the height of the cells.
+    ///
+    explicit visibility_grid(
+        const rectangle& area,
+        const float cell_size = visibility_cell_size) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Constructs an object of the type \c visibility_grid by copying the
+    /// given object of the type \c visibility_grid.
+    ///
+    /// \param a a \c visibility_grid from which the new one is constructed.
+    ///
+    visibility_grid(const visibility_grid& a) = default;
+
+    ///
+    /// Constructs an object of the type \c visibility_grid by moving the
+    /// given object of the type \c visibility_grid.
+    ///
+    /// \param a a \c visibility_grid from which the new one is constructed.
+    ///
+    visibility_grid(visibility_grid&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c visibility_grid.
+    ///
+    ~visibility_grid() = default;
+
+    ///
+    /// Assigns the given object of the type \c visibility_grid to this one by
+    /// copying.
+    ///
+    /// \param a a \c visibility_grid from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    visibility_grid& operator=(const visibility_grid& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c visibility_grid to this one by
+    /// moving.
+    ///
+    /// \param a a \c visibility_grid from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    visibility_grid& operator=(visibility_grid&& a) = default;
+
+    ///
+    /// Adds an object to the grid or updates its bounds if it is already in
+    /// the grid.
+    ///
+    /// \param id the ID of the object.
+    /// \param bounds the bounds of the object.
+    ///
+    void insert(const std::size_t id, const rectangle& bounds);
+
+    ///
+    /// Removes an object from the grid.
+    ///
+    /// \param id the ID of the object.
+    ///
+    void remove(const std::size_t id);
+
+    ///
+    /// Tells whether or not the object is in the grid.
+    ///
+    /// \param id the ID of the object.
+    ///
+    /// \return A \c bool.
+    ///
+    bool contains(const std::size_t id) const noexcept;
+
+    ///
+    /// Gives the number of the objects in the grid.
+    ///
+    /// \return The number of the objects.
+    ///
+    std::size_t get_object_count() const noexcept;
+
+    ///
+    /// Finds the objects whose bounds overlap the given area.
+    ///
+    /// \param view the area.
+    ///
+    /// \return A reference to the IDs of the objects, which is valid until
+    /// the grid is queried again.
+    ///
+    const std::vector<std::size_t>& query(const rectangle& view) const;
+
+  private:
+    ///
+    /// The type of the objects which describe the cells that a rectangle
+    /// overlaps.
+    ///
+    struct cell_span final
+    {
+      int x0;
+      int y0;
+      int x1;
+      int y1;
+    };
+
+    ///
+    /// Gives the cells that the given rectangle overlaps.
+    ///
+    /// \param r the rectangle.
+    ///
+    /// \return The cells, clamped to the grid.
+    ///
+    cell_span get_span(const rectangle& r) const noexcept;
+
+    ///
+    /// Adds the given object to or removes it from the given cells.
+    ///
+    /// \param id the ID of the object.
+    /// \param span the cells.
+    /// \param add whether the object is added or removed.
+    ///
+    void link(const std::size_t id, const cell_span& span, const bool add);
+
+    ///
+    /// The area of the world covered by the grid.
+    ///
+    rectangle area;
+
+    ///
+    /// The width and the height of the cells.
+    ///
+    float cell_size;
+
+    ///
+    /// The number of the columns of the cells.
+    ///
+    int columns;
+
+    ///
+    /// The number of the rows of the cells.
+    ///
+    int rows;
+
+    ///
+    /// The IDs of the objects in each of the cells.
+    ///
+    std::vector<std::vector<std::uint32_t>> cells;
+
+    ///
+    /// The bounds of the objects, indexed by their IDs.
+    ///
+    std::vector<rectangle> bounds;
+
+    ///
+    /// Whether or not each of the IDs is in the grid.
+    ///
+    std::vector<bool> present;
+
+    ///
+    /// The number of the objects in the grid.
+    ///
+    std::size_t object_count;
+
+    ///
+    /// The query in which each of the objects was last visited. This
+    /// prevents reporting an object more than once when it is in many
+    /// cells.
+    ///
+    mutable std::vector<std::uint32_t> visits;
+
+    ///
+    /// The number of the current query.
+    ///
+    mutable std::uint32_t current_query;
+
+    ///
+    /// The IDs of the objects found by the last query.
+    ///
+    mutable std::vector<std::size_t> results;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_GRAPHICS_VISIBILITY_GRID_H
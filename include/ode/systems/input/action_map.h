@@ -0,0 +1,130 @@
+/// The declaration of the type of the tables which bind the inputs to the
+/// game actions.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_INPUT_ACTION_MAP_H
+#define ODE_SYSTEMS_INPUT_ACTION_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+namespace ode
+{
+  ///
+  /// An enumeration type, the enumerators of which represent the devices from
+  /// which the inputs come.
+  ///
+  enum class input_device : std::uint8_t
+  {
+    keyboard,
+    mouse,
+    controller
+  };
+
+  ///
+  /// The type of the tables which bind the inputs to the game actions. An
+  /// input is a device and a code, which is the scancode of a key, the number
+  /// of a mouse button, or a controller button. Each input is bound to at
+  /// most one action but an action may have many inputs.
+  ///
+  class action_map final
+  {
+  public:
+    ///
+    /// Binds the given input to the given action, replacing the previous
+    /// binding of the input.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    /// \param action the action, which must be less than
+    /// \c max_input_actions.
+    ///
+    void bind(
+        const input_device device, const int code, const std::size_t action);
+
+    ///
+    /// Removes the binding of the given input.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    ///
+    /// \return Whether or not the input was bound.
+    ///
+    bool unbind(const input_device device, const int code);
+
+    ///
+    /// Removes all of the bindings.
+    ///
+    void clear() noexcept;
+
+    ///
+    /// Gives the action to which the given input is bound.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    ///
+    /// \return The action or \c std::nullopt if the input isn't bound.
+    ///
+    std::optional<std::size_t> find(
+        const input_device device, const int code) const;
+
+    ///
+    /// Calls the given function for each binding.
+    ///
+    /// \tparam F the type of the function.
+    ///
+    /// \param f the function, which is called with the device, the code, and
+    /// the action of the binding.
+    ///
+    template <typename F> void for_each(F&& f) const
+    {
+      for (const auto& [key, action] : bindings)
+      {
+        f(static_cast<input_device>(key >> 24),
+          static_cast<int>(key & 0xffffff),
+          action);
+      }
+    }
+
+    ///
+    /// Gives the number of the bindings.
+    ///
+    /// \return The number of the bindings.
+    ///
+    inline std::size_t size() const noexcept
+    {
+      return bindings.size();
+    }
+
+  private:
+    ///
+    /// Combines the device and the code of an input into the key of the
+    /// table.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    ///
+    /// \return The key.
+    ///
+    static constexpr std::uint32_t make_key(
+        const input_device device, const int code) noexcept
+    {
+      return static_cast<std::uint32_t>(device) << 24 |
+          (static_cast<std::uint32_t>(code) & 0xffffff);
+    }
+
+    ///
+    /// The actions by the keys of the inputs.
+    ///
+    std::unordered_map<std::uint32_t, std::size_t> bindings{};
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_INPUT_ACTION_MAP_H
@@ -0,0 +1,47 @@
+/// The declarations and the definitions of the input system constants.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_INPUT_INPUT_CONFIG_H
+#define ODE_SYSTEMS_INPUT_INPUT_CONFIG_H
+
+#include <cstddef>
+
+namespace ode
+{
+  ///
+  /// The number of the game actions to which the inputs can be bound. The
+  /// actions are stored as bits in the input snapshots.
+  ///
+#ifdef ODE_MAX_INPUT_ACTIONS
+  constexpr std::size_t max_input_actions = ODE_MAX_INPUT_ACTIONS;
+#else
+  constexpr std::size_t max_input_actions = 64;
+#endif // !defined(ODE_MAX_INPUT_ACTIONS)
+
+  ///
+  /// The number of the mouse buttons that are tracked.
+  ///
+  constexpr std::size_t input_mouse_buttons = 8;
+
+  ///
+  /// The number of the input snapshots kept in the ring. A published
+  /// snapshot stays unchanged until this many more snapshots minus one have
+  /// been published.
+  ///
+#ifdef ODE_INPUT_SNAPSHOT_BUFFERS
+  constexpr std::size_t input_snapshot_buffers = ODE_INPUT_SNAPSHOT_BUFFERS;
+#else
+  constexpr std::size_t input_snapshot_buffers = 3;
+#endif // !defined(ODE_INPUT_SNAPSHOT_BUFFERS)
+
+  static_assert(
+      input_snapshot_buffers >= 2,
+      "The snapshot that is read must not be the one that is written");
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_INPUT_INPUT_CONFIG_H
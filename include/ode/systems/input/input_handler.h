@@ -0,0 +1,195 @@
+/// The declaration of the type of the objects which turn the input events
+/// into the game actions and the input snapshots.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_INPUT_INPUT_HANDLER_H
+#define ODE_SYSTEMS_INPUT_INPUT_HANDLER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL2/SDL.h>
+
+#include "ode/systems/input/action_map.h"
+#include "ode/systems/input/input_config.h"
+#include "ode/systems/input/input_snapshot.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which keep the state of the keyboard, the mouse,
+  /// and the controllers, map the input events to the game actions, and
+  /// publish a snapshot of the state once per update tick. The events are
+  /// handled and the snapshots published on the main thread, but the latest
+  /// snapshot can be read from any thread without locking.
+  ///
+  class input_handler final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c input_handler.
+    ///
+    input_handler();
+
+    ///
+    /// Constructs an object of the type \c input_handler by copying the given
+    /// object of the type \c input_handler.
+    ///
+    /// \param a an \c input_handler from which the new one is constructed.
+    ///
+    input_handler(const input_handler& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c input_handler by moving the given
+    /// object of the type \c input_handler.
+    ///
+    /// \param a an \c input_handler from which the new one is constructed.
+    ///
+    input_handler(input_handler&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c input_handler and closes the
+    /// controllers.
+    ///
+    ~input_handler();
+
+    ///
+    /// Assigns the given object of the type \c input_handler to this one by
+    /// copying.
+    ///
+    /// \param a an \c input_handler from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    input_handler& operator=(const input_handler& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c input_handler to this one by
+    /// moving.
+    ///
+    /// \param a an \c input_handler from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    input_handler& operator=(input_handler&& a) = delete;
+
+    ///
+    /// Updates the input state according to the given event. The events that
+    /// don't come from the input devices are ignored.
+    ///
+    /// \param event the event.
+    ///
+    void handle(const SDL_Event& event);
+
+    ///
+    /// Publishes the current input state as the latest snapshot and starts
+    /// collecting the changes of the next tick.
+    ///
+    void publish();
+
+    ///
+    /// Gives the latest published snapshot. The snapshot isn't modified until
+    /// \c input_snapshot_buffers minus one more snapshots are published, so
+    /// it may be read during the tick on any thread.
+    ///
+    /// \return A reference to the snapshot.
+    ///
+    const input_snapshot& get_snapshot() const noexcept;
+
+    ///
+    /// Binds the given input to the given action.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    /// \param action the action.
+    ///
+    void bind(
+        const input_device device, const int code, const std::size_t action);
+
+    ///
+    /// Removes the binding of the given input.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    ///
+    void unbind(const input_device device, const int code);
+
+    ///
+    /// Gives the bindings of the inputs to the actions.
+    ///
+    /// \return A reference to the bindings.
+    ///
+    inline const action_map& get_bindings() const noexcept
+    {
+      return bindings;
+    }
+
+  private:
+    ///
+    /// Checks whether or not the given input is held down.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    ///
+    /// \return \c true if the input is down, otherwise \c false.
+    ///
+    bool is_down(const input_device device, const int code) const;
+
+    ///
+    /// Sets the state of the given input and updates the action that it is
+    /// bound to.
+    ///
+    /// \param device the device of the input.
+    /// \param code the code of the input.
+    /// \param down whether or not the input is held down.
+    ///
+    void set(const input_device device, const int code, const bool down);
+
+    ///
+    /// Counts the held inputs of the actions again after the bindings or the
+    /// input state have changed. The actions which start or stop being held
+    /// are marked as pressed or released.
+    ///
+    void recount();
+
+    ///
+    /// The bindings of the inputs to the actions.
+    ///
+    action_map bindings;
+
+    ///
+    /// The state that is collected during the current tick.
+    ///
+    input_snapshot current;
+
+    ///
+    /// The number of the held inputs of each action.
+    ///
+    std::array<std::uint16_t, max_input_actions> held;
+
+    ///
+    /// The published snapshots.
+    ///
+    std::array<input_snapshot, input_snapshot_buffers> snapshots;
+
+    ///
+    /// The index of the latest published snapshot.
+    ///
+    std::atomic<std::size_t> latest;
+
+    ///
+    /// The opened controllers.
+    ///
+    std::vector<SDL_GameController*> controllers;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_INPUT_INPUT_HANDLER_H
@@ -0,0 +1,151 @@
+/// The declaration of the type of the immutable snapshots of the input state.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_INPUT_INPUT_SNAPSHOT_H
+#define ODE_SYSTEMS_INPUT_INPUT_SNAPSHOT_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+#include <SDL2/SDL.h>
+
+#include "ode/systems/input/input_config.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which hold the state of the input devices and
+  /// the game actions at the end of an update tick. The snapshots are
+  /// published once per tick and aren't modified after that, so the systems
+  /// that update the game can read them from any thread.
+  ///
+  struct input_snapshot final
+  {
+    ///
+    /// The number of the tick in which the snapshot was published.
+    ///
+    std::uint64_t tick = 0;
+
+    ///
+    /// The keys that are held down, indexed by their scancodes.
+    ///
+    std::bitset<SDL_NUM_SCANCODES> keys{};
+
+    ///
+    /// The mouse buttons that are held down, indexed by their SDL button
+    /// numbers.
+    ///
+    std::bitset<input_mouse_buttons> mouse_buttons{};
+
+    ///
+    /// The controller buttons that are held down on any controller.
+    ///
+    std::bitset<SDL_CONTROLLER_BUTTON_MAX> controller_buttons{};
+
+    ///
+    /// The positions of the controller axes.
+    ///
+    std::array<std::int16_t, SDL_CONTROLLER_AXIS_MAX> controller_axes{};
+
+    ///
+    /// The position of the mouse on the x axis of the window.
+    ///
+    int mouse_x = 0;
+
+    ///
+    /// The position of the mouse on the y axis of the window.
+    ///
+    int mouse_y = 0;
+
+    ///
+    /// The movement of the mouse on the x axis during the tick.
+    ///
+    int mouse_dx = 0;
+
+    ///
+    /// The movement of the mouse on the y axis during the tick.
+    ///
+    int mouse_dy = 0;
+
+    ///
+    /// The vertical scrolling of the mouse wheel during the tick.
+    ///
+    int wheel = 0;
+
+    ///
+    /// The actions that are active as at least one of their inputs is held
+    /// down.
+    ///
+    std::bitset<max_input_actions> actions{};
+
+    ///
+    /// The actions that became active during the tick.
+    ///
+    std::bitset<max_input_actions> pressed{};
+
+    ///
+    /// The actions that stopped being active during the tick.
+    ///
+    std::bitset<max_input_actions> released{};
+
+    ///
+    /// Checks whether or not the given action is active.
+    ///
+    /// \param action the action.
+    ///
+    /// \return \c true if the action is active, otherwise \c false.
+    ///
+    inline bool is_down(const std::size_t action) const
+    {
+      return actions.test(action);
+    }
+
+    ///
+    /// Checks whether or not the given action became active during the
+    /// tick. An action that is pressed and released within a single tick is
+    /// both pressed and released.
+    ///
+    /// \param action the action.
+    ///
+    /// \return \c true if the action was pressed, otherwise \c false.
+    ///
+    inline bool was_pressed(const std::size_t action) const
+    {
+      return pressed.test(action);
+    }
+
+    ///
+    /// Checks whether or not the given action stopped being active during
+    /// the tick.
+    ///
+    /// \param action the action.
+    ///
+    /// \return \c true if the action was released, otherwise \c false.
+    ///
+    inline bool was_released(const std::size_t action) const
+    {
+      return released.test(action);
+    }
+
+    ///
+    /// Checks whether or not the given key is held down.
+    ///
+    /// \param key the scancode of the key.
+    ///
+    /// \return \c true if the key is down, otherwise \c false.
+    ///
+    inline bool is_key_down(const SDL_Scancode key) const
+    {
+      return keys.test(static_cast<std::size_t>(key));
+    }
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_INPUT_INPUT_SNAPSHOT_H
@@ -0,0 +1,150 @@
+/// The declaration of the type of the broadphases which find the pairs of the
+/// dynamic bodies that may collide.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_PHYSICS_BROADPHASE_H
+#define ODE_SYSTEMS_PHYSICS_BROADPHASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ode/systems/graphics/rectangle.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which hold a pair of the bodies whose bounds
+  /// overlap. The first body has the lower index.
+  ///
+  struct body_pair final
+  {
+    ///
+    /// The index of the first body.
+    ///
+    std::uint32_t first;
+
+    ///
+    /// The index of the second body.
+    ///
+    std::uint32_t second;
+  };
+
+  ///
+  /// Tells whether or not the given pairs of bodies are the same.
+  ///
+  /// \param a the first pair.
+  /// \param b the second pair.
+  ///
+  /// \return A \c bool.
+  ///
+  constexpr bool operator==(const body_pair& a, const body_pair& b) noexcept
+  {
+    return a.first == b.first && a.second == b.second;
+  }
+
+  ///
+  /// The type of the broadphases which find the overlapping bounds of the
+  /// dynamic bodies by sorting them along the x axis and sweeping over them.
+  /// The order of the bodies is kept between the updates, and as the bodies
+  /// move only a little in each update, it is restored with an insertion
+  /// sort in nearly linear time.
+  ///
+  class broadphase final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c broadphase.
+    ///
+    broadphase();
+
+    ///
+    /// Constructs an object of the type \c broadphase by copying the given
+    /// object of the type \c broadphase.
+    ///
+    /// \param a a \c broadphase from which the new one is constructed.
+    ///
+    broadphase(const broadphase& a) = default;
+
+    ///
+    /// Constructs an object of the type \c broadphase by moving the given
+    /// object of the type \c broadphase.
+    ///
+    /// \param a a \c broadphase from which the new one is constructed.
+    ///
+    broadphase(broadphase&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c broadphase.
+    ///
+    ~broadphase() = default;
+
+    ///
+    /// Assigns the given object of the type \c broadphase to this one by
+    /// copying.
+    ///
+    /// \param a a \c broadphase from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    broadphase& operator=(const broadphase& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c broadphase to this one by
+    /// moving.
+    ///
+    /// \param a a \c broadphase from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    broadphase& operator=(broadphase&& a) = default;
+
+    ///
+    /// Finds the pairs of the bodies whose bounds overlap.
+    ///
+    /// \param bounds the bounds of the bodies, indexed by the bodies.
+    ///
+    void update(const std::vector<rectangle>& bounds);
+
+    ///
+    /// Gives the pairs of the bodies that were found in the last update.
+    ///
+    /// \return A reference to the pairs.
+    ///
+    const std::vector<body_pair>& get_pairs() const noexcept;
+
+  private:
+    ///
+    /// The type of the entries of the sorted bodies.
+    ///
+    struct entry final
+    {
+      ///
+      /// The bounds of the body.
+      ///
+      rectangle bounds;
+
+      ///
+      /// The index of the body.
+      ///
+      std::uint32_t index;
+    };
+
+    ///
+    /// The bodies in the order of the left edges of their bounds.
+    ///
+    std::vector<entry> entries;
+
+    ///
+    /// The pairs found in the last update.
+    ///
+    std::vector<body_pair> pairs;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_PHYSICS_BROADPHASE_H
@@ -0,0 +1,274 @@
+/// The declaration of the type of the collision maps of the tile grids.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_PHYSICS_COLLISION_MAP_H
+#define ODE_SYSTEMS_PHYSICS_COLLISION_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ode/__config"
+#include "ode/systems/graphics/rectangle.h"
+#include "ode/systems/graphics/tile_layer.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which describe the result of sweeping a box
+  /// through a collision map.
+  ///
+  struct sweep_result final
+  {
+    ///
+    /// Whether or not the box hit a solid tile.
+    ///
+    bool hit = false;
+
+    ///
+    /// The fraction of the movement after which the box hit a solid tile, or
+    /// \c 1 if it didn't hit anything.
+    ///
+    float time = 1.0f;
+
+    ///
+    /// The x component of the normal of the surface that was hit.
+    ///
+    int normal_x = 0;
+
+    ///
+    /// The y component of the normal of the surface that was hit.
+    ///
+    int normal_y = 0;
+
+    ///
+    /// The x coordinate of the left edge of the box when the movement ended.
+    ///
+    float x = 0.0f;
+
+    ///
+    /// The y coordinate of the top edge of the box when the movement ended.
+    ///
+    float y = 0.0f;
+  };
+
+  ///
+  /// The type of the collision maps. A collision map is a bitmap with one
+  /// bit for each of the tiles of a map, which tells whether or not the tile
+  /// is solid. The rows of the bitmap are packed into 64-bit words so that
+  /// the runs of tiles that a box overlaps are tested a word at a time. The
+  /// area outside of the map is solid.
+  ///
+  class collision_map final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c collision_map with no solid
+    /// tiles.
+    ///
+    /// \param w the width of the map in tiles.
+    /// \param h the height of the map in tiles.
+    /// \param tile_width the width of the tiles in the world coordinates.
+    /// \param tile_height the height of the tiles in the world coordinates.
+    ///
+    collision_map(
+        const int w,
+        const int h,
+        const float tile_width,
+        const float tile_height) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Constructs an object of the type \c collision_map by copying the
+    /// given object of the type \c collision_map.
+    ///
+    /// \param a a \c collision_map from which the new one is constructed.
+    ///
+    collision_map(const collision_map& a) = default;
+
+    ///
+    /// Constructs an object of the type \c collision_map by moving the given
+    /// object of the type \c collision_map.
+    ///
+    /// \param a a \c collision_map from which the new one is constructed.
+    ///
+    collision_map(collision_map&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c collision_map.
+    ///
+    ~collision_map() = default;
+
+    ///
+    /// Assigns the given object of the type \c collision_map to this one by
+    /// copying.
+    ///
+    /// \param a a \c collision_map from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    collision_map& operator=(const collision_map& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c collision_map to this one by
+    /// moving.
+    ///
+    /// \param a a \c collision_map from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    collision_map& operator=(collision_map&& a) = default;
+
+    ///
+    /// Gives the width of the map in tiles.
+    ///
+    /// \return The width of the map.
+    ///
+    int get_width() const noexcept;
+
+    ///
+    /// Gives the height of the map in tiles.
+    ///
+    /// \return The height of the map.
+    ///
+    int get_height() const noexcept;
+
+    ///
+    /// Tells whether or not the given tile is solid. The tiles outside of
+    /// the map are solid.
+    ///
+    /// \param x the column of the tile.
+    /// \param y the row of the tile.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_solid(const int x, const int y) const noexcept;
+
+    ///
+    /// Sets whether or not the given tile is solid.
+    ///
+    /// \param x the column of the tile.
+    /// \param y the row of the tile.
+    /// \param solid whether or not the tile is solid.
+    ///
+    void set_solid(const int x, const int y, const bool solid)
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Marks the non-empty tiles of the given tile layer as solid.
+    ///
+    /// \param layer the tile layer, which must be as large as the map.
+    ///
+    void add_layer(const tile_layer& layer) ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Marks the tiles that the given area overlaps as solid. This is used
+    /// for the rectangles in the object groups of the maps.
+    ///
+    /// \param area the area in the world coordinates.
+    ///
+    void add_area(const rectangle& area) noexcept;
+
+    ///
+    /// Tells whether or not any of the tiles that the given area overlaps is
+    /// solid.
+    ///
+    /// \param area the area in the world coordinates.
+    ///
+    /// \return A \c bool.
+    ///
+    bool overlaps(const rectangle& area) const noexcept;
+
+    ///
+    /// Moves a box through the map until it hits a solid tile. The tiles
+    /// that the box crosses are visited in order with a DDA traversal of its
+    /// leading edges, so the cost depends on the distance moved in tiles and
+    /// not on the size of the map. The tiles that the box already overlaps
+    /// at the start don't stop it.
+    ///
+    /// \param box the box.
+    /// \param dx the movement along the x axis.
+    /// \param dy the movement along the y axis.
+    ///
+    /// \return The result of the sweep.
+    ///
+    sweep_result sweep(
+        const rectangle& box, const float dx, const float dy) const noexcept;
+
+    ///
+    /// Moves a box through the map and slides it along the surfaces that it
+    /// hits.
+    ///
+    /// \param box the box.
+    /// \param dx the movement along the x axis.
+    /// \param dy the movement along the y axis.
+    ///
+    /// \return The result of the movement. The normal is the sum of the
+    /// normals of the surfaces that were hit.
+    ///
+    sweep_result move(
+        const rectangle& box, const float dx, const float dy) const noexcept;
+
+  private:
+    ///
+    /// Tells whether or not any of the tiles in the given run of a row is
+    /// solid.
+    ///
+    /// \param y the row.
+    /// \param x0 the first column of the run.
+    /// \param x1 the last column of the run.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_row_solid(const int y, const int x0, const int x1) const noexcept;
+
+    ///
+    /// Tells whether or not any of the tiles in the given run of a column is
+    /// solid.
+    ///
+    /// \param x the column.
+    /// \param y0 the first row of the run.
+    /// \param y1 the last row of the run.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_column_solid(const int x, const int y0, const int y1)
+        const noexcept;
+
+    ///
+    /// The width of the map in tiles.
+    ///
+    int width;
+
+    ///
+    /// The height of the map in tiles.
+    ///
+    int height;
+
+    ///
+    /// The width of the tiles in the world coordinates.
+    ///
+    float tile_width;
+
+    ///
+    /// The height of the tiles in the world coordinates.
+    ///
+    float tile_height;
+
+    ///
+    /// The number of the words in each of the rows.
+    ///
+    std::size_t row_words;
+
+    ///
+    /// The bits of the tiles, row by row.
+    ///
+    std::vector<std::uint64_t> bits;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_PHYSICS_COLLISION_MAP_H
@@ -0,0 +1,188 @@
+/// The declaration of the type of the physics worlds of the scenes.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_PHYSICS_PHYSICS_WORLD_H
+#define ODE_SYSTEMS_PHYSICS_PHYSICS_WORLD_H
+
+#include <cstddef>
+#include <vector>
+
+#include "ode/__config"
+#include "ode/systems/graphics/rectangle.h"
+#include "ode/systems/physics/broadphase.h"
+#include "ode/systems/physics/collision_map.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which hold the velocity of a body.
+  ///
+  struct body_velocity final
+  {
+    ///
+    /// The velocity along the x axis in the world units per second.
+    ///
+    float x = 0.0f;
+
+    ///
+    /// The velocity along the y axis in the world units per second.
+    ///
+    float y = 0.0f;
+  };
+
+  ///
+  /// The type of the physics worlds. A physics world moves the dynamic
+  /// bodies of a scene through its collision map and finds the pairs of the
+  /// bodies that overlap each other. The bodies are stored as parallel
+  /// arrays and identified by their indices.
+  ///
+  class physics_world final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c physics_world.
+    ///
+    /// \param map the collision map of the world.
+    ///
+    explicit physics_world(collision_map map);
+
+    ///
+    /// Constructs an object of the type \c physics_world by copying the
+    /// given object of the type \c physics_world.
+    ///
+    /// \param a a \c physics_world from which the new one is constructed.
+    ///
+    physics_world(const physics_world& a) = default;
+
+    ///
+    /// Constructs an object of the type \c physics_world by moving the given
+    /// object of the type \c physics_world.
+    ///
+    /// \param a a \c physics_world from which the new one is constructed.
+    ///
+    physics_world(physics_world&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c physics_world.
+    ///
+    ~physics_world() = default;
+
+    ///
+    /// Assigns the given object of the type \c physics_world to this one by
+    /// copying.
+    ///
+    /// \param a a \c physics_world from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    physics_world& operator=(const physics_world& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c physics_world to this one by
+    /// moving.
+    ///
+    /// \param a a \c physics_world from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    physics_world& operator=(physics_world&& a) = default;
+
+    ///
+    /// Adds a body to the world.
+    ///
+    /// \param bounds the bounds of the body.
+    /// \param velocity the velocity of the body.
+    ///
+    /// \return The index of the body.
+    ///
+    std::size_t add_body(
+        const rectangle& bounds, const body_velocity& velocity = {});
+
+    ///
+    /// Gives the number of the bodies in the world.
+    ///
+    /// \return The number of the bodies.
+    ///
+    std::size_t get_body_count() const noexcept;
+
+    ///
+    /// Gives the bounds of the given body.
+    ///
+    /// \param i the index of the body.
+    ///
+    /// \return The bounds.
+    ///
+    const rectangle& get_bounds(const std::size_t i) const
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Gives the velocity of the given body.
+    ///
+    /// \param i the index of the body.
+    ///
+    /// \return The velocity.
+    ///
+    const body_velocity& get_velocity(const std::size_t i) const
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Sets the velocity of the given body.
+    ///
+    /// \param i the index of the body.
+    /// \param velocity the velocity.
+    ///
+    void set_velocity(const std::size_t i, const body_velocity& velocity)
+        ODE_CONTRACT_NOEXCEPT;
+
+    ///
+    /// Moves the bodies by their velocities and finds the overlapping pairs.
+    /// The velocity of a body is cleared along the axes on which it hits a
+    /// solid tile.
+    ///
+    /// \param delta the duration of the step in seconds.
+    ///
+    void step(const float delta);
+
+    ///
+    /// Gives the pairs of the bodies that overlapped after the last step.
+    ///
+    /// \return A reference to the pairs.
+    ///
+    const std::vector<body_pair>& get_pairs() const noexcept;
+
+    ///
+    /// Gives the collision map of the world.
+    ///
+    /// \return A reference to the collision map.
+    ///
+    const collision_map& get_map() const noexcept;
+
+  private:
+    ///
+    /// The collision map of the world.
+    ///
+    collision_map map;
+
+    ///
+    /// The bounds of the bodies.
+    ///
+    std::vector<rectangle> bounds;
+
+    ///
+    /// The velocities of the bodies.
+    ///
+    std::vector<body_velocity> velocities;
+
+    ///
+    /// The broadphase of the bodies.
+    ///
+    broadphase broad_phase;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_PHYSICS_PHYSICS_WORLD_H
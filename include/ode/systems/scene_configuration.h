@@ -10,6 +10,9 @@
 
 namespace ode
 {
+  class asset_manager;
+  class texture_cache;
+
   ///
   /// The type of the objects which hold the configurations of the scenes which
   /// determine how a scene is loaded and run.
@@ -64,6 +67,33 @@ namespace ode
     /// \return A reference to \c *this.
     ///
     scene_configuration& operator=(scene_configuration&& a) = default;
+
+    ///
+    /// Continues to load the data of the scene. The engine calls this once on
+    /// each frame until it returns \c true and enters the scene only after
+    /// that, so a scene which requests its data from the asset manager is
+    /// loaded across the frames without blocking them.
+    ///
+    /// \param assets the asset manager of the engine.
+    /// \param textures the texture cache of the engine.
+    ///
+    /// \return \c true if the scene is loaded, otherwise \c false.
+    ///
+    virtual bool load(asset_manager&, texture_cache&)
+    {
+      return true;
+    }
+
+    ///
+    /// Releases the assets which the scene has requested in \c load. This is
+    /// called when the scene is left, even if it wasn't fully loaded.
+    ///
+    /// \param assets the asset manager of the engine.
+    /// \param textures the texture cache of the engine.
+    ///
+    virtual void unload(asset_manager&, texture_cache&)
+    {
+    }
   };
 
 } // namespace ode
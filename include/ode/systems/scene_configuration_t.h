@@ -82,11 +82,35 @@ namespace ode
     ///
     scene_configuration_t& operator=(scene_configuration_t&& a) = default;
 
+    ///
+    /// Gives the contained configuration implementation.
+    ///
+    /// \return A pointer to the configuration or \c nullptr if there is
+    /// none.
+    ///
+    inline const scene_configuration* get() const noexcept
+    {
+      return config_ptr.get();
+    }
+
+    ///
+    /// Gives the contained configuration implementation.
+    ///
+    /// Remarks: The pointer returned by this function is not constant.
+    ///
+    /// \return A pointer to the configuration or \c nullptr if there is
+    /// none.
+    ///
+    inline scene_configuration* get() noexcept
+    {
+      return config_ptr.get();
+    }
+
   private:
     ///
     /// A pointer to the contained configuration implementation.
     ///
-    std::shared_ptr<const scene_configuration> config_ptr;
+    std::shared_ptr<scene_configuration> config_ptr;
   };
 
 } // namespace ode
@@ -0,0 +1,290 @@
+/// The declaration of the type of the spatial grids which find the objects
+/// near a point or in an area.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_SPATIAL_GRID_H
+#define ODE_SYSTEMS_SPATIAL_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ode/framework/job_system.h"
+#include "ode/systems/graphics/rectangle.h"
+
+namespace ode
+{
+  ///
+  /// The type of the objects which give the position of an object to a
+  /// spatial grid.
+  ///
+  struct spatial_entry final
+  {
+    ///
+    /// The ID of the object, which the queries give back.
+    ///
+    std::uint32_t id;
+
+    ///
+    /// The x coordinate of the object.
+    ///
+    float x;
+
+    ///
+    /// The y coordinate of the object.
+    ///
+    float y;
+  };
+
+  ///
+  /// The type of the spatial grids. The area of the world is divided into
+  /// square cells, and the objects are indexed by the cells of their
+  /// positions. The grid is rebuilt from the positions of all of the objects
+  /// on every tick instead of being updated as they move: the cell keys of
+  /// the objects are sorted with a radix sort, optionally on the job system,
+  /// and the positions and the IDs are stored in the sorted order. The
+  /// objects in a row of cells are then next to each other in memory, and a
+  /// query looks up each of the rows it covers with a single binary search
+  /// of the sorted keys.
+  ///
+  /// The grid holds the objects as points, so the rendering, the collision,
+  /// and the AI systems can share one grid and test the extents of the
+  /// objects themselves. The objects outside of the bounds of the grid are
+  /// put in the cells at its edges. The queries are const and can be made
+  /// from many threads at the same time.
+  ///
+  class spatial_grid final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c spatial_grid.
+    ///
+    /// \param bounds the area of the world that the grid covers.
+    /// \param cell_size the width and the height of the cells.
+    ///
+    spatial_grid(const rectangle& bounds, const float cell_size);
+
+    ///
+    /// Constructs an object of the type \c spatial_grid by copying the given
+    /// object of the type \c spatial_grid.
+    ///
+    /// \param a a \c spatial_grid from which the new one is constructed.
+    ///
+    spatial_grid(const spatial_grid& a) = default;
+
+    ///
+    /// Constructs an object of the type \c spatial_grid by moving the given
+    /// object of the type \c spatial_grid.
+    ///
+    /// \param a a \c spatial_grid from which the new one is constructed.
+    ///
+    spatial_grid(spatial_grid&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c spatial_grid.
+    ///
+    ~spatial_grid() = default;
+
+    ///
+    /// Assigns the given object of the type \c spatial_grid to this one by
+    /// copying.
+    ///
+    /// \param a a \c spatial_grid from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    spatial_grid& operator=(const spatial_grid& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c spatial_grid to this one by
+    /// moving.
+    ///
+    /// \param a a \c spatial_grid from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    spatial_grid& operator=(spatial_grid&& a) = default;
+
+    ///
+    /// Replaces the objects of the grid with the given ones.
+    ///
+    /// \param entries the objects.
+    ///
+    void rebuild(const std::vector<spatial_entry>& entries);
+
+    ///
+    /// Replaces the objects of the grid with the given ones and sorts them
+    /// on the given job system if there are enough of them. The call blocks
+    /// until the grid is built.
+    ///
+    /// \param entries the objects.
+    /// \param jobs the job system.
+    ///
+    void rebuild(const std::vector<spatial_entry>& entries, job_system& jobs);
+
+    ///
+    /// Finds the objects in the given area, including its edges.
+    ///
+    /// \param area the area.
+    /// \param ids the vector whose contents are replaced by the IDs of the
+    /// objects.
+    ///
+    void query_area(
+        const rectangle& area, std::vector<std::uint32_t>& ids) const;
+
+    ///
+    /// Finds the objects within the given distance of the given point.
+    ///
+    /// \param x the x coordinate of the point.
+    /// \param y the y coordinate of the point.
+    /// \param radius the distance.
+    /// \param ids the vector whose contents are replaced by the IDs of the
+    /// objects.
+    ///
+    void query_radius(
+        const float x,
+        const float y,
+        const float radius,
+        std::vector<std::uint32_t>& ids) const;
+
+    ///
+    /// Finds the objects nearest to the given point. The cells are searched
+    /// in rings around the cell of the point until no cell further out can
+    /// hold a nearer object.
+    ///
+    /// \param x the x coordinate of the point.
+    /// \param y the y coordinate of the point.
+    /// \param count the number of the objects to find.
+    /// \param ids the vector whose contents are replaced by the IDs of the
+    /// objects, the nearest first.
+    ///
+    void query_nearest(
+        const float x,
+        const float y,
+        const std::size_t count,
+        std::vector<std::uint32_t>& ids) const;
+
+    ///
+    /// Gives the number of the objects in the grid.
+    ///
+    /// \return The number of the objects.
+    ///
+    std::size_t get_entry_count() const noexcept;
+
+    ///
+    /// Gives the number of the cells of the grid.
+    ///
+    /// \return The number of the cells.
+    ///
+    std::size_t get_cell_count() const noexcept;
+
+  private:
+    ///
+    /// Gives the column of the cell that contains the given x coordinate.
+    ///
+    /// \param x the x coordinate.
+    ///
+    /// \return The column, clamped to the grid.
+    ///
+    std::uint32_t get_column(const float x) const noexcept;
+
+    ///
+    /// Gives the row of the cell that contains the given y coordinate.
+    ///
+    /// \param y the y coordinate.
+    ///
+    /// \return The row, clamped to the grid.
+    ///
+    std::uint32_t get_row(const float y) const noexcept;
+
+    ///
+    /// Gives the index of the first object in the given row whose column is
+    /// at least the given one.
+    ///
+    /// \param row the row.
+    /// \param column the column.
+    ///
+    /// \return The index of the object.
+    ///
+    std::size_t find_cell(
+        const std::uint32_t row, const std::uint32_t column) const noexcept;
+
+    ///
+    /// Builds the grid from the given objects.
+    ///
+    /// \param entries the objects.
+    /// \param jobs the job system on which the objects are sorted, or
+    /// \c nullptr if they are sorted on the calling thread.
+    ///
+    void build(const std::vector<spatial_entry>& entries, job_system* jobs);
+
+    ///
+    /// The area of the world that the grid covers.
+    ///
+    rectangle bounds;
+
+    ///
+    /// The width and the height of the cells.
+    ///
+    float cell_size;
+
+    ///
+    /// The inverse of the width and the height of the cells.
+    ///
+    float inverse_cell_size;
+
+    ///
+    /// The number of the columns of the cells.
+    ///
+    std::uint32_t columns;
+
+    ///
+    /// The number of the rows of the cells.
+    ///
+    std::uint32_t rows;
+
+    ///
+    /// The sorted cell keys of the objects.
+    ///
+    std::vector<std::uint32_t> keys;
+
+    ///
+    /// The IDs of the objects in the sorted order.
+    ///
+    std::vector<std::uint32_t> ids;
+
+    ///
+    /// The x coordinates of the objects in the sorted order.
+    ///
+    std::vector<float> xs;
+
+    ///
+    /// The y coordinates of the objects in the sorted order.
+    ///
+    std::vector<float> ys;
+
+    ///
+    /// The cell keys of the objects in the upper halves and the indices of
+    /// the objects in the lower halves, in the order in which they are
+    /// sorted.
+    ///
+    std::vector<std::uint64_t> order;
+
+    ///
+    /// The values that the radix sort writes into.
+    ///
+    std::vector<std::uint64_t> order_buffer;
+
+    ///
+    /// The counts of the digits of the radix sort for each of the chunks.
+    ///
+    std::vector<std::size_t> histograms;
+  };
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_SPATIAL_GRID_H
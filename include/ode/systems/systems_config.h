@@ -0,0 +1,44 @@
+/// The declarations and the definitions of the constants shared by the
+/// systems.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ODE_SYSTEMS_SYSTEMS_CONFIG_H
+#define ODE_SYSTEMS_SYSTEMS_CONFIG_H
+
+#include <cstddef>
+
+namespace ode
+{
+  ///
+  /// The number of the bits of the cell keys that the spatial grids sort in
+  /// a single pass of the radix sort.
+  ///
+#ifdef ODE_SPATIAL_GRID_RADIX_BITS
+  constexpr int spatial_grid_radix_bits = ODE_SPATIAL_GRID_RADIX_BITS;
+#else
+  constexpr int spatial_grid_radix_bits = 8;
+#endif // !defined(ODE_SPATIAL_GRID_RADIX_BITS)
+
+  static_assert(
+      spatial_grid_radix_bits > 0 && spatial_grid_radix_bits <= 16,
+      "The radix of the spatial grids must be between 1 and 16 bits");
+
+  ///
+  /// The number of the entries from which on the spatial grids are sorted
+  /// on the job system. Sorting fewer entries in parallel costs more than
+  /// it saves.
+  ///
+#ifdef ODE_SPATIAL_GRID_PARALLEL_THRESHOLD
+  constexpr std::size_t spatial_grid_parallel_threshold =
+      ODE_SPATIAL_GRID_PARALLEL_THRESHOLD;
+#else
+  constexpr std::size_t spatial_grid_parallel_threshold = 65536;
+#endif // !defined(ODE_SPATIAL_GRID_PARALLEL_THRESHOLD)
+
+} // namespace ode
+
+#endif // !ODE_SYSTEMS_SYSTEMS_CONFIG_H
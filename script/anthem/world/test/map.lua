@@ -22,7 +22,7 @@ test = {
       tileheight = 16,
       spacing = 0,
       margin = 0,
-      image = "assets/anthem/test/map/tileset.png",
+      image = "assets/anthem/world/test/map/tileset.png",
       imagewidth = 128,
       imageheight = 64,
       transparentcolour = "#ff00ff",
@@ -0,0 +1,17 @@
+-- Copyright (c) 2026 Antti Kivi
+-- Licensed under the Effective Elegy Licence
+
+total = 0
+
+function accumulate(x)
+  total = total + x
+  return total
+end
+
+function work(n)
+  local sum = 0
+  for i = 1, n do
+    sum = sum + (i * i) % 7
+  end
+  return sum
+end
@@ -0,0 +1,8 @@
+-- Copyright (c) 2026 Antti Kivi
+-- Licensed under the Effective Elegy Licence
+
+function make_garbage(n)
+  for i = 1, n do
+    local t = { i, tostring(i), { x = i, y = i * 2 } }
+  end
+end
@@ -0,0 +1,50 @@
+-- Copyright (c) 2026 Antti Kivi
+-- Licensed under the Effective Elegy Licence
+
+function make(x, y)
+  made = vector2.new(x, y)
+end
+
+function length_of_shared()
+  return shared:length()
+end
+
+function scale_shared(f)
+  shared:scale(f)
+end
+
+function sum_x(x1, x2)
+  return vector2.new(x1, 0):add(vector2.new(x2, 0)):get_x()
+end
+
+function add_wrong_type()
+  return shared:add(3)
+end
+
+function shift_shared(n)
+  shared:shift(n)
+end
+
+function rename_shared(name)
+  shared:rename(name)
+end
+
+function sum_lengths(n)
+  local s = 0
+  for i = 1, n do
+    s = s + shared:length()
+  end
+  return s
+end
+
+function fill_layer(gid)
+  for y = 0, layer:get_height() - 1 do
+    for x = 0, layer:get_width() - 1 do
+      layer:set(x, y, gid)
+    end
+  end
+end
+
+function read_outside_layer()
+  return layer:get(layer:get_width(), 0)
+end
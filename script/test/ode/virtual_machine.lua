@@ -18,3 +18,11 @@ end
 function pow(x, y)
   return math.pow(x, y) -- x ^ y
 end
+
+function fail()
+  error("failed on purpose")
+end
+
+function pair(x)
+  return x, "pair"
+end
@@ -24,7 +24,9 @@ namespace anthem
     return os << "{"
               << ", window_width:" << std::to_string(a.window_width)
               << ", window_height:" << std::to_string(a.window_height)
-              << ", window_name:" << a.window_name << "}";
+              << ", window_name:" << a.window_name
+              << ", record_file:" << a.record_file
+              << ", replay_file:" << a.replay_file << "}";
   }
 
   std::pair<bool, arguments> parse_arguments(const int argc, char* argv[])
@@ -47,7 +49,14 @@ namespace anthem
         "window-name",
         "Set the name of the game window",
         cxxopts::value<std::string>()->default_value(
-            default_window_name_value));
+            default_window_name_value))(
+        "record",
+        "Record the input of the session to the given file",
+        cxxopts::value<std::string>()->default_value(""))(
+        "replay",
+        "Replay the input recorded in the given file as fast as possible and "
+        "exit",
+        cxxopts::value<std::string>()->default_value(""));
 
     try
     {
@@ -70,7 +79,9 @@ namespace anthem
           true,
           {result["window-width"].as<ode::pixel_t>(),
            result["window-height"].as<ode::pixel_t>(),
-           result["window-name"].as<std::string>()}};
+           result["window-name"].as<std::string>(),
+           result["record"].as<std::string>(),
+           result["replay"].as<std::string>()}};
     }
     catch (const cxxopts::OptionParseException& e)
     {
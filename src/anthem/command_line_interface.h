@@ -84,6 +84,16 @@ namespace anthem
     ///
     const std::string window_name = "null"s;
 
+    ///
+    /// The name of the file to which the input is recorded.
+    ///
+    const std::string record_file = ""s;
+
+    ///
+    /// The name of the file from which the recorded input is replayed.
+    ///
+    const std::string replay_file = ""s;
+
   }; // struct arguments final
 
   ///
@@ -99,7 +109,9 @@ namespace anthem
   {
     return lhs.window_width == rhs.window_width &&
         lhs.window_height == rhs.window_height &&
-        lhs.window_name == rhs.window_name;
+        lhs.window_name == rhs.window_name &&
+        lhs.record_file == rhs.record_file &&
+        lhs.replay_file == rhs.replay_file;
   }
 
   ///
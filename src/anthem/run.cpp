@@ -57,12 +57,20 @@ namespace anthem
     ANTHEM_TRACE("The following values are set to the arguments:\n{}", args);
 
     const auto info = ode::execution_info{
-        args.window_width, args.window_height, args.window_name};
+        args.window_width,
+        args.window_height,
+        args.window_name,
+        args.record_file,
+        args.replay_file};
 
     auto app = application{};
     auto engine = ode::make_engine(std::move(app), info);
 
-    ode::main_loop<application>(std::move(engine));
+    // The framework logs the reason if the session fails.
+    if (!ode::main_loop<application>(std::move(engine)))
+    {
+      return EXIT_FAILURE;
+    }
 
     return EXIT_SUCCESS;
   }
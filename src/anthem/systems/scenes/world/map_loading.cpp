@@ -8,10 +8,263 @@
 
 #include "anthem/systems/scenes/world/map_loading.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "gsl/assert"
+
+#include "ode/filesystem/path.h"
+#include "ode/lua/lua_config.h"
+#include "ode/lua/script.h"
+#include "ode/lua/stack.h"
+#include "ode/lua/state.h"
 #include "ode/lua/virtual_machine.h"
+#include "ode/systems/graphics/image.h"
+#include "ode/systems/graphics/texture_atlas.h"
+
+#include "anthem/config.h"
+#include "anthem/logger.h"
 
 namespace anthem::world
 {
+  namespace detail
+  {
+    struct tileset_image final
+    {
+      std::string filename;
+      std::optional<std::uint32_t> colour_key;
+      ode::atlas_entry entry;
+    };
+
+    static int get_int_field(const ode::lua::state_ptr_t state, const char* k)
+    {
+      lua_getfield(state, ode::lua::stack_top, k);
+      const auto value = static_cast<int>(lua_tointeger(state, -1));
+      lua_pop(state, 1);
+      return value;
+    }
+
+    static std::string get_string_field(
+        const ode::lua::state_ptr_t state, const char* k)
+    {
+      lua_getfield(state, ode::lua::stack_top, k);
+      const char* value = lua_tostring(state, -1);
+      std::string s = nullptr == value ? std::string{} : std::string{value};
+      lua_pop(state, 1);
+      return s;
+    }
+
+    static bool get_collision_property(const ode::lua::state_ptr_t state)
+    {
+      lua_getfield(state, ode::lua::stack_top, "properties");
+
+      bool collision = false;
+
+      if (1 == lua_istable(state, ode::lua::stack_top))
+      {
+        lua_getfield(state, ode::lua::stack_top, "collision");
+        collision = 1 == lua_toboolean(state, ode::lua::stack_top);
+        lua_pop(state, 1);
+      }
+
+      lua_pop(state, 1);
+
+      return collision;
+    }
+
+    static void add_collision_objects(
+        const ode::lua::state_ptr_t state, ode::collision_map& map)
+    {
+      lua_getfield(state, ode::lua::stack_top, "objects");
+
+      if (1 == lua_istable(state, ode::lua::stack_top))
+      {
+        const auto count = static_cast<int>(lua_rawlen(state, -1));
+
+        for (int i = 1; i <= count; ++i)
+        {
+          lua_rawgeti(state, ode::lua::stack_top, i);
+
+          if ("rectangle" == get_string_field(state, "shape"))
+          {
+            const auto x = static_cast<float>(get_int_field(state, "x"));
+            const auto y = static_cast<float>(get_int_field(state, "y"));
+            const auto w = static_cast<float>(get_int_field(state, "width"));
+            const auto h = static_cast<float>(get_int_field(state, "height"));
+
+            map.add_area({x, y, x + w, y + h});
+          }
+
+          lua_pop(state, 1);
+        }
+      }
+
+      lua_pop(state, 1);
+    }
+
+    static std::string make_atlas_key(
+        const std::vector<tileset_image>& images, const std::size_t page)
+    {
+      // The key describes the whole layout of the page so that the maps
+      // share an atlas only if it has the same images in the same places.
+      std::string key = "atlas";
+
+      for (const auto& img : images)
+      {
+        if (page != img.entry.page)
+        {
+          continue;
+        }
+
+        key += ";" + img.filename + "@" + std::to_string(img.entry.region.x) +
+            "," + std::to_string(img.entry.region.y);
+
+        if (img.colour_key)
+        {
+          key += "#" + std::to_string(*img.colour_key);
+        }
+      }
+
+      return key;
+    }
+
+    static std::optional<ode::image> build_atlas_page(
+        const ode::atlas_builder& builder,
+        const std::vector<tileset_image>& images,
+        const std::size_t page)
+    {
+      auto atlas = builder.make_page_image(page);
+
+      for (const auto& img : images)
+      {
+        if (page != img.entry.page)
+        {
+          continue;
+        }
+
+        auto decoded = ode::load_image(img.filename);
+
+        if (!decoded)
+        {
+          return std::nullopt;
+        }
+
+        const auto& region = img.entry.region;
+
+        if (decoded->width != region.width ||
+            decoded->height != region.height)
+        {
+          ANTHEM_ERROR(
+              "The size of the tileset image '{}' is {}x{} instead of {}x{}",
+              img.filename,
+              decoded->width,
+              decoded->height,
+              region.width,
+              region.height);
+          return std::nullopt;
+        }
+
+        if (img.colour_key)
+        {
+          ode::apply_colour_key(*decoded, *img.colour_key);
+        }
+
+        ode::blit(*decoded, atlas, region.x, region.y);
+      }
+
+      return atlas;
+    }
+
+    static void read_tilesets(
+        const ode::lua::state_ptr_t state,
+        const std::string& name,
+        map_tilesets& result,
+        std::vector<tileset_image>& images,
+        ode::atlas_builder& builder)
+    {
+      using ode::lua::stack_top;
+
+      const int top = lua_gettop(state);
+
+      const bool found =
+          ode::lua::try_to_stack(state, name + ".tilesets").has_value();
+
+      Expects(found);
+
+      const auto count = static_cast<int>(lua_rawlen(state, stack_top));
+
+      for (int i = 1; i <= count; ++i)
+      {
+        lua_rawgeti(state, stack_top, i);
+
+        Expects(1 == lua_istable(state, stack_top));
+
+        ode::tileset set{};
+        set.first_gid =
+            static_cast<std::uint32_t>(get_int_field(state, "firstgid"));
+        set.tile_width = get_int_field(state, "tilewidth");
+        set.tile_height = get_int_field(state, "tileheight");
+        set.image_width = get_int_field(state, "imagewidth");
+        set.image_height = get_int_field(state, "imageheight");
+        set.spacing = get_int_field(state, "spacing");
+        set.margin = get_int_field(state, "margin");
+        set.tile_count =
+            static_cast<std::uint32_t>(get_int_field(state, "tilecount"));
+
+        tileset_image img{};
+        img.filename = get_string_field(state, "image");
+        img.colour_key = ode::parse_colour(
+            get_string_field(state, "transparentcolour"));
+        img.entry = builder.add(set.image_width, set.image_height);
+
+        set.atlas_x = img.entry.region.x;
+        set.atlas_y = img.entry.region.y;
+        set.texture_width = builder.get_page_width(img.entry.page);
+        set.texture_height = builder.get_page_height(img.entry.page);
+
+        result.tilesets.push_back(set);
+        images.push_back(std::move(img));
+
+        lua_pop(state, 1);
+      }
+
+      lua_settop(state, top);
+    }
+
+    static std::vector<int> find_tile_layers(
+        const ode::lua::state_ptr_t state, const std::string& name)
+    {
+      const int top = lua_gettop(state);
+
+      std::vector<int> indices{};
+
+      if (ode::lua::try_to_stack(state, name + ".layers"))
+      {
+        const auto count = static_cast<int>(lua_rawlen(state, -1));
+
+        for (int i = 0; i < count; ++i)
+        {
+          lua_rawgeti(state, -1, i + 1);
+
+          if ("tilelayer" == get_string_field(state, "type"))
+          {
+            indices.push_back(i);
+          }
+
+          lua_pop(state, 1);
+        }
+      }
+
+      lua_settop(state, top);
+
+      return indices;
+    }
+  } // namespace detail
+
   int load_map_width(const ode::lua::state_ptr_t state, const std::string& name)
       ODE_CONTRACT_NOEXCEPT
   {
@@ -26,4 +279,350 @@ namespace anthem::world
     const std::string var = name + ".height";
     return ode::lua::get<int>(state, var);
   }
+
+  ode::tile_layer load_tile_layer(
+      const ode::lua::state_ptr_t state,
+      const std::string& name,
+      const int index)
+  {
+    using ode::lua::stack_top;
+
+    const int top = lua_gettop(state);
+
+    const bool found =
+        ode::lua::try_to_stack(state, name + ".layers").has_value();
+
+    Expects(found);
+
+    lua_rawgeti(state, stack_top, index + 1);
+
+    Expects(1 == lua_istable(state, stack_top));
+
+    lua_getfield(state, stack_top, "width");
+    const auto width = static_cast<int>(lua_tointeger(state, stack_top));
+    lua_getfield(state, stack_top - 1, "height");
+    const auto height = static_cast<int>(lua_tointeger(state, stack_top));
+    lua_pop(state, 2);
+
+    lua_getfield(state, stack_top, "data");
+
+    Expects(1 == lua_istable(state, stack_top));
+
+    std::vector<std::uint32_t> gids(static_cast<std::size_t>(width) * height);
+
+    for (std::size_t i = 0; i < gids.size(); ++i)
+    {
+      lua_rawgeti(state, stack_top, static_cast<lua_Integer>(i + 1));
+      gids[i] = static_cast<std::uint32_t>(lua_tointeger(state, stack_top));
+      lua_pop(state, 1);
+    }
+
+    lua_settop(state, top);
+
+    return {width, height, std::move(gids)};
+  }
+
+  ode::collision_map load_collision_map(
+      const ode::lua::state_ptr_t state,
+      const std::string& name)
+  {
+    using ode::lua::stack_top;
+
+    const int top = lua_gettop(state);
+
+    const bool found = ode::lua::try_to_stack(state, name).has_value();
+
+    Expects(found);
+
+    ode::collision_map map{
+        detail::get_int_field(state, "width"),
+        detail::get_int_field(state, "height"),
+        static_cast<float>(detail::get_int_field(state, "tilewidth")),
+        static_cast<float>(detail::get_int_field(state, "tileheight"))};
+
+    lua_getfield(state, stack_top, "layers");
+
+    const auto count = static_cast<int>(lua_rawlen(state, stack_top));
+
+    for (int i = 0; i < count; ++i)
+    {
+      lua_rawgeti(state, stack_top, i + 1);
+
+      if (detail::get_collision_property(state))
+      {
+        const auto type = detail::get_string_field(state, "type");
+
+        if ("tilelayer" == type)
+        {
+          map.add_layer(load_tile_layer(state, name, i));
+        }
+        else if ("objectgroup" == type)
+        {
+          detail::add_collision_objects(state, map);
+        }
+      }
+
+      lua_pop(state, 1);
+    }
+
+    lua_settop(state, top);
+
+    return map;
+  }
+
+  map_tilesets load_tilesets(
+      const ode::lua::state_ptr_t state,
+      const std::string& name,
+      ode::texture_cache& cache)
+  {
+    map_tilesets result{};
+    std::vector<detail::tileset_image> images{};
+    ode::atlas_builder builder{};
+
+    detail::read_tilesets(state, name, result, images, builder);
+
+    std::vector<std::uint32_t> textures(builder.get_page_count(), 0);
+
+    for (std::size_t page = 0; page < builder.get_page_count(); ++page)
+    {
+      auto key = detail::make_atlas_key(images, page);
+
+      textures[page] = cache.acquire(key, [&builder, &images, page] {
+        return detail::build_atlas_page(builder, images, page);
+      });
+
+      if (cache.contains(key))
+      {
+        result.textures.push_back(std::move(key));
+      }
+    }
+
+    for (std::size_t i = 0; i < images.size(); ++i)
+    {
+      result.tilesets[i].texture = textures[images[i].entry.page];
+    }
+
+    return result;
+  }
+
+  std::vector<map_tile_animation> load_tile_animations(
+      const ode::lua::state_ptr_t state,
+      const std::string& name)
+  {
+    using ode::lua::stack_top;
+
+    const int top = lua_gettop(state);
+
+    const bool found =
+        ode::lua::try_to_stack(state, name + ".tilesets").has_value();
+
+    Expects(found);
+
+    const auto count = static_cast<int>(lua_rawlen(state, stack_top));
+
+    std::vector<map_tile_animation> animations{};
+
+    for (int i = 1; i <= count; ++i)
+    {
+      lua_rawgeti(state, stack_top, i);
+
+      const auto first_gid =
+          static_cast<std::uint32_t>(detail::get_int_field(state, "firstgid"));
+
+      lua_getfield(state, stack_top, "tiles");
+
+      const auto tiles = 1 == lua_istable(state, stack_top)
+          ? static_cast<int>(lua_rawlen(state, stack_top))
+          : 0;
+
+      for (int j = 1; j <= tiles; ++j)
+      {
+        lua_rawgeti(state, stack_top, j);
+        lua_getfield(state, stack_top, "animation");
+
+        if (1 == lua_istable(state, stack_top))
+        {
+          map_tile_animation animation{};
+
+          const auto frames = static_cast<int>(lua_rawlen(state, stack_top));
+
+          for (int k = 1; k <= frames; ++k)
+          {
+            lua_rawgeti(state, stack_top, k);
+
+            animation.frames.push_back(
+                {static_cast<std::uint32_t>(
+                     detail::get_int_field(state, "tileid")),
+                 static_cast<std::uint32_t>(
+                     detail::get_int_field(state, "duration"))});
+
+            lua_pop(state, 1);
+          }
+
+          // Pop the animation table to read the ID of the tile.
+          lua_pop(state, 1);
+
+          animation.gid = first_gid +
+              static_cast<std::uint32_t>(detail::get_int_field(state, "id"));
+          animation.tileset = static_cast<std::size_t>(i - 1);
+
+          if (!animation.frames.empty())
+          {
+            animations.push_back(std::move(animation));
+          }
+        }
+        else
+        {
+          lua_pop(state, 1);
+        }
+
+        lua_pop(state, 1);
+      }
+
+      lua_pop(state, 2);
+    }
+
+    lua_settop(state, top);
+
+    return animations;
+  }
+
+  void release_tilesets(
+      const map_tilesets& tilesets,
+      ode::texture_cache& cache)
+  {
+    for (const auto& key : tilesets.textures)
+    {
+      cache.release(key);
+    }
+  }
+
+
+  ode::asset_handle<map_data> request_map(
+      ode::asset_manager& assets,
+      const std::string& name)
+  {
+    using ode::filesystem::path::preferred_separator;
+
+    const auto filename = std::string{script_root} + preferred_separator +
+        "world" + preferred_separator + name + preferred_separator +
+        "map.lua";
+
+    const auto decode = [name, filename]() {
+      std::optional<map_data> map{};
+      auto state = ode::lua::make_state();
+      const auto loaded = ode::lua::try_load_script_file(state.get(), filename);
+
+      if (!loaded)
+      {
+        ANTHEM_ERROR(
+            "The map '{}' can't be loaded: {}",
+            name,
+            loaded.get_error().message);
+        return map;
+      }
+
+      map = map_data{
+          load_map_width(state.get(), name),
+          load_map_height(state.get(), name),
+          {},
+          load_collision_map(state.get(), name)};
+
+      for (const int index : detail::find_tile_layers(state.get(), name))
+      {
+        map->layers.push_back(load_tile_layer(state.get(), name, index));
+      }
+
+      return map;
+    };
+
+    // The tile layers are uploaded by the renderer when they are first
+    // drawn, so there is nothing to upload here.
+    return assets.request<map_data>(
+        "map:" + name, decode, [](map_data&) -> std::size_t { return 0; });
+  }
+
+  ode::asset_handle<map_tilesets> request_tilesets(
+      ode::asset_manager& assets,
+      ode::texture_cache& cache,
+      const ode::lua::state_ptr_t state,
+      const std::string& name)
+  {
+    map_tilesets tilesets{};
+    std::vector<detail::tileset_image> images{};
+    ode::atlas_builder builder{};
+
+    detail::read_tilesets(state, name, tilesets, images, builder);
+
+    const auto page_count = builder.get_page_count();
+
+    std::vector<std::string> keys{};
+    std::vector<bool> cached{};
+
+    for (std::size_t page = 0; page < page_count; ++page)
+    {
+      keys.push_back(detail::make_atlas_key(images, page));
+      cached.push_back(cache.contains(keys.back()));
+    }
+
+    // The worker hands the decoded pages to the upload through the shared
+    // vector. The pages that are already in the cache aren't decoded.
+    auto pages =
+        std::make_shared<std::vector<std::optional<ode::image>>>(page_count);
+
+    const auto decode = [tilesets, images, builder, cached, pages]() {
+      for (std::size_t page = 0; page < pages->size(); ++page)
+      {
+        if (!cached[page])
+        {
+          (*pages)[page] = detail::build_atlas_page(builder, images, page);
+        }
+      }
+
+      return std::optional<map_tilesets>{tilesets};
+    };
+
+    const auto upload =
+        [&cache, images, builder, keys, pages](map_tilesets& t) {
+          std::size_t size = 0;
+
+          for (std::size_t page = 0; page < pages->size(); ++page)
+          {
+            auto& decoded = (*pages)[page];
+            size += decoded ? decoded->pixels.size() : 0;
+
+            // A page that was cached when the tilesets were requested may
+            // have been released since, and it's then built here.
+            const auto texture = cache.acquire(keys[page], [&] {
+              return decoded ? std::move(decoded)
+                             : detail::build_atlas_page(builder, images, page);
+            });
+
+            if (cache.contains(keys[page]))
+            {
+              t.textures.push_back(keys[page]);
+            }
+
+            for (std::size_t i = 0; i < images.size(); ++i)
+            {
+              if (page == images[i].entry.page)
+              {
+                t.tilesets[i].texture = texture;
+              }
+            }
+          }
+
+          pages->clear();
+
+          return size;
+        };
+
+    const auto unload = [&cache](map_tilesets& t) {
+      release_tilesets(t, cache);
+    };
+
+    return assets.request<map_tilesets>(
+        "tilesets:" + name, decode, upload, unload);
+  }
+
 } // namespace anthem::world
@@ -9,10 +9,19 @@
 #ifndef ANTHEM_SYSTEMS_SCENES_WORLD_MAP_LOADING_H
 #define ANTHEM_SYSTEMS_SCENES_WORLD_MAP_LOADING_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "ode/__config"
+#include "ode/assets/asset_manager.h"
 #include "ode/lua/state_t.h"
+#include "ode/systems/graphics/animation_system.h"
+#include "ode/systems/graphics/texture_cache.h"
+#include "ode/systems/graphics/tile_layer.h"
+#include "ode/systems/graphics/tile_renderer.h"
+#include "ode/systems/physics/collision_map.h"
 
 namespace anthem::world
 {
@@ -45,6 +54,138 @@ namespace anthem::world
       const ode::lua::state_ptr_t state,
       const std::string& name) ODE_CONTRACT_NOEXCEPT;
 
+  ///
+  /// Loads a tile layer of the map from the scripts.
+  ///
+  /// Remarks: The script containing the data of the map must be loaded into
+  /// the Lua state before this function may be called, and the layer must
+  /// be a tile layer with its data encoded as a Lua table.
+  ///
+  /// \param state the Lua state to be used.
+  /// \param name the name of the map.
+  /// \param index the zero-based index of the layer in the layers of the
+  /// map.
+  ///
+  /// \return The tile layer.
+  ///
+  ode::tile_layer load_tile_layer(
+      const ode::lua::state_ptr_t state,
+      const std::string& name,
+      const int index);
+
+  /// Loads the collision map of the map from the scripts. The non-empty
+  /// tiles of the tile layers and the rectangles of the object groups are
+  /// solid if the layer has the custom property \c collision set to true.
+  /// Remarks: The script containing the data of the map must be loaded into
+  /// the Lua state before this function may be called.
+  /// \param state the Lua state to be used.
+  /// \param name the name of the map.
+  /// \return The collision map.
+  ode::collision_map load_collision_map(
+      const ode::lua::state_ptr_t state,
+      const std::string& name);
+
+  /// The tilesets of a map and the keys of the textures that they hold in the
+  /// texture cache.
+  struct map_tilesets final
+  {
+    /// The tilesets in the order of the map.
+    std::vector<ode::tileset> tilesets;
+
+    /// The keys of the atlas textures of the tilesets.
+    std::vector<std::string> textures;
+  };
+
+  /// Loads the tilesets of the map from the scripts and packs their images
+  /// into shared atlas textures. The atlas pages are acquired from the
+  /// texture cache, so the images are decoded and uploaded only if no other
+  /// map has already loaded the same atlas.
+  /// Remarks: The script containing the data of the map must be loaded into
+  /// the Lua state before this function may be called.
+  /// \param state the Lua state to be used.
+  /// \param name the name of the map.
+  /// \param cache the texture cache to be used.
+  /// \return The tilesets. A tileset that can't be loaded has no texture.
+  map_tilesets load_tilesets(
+      const ode::lua::state_ptr_t state,
+      const std::string& name,
+      ode::texture_cache& cache);
+
+  /// Releases the atlas textures of the tilesets of a map.
+  /// \param tilesets the tilesets.
+  /// \param cache the texture cache from which the tilesets were loaded.
+  void release_tilesets(
+      const map_tilesets& tilesets,
+      ode::texture_cache& cache);
+
+  /// The animation of a tile of a tileset of a map.
+  struct map_tile_animation final
+  {
+    /// The global tile ID of the animated tile.
+    std::uint32_t gid;
+
+    /// The index of the tileset of the tile in the tilesets of the map.
+    std::size_t tileset;
+
+    /// The frames of the animation.
+    std::vector<ode::animation_frame> frames;
+  };
+
+  /// Loads the animations of the tiles of the tilesets of the map from the
+  /// scripts.
+  /// Remarks: The script containing the data of the map must be loaded into
+  /// the Lua state before this function may be called.
+  /// \param state the Lua state to be used.
+  /// \param name the name of the map.
+  /// \return The animations of the tiles.
+  std::vector<map_tile_animation> load_tile_animations(
+      const ode::lua::state_ptr_t state,
+      const std::string& name);
+
+  /// The data of a map which is decoded from the scripts.
+  struct map_data final
+  {
+    /// The width of the map in tiles.
+    int width;
+
+    /// The height of the map in tiles.
+    int height;
+
+    /// The tile layers of the map in the order of the map.
+    std::vector<ode::tile_layer> layers;
+
+    /// The collision map of the map.
+    ode::collision_map collision;
+  };
+
+  /// Requests the data of the map to be decoded from its script on a worker
+  /// thread of the asset manager. The script is run in a Lua state of its
+  /// own, so the scene that requests the map isn't blocked.
+  /// \param assets the asset manager to be used.
+  /// \param name the name of the map.
+  /// \return The handle of the map data.
+  ode::asset_handle<map_data> request_map(
+      ode::asset_manager& assets,
+      const std::string& name);
+
+  /// Requests the tilesets of the map to be packed into atlas textures. The
+  /// tilesets are read from the given Lua state on the calling thread, and
+  /// the images are decoded and packed on a worker thread of the asset
+  /// manager. The atlas pages are uploaded through the texture cache, so the
+  /// pages that another map has already loaded aren't decoded again.
+  /// Remarks: The script containing the data of the map must be loaded into
+  /// the Lua state before this function may be called.
+  /// \param assets the asset manager to be used.
+  /// \param cache the texture cache, which must outlive the tilesets.
+  /// \param state the Lua state to be used.
+  /// \param name the name of the map.
+  /// \return The handle of the tilesets.
+  ode::asset_handle<map_tilesets> request_tilesets(
+      ode::asset_manager& assets,
+      ode::texture_cache& cache,
+      const ode::lua::state_ptr_t state,
+      const std::string& name);
+
 } // namespace anthem::world
 
 #endif // !ANTHEM_SYSTEMS_SCENES_WORLD_MAP_LOADING_H
@@ -0,0 +1,775 @@
+/// The definition of the type of the hierarchical path graphs of the tile
+/// maps.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "anthem/systems/scenes/world/path_graph.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+
+#include "gsl/assert"
+
+namespace anthem::world
+{
+  namespace detail
+  {
+    ///
+    /// The directions of the steps between the tiles. The first four are
+    /// the straight ones.
+    ///
+    constexpr int step_x[] = {1, -1, 0, 0, 1, 1, -1, -1};
+
+    ///
+    /// The directions of the steps between the tiles along the y axis.
+    ///
+    constexpr int step_y[] = {0, 0, 1, -1, 1, -1, 1, -1};
+
+    ///
+    /// Gives the lower bound of the cost between the given tiles.
+    ///
+    /// \param a the first tile.
+    /// \param b the second tile.
+    ///
+    /// \return The octile distance between the tiles.
+    ///
+    static int estimate_cost(const tile_point& a, const tile_point& b) noexcept
+    {
+      const int dx = std::abs(a.x - b.x);
+      const int dy = std::abs(a.y - b.y);
+      const int diagonal = std::min(dx, dy);
+
+      return path_diagonal_cost * diagonal +
+          path_straight_cost * (std::max(dx, dy) - diagonal);
+    }
+
+    ///
+    /// Starts a new search by advancing its number, and clears the marks of
+    /// the searches when the number wraps around.
+    ///
+    /// \param search the number of the search.
+    /// \param reached the marks of the reached elements.
+    /// \param closed the marks of the closed elements.
+    ///
+    static void begin_search(
+        std::uint32_t& search,
+        std::vector<std::uint32_t>& reached,
+        std::vector<std::uint32_t>& closed)
+    {
+      if (0 == ++search)
+      {
+        std::fill(reached.begin(), reached.end(), 0);
+        std::fill(closed.begin(), closed.end(), 0);
+        search = 1;
+      }
+    }
+
+    ///
+    /// Adds an element to the open set of a search.
+    ///
+    /// \param open the open set.
+    /// \param estimate the estimated cost of the path through the element.
+    /// \param index the index of the element.
+    ///
+    static void push_open(
+        std::vector<std::pair<int, std::uint32_t>>& open,
+        const int estimate,
+        const std::uint32_t index)
+    {
+      open.emplace_back(estimate, index);
+      std::push_heap(open.begin(), open.end(), std::greater<>{});
+    }
+
+    ///
+    /// Removes the element with the lowest estimated cost from the open set
+    /// of a search.
+    ///
+    /// \param open the open set.
+    ///
+    /// \return The estimated cost and the index of the element.
+    ///
+    static std::pair<int, std::uint32_t> pop_open(
+        std::vector<std::pair<int, std::uint32_t>>& open)
+    {
+      std::pop_heap(open.begin(), open.end(), std::greater<>{});
+      const auto top = open.back();
+      open.pop_back();
+      return top;
+    }
+  } // namespace detail
+
+  path_graph::path_graph(ode::collision_map map, const int cluster_size)
+      : map{std::move(map)},
+        cluster_size{cluster_size},
+        cluster_columns{0},
+        cluster_rows{0},
+        nodes{},
+        free_nodes{},
+        cluster_nodes{},
+        dirty{},
+        dirty_clusters{}
+  {
+    Expects(0 < cluster_size);
+
+    cluster_columns = (this->map.get_width() + cluster_size - 1) / cluster_size;
+    cluster_rows = (this->map.get_height() + cluster_size - 1) / cluster_size;
+
+    const auto count = static_cast<std::size_t>(cluster_columns) *
+        static_cast<std::size_t>(cluster_rows);
+
+    cluster_nodes.resize(count);
+    dirty.assign(count, true);
+    dirty_clusters.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      dirty_clusters.push_back(static_cast<int>(i));
+    }
+
+    rebuild();
+  }
+
+  const ode::collision_map& path_graph::get_map() const noexcept
+  {
+    return map;
+  }
+
+  void path_graph::set_solid(const int x, const int y, const bool solid)
+  {
+    if (solid == map.is_solid(x, y))
+    {
+      return;
+    }
+
+    map.set_solid(x, y, solid);
+
+    const int cluster = get_cluster({x, y});
+
+    if (!dirty[static_cast<std::size_t>(cluster)])
+    {
+      dirty[static_cast<std::size_t>(cluster)] = true;
+      dirty_clusters.push_back(cluster);
+    }
+  }
+
+  bool path_graph::is_dirty() const noexcept
+  {
+    return !dirty_clusters.empty();
+  }
+
+  void path_graph::rebuild()
+  {
+    if (dirty_clusters.empty())
+    {
+      return;
+    }
+
+    std::vector<int> borders{};
+    std::vector<int> affected{};
+
+    for (const int c : dirty_clusters)
+    {
+      const int cx = c % cluster_columns;
+      const int cy = c / cluster_columns;
+
+      // The entrances on all four borders of a dirty cluster may change, and
+      // so may the edges inside of the clusters on the other sides.
+      borders.push_back(c * 2);
+      borders.push_back(c * 2 + 1);
+      affected.push_back(c);
+
+      if (0 < cx)
+      {
+        borders.push_back((c - 1) * 2);
+        affected.push_back(c - 1);
+      }
+
+      if (0 < cy)
+      {
+        borders.push_back((c - cluster_columns) * 2 + 1);
+        affected.push_back(c - cluster_columns);
+      }
+
+      if (cx + 1 < cluster_columns)
+      {
+        affected.push_back(c + 1);
+      }
+
+      if (cy + 1 < cluster_rows)
+      {
+        affected.push_back(c + cluster_columns);
+      }
+
+      dirty[static_cast<std::size_t>(c)] = false;
+    }
+
+    dirty_clusters.clear();
+
+    std::sort(borders.begin(), borders.end());
+    borders.erase(std::unique(borders.begin(), borders.end()), borders.end());
+    std::sort(affected.begin(), affected.end());
+    affected.erase(
+        std::unique(affected.begin(), affected.end()), affected.end());
+
+    for (const int c : affected)
+    {
+      auto& list = cluster_nodes[static_cast<std::size_t>(c)];
+
+      const auto removed = std::remove_if(
+          list.begin(), list.end(), [this, &borders](const std::uint32_t i) {
+            auto& n = nodes[i];
+
+            if (!std::binary_search(borders.begin(), borders.end(), n.border))
+            {
+              return false;
+            }
+
+            n.alive = false;
+            n.edges.clear();
+            free_nodes.push_back(i);
+            return true;
+          });
+
+      list.erase(removed, list.end());
+
+      // The edges inside of the cluster are dropped before the removed nodes
+      // are reused, so no edge is left pointing to a reused node.
+      for (const auto i : list)
+      {
+        auto& edges = nodes[i].edges;
+
+        edges.erase(
+            std::remove_if(
+                edges.begin(),
+                edges.end(),
+                [this, c](const edge& e) { return c == nodes[e.to].cluster; }),
+            edges.end());
+      }
+    }
+
+    for (const int border : borders)
+    {
+      build_border(border);
+    }
+
+    path_scratch scratch{};
+
+    for (const int c : affected)
+    {
+      build_cluster_edges(c, scratch);
+    }
+  }
+
+  std::size_t path_graph::get_cluster_count() const noexcept
+  {
+    return cluster_nodes.size();
+  }
+
+  std::size_t path_graph::get_node_count() const noexcept
+  {
+    return nodes.size() - free_nodes.size();
+  }
+
+  std::size_t path_graph::get_edge_count() const noexcept
+  {
+    std::size_t count = 0;
+
+    for (const auto& n : nodes)
+    {
+      count += n.edges.size();
+    }
+
+    return count;
+  }
+
+  std::vector<tile_point> path_graph::find_path(
+      const tile_point& start,
+      const tile_point& goal,
+      path_scratch& scratch) const
+  {
+    Expects(!is_dirty());
+
+    if (map.is_solid(start.x, start.y) || map.is_solid(goal.x, goal.y))
+    {
+      return {};
+    }
+
+    std::vector<tile_point> path{start};
+
+    if (start == goal)
+    {
+      return path;
+    }
+
+    const int start_cluster = get_cluster(start);
+    const int goal_cluster = get_cluster(goal);
+    const auto start_bounds = get_bounds(start_cluster);
+    const auto goal_bounds = get_bounds(goal_cluster);
+
+    if (start_cluster == goal_cluster)
+    {
+      if (append_local_path(start_bounds, start, goal, scratch, path))
+      {
+        return path;
+      }
+
+      path.resize(1);
+    }
+
+    // The start and the goal are connected to the nodes of their clusters
+    // for the search without adding them to the graph, so the graph can be
+    // searched from many threads at the same time.
+    scratch.goal_links.clear();
+    search_cluster(goal_bounds, goal, nullptr, scratch);
+
+    for (const auto i :
+         cluster_nodes[static_cast<std::size_t>(goal_cluster)])
+    {
+      const int cost = get_tile_cost(goal_bounds, nodes[i].position, scratch);
+
+      if (0 <= cost)
+      {
+        scratch.goal_links.emplace_back(i, cost);
+      }
+    }
+
+    if (scratch.goal_links.empty())
+    {
+      return {};
+    }
+
+    if (scratch.costs.size() < nodes.size())
+    {
+      scratch.costs.resize(nodes.size());
+      scratch.parents.resize(nodes.size());
+      scratch.reached.resize(nodes.size(), 0);
+      scratch.closed.resize(nodes.size(), 0);
+    }
+
+    search_cluster(start_bounds, start, nullptr, scratch);
+    detail::begin_search(scratch.search, scratch.reached, scratch.closed);
+    scratch.open.clear();
+
+    const auto stamp = scratch.search;
+
+    for (const auto i :
+         cluster_nodes[static_cast<std::size_t>(start_cluster)])
+    {
+      const int cost = get_tile_cost(start_bounds, nodes[i].position, scratch);
+
+      if (0 <= cost)
+      {
+        scratch.costs[i] = cost;
+        scratch.parents[i] = -1;
+        scratch.reached[i] = stamp;
+        detail::push_open(
+            scratch.open,
+            cost + detail::estimate_cost(nodes[i].position, goal),
+            i);
+      }
+    }
+
+    std::int32_t best = -1;
+    int best_cost = std::numeric_limits<int>::max();
+
+    while (!scratch.open.empty())
+    {
+      const auto [estimate, i] = detail::pop_open(scratch.open);
+
+      if (stamp == scratch.closed[i])
+      {
+        continue;
+      }
+
+      if (estimate >= best_cost)
+      {
+        break;
+      }
+
+      scratch.closed[i] = stamp;
+
+      for (const auto& [node, cost] : scratch.goal_links)
+      {
+        if (node == i && scratch.costs[i] + cost < best_cost)
+        {
+          best = static_cast<std::int32_t>(i);
+          best_cost = scratch.costs[i] + cost;
+        }
+      }
+
+      for (const auto& e : nodes[i].edges)
+      {
+        if (stamp == scratch.closed[e.to])
+        {
+          continue;
+        }
+
+        const int cost = scratch.costs[i] + e.cost;
+
+        if (stamp != scratch.reached[e.to] || cost < scratch.costs[e.to])
+        {
+          scratch.costs[e.to] = cost;
+          scratch.parents[e.to] = static_cast<std::int32_t>(i);
+          scratch.reached[e.to] = stamp;
+          detail::push_open(
+              scratch.open,
+              cost + detail::estimate_cost(nodes[e.to].position, goal),
+              e.to);
+        }
+      }
+    }
+
+    if (0 > best)
+    {
+      return {};
+    }
+
+    std::vector<std::uint32_t> chain{};
+
+    for (auto i = best; 0 <= i;
+         i = scratch.parents[static_cast<std::size_t>(i)])
+    {
+      chain.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    std::reverse(chain.begin(), chain.end());
+
+    // The abstract path is refined into tiles one cluster at a time. The
+    // edges between the clusters join two neighbouring tiles.
+    bool refined = append_local_path(
+        start_bounds, start, nodes[chain.front()].position, scratch, path);
+
+    for (std::size_t k = 1; refined && k < chain.size(); ++k)
+    {
+      const auto& a = nodes[chain[k - 1]];
+      const auto& b = nodes[chain[k]];
+
+      if (a.cluster == b.cluster)
+      {
+        refined = append_local_path(
+            get_bounds(a.cluster), a.position, b.position, scratch, path);
+      }
+      else
+      {
+        path.push_back(b.position);
+      }
+    }
+
+    if (refined)
+    {
+      refined = append_local_path(
+          goal_bounds, nodes[chain.back()].position, goal, scratch, path);
+    }
+
+    return refined ? path : std::vector<tile_point>{};
+  }
+
+  std::vector<tile_point> path_graph::find_path(
+      const tile_point& start, const tile_point& goal) const
+  {
+    path_scratch scratch{};
+    return find_path(start, goal, scratch);
+  }
+
+  int path_graph::get_cluster(const tile_point& p) const noexcept
+  {
+    return (p.y / cluster_size) * cluster_columns + p.x / cluster_size;
+  }
+
+  path_graph::cluster_bounds path_graph::get_bounds(
+      const int cluster) const noexcept
+  {
+    const int x0 = (cluster % cluster_columns) * cluster_size;
+    const int y0 = (cluster / cluster_columns) * cluster_size;
+
+    return {
+        x0,
+        y0,
+        std::min(x0 + cluster_size, map.get_width()) - 1,
+        std::min(y0 + cluster_size, map.get_height()) - 1};
+  }
+
+  std::uint32_t path_graph::add_node(
+      const tile_point& position, const int border)
+  {
+    std::uint32_t i = static_cast<std::uint32_t>(nodes.size());
+
+    if (free_nodes.empty())
+    {
+      nodes.push_back({position, 0, 0, false, {}});
+    }
+    else
+    {
+      i = free_nodes.back();
+      free_nodes.pop_back();
+    }
+
+    auto& n = nodes[i];
+    n.position = position;
+    n.cluster = get_cluster(position);
+    n.border = border;
+    n.alive = true;
+    n.edges.clear();
+
+    cluster_nodes[static_cast<std::size_t>(n.cluster)].push_back(i);
+
+    return i;
+  }
+
+  void path_graph::build_border(const int border)
+  {
+    const int cluster = border / 2;
+    const bool vertical = 0 == border % 2;
+    const int cx = cluster % cluster_columns;
+    const int cy = cluster / cluster_columns;
+
+    if ((vertical && cx + 1 >= cluster_columns) ||
+        (!vertical && cy + 1 >= cluster_rows))
+    {
+      return;
+    }
+
+    const auto bounds = get_bounds(cluster);
+
+    // The border is walked along its length, and each of the runs of the
+    // tiles that are open on both sides is an entrance.
+    const int first = vertical ? bounds.y0 : bounds.x0;
+    const int last = vertical ? bounds.y1 : bounds.x1;
+    const auto inside = [&](const int t) -> tile_point {
+      return vertical ? tile_point{bounds.x1, t} : tile_point{t, bounds.y1};
+    };
+    const auto outside = [&](const int t) -> tile_point {
+      return vertical ? tile_point{bounds.x1 + 1, t}
+                      : tile_point{t, bounds.y1 + 1};
+    };
+    const auto connect = [this, border, &inside, &outside](const int t) {
+      const auto a = add_node(inside(t), border);
+      const auto b = add_node(outside(t), border);
+
+      nodes[a].edges.push_back({b, path_straight_cost});
+      nodes[b].edges.push_back({a, path_straight_cost});
+    };
+
+    int run = -1;
+
+    for (int t = first; t <= last + 1; ++t)
+    {
+      bool open = false;
+
+      if (t <= last)
+      {
+        const auto a = inside(t);
+        const auto b = outside(t);
+        open = !map.is_solid(a.x, a.y) && !map.is_solid(b.x, b.y);
+      }
+
+      if (open && 0 > run)
+      {
+        run = t;
+      }
+      else if (!open && 0 <= run)
+      {
+        const int end = t - 1;
+
+        if (end - run + 1 >= path_entrance_split)
+        {
+          connect(run);
+          connect(end);
+        }
+        else
+        {
+          connect((run + end) / 2);
+        }
+
+        run = -1;
+      }
+    }
+  }
+
+  void path_graph::build_cluster_edges(
+      const int cluster, path_scratch& scratch)
+  {
+    const auto& list = cluster_nodes[static_cast<std::size_t>(cluster)];
+    const auto bounds = get_bounds(cluster);
+
+    for (const auto i : list)
+    {
+      search_cluster(bounds, nodes[i].position, nullptr, scratch);
+
+      for (const auto j : list)
+      {
+        if (i == j)
+        {
+          continue;
+        }
+
+        const int cost = get_tile_cost(bounds, nodes[j].position, scratch);
+
+        if (0 <= cost)
+        {
+          nodes[i].edges.push_back({j, cost});
+        }
+      }
+    }
+  }
+
+  bool path_graph::search_cluster(
+      const cluster_bounds& bounds,
+      const tile_point& start,
+      const tile_point* goal,
+      path_scratch& scratch) const
+  {
+    const int width = bounds.x1 - bounds.x0 + 1;
+    const auto area = static_cast<std::size_t>(cluster_size) *
+        static_cast<std::size_t>(cluster_size);
+
+    if (scratch.tile_costs.size() < area)
+    {
+      scratch.tile_costs.resize(area);
+      scratch.tile_parents.resize(area);
+      scratch.tile_reached.resize(area, 0);
+      scratch.tile_closed.resize(area, 0);
+    }
+
+    detail::begin_search(
+        scratch.tile_search, scratch.tile_reached, scratch.tile_closed);
+    scratch.open.clear();
+
+    const auto stamp = scratch.tile_search;
+    const auto index = [&bounds, width](const int x, const int y) {
+      return static_cast<std::uint32_t>(
+          (y - bounds.y0) * width + (x - bounds.x0));
+    };
+    const auto first = index(start.x, start.y);
+    const auto target = nullptr == goal
+        ? std::numeric_limits<std::uint32_t>::max()
+        : index(goal->x, goal->y);
+
+    scratch.tile_costs[first] = 0;
+    scratch.tile_parents[first] = -1;
+    scratch.tile_reached[first] = stamp;
+    detail::push_open(scratch.open, 0, first);
+
+    while (!scratch.open.empty())
+    {
+      const auto i = detail::pop_open(scratch.open).second;
+
+      if (stamp == scratch.tile_closed[i])
+      {
+        continue;
+      }
+
+      scratch.tile_closed[i] = stamp;
+
+      if (target == i)
+      {
+        return true;
+      }
+
+      const int x = bounds.x0 + static_cast<int>(i) % width;
+      const int y = bounds.y0 + static_cast<int>(i) / width;
+
+      for (int d = 0; d < 8; ++d)
+      {
+        const int nx = x + detail::step_x[d];
+        const int ny = y + detail::step_y[d];
+
+        if (nx < bounds.x0 || nx > bounds.x1 || ny < bounds.y0 ||
+            ny > bounds.y1 || map.is_solid(nx, ny))
+        {
+          continue;
+        }
+
+        const bool diagonal = 4 <= d;
+
+        // The diagonal steps may not cut the corners of the solid tiles.
+        if (diagonal && (map.is_solid(nx, y) || map.is_solid(x, ny)))
+        {
+          continue;
+        }
+
+        const auto j = index(nx, ny);
+
+        if (stamp == scratch.tile_closed[j])
+        {
+          continue;
+        }
+
+        const int cost = scratch.tile_costs[i] +
+            (diagonal ? path_diagonal_cost : path_straight_cost);
+
+        if (stamp != scratch.tile_reached[j] || cost < scratch.tile_costs[j])
+        {
+          scratch.tile_costs[j] = cost;
+          scratch.tile_parents[j] = static_cast<std::int32_t>(i);
+          scratch.tile_reached[j] = stamp;
+
+          const int estimate = nullptr == goal
+              ? cost
+              : cost + detail::estimate_cost({nx, ny}, *goal);
+
+          detail::push_open(scratch.open, estimate, j);
+        }
+      }
+    }
+
+    return nullptr == goal;
+  }
+
+  int path_graph::get_tile_cost(
+      const cluster_bounds& bounds,
+      const tile_point& p,
+      const path_scratch& scratch) const noexcept
+  {
+    const int width = bounds.x1 - bounds.x0 + 1;
+    const auto i = static_cast<std::size_t>(
+        (p.y - bounds.y0) * width + (p.x - bounds.x0));
+
+    if (scratch.tile_search != scratch.tile_reached[i])
+    {
+      return -1;
+    }
+
+    return scratch.tile_costs[i];
+  }
+
+  bool path_graph::append_local_path(
+      const cluster_bounds& bounds,
+      const tile_point& start,
+      const tile_point& goal,
+      path_scratch& scratch,
+      std::vector<tile_point>& path) const
+  {
+    if (start == goal)
+    {
+      return true;
+    }
+
+    if (!search_cluster(bounds, start, &goal, scratch))
+    {
+      return false;
+    }
+
+    const int width = bounds.x1 - bounds.x0 + 1;
+    const auto offset = path.size();
+
+    for (auto i = static_cast<std::int32_t>(
+             (goal.y - bounds.y0) * width + (goal.x - bounds.x0));
+         0 <= scratch.tile_parents[static_cast<std::size_t>(i)];
+         i = scratch.tile_parents[static_cast<std::size_t>(i)])
+    {
+      path.push_back({bounds.x0 + i % width, bounds.y0 + i / width});
+    }
+
+    std::reverse(
+        path.begin() + static_cast<std::ptrdiff_t>(offset), path.end());
+
+    return true;
+  }
+
+} // namespace anthem::world
@@ -0,0 +1,496 @@
+/// The declaration of the type of the hierarchical path graphs of the tile
+/// maps.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ANTHEM_SYSTEMS_SCENES_WORLD_PATH_GRAPH_H
+#define ANTHEM_SYSTEMS_SCENES_WORLD_PATH_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ode/systems/physics/collision_map.h"
+
+#include "anthem/systems/scenes/world/pathfinding_config.h"
+
+namespace anthem::world
+{
+  ///
+  /// The type of the objects which hold the position of a tile.
+  ///
+  struct tile_point final
+  {
+    ///
+    /// The column of the tile.
+    ///
+    int x;
+
+    ///
+    /// The row of the tile.
+    ///
+    int y;
+  };
+
+  ///
+  /// Tells whether or not the given tile positions are the same.
+  ///
+  /// \param a the first position.
+  /// \param b the second position.
+  ///
+  /// \return A \c bool.
+  ///
+  constexpr bool operator==(const tile_point& a, const tile_point& b) noexcept
+  {
+    return a.x == b.x && a.y == b.y;
+  }
+
+  ///
+  /// Tells whether or not the given tile positions are different.
+  ///
+  /// \param a the first position.
+  /// \param b the second position.
+  ///
+  /// \return A \c bool.
+  ///
+  constexpr bool operator!=(const tile_point& a, const tile_point& b) noexcept
+  {
+    return !(a == b);
+  }
+
+  ///
+  /// The type of the objects which hold the memory that the path searches
+  /// reuse. Each thread that searches for paths needs its own.
+  ///
+  struct path_scratch final
+  {
+    ///
+    /// The costs of the nodes of the graph from the start.
+    ///
+    std::vector<int> costs;
+
+    ///
+    /// The nodes from which the nodes of the graph were reached.
+    ///
+    std::vector<std::int32_t> parents;
+
+    ///
+    /// The search in which each of the nodes was last reached.
+    ///
+    std::vector<std::uint32_t> reached;
+
+    ///
+    /// The search in which each of the nodes was last closed.
+    ///
+    std::vector<std::uint32_t> closed;
+
+    ///
+    /// The costs of the tiles of a cluster from the start of a local search.
+    ///
+    std::vector<int> tile_costs;
+
+    ///
+    /// The tiles from which the tiles of a cluster were reached.
+    ///
+    std::vector<std::int32_t> tile_parents;
+
+    ///
+    /// The local search in which each of the tiles was last reached.
+    ///
+    std::vector<std::uint32_t> tile_reached;
+
+    ///
+    /// The local search in which each of the tiles was last closed.
+    ///
+    std::vector<std::uint32_t> tile_closed;
+
+    ///
+    /// The open nodes or tiles of the current search and their estimated
+    /// costs, as a binary heap.
+    ///
+    std::vector<std::pair<int, std::uint32_t>> open;
+
+    ///
+    /// The nodes of the cluster of the goal and their costs to the goal.
+    ///
+    std::vector<std::pair<std::uint32_t, int>> goal_links;
+
+    ///
+    /// The number of the current search of the graph.
+    ///
+    std::uint32_t search = 0;
+
+    ///
+    /// The number of the current local search.
+    ///
+    std::uint32_t tile_search = 0;
+  };
+
+  ///
+  /// The type of the hierarchical path graphs. The tile map is split into
+  /// square clusters, and the walkable runs of tiles on the borders between
+  /// two clusters are entrances that get a pair of nodes in the abstract
+  /// graph. The nodes of a cluster are connected by edges with the costs of
+  /// the shortest paths between them inside of the cluster. A path is found
+  /// on the abstract graph first and then refined into tiles one cluster at
+  /// a time, so a search visits only a small part of the map.
+  ///
+  /// When tiles change, only the clusters that contain them are marked as
+  /// dirty, and \c rebuild recomputes their entrances and the edges of them
+  /// and of their neighbours. The paths move in eight directions but don't
+  /// cut the corners of the solid tiles.
+  ///
+  class path_graph final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c path_graph and builds the graph.
+    ///
+    /// \param map the collision map of the tile map.
+    /// \param cluster_size the width and the height of the clusters.
+    ///
+    explicit path_graph(
+        ode::collision_map map, const int cluster_size = path_cluster_size);
+
+    ///
+    /// Constructs an object of the type \c path_graph by copying the given
+    /// object of the type \c path_graph.
+    ///
+    /// \param a a \c path_graph from which the new one is constructed.
+    ///
+    path_graph(const path_graph& a) = default;
+
+    ///
+    /// Constructs an object of the type \c path_graph by moving the given
+    /// object of the type \c path_graph.
+    ///
+    /// \param a a \c path_graph from which the new one is constructed.
+    ///
+    path_graph(path_graph&& a) = default;
+
+    ///
+    /// Destructs an object of the type \c path_graph.
+    ///
+    ~path_graph() = default;
+
+    ///
+    /// Assigns the given object of the type \c path_graph to this one by
+    /// copying.
+    ///
+    /// \param a a \c path_graph from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    path_graph& operator=(const path_graph& a) = default;
+
+    ///
+    /// Assigns the given object of the type \c path_graph to this one by
+    /// moving.
+    ///
+    /// \param a a \c path_graph from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    path_graph& operator=(path_graph&& a) = default;
+
+    ///
+    /// Gives the collision map of the graph.
+    ///
+    /// \return A reference to the collision map.
+    ///
+    const ode::collision_map& get_map() const noexcept;
+
+    ///
+    /// Sets whether or not the given tile is solid and marks its cluster as
+    /// dirty if the tile changes. The graph must be rebuilt before it is
+    /// searched again.
+    ///
+    /// \param x the column of the tile.
+    /// \param y the row of the tile.
+    /// \param solid whether or not the tile is solid.
+    ///
+    void set_solid(const int x, const int y, const bool solid);
+
+    ///
+    /// Tells whether or not any of the clusters is dirty.
+    ///
+    /// \return A \c bool.
+    ///
+    bool is_dirty() const noexcept;
+
+    ///
+    /// Rebuilds the parts of the graph that the dirty clusters affect.
+    ///
+    void rebuild();
+
+    ///
+    /// Gives the number of the clusters.
+    ///
+    /// \return The number of the clusters.
+    ///
+    std::size_t get_cluster_count() const noexcept;
+
+    ///
+    /// Gives the number of the nodes in the abstract graph.
+    ///
+    /// \return The number of the nodes.
+    ///
+    std::size_t get_node_count() const noexcept;
+
+    ///
+    /// Gives the number of the edges in the abstract graph. Each of the edges
+    /// is counted in both directions.
+    ///
+    /// \return The number of the edges.
+    ///
+    std::size_t get_edge_count() const noexcept;
+
+    ///
+    /// Finds a path between the given tiles.
+    ///
+    /// \param start the tile from which the path starts.
+    /// \param goal the tile at which the path ends.
+    /// \param scratch the memory used by the search.
+    ///
+    /// \return The tiles of the path including the start and the goal, or an
+    /// empty path if there is no path.
+    ///
+    std::vector<tile_point> find_path(
+        const tile_point& start,
+        const tile_point& goal,
+        path_scratch& scratch) const;
+
+    ///
+    /// Finds a path between the given tiles.
+    ///
+    /// \param start the tile from which the path starts.
+    /// \param goal the tile at which the path ends.
+    ///
+    /// \return The tiles of the path including the start and the goal, or an
+    /// empty path if there is no path.
+    ///
+    std::vector<tile_point> find_path(
+        const tile_point& start, const tile_point& goal) const;
+
+  private:
+    ///
+    /// The type of the edges of the abstract graph.
+    ///
+    struct edge final
+    {
+      ///
+      /// The index of the node to which the edge leads.
+      ///
+      std::uint32_t to;
+
+      ///
+      /// The cost of the edge.
+      ///
+      int cost;
+    };
+
+    ///
+    /// The type of the nodes of the abstract graph.
+    ///
+    struct node final
+    {
+      ///
+      /// The tile of the node.
+      ///
+      tile_point position;
+
+      ///
+      /// The index of the cluster of the node.
+      ///
+      int cluster;
+
+      ///
+      /// The key of the border on which the entrance of the node is.
+      ///
+      int border;
+
+      ///
+      /// Whether or not the node is in use.
+      ///
+      bool alive;
+
+      ///
+      /// The edges from the node.
+      ///
+      std::vector<edge> edges;
+    };
+
+    ///
+    /// The type of the objects which describe the tiles of a cluster.
+    ///
+    struct cluster_bounds final
+    {
+      ///
+      /// The first column of the cluster.
+      ///
+      int x0;
+
+      ///
+      /// The first row of the cluster.
+      ///
+      int y0;
+
+      ///
+      /// The last column of the cluster.
+      ///
+      int x1;
+
+      ///
+      /// The last row of the cluster.
+      ///
+      int y1;
+    };
+
+    ///
+    /// Gives the index of the cluster of the given tile.
+    ///
+    /// \param p the tile.
+    ///
+    /// \return The index of the cluster.
+    ///
+    int get_cluster(const tile_point& p) const noexcept;
+
+    ///
+    /// Gives the tiles of the given cluster.
+    ///
+    /// \param cluster the index of the cluster.
+    ///
+    /// \return The bounds of the cluster.
+    ///
+    cluster_bounds get_bounds(const int cluster) const noexcept;
+
+    ///
+    /// Adds a node to the graph.
+    ///
+    /// \param position the tile of the node.
+    /// \param border the key of the border of the entrance of the node.
+    ///
+    /// \return The index of the node.
+    ///
+    std::uint32_t add_node(const tile_point& position, const int border);
+
+    ///
+    /// Finds the entrances on the given border and adds their nodes.
+    ///
+    /// \param border the key of the border.
+    ///
+    void build_border(const int border);
+
+    ///
+    /// Computes the edges between the nodes of the given cluster.
+    ///
+    /// \param cluster the index of the cluster.
+    /// \param scratch the memory used by the searches.
+    ///
+    void build_cluster_edges(const int cluster, path_scratch& scratch);
+
+    ///
+    /// Searches the tiles of a cluster from the given tile. If a goal is
+    /// given, the search stops when the goal is reached, and otherwise all
+    /// of the reachable tiles of the cluster are visited.
+    ///
+    /// \param bounds the tiles of the cluster.
+    /// \param start the tile from which the search starts.
+    /// \param goal the tile at which the search stops, if any.
+    /// \param scratch the memory used by the search.
+    ///
+    /// \return Whether or not the goal was reached.
+    ///
+    bool search_cluster(
+        const cluster_bounds& bounds,
+        const tile_point& start,
+        const tile_point* goal,
+        path_scratch& scratch) const;
+
+    ///
+    /// Gives the cost of the given tile from the start of the last local
+    /// search.
+    ///
+    /// \param bounds the tiles of the cluster that was searched.
+    /// \param p the tile.
+    /// \param scratch the memory used by the search.
+    ///
+    /// \return The cost or a negative value if the tile wasn't reached.
+    ///
+    int get_tile_cost(
+        const cluster_bounds& bounds,
+        const tile_point& p,
+        const path_scratch& scratch) const noexcept;
+
+    ///
+    /// Appends the path inside of a cluster between the given tiles to the
+    /// given path. The start of the path is not appended.
+    ///
+    /// \param bounds the tiles of the cluster.
+    /// \param start the tile from which the path starts.
+    /// \param goal the tile at which the path ends.
+    /// \param scratch the memory used by the search.
+    /// \param path the path to which the tiles are appended.
+    ///
+    /// \return Whether or not a path was found.
+    ///
+    bool append_local_path(
+        const cluster_bounds& bounds,
+        const tile_point& start,
+        const tile_point& goal,
+        path_scratch& scratch,
+        std::vector<tile_point>& path) const;
+
+    ///
+    /// The collision map of the tile map.
+    ///
+    ode::collision_map map;
+
+    ///
+    /// The width and the height of the clusters.
+    ///
+    int cluster_size;
+
+    ///
+    /// The number of the columns of the clusters.
+    ///
+    int cluster_columns;
+
+    ///
+    /// The number of the rows of the clusters.
+    ///
+    int cluster_rows;
+
+    ///
+    /// The nodes of the abstract graph.
+    ///
+    std::vector<node> nodes;
+
+    ///
+    /// The indices of the nodes that aren't in use.
+    ///
+    std::vector<std::uint32_t> free_nodes;
+
+    ///
+    /// The indices of the nodes of each of the clusters.
+    ///
+    std::vector<std::vector<std::uint32_t>> cluster_nodes;
+
+    ///
+    /// Whether or not each of the clusters is dirty.
+    ///
+    std::vector<bool> dirty;
+
+    ///
+    /// The indices of the dirty clusters.
+    ///
+    std::vector<int> dirty_clusters;
+  };
+
+} // namespace anthem::world
+
+#endif // !ANTHEM_SYSTEMS_SCENES_WORLD_PATH_GRAPH_H
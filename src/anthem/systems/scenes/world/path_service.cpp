@@ -0,0 +1,144 @@
+/// The definition of the type of the services which find the paths of the
+/// characters on the job system.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "anthem/systems/scenes/world/path_service.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "gsl/assert"
+
+#include "anthem/logger.h"
+
+namespace anthem::world
+{
+  path_service::path_service(
+      ode::job_system& jobs,
+      ode::collision_map map,
+      const std::size_t batch_size)
+      : jobs{jobs},
+        batch_size{batch_size},
+        graph{std::make_shared<path_graph>(std::move(map))},
+        readers{std::make_shared<std::atomic<std::size_t>>(0)},
+        requests{},
+        results{std::make_shared<ode::message_queue<path_result>>()},
+        next_id{0},
+        pending{0}
+  {
+    Expects(0 < batch_size);
+
+    ANTHEM_DEBUG(
+        "Built a path graph with {} nodes in {} clusters",
+        graph->get_node_count(),
+        graph->get_cluster_count());
+  }
+
+  path_service::~path_service()
+  {
+    results->close();
+  }
+
+  std::uint64_t path_service::request(
+      const tile_point& start, const tile_point& goal)
+  {
+    const auto id = next_id++;
+    requests.push_back({id, start, goal});
+    ++pending;
+    return id;
+  }
+
+  void path_service::set_solid(const int x, const int y, const bool solid)
+  {
+    if (solid == graph->get_map().is_solid(x, y))
+    {
+      return;
+    }
+
+    // The jobs that are still running keep their snapshot of the graph. The
+    // acquire pairs with the release in the jobs so that their reads of the
+    // graph happen before it is changed in place.
+    if (0 < readers->load(std::memory_order_acquire))
+    {
+      graph = std::make_shared<path_graph>(*graph);
+      readers = std::make_shared<std::atomic<std::size_t>>(0);
+    }
+
+    graph->set_solid(x, y, solid);
+  }
+
+  void path_service::update()
+  {
+    if (graph->is_dirty())
+    {
+      graph->rebuild();
+    }
+
+    if (requests.empty())
+    {
+      return;
+    }
+
+    const std::shared_ptr<const path_graph> snapshot = graph;
+
+    for (std::size_t first = 0; first < requests.size(); first += batch_size)
+    {
+      const auto last = std::min(first + batch_size, requests.size());
+
+      std::vector<path_request> batch(
+          requests.begin() + static_cast<std::ptrdiff_t>(first),
+          requests.begin() + static_cast<std::ptrdiff_t>(last));
+
+      readers->fetch_add(1, std::memory_order_relaxed);
+
+      jobs.submit([queue = results,
+                   snapshot,
+                   count = readers,
+                   batch = std::move(batch)] {
+        path_scratch scratch{};
+
+        for (const auto& r : batch)
+        {
+          queue->push({r.id, snapshot->find_path(r.start, r.goal, scratch)});
+        }
+
+        count->fetch_sub(1, std::memory_order_release);
+      });
+    }
+
+    requests.clear();
+  }
+
+  void path_service::finish()
+  {
+    update();
+    jobs.wait();
+  }
+
+  std::optional<path_result> path_service::poll()
+  {
+    auto result = results->try_pop();
+
+    if (result)
+    {
+      --pending;
+    }
+
+    return result;
+  }
+
+  std::size_t path_service::get_pending_count() const noexcept
+  {
+    return pending;
+  }
+
+  const path_graph& path_service::get_graph() const noexcept
+  {
+    return *graph;
+  }
+
+} // namespace anthem::world
@@ -0,0 +1,234 @@
+/// The declaration of the type of the services which find the paths of the
+/// characters on the job system.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ANTHEM_SYSTEMS_SCENES_WORLD_PATH_SERVICE_H
+#define ANTHEM_SYSTEMS_SCENES_WORLD_PATH_SERVICE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "ode/framework/job_system.h"
+#include "ode/framework/message_queue.h"
+#include "ode/systems/physics/collision_map.h"
+
+#include "anthem/systems/scenes/world/path_graph.h"
+#include "anthem/systems/scenes/world/pathfinding_config.h"
+
+namespace anthem::world
+{
+  ///
+  /// The type of the objects which hold a path that was found.
+  ///
+  struct path_result final
+  {
+    ///
+    /// The ID of the request of the path.
+    ///
+    std::uint64_t id;
+
+    ///
+    /// The tiles of the path, or an empty path if there is no path.
+    ///
+    std::vector<tile_point> path;
+  };
+
+  ///
+  /// The type of the services which find the paths between the tiles of a
+  /// map without blocking the frames. The requests are collected during a
+  /// frame and submitted to the job system in batches by \c update, and the
+  /// results are handed back through a message queue.
+  ///
+  /// The jobs search a shared snapshot of the path graph. When tiles change
+  /// while jobs still use the snapshot, the graph is copied, so the running
+  /// jobs finish on the old map and the new requests see the new one. The
+  /// service itself must only be used on a single thread.
+  ///
+  class path_service final
+  {
+  public:
+    ///
+    /// Constructs an object of the type \c path_service.
+    ///
+    /// \param jobs the job system on which the paths are found.
+    /// \param map the collision map of the tile map.
+    /// \param batch_size the number of the requests handled by a single job.
+    ///
+    path_service(
+        ode::job_system& jobs,
+        ode::collision_map map,
+        const std::size_t batch_size = path_batch_size);
+
+    ///
+    /// Constructs an object of the type \c path_service by copying the given
+    /// object of the type \c path_service.
+    ///
+    /// \param a a \c path_service from which the new one is constructed.
+    ///
+    path_service(const path_service& a) = delete;
+
+    ///
+    /// Constructs an object of the type \c path_service by moving the given
+    /// object of the type \c path_service.
+    ///
+    /// \param a a \c path_service from which the new one is constructed.
+    ///
+    path_service(path_service&& a) = delete;
+
+    ///
+    /// Destructs an object of the type \c path_service. The jobs that are
+    /// still running are left to finish, and their results are dropped.
+    ///
+    ~path_service();
+
+    ///
+    /// Assigns the given object of the type \c path_service to this one by
+    /// copying.
+    ///
+    /// \param a a \c path_service from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    path_service& operator=(const path_service& a) = delete;
+
+    ///
+    /// Assigns the given object of the type \c path_service to this one by
+    /// moving.
+    ///
+    /// \param a a \c path_service from which this one is assigned.
+    ///
+    /// \return A reference to \c *this.
+    ///
+    path_service& operator=(path_service&& a) = delete;
+
+    ///
+    /// Requests a path between the given tiles. The request is submitted on
+    /// the next update.
+    ///
+    /// \param start the tile from which the path starts.
+    /// \param goal the tile at which the path ends.
+    ///
+    /// \return The ID of the request.
+    ///
+    std::uint64_t request(const tile_point& start, const tile_point& goal);
+
+    ///
+    /// Sets whether or not the given tile is solid. The change is applied to
+    /// the requests submitted after it.
+    ///
+    /// \param x the column of the tile.
+    /// \param y the row of the tile.
+    /// \param solid whether or not the tile is solid.
+    ///
+    void set_solid(const int x, const int y, const bool solid);
+
+    ///
+    /// Rebuilds the changed parts of the path graph and submits the
+    /// requests to the job system.
+    ///
+    void update();
+
+    ///
+    /// Submits the requests and blocks until all of the jobs of the job
+    /// system are finished.
+    ///
+    void finish();
+
+    ///
+    /// Gives the next path that was found.
+    ///
+    /// \return The path or \c std::nullopt if no path is ready.
+    ///
+    std::optional<path_result> poll();
+
+    ///
+    /// Gives the number of the requests whose results haven't been polled.
+    ///
+    /// \return The number of the requests.
+    ///
+    std::size_t get_pending_count() const noexcept;
+
+    ///
+    /// Gives the current path graph.
+    ///
+    /// \return A reference to the path graph.
+    ///
+    const path_graph& get_graph() const noexcept;
+
+  private:
+    ///
+    /// The type of the path requests.
+    ///
+    struct path_request final
+    {
+      ///
+      /// The ID of the request.
+      ///
+      std::uint64_t id;
+
+      ///
+      /// The tile from which the path starts.
+      ///
+      tile_point start;
+
+      ///
+      /// The tile at which the path ends.
+      ///
+      tile_point goal;
+    };
+
+    ///
+    /// The job system on which the paths are found.
+    ///
+    ode::job_system& jobs;
+
+    ///
+    /// The number of the requests handled by a single job.
+    ///
+    std::size_t batch_size;
+
+    ///
+    /// The current path graph.
+    ///
+    std::shared_ptr<path_graph> graph;
+
+    ///
+    /// The number of the jobs which still read the current path graph. The
+    /// counter is shared with the jobs, which decrement it once they no
+    /// longer read the graph, and the graph is only changed in place when no
+    /// job reads it.
+    ///
+    std::shared_ptr<std::atomic<std::size_t>> readers;
+
+    ///
+    /// The requests that haven't been submitted.
+    ///
+    std::vector<path_request> requests;
+
+    ///
+    /// The queue through which the jobs give the paths.
+    ///
+    std::shared_ptr<ode::message_queue<path_result>> results;
+
+    ///
+    /// The ID of the next request.
+    ///
+    std::uint64_t next_id;
+
+    ///
+    /// The number of the requests whose results haven't been polled.
+    ///
+    std::size_t pending;
+  };
+
+} // namespace anthem::world
+
+#endif // !ANTHEM_SYSTEMS_SCENES_WORLD_PATH_SERVICE_H
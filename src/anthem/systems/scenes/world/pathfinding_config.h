@@ -0,0 +1,51 @@
+/// The declarations and the definitions of the pathfinding constants.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#ifndef ANTHEM_SYSTEMS_SCENES_WORLD_PATHFINDING_CONFIG_H
+#define ANTHEM_SYSTEMS_SCENES_WORLD_PATHFINDING_CONFIG_H
+
+#include <cstddef>
+
+namespace anthem::world
+{
+  ///
+  /// The width and the height of the clusters of the path graphs in tiles.
+  ///
+#ifdef ANTHEM_PATH_CLUSTER_SIZE
+  constexpr int path_cluster_size = ANTHEM_PATH_CLUSTER_SIZE;
+#else
+  constexpr int path_cluster_size = 16;
+#endif // !defined(ANTHEM_PATH_CLUSTER_SIZE)
+
+  ///
+  /// The length of the entrances between the clusters from which on an
+  /// entrance gets a node at both of its ends instead of one in the middle.
+  ///
+  constexpr int path_entrance_split = 6;
+
+  ///
+  /// The cost of a straight step between two tiles.
+  ///
+  constexpr int path_straight_cost = 10;
+
+  ///
+  /// The cost of a diagonal step between two tiles.
+  ///
+  constexpr int path_diagonal_cost = 14;
+
+  ///
+  /// The number of the path requests that are handled by a single job.
+  ///
+#ifdef ANTHEM_PATH_BATCH_SIZE
+  constexpr std::size_t path_batch_size = ANTHEM_PATH_BATCH_SIZE;
+#else
+  constexpr std::size_t path_batch_size = 32;
+#endif // !defined(ANTHEM_PATH_BATCH_SIZE)
+
+} // namespace anthem::world
+
+#endif // !ANTHEM_SYSTEMS_SCENES_WORLD_PATHFINDING_CONFIG_H
@@ -12,19 +12,110 @@
 #include "ode/lua/script.h"
 
 #include "anthem/config.h"
-#include "anthem/systems/scenes/world/map_loading.h"
+#include "anthem/logger.h"
 
 namespace anthem
 {
   world_configuration::world_configuration(const std::string& n)
-      : state{ode::lua::make_state()}, name{n}
+      : state{ode::lua::make_state()}, name{n}, width{0}, height{0}
   {
-    std::string s = std::string{script_root} +
+    filename = std::string{script_root} +
         ode::filesystem::path::preferred_separator + "world" +
         ode::filesystem::path::preferred_separator + name +
         ode::filesystem::path::preferred_separator + "map.lua";
-    ode::lua::load_script_file(state.get(), s);
-    width = world::load_map_width(state.get(), name);
-    height = world::load_map_height(state.get(), name);
+  }
+
+  bool world_configuration::load(
+      ode::asset_manager& assets, ode::texture_cache& textures)
+  {
+    if (loading_stage::idle == stage)
+    {
+      script = ode::request_script(assets, filename);
+      map = world::request_map(assets, name);
+      stage = loading_stage::script;
+    }
+
+    if (loading_stage::script == stage)
+    {
+      if (ode::asset_state::pending == assets.get_state(script))
+      {
+        return false;
+      }
+
+      // The tilesets are described by the map script, so they can only be
+      // requested after the script has run in the state of the scene.
+      if (const auto* compiled = assets.get(script))
+      {
+        const auto loaded = ode::lua::try_load_bytecode(
+            state.get(), compiled->bytecode, "@" + filename);
+
+        if (loaded)
+        {
+          width = world::load_map_width(state.get(), name);
+          height = world::load_map_height(state.get(), name);
+          tilesets =
+              world::request_tilesets(assets, textures, state.get(), name);
+          tilesets_requested = true;
+        }
+        else
+        {
+          ANTHEM_ERROR(
+              "The map script '{}' can't be run: {}",
+              filename,
+              loaded.get_error().message);
+        }
+      }
+
+      stage = loading_stage::assets;
+    }
+
+    if (loading_stage::assets == stage)
+    {
+      if (ode::asset_state::pending == assets.get_state(map) ||
+          (tilesets_requested &&
+           ode::asset_state::pending == assets.get_state(tilesets)))
+      {
+        return false;
+      }
+
+      stage = loading_stage::loaded;
+    }
+
+    return true;
+  }
+
+  void world_configuration::unload(
+      ode::asset_manager& assets, ode::texture_cache&)
+  {
+    if (loading_stage::idle == stage)
+    {
+      return;
+    }
+
+    assets.release(script);
+    assets.release(map);
+
+    if (tilesets_requested)
+    {
+      assets.release(tilesets);
+    }
+
+    stage = loading_stage::idle;
+    tilesets_requested = false;
+  }
+
+  lua_State* world_configuration::get_lua_state() const noexcept
+  {
+    return state.get();
+  }
+
+  std::string world_configuration::get_script_file() const
+  {
+    return filename;
+  }
+
+  std::string world_configuration::get_script_root() const
+  {
+    return script_root;
   }
 } // namespace anthem
@@ -11,16 +11,23 @@
 
 #include <string>
 
+#include "ode/assets/asset_loaders.h"
+#include "ode/assets/asset_manager.h"
+#include "ode/lua/scripted_scene.h"
 #include "ode/lua/state.h"
+#include "ode/systems/graphics/texture_cache.h"
 #include "ode/systems/scene_configuration.h"
 
+#include "anthem/systems/scenes/world/map_loading.h"
+
 namespace anthem
 {
   ///
   /// The type of the objects which hold the configurations of the basic
   /// gameplay scenes.
   ///
-  class world_configuration : public ode::scene_configuration
+  class world_configuration : public ode::scene_configuration,
+                              public ode::lua::scripted_scene
   {
   public:
     ///
@@ -78,7 +85,78 @@ namespace anthem
     ///
     world_configuration& operator=(world_configuration&& a) = default;
 
+    ///
+    /// Continues to load the map. The map script is compiled and the map
+    /// data is decoded on the workers of the asset manager, and when the
+    /// script is ready, it's run in the Lua state of the scene and the
+    /// tilesets it describes are requested.
+    ///
+    /// \param assets the asset manager of the engine.
+    /// \param textures the texture cache of the engine.
+    ///
+    /// \return \c true if the map is loaded, otherwise \c false.
+    ///
+    bool load(ode::asset_manager& assets, ode::texture_cache& textures)
+        override;
+
+    ///
+    /// Releases the assets of the map.
+    ///
+    /// \param assets the asset manager of the engine.
+    /// \param textures the texture cache of the engine.
+    ///
+    void unload(ode::asset_manager& assets, ode::texture_cache& textures)
+        override;
+
+    ///
+    /// Gives the Lua state into which the map script is loaded.
+    ///
+    /// \return A pointer to the Lua state.
+    ///
+    lua_State* get_lua_state() const noexcept override;
+
+    ///
+    /// Gives the name of the map script file.
+    ///
+    /// \return The name of the script file.
+    ///
+    std::string get_script_file() const override;
+
+    ///
+    /// Gives the name of the directory from which the scene loads the
+    /// modules required by its script.
+    ///
+    /// \return The name of the script directory.
+    ///
+    std::string get_script_root() const override;
+
   private:
+    ///
+    /// The stages of loading the map.
+    ///
+    enum class loading_stage
+    {
+      ///
+      /// Nothing is requested.
+      ///
+      idle,
+
+      ///
+      /// The map script is being compiled.
+      ///
+      script,
+
+      ///
+      /// The map data and the tilesets are being loaded.
+      ///
+      assets,
+
+      ///
+      /// The map is loaded.
+      ///
+      loaded
+    };
+
     ///
     /// The Lua state this configuration uses to load its data.
     ///
@@ -89,6 +167,11 @@ namespace anthem
     ///
     const std::string name;
 
+    ///
+    /// The name of the map script file.
+    ///
+    std::string filename;
+
     ///
     /// The width of the map in tiles.
     ///
@@ -98,6 +181,31 @@ namespace anthem
     /// The height of the map in tiles.
     ///
     int height;
+
+    ///
+    /// The stage of loading the map.
+    ///
+    loading_stage stage = loading_stage::idle;
+
+    ///
+    /// The handle of the compiled map script.
+    ///
+    ode::asset_handle<ode::script_asset> script;
+
+    ///
+    /// The handle of the decoded map data.
+    ///
+    ode::asset_handle<world::map_data> map;
+
+    ///
+    /// The handle of the tilesets of the map.
+    ///
+    ode::asset_handle<world::map_tilesets> tilesets;
+
+    ///
+    /// Whether or not the tilesets are requested.
+    ///
+    bool tilesets_requested = false;
   };
 
 } // namespace anthem
@@ -0,0 +1,97 @@
+/// The definitions of the functions which request the common assets from an
+/// asset manager.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/assets/asset_loaders.h"
+
+#include <cstddef>
+#include <utility>
+
+#include "ode/logger.h"
+#include "ode/lua/script.h"
+
+namespace ode
+{
+  asset_handle<texture_asset> request_texture(
+      asset_manager& assets,
+      texture_cache& cache,
+      const std::string& filename,
+      const std::optional<std::uint32_t> colour_key)
+  {
+    auto key = "texture:" + filename;
+
+    if (colour_key)
+    {
+      key += "#" + std::to_string(*colour_key);
+    }
+
+    const auto decode = [filename, colour_key]() {
+      std::optional<texture_asset> asset{};
+
+      if (auto img = load_image(filename))
+      {
+        if (colour_key)
+        {
+          apply_colour_key(*img, *colour_key);
+        }
+
+        asset.emplace();
+        asset->width = img->width;
+        asset->height = img->height;
+        asset->pixels = std::move(*img);
+      }
+
+      return asset;
+    };
+
+    const auto upload = [&cache, key](texture_asset& asset) {
+      const auto size = asset.pixels.pixels.size();
+
+      asset.texture = cache.acquire(key, [&asset] {
+        return std::optional<image>{std::move(asset.pixels)};
+      });
+
+      // The pixels are no longer needed after they are on the GPU.
+      asset.pixels = image{};
+
+      return size;
+    };
+
+    const auto unload = [&cache, key](texture_asset&) { cache.release(key); };
+
+    return assets.request<texture_asset>(key, decode, upload, unload);
+  }
+
+  asset_handle<script_asset> request_script(
+      asset_manager& assets, const std::string& filename)
+  {
+    const auto decode = [filename]() {
+      std::optional<script_asset> asset{};
+      auto bytecode = lua::compile_script_file(filename);
+
+      if (bytecode)
+      {
+        asset = script_asset{filename, bytecode.get_value()};
+      }
+      else
+      {
+        ODE_ERROR(
+            "The script '{}' can't be compiled: {}",
+            filename,
+            bytecode.get_error().message);
+      }
+
+      return asset;
+    };
+
+    return assets.request<script_asset>(
+        "script:" + filename, decode, [](script_asset&) -> std::size_t {
+          return 0;
+        });
+  }
+
+} // namespace ode
@@ -0,0 +1,229 @@
+/// The definition of the asset manager which decodes the assets on worker
+/// threads and uploads them on the main thread.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/assets/asset_manager.h"
+
+#include <exception>
+#include <limits>
+
+#include "gsl/assert"
+
+#include "ode/logger.h"
+
+namespace ode
+{
+  asset_manager::asset_manager(
+      job_system& jobs, const std::size_t upload_budget)
+      : jobs{jobs},
+        upload_budget{upload_budget},
+        entries{},
+        free_ids{},
+        ids{},
+        decoded{std::make_shared<message_queue<decoded_asset>>()},
+        uploads{},
+        pending{0}
+  {
+  }
+
+  asset_manager::~asset_manager()
+  {
+    decoded->close();
+
+    for (auto& e : entries)
+    {
+      if (e.references > 0 && asset_state::ready == e.state)
+      {
+        e.unload(e.value.get());
+      }
+    }
+  }
+
+  std::size_t asset_manager::update()
+  {
+    return process(upload_budget);
+  }
+
+  void asset_manager::finish()
+  {
+    while (pending > 0)
+    {
+      jobs.wait();
+      process(std::numeric_limits<std::size_t>::max());
+    }
+  }
+
+  std::size_t asset_manager::get_pending_count() const noexcept
+  {
+    return pending;
+  }
+
+  std::size_t asset_manager::add_entry(
+      const std::string& key,
+      const void* type,
+      std::function<std::size_t(void*)> upload,
+      std::function<void(void*)> unload)
+  {
+    std::size_t id = entries.size();
+
+    if (free_ids.empty())
+    {
+      entries.push_back(
+          {key, type, asset_state::pending, 0, 0, nullptr, {}, {}});
+    }
+    else
+    {
+      id = free_ids.back();
+      free_ids.pop_back();
+    }
+
+    auto& e = entries[id];
+    e.key = key;
+    e.type = type;
+    e.state = asset_state::pending;
+    e.references = 1;
+    e.upload = std::move(upload);
+    e.unload = std::move(unload);
+
+    ids.emplace(key, id);
+    ++pending;
+
+    return id;
+  }
+
+  void asset_manager::submit(
+      const std::size_t id, std::function<std::shared_ptr<void>()> decode)
+  {
+    const auto generation = entries[id].generation;
+    const auto key = entries[id].key;
+
+    jobs.submit([queue = decoded, id, generation, key, decode] {
+      std::shared_ptr<void> value{};
+
+      try
+      {
+        value = decode();
+      }
+      catch (const std::exception& e)
+      {
+        ODE_ERROR("The asset '{}' can't be decoded: {}", key, e.what());
+      }
+      catch (...)
+      {
+        ODE_ERROR("The asset '{}' can't be decoded", key);
+      }
+
+      queue->push({id, generation, std::move(value)});
+    });
+
+    ODE_TRACE("Requested the asset '{}'", key);
+  }
+
+  void asset_manager::release(
+      const std::size_t id, const std::uint32_t generation)
+  {
+    Expects(id < entries.size());
+
+    auto& e = entries[id];
+
+    if (generation != e.generation || 0 == e.references ||
+        0 != --e.references)
+    {
+      return;
+    }
+
+    if (asset_state::ready == e.state)
+    {
+      e.unload(e.value.get());
+    }
+    else if (asset_state::pending == e.state)
+    {
+      --pending;
+    }
+
+    ODE_TRACE("Released the asset '{}'", e.key);
+
+    // The results of the jobs which are still running are dropped because
+    // the generation changes. A failed asset is already removed from the
+    // keys, and the key may refer to a newer request.
+    if (const auto it = ids.find(e.key); ids.end() != it && id == it->second)
+    {
+      ids.erase(it);
+    }
+
+    e.value.reset();
+    e.upload = nullptr;
+    e.unload = nullptr;
+    ++e.generation;
+
+    free_ids.push_back(id);
+  }
+
+  const asset_manager::entry& asset_manager::get_entry(
+      const std::size_t id,
+      const std::uint32_t generation) const ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(id < entries.size());
+    Expects(generation == entries[id].generation);
+    Expects(entries[id].references > 0);
+
+    return entries[id];
+  }
+
+  std::size_t asset_manager::process(const std::size_t budget)
+  {
+    std::size_t finished = 0;
+
+    while (auto d = decoded->try_pop())
+    {
+      auto& e = entries[d->id];
+
+      if (d->generation != e.generation)
+      {
+        continue;
+      }
+
+      if (!d->value)
+      {
+        ODE_ERROR("The asset '{}' failed to load", e.key);
+        e.state = asset_state::failed;
+        ids.erase(e.key);
+        --pending;
+        ++finished;
+        continue;
+      }
+
+      e.value = std::move(d->value);
+      uploads.emplace_back(d->id, d->generation);
+    }
+
+    std::size_t spent = 0;
+
+    while (!uploads.empty() && spent < budget)
+    {
+      const auto [id, generation] = uploads.front();
+      uploads.pop_front();
+
+      auto& e = entries[id];
+
+      if (generation != e.generation)
+      {
+        continue;
+      }
+
+      spent += e.upload(e.value.get());
+      e.state = asset_state::ready;
+      --pending;
+      ++finished;
+
+      ODE_TRACE("The asset '{}' is ready", e.key);
+    }
+
+    return finished;
+  }
+
+} // namespace ode
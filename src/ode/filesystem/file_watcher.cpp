@@ -0,0 +1,368 @@
+/// The definition of the watcher which detects changes in files.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/filesystem/file_watcher.h"
+
+#if __linux__
+#  include <poll.h>
+#  include <sys/inotify.h>
+#  include <unistd.h>
+#endif // __linux__
+
+#include <algorithm>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "ode/logger.h"
+
+namespace ode::filesystem
+{
+  namespace detail
+  {
+    static std::string normalize(const std::filesystem::path& p)
+    {
+      std::error_code ec{};
+      const auto absolute = std::filesystem::absolute(p, ec);
+      return (ec ? p : absolute).lexically_normal().string();
+    }
+
+    static void add_unique(
+        std::vector<std::string>& changed, const std::string& filename)
+    {
+      if (std::find(changed.begin(), changed.end(), filename) ==
+          changed.end())
+      {
+        changed.push_back(filename);
+      }
+    }
+  } // namespace detail
+
+  file_watcher::file_watcher()
+      : notify_fd{-1}, directories{}, roots{}, files{}, times{}
+  {
+#if __linux__
+
+    notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (notify_fd < 0)
+    {
+      ODE_WARN(
+          "The file notifications couldn't be initialized, falling back to "
+          "polling the modification times");
+    }
+
+#endif // __linux__
+  }
+
+  file_watcher::~file_watcher()
+  {
+#if __linux__
+
+    if (notify_fd >= 0)
+    {
+      ::close(notify_fd);
+    }
+
+#endif // __linux__
+  }
+
+  bool file_watcher::add(std::string_view filename)
+  {
+    const std::filesystem::path p{filename};
+    const auto normalized = detail::normalize(p);
+
+    if (files.count(normalized) > 0)
+    {
+      return true;
+    }
+
+    std::error_code ec{};
+    const auto time = std::filesystem::last_write_time(p, ec);
+
+    if (ec)
+    {
+      ODE_ERROR("The file '{}' can't be watched: {}", filename, ec.message());
+      return false;
+    }
+
+    if (is_notified() &&
+        !watch(std::filesystem::path{normalized}.parent_path()))
+    {
+      return false;
+    }
+
+    files.emplace(normalized, std::string{filename});
+    times.emplace(normalized, time);
+
+    ODE_TRACE("Watching the file '{}'", normalized);
+
+    return true;
+  }
+
+  bool file_watcher::add_directory(std::string_view directory)
+  {
+    std::filesystem::path root{detail::normalize(directory)};
+
+    if (root.filename().empty())
+    {
+      root = root.parent_path();
+    }
+
+    if (std::find(roots.begin(), roots.end(), root) != roots.end())
+    {
+      return true;
+    }
+
+    std::error_code ec{};
+
+    if (!std::filesystem::is_directory(root, ec))
+    {
+      ODE_ERROR("The directory '{}' can't be watched", directory);
+      return false;
+    }
+
+    if (is_notified() && !watch(root))
+    {
+      return false;
+    }
+
+    // The existing subdirectories are watched and, when the modification
+    // times are polled, the existing files are recorded so that only the
+    // changes made after this call are reported.
+    for (std::filesystem::recursive_directory_iterator it{root, ec}, end{};
+         !ec && it != end;
+         it.increment(ec))
+    {
+      std::error_code entry_ec{};
+
+      if (it->is_directory(entry_ec))
+      {
+        if (is_notified() && !watch(detail::normalize(it->path())))
+        {
+          return false;
+        }
+      }
+      else if (!is_notified() && it->is_regular_file(entry_ec))
+      {
+        const auto time = it->last_write_time(entry_ec);
+
+        if (!entry_ec)
+        {
+          record(detail::normalize(it->path()), time);
+        }
+      }
+    }
+
+    roots.push_back(std::move(root));
+
+    ODE_TRACE("Watching the directory '{}'", roots.back().string());
+
+    return true;
+  }
+
+  std::vector<std::string> file_watcher::poll(
+      const std::chrono::milliseconds timeout)
+  {
+    if (is_notified())
+    {
+      return read_notifications(timeout);
+    }
+
+    return read_modification_times(timeout);
+  }
+
+  bool file_watcher::watch(const std::filesystem::path& directory)
+  {
+#if __linux__
+
+    const auto it = std::find_if(
+        directories.begin(), directories.end(), [&directory](const auto& d) {
+          return d.second == directory;
+        });
+
+    if (directories.end() != it)
+    {
+      return true;
+    }
+
+    const int wd = inotify_add_watch(
+        notify_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+
+    if (wd < 0)
+    {
+      ODE_ERROR("The directory '{}' can't be watched", directory.string());
+      return false;
+    }
+
+    directories.emplace(wd, directory);
+
+    return true;
+
+#else
+
+    return false;
+
+#endif // __linux__
+  }
+
+  bool file_watcher::is_in_roots(const std::filesystem::path& directory) const
+  {
+    return std::any_of(
+        roots.begin(), roots.end(), [&directory](const auto& root) {
+          return std::mismatch(
+                     root.begin(),
+                     root.end(),
+                     directory.begin(),
+                     directory.end())
+                     .first == root.end();
+        });
+  }
+
+  bool file_watcher::record(
+      const std::string& normalized,
+      const std::filesystem::file_time_type time)
+  {
+    const auto [it, inserted] = times.try_emplace(normalized, time);
+
+    if (inserted)
+    {
+      return true;
+    }
+
+    if (it->second == time)
+    {
+      return false;
+    }
+
+    it->second = time;
+
+    return true;
+  }
+
+  std::string file_watcher::name_of(const std::string& normalized) const
+  {
+    const auto it = files.find(normalized);
+    return files.end() == it ? normalized : it->second;
+  }
+
+  std::vector<std::string> file_watcher::read_notifications(
+      const std::chrono::milliseconds timeout)
+  {
+    std::vector<std::string> changed{};
+
+#if __linux__
+
+    pollfd pfd{notify_fd, POLLIN, 0};
+
+    if (::poll(&pfd, 1, static_cast<int>(timeout.count())) <= 0)
+    {
+      return changed;
+    }
+
+    alignas(inotify_event) char buffer[4096];
+
+    while (true)
+    {
+      const auto length = ::read(notify_fd, buffer, sizeof(buffer));
+
+      if (length <= 0)
+      {
+        break;
+      }
+
+      for (const char* ptr = buffer; ptr < buffer + length;)
+      {
+        const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+        ptr += sizeof(inotify_event) + event->len;
+
+        const auto directory = directories.find(event->wd);
+
+        if (0 == event->len || directories.end() == directory)
+        {
+          continue;
+        }
+
+        const auto normalized =
+            detail::normalize(directory->second / event->name);
+
+        if (event->mask & IN_ISDIR)
+        {
+          // A subdirectory created in a watched directory is watched too, but
+          // the files written into it before that aren't reported.
+          if (is_in_roots(directory->second))
+          {
+            watch(normalized);
+          }
+
+          continue;
+        }
+
+        if (event->mask & IN_CREATE)
+        {
+          continue;
+        }
+
+        if (files.count(normalized) > 0 || is_in_roots(directory->second))
+        {
+          detail::add_unique(changed, name_of(normalized));
+        }
+      }
+    }
+
+#endif // __linux__
+
+    return changed;
+  }
+
+  std::vector<std::string> file_watcher::read_modification_times(
+      const std::chrono::milliseconds timeout)
+  {
+    std::this_thread::sleep_for(timeout);
+
+    std::vector<std::string> changed{};
+
+    for (const auto& [normalized, filename] : files)
+    {
+      std::error_code ec{};
+      const auto current = std::filesystem::last_write_time(normalized, ec);
+
+      if (!ec && record(normalized, current))
+      {
+        detail::add_unique(changed, filename);
+      }
+    }
+
+    for (const auto& root : roots)
+    {
+      std::error_code ec{};
+
+      for (std::filesystem::recursive_directory_iterator it{root, ec}, end{};
+           !ec && it != end;
+           it.increment(ec))
+      {
+        std::error_code entry_ec{};
+
+        if (!it->is_regular_file(entry_ec))
+        {
+          continue;
+        }
+
+        const auto normalized = detail::normalize(it->path());
+        const auto current = it->last_write_time(entry_ec);
+
+        if (!entry_ec && record(normalized, current))
+        {
+          detail::add_unique(changed, name_of(normalized));
+        }
+      }
+    }
+
+    return changed;
+  }
+
+} // namespace ode::filesystem
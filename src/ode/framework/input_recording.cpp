@@ -0,0 +1,535 @@
+/// The definitions of the types of the objects which record the input events
+/// into a file and play them back.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/input_recording.h"
+
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+#include "ode/logger.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The bytes at the start of the files of the recorded sessions.
+    ///
+    constexpr char input_magic[] = {'O', 'D', 'E', 'I', 'N', 'P', 'U', 'T'};
+
+    ///
+    /// The version of the format of the recorded sessions.
+    ///
+    constexpr std::uint8_t input_format_version = 1;
+
+    ///
+    /// The size of the header of the recorded sessions in bytes.
+    ///
+    constexpr std::size_t input_header_size = sizeof(input_magic) + 1;
+
+    ///
+    /// The size of the footer, which holds the number of the ticks and the
+    /// checksum, in bytes.
+    ///
+    constexpr std::size_t input_footer_size = 16;
+
+    ///
+    /// The prime of the 64-bit FNV-1a hash.
+    ///
+    constexpr std::uint64_t input_fnv_prime = 1099511628211ull;
+
+    ///
+    /// The kinds of the encoded events.
+    ///
+    enum class input_event_kind : std::uint8_t
+    {
+      key = 1,
+      mouse_motion,
+      mouse_button,
+      mouse_wheel,
+      controller_button,
+      controller_axis
+    };
+
+    ///
+    /// Appends an unsigned integer as a variable-length integer.
+    ///
+    /// \param out the buffer.
+    /// \param v the integer.
+    ///
+    static void write_varint(std::vector<std::uint8_t>& out, std::uint64_t v)
+    {
+      while (0x80 <= v)
+      {
+        out.push_back(static_cast<std::uint8_t>(v | 0x80));
+        v >>= 7;
+      }
+
+      out.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    ///
+    /// Reads a variable-length unsigned integer.
+    ///
+    /// \param data a reference to the pointer to the data, which is moved past
+    /// the integer.
+    /// \param end a pointer past the end of the data.
+    /// \param v the integer that is read.
+    ///
+    /// \return Whether or not the integer was read.
+    ///
+    static bool read_varint(
+        const std::uint8_t*& data, const std::uint8_t* end, std::uint64_t& v)
+    {
+      v = 0;
+
+      for (int shift = 0; shift < 64; shift += 7)
+      {
+        if (end == data)
+        {
+          return false;
+        }
+
+        const std::uint8_t byte = *data++;
+
+        v |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+
+        if (0 == (byte & 0x80))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    ///
+    /// Appends a signed integer as a variable-length integer.
+    ///
+    /// \param out the buffer.
+    /// \param v the integer.
+    ///
+    static void write_signed(std::vector<std::uint8_t>& out, const int v)
+    {
+      // Zigzag encoding keeps the small negative values small.
+      const auto u = static_cast<std::uint32_t>(v);
+      write_varint(out, (u << 1) ^ static_cast<std::uint32_t>(v >> 31));
+    }
+
+    ///
+    /// Reads a variable-length signed integer.
+    ///
+    /// \param data a reference to the pointer to the data, which is moved past
+    /// the integer.
+    /// \param end a pointer past the end of the data.
+    /// \param v the integer that is read.
+    ///
+    /// \return Whether or not the integer was read.
+    ///
+    static bool read_signed(
+        const std::uint8_t*& data, const std::uint8_t* end, int& v)
+    {
+      std::uint64_t u = 0;
+
+      if (!read_varint(data, end, u))
+      {
+        return false;
+      }
+
+      const auto z = static_cast<std::uint32_t>(u);
+      v = static_cast<int>((z >> 1) ^ (~(z & 1) + 1));
+      return true;
+    }
+
+    ///
+    /// Writes a 64-bit integer in little-endian order.
+    ///
+    /// \param out a pointer to the eight bytes to write.
+    /// \param v the integer.
+    ///
+    static void write_u64(std::uint8_t* out, const std::uint64_t v) noexcept
+    {
+      for (int i = 0; i < 8; ++i)
+      {
+        out[i] = static_cast<std::uint8_t>(v >> (8 * i));
+      }
+    }
+
+    ///
+    /// Reads a 64-bit integer in little-endian order.
+    ///
+    /// \param data a pointer to the eight bytes to read.
+    ///
+    /// \return The integer.
+    ///
+    static std::uint64_t read_u64(const std::uint8_t* data) noexcept
+    {
+      std::uint64_t v = 0;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        v |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+      }
+
+      return v;
+    }
+
+    ///
+    /// Folds a 64-bit integer into a checksum.
+    ///
+    /// \param checksum the current checksum.
+    /// \param v the integer.
+    ///
+    /// \return The new checksum.
+    ///
+    static std::uint64_t fold_u64(
+        const std::uint64_t checksum, const std::uint64_t v) noexcept
+    {
+      std::uint8_t bytes[8];
+      write_u64(bytes, v);
+      return fold_checksum(checksum, bytes, sizeof(bytes));
+    }
+  } // namespace detail
+
+  std::uint64_t fold_checksum(
+      std::uint64_t checksum,
+      const std::uint8_t* data,
+      const std::size_t size) noexcept
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      checksum ^= data[i];
+      checksum *= detail::input_fnv_prime;
+    }
+
+    return checksum;
+  }
+
+  bool encode_input_event(
+      const SDL_Event& event, std::vector<std::uint8_t>& out)
+  {
+    using detail::input_event_kind;
+
+    if (SDL_KEYDOWN == event.type || SDL_KEYUP == event.type)
+    {
+      const auto scancode =
+          static_cast<std::uint16_t>(event.key.keysym.scancode);
+
+      out.push_back(static_cast<std::uint8_t>(input_event_kind::key));
+      out.push_back(static_cast<std::uint8_t>(scancode));
+      out.push_back(static_cast<std::uint8_t>(scancode >> 8));
+      out.push_back(static_cast<std::uint8_t>(
+          (SDL_KEYDOWN == event.type ? 1 : 0) | (event.key.repeat ? 2 : 0)));
+    }
+    else if (SDL_MOUSEMOTION == event.type)
+    {
+      out.push_back(static_cast<std::uint8_t>(input_event_kind::mouse_motion));
+      detail::write_signed(out, event.motion.x);
+      detail::write_signed(out, event.motion.y);
+      detail::write_signed(out, event.motion.xrel);
+      detail::write_signed(out, event.motion.yrel);
+    }
+    else if (
+        SDL_MOUSEBUTTONDOWN == event.type || SDL_MOUSEBUTTONUP == event.type)
+    {
+      out.push_back(static_cast<std::uint8_t>(input_event_kind::mouse_button));
+      out.push_back(event.button.button);
+      out.push_back(SDL_MOUSEBUTTONDOWN == event.type ? 1 : 0);
+    }
+    else if (SDL_MOUSEWHEEL == event.type)
+    {
+      out.push_back(static_cast<std::uint8_t>(input_event_kind::mouse_wheel));
+      detail::write_signed(out, event.wheel.x);
+      detail::write_signed(out, event.wheel.y);
+    }
+    else if (
+        SDL_CONTROLLERBUTTONDOWN == event.type ||
+        SDL_CONTROLLERBUTTONUP == event.type)
+    {
+      out.push_back(
+          static_cast<std::uint8_t>(input_event_kind::controller_button));
+      out.push_back(event.cbutton.button);
+      out.push_back(SDL_CONTROLLERBUTTONDOWN == event.type ? 1 : 0);
+    }
+    else if (SDL_CONTROLLERAXISMOTION == event.type)
+    {
+      out.push_back(
+          static_cast<std::uint8_t>(input_event_kind::controller_axis));
+      out.push_back(event.caxis.axis);
+      detail::write_signed(out, event.caxis.value);
+    }
+    else
+    {
+      return false;
+    }
+
+    return true;
+  }
+
+  std::optional<SDL_Event> decode_input_event(
+      const std::uint8_t*& data, const std::uint8_t* end)
+  {
+    using detail::input_event_kind;
+
+    if (end == data)
+    {
+      return std::nullopt;
+    }
+
+    const auto kind = static_cast<input_event_kind>(*data++);
+
+    SDL_Event event{};
+
+    if (input_event_kind::key == kind)
+    {
+      if (3 > end - data)
+      {
+        return std::nullopt;
+      }
+
+      const bool down = 0 != (data[2] & 1);
+
+      event.type = down ? SDL_KEYDOWN : SDL_KEYUP;
+      event.key.state = down ? SDL_PRESSED : SDL_RELEASED;
+      event.key.repeat = 0 != (data[2] & 2) ? 1 : 0;
+      event.key.keysym.scancode =
+          static_cast<SDL_Scancode>(data[0] | data[1] << 8);
+      data += 3;
+    }
+    else if (input_event_kind::mouse_motion == kind)
+    {
+      event.type = SDL_MOUSEMOTION;
+
+      if (!detail::read_signed(data, end, event.motion.x) ||
+          !detail::read_signed(data, end, event.motion.y) ||
+          !detail::read_signed(data, end, event.motion.xrel) ||
+          !detail::read_signed(data, end, event.motion.yrel))
+      {
+        return std::nullopt;
+      }
+    }
+    else if (
+        input_event_kind::mouse_button == kind ||
+        input_event_kind::controller_button == kind)
+    {
+      if (2 > end - data)
+      {
+        return std::nullopt;
+      }
+
+      const bool down = 0 != data[1];
+
+      if (input_event_kind::mouse_button == kind)
+      {
+        event.type = down ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+        event.button.button = data[0];
+        event.button.state = down ? SDL_PRESSED : SDL_RELEASED;
+      }
+      else
+      {
+        event.type = down ? SDL_CONTROLLERBUTTONDOWN : SDL_CONTROLLERBUTTONUP;
+        event.cbutton.button = data[0];
+        event.cbutton.state = down ? SDL_PRESSED : SDL_RELEASED;
+      }
+
+      data += 2;
+    }
+    else if (input_event_kind::mouse_wheel == kind)
+    {
+      event.type = SDL_MOUSEWHEEL;
+
+      if (!detail::read_signed(data, end, event.wheel.x) ||
+          !detail::read_signed(data, end, event.wheel.y))
+      {
+        return std::nullopt;
+      }
+    }
+    else if (input_event_kind::controller_axis == kind)
+    {
+      int value = 0;
+
+      if (end == data)
+      {
+        return std::nullopt;
+      }
+
+      event.type = SDL_CONTROLLERAXISMOTION;
+      event.caxis.axis = *data++;
+
+      if (!detail::read_signed(data, end, value))
+      {
+        return std::nullopt;
+      }
+
+      event.caxis.value = static_cast<Sint16>(value);
+    }
+    else
+    {
+      return std::nullopt;
+    }
+
+    return event;
+  }
+
+  input_recorder::input_recorder(const std::string& filename)
+      : file{filename, std::ios::binary | std::ios::trunc},
+        buffer{},
+        previous_tick{0},
+        checksum{input_checksum_seed},
+        events{0}
+  {
+    if (!file)
+    {
+      ODE_ERROR("The input recording '{}' can't be opened", filename);
+      throw std::runtime_error{"The input recording can't be opened"};
+    }
+
+    file.write(detail::input_magic, sizeof(detail::input_magic));
+    file.put(static_cast<char>(detail::input_format_version));
+
+    ODE_INFO("Recording the input to '{}'", filename);
+  }
+
+  void input_recorder::record(const std::uint64_t tick, const SDL_Event& event)
+  {
+    buffer.clear();
+    detail::write_varint(buffer, tick - previous_tick);
+
+    if (!encode_input_event(event, buffer))
+    {
+      return;
+    }
+
+    previous_tick = tick;
+    checksum = fold_checksum(checksum, buffer.data(), buffer.size());
+    ++events;
+
+    file.write(
+        reinterpret_cast<const char*>(buffer.data()),
+        static_cast<std::streamsize>(buffer.size()));
+  }
+
+  std::uint64_t input_recorder::finish(
+      const std::uint64_t ticks, const std::uint64_t state_checksum)
+  {
+    const auto result = detail::fold_u64(checksum, state_checksum);
+
+    std::uint8_t footer[detail::input_footer_size];
+
+    detail::write_u64(footer, ticks);
+    detail::write_u64(footer + 8, result);
+
+    file.write(reinterpret_cast<const char*>(footer), sizeof(footer));
+    file.close();
+
+    ODE_INFO(
+        "Recorded {} input events in {} ticks with the checksum {:#018x}",
+        events,
+        ticks,
+        result);
+
+    return result;
+  }
+
+  input_player::input_player(const std::string& filename)
+      : data{},
+        offset{detail::input_header_size},
+        end{0},
+        next_tick{0},
+        ticks{0},
+        checksum{input_checksum_seed},
+        recorded_checksum{0}
+  {
+    std::ifstream file{filename, std::ios::binary};
+
+    if (!file)
+    {
+      ODE_ERROR("The input recording '{}' can't be opened", filename);
+      throw std::runtime_error{"The input recording can't be opened"};
+    }
+
+    data.assign(
+        std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+
+    if (detail::input_header_size + detail::input_footer_size > data.size() ||
+        0 != std::memcmp(
+                 data.data(),
+                 detail::input_magic,
+                 sizeof(detail::input_magic)) ||
+        detail::input_format_version != data[sizeof(detail::input_magic)])
+    {
+      ODE_ERROR("The file '{}' isn't an input recording", filename);
+      throw std::runtime_error{"The file isn't an input recording"};
+    }
+
+    end = data.size() - detail::input_footer_size;
+    ticks = detail::read_u64(data.data() + end);
+    recorded_checksum = detail::read_u64(data.data() + end + 8);
+
+    // The tick of the first record is read ahead.
+    const std::uint8_t* p = data.data() + offset;
+    std::uint64_t delta = 0;
+
+    if (offset < end && detail::read_varint(p, data.data() + end, delta))
+    {
+      next_tick = delta;
+    }
+
+    ODE_INFO("Replaying {} ticks of input from '{}'", ticks, filename);
+  }
+
+  std::optional<SDL_Event> input_player::next(const std::uint64_t tick)
+  {
+    if (offset >= end || next_tick != tick)
+    {
+      return std::nullopt;
+    }
+
+    const std::uint8_t* const record = data.data() + offset;
+    const std::uint8_t* const last = data.data() + end;
+    const std::uint8_t* p = record;
+    std::uint64_t delta = 0;
+
+    detail::read_varint(p, last, delta);
+
+    const auto event = decode_input_event(p, last);
+
+    if (!event)
+    {
+      ODE_ERROR("The input recording is corrupted at the offset {}", offset);
+      offset = end;
+      return std::nullopt;
+    }
+
+    checksum = fold_checksum(
+        checksum, record, static_cast<std::size_t>(p - record));
+    offset = static_cast<std::size_t>(p - data.data());
+
+    // The tick of the next record is read ahead so that the records of the
+    // later ticks aren't consumed.
+    if (offset < end)
+    {
+      const std::uint8_t* q = p;
+
+      if (detail::read_varint(q, last, delta))
+      {
+        next_tick += delta;
+      }
+    }
+
+    return event;
+  }
+
+  std::uint64_t input_player::finish(
+      const std::uint64_t state_checksum) const noexcept
+  {
+    return detail::fold_u64(checksum, state_checksum);
+  }
+
+} // namespace ode
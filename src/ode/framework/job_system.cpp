@@ -0,0 +1,259 @@
+/// The definition of the job system which runs work on a pool of worker
+/// threads.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/job_system.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <utility>
+
+#include "gsl/assert"
+
+#include "ode/logger.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The state of a batch which is shared by the threads running it.
+    ///
+    struct job_batch
+    {
+      ///
+      /// Constructs an object of the type \c job_batch.
+      ///
+      /// \param f the function which is run for each index.
+      /// \param count the number of the indices in the batch.
+      ///
+      job_batch(
+          const std::function<void(std::size_t)>& f, const std::size_t count)
+          : f{f}, count{count}
+      {
+      }
+
+      ///
+      /// The function which is run for each index.
+      ///
+      const std::function<void(std::size_t)>& f;
+
+      ///
+      /// The number of the indices in the batch.
+      ///
+      const std::size_t count;
+
+      ///
+      /// The next index which isn't yet taken by a thread.
+      ///
+      std::atomic<std::size_t> next{0};
+
+      ///
+      /// The mutex which guards the number of the finished indices and the
+      /// exception.
+      ///
+      std::mutex mutex{};
+
+      ///
+      /// The condition variable which signals that the batch is finished.
+      ///
+      std::condition_variable condition{};
+
+      ///
+      /// The number of the finished indices.
+      ///
+      std::size_t finished = 0;
+
+      ///
+      /// The first exception thrown by the function.
+      ///
+      std::exception_ptr error{};
+    };
+
+    ///
+    /// Takes the indices of the given batch and runs the function of the
+    /// batch for them until all of the indices are taken.
+    ///
+    /// \param batch the batch.
+    ///
+    static void run_batch_indices(job_batch& batch)
+    {
+      for (auto i = batch.next++; i < batch.count; i = batch.next++)
+      {
+        std::exception_ptr error{};
+
+        try
+        {
+          batch.f(i);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+
+        bool done = false;
+
+        {
+          std::lock_guard<std::mutex> lock{batch.mutex};
+
+          if (error && !batch.error)
+          {
+            batch.error = error;
+          }
+
+          done = batch.count == ++batch.finished;
+        }
+
+        if (done)
+        {
+          batch.condition.notify_all();
+        }
+      }
+    }
+  } // namespace detail
+
+  job_system::job_system(std::size_t thread_count)
+      : jobs{},
+        threads{},
+        pending_mutex{},
+        pending_condition{},
+        pending_jobs{0}
+  {
+    if (0 == thread_count)
+    {
+      const auto hardware = std::thread::hardware_concurrency();
+      thread_count = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    ODE_DEBUG("Creating a job system with {} threads", thread_count);
+
+    threads.reserve(thread_count);
+
+    for (std::size_t i = 0; i < thread_count; ++i)
+    {
+      threads.emplace_back(&job_system::run, this, i);
+    }
+  }
+
+  job_system::~job_system()
+  {
+    jobs.close();
+
+    for (auto& thread : threads)
+    {
+      if (thread.joinable())
+      {
+        thread.join();
+      }
+    }
+  }
+
+  void job_system::submit(job_t job)
+  {
+    Expects(job);
+
+    {
+      std::lock_guard<std::mutex> lock{pending_mutex};
+      ++pending_jobs;
+    }
+
+    if (!jobs.push(std::move(job)))
+    {
+      finish_job();
+    }
+  }
+
+  void job_system::wait()
+  {
+    std::unique_lock<std::mutex> lock{pending_mutex};
+    pending_condition.wait(lock, [this] { return 0 == pending_jobs; });
+  }
+
+  void job_system::run_batch(
+      const std::size_t count,
+      const std::function<void(std::size_t)>& f)
+  {
+    Expects(f);
+
+    if (0 == count)
+    {
+      return;
+    }
+
+    // The jobs of the batch may start after the batch is finished, so they
+    // share the ownership of its state. They only call the function for the
+    // indices that they take before the batch is finished.
+    auto batch = std::make_shared<detail::job_batch>(f, count);
+    const auto helpers = std::min(count - 1, threads.size());
+
+    for (std::size_t i = 0; i < helpers; ++i)
+    {
+      submit([batch] { detail::run_batch_indices(*batch); });
+    }
+
+    detail::run_batch_indices(*batch);
+
+    {
+      std::unique_lock<std::mutex> lock{batch->mutex};
+      batch->condition.wait(
+          lock, [&batch] { return batch->count == batch->finished; });
+    }
+
+    if (batch->error)
+    {
+      std::rethrow_exception(batch->error);
+    }
+  }
+
+  std::size_t job_system::get_thread_count() const noexcept
+  {
+    return threads.size();
+  }
+
+  void job_system::run(const std::size_t index)
+  {
+    ODE_TRACE("Starting the job worker {}", index);
+
+    while (auto job = jobs.pop())
+    {
+      try
+      {
+        (*job)();
+      }
+      catch (const std::exception& e)
+      {
+        ODE_ERROR("A job on the worker {} failed: {}", index, e.what());
+      }
+      catch (...)
+      {
+        ODE_ERROR("A job on the worker {} failed", index);
+      }
+
+      finish_job();
+    }
+
+    ODE_TRACE("Stopping the job worker {}", index);
+  }
+
+  void job_system::finish_job()
+  {
+    bool finished = false;
+
+    {
+      std::lock_guard<std::mutex> lock{pending_mutex};
+      finished = 0 == --pending_jobs;
+    }
+
+    if (finished)
+    {
+      pending_condition.notify_all();
+    }
+  }
+
+} // namespace ode
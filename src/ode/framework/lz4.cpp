@@ -0,0 +1,322 @@
+/// The definitions of the functions which compress and decompress data in
+/// the LZ4 block format.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/lz4.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The base-2 logarithm of the number of the entries in the hash table
+    /// of the compressor.
+    ///
+    constexpr int lz4_hash_log = 12;
+
+    ///
+    /// The shortest match that is encoded.
+    ///
+    constexpr std::size_t lz4_min_match = 4;
+
+    ///
+    /// The number of the bytes at the end of a block that are always
+    /// literals.
+    ///
+    constexpr std::size_t lz4_last_literals = 5;
+
+    ///
+    /// The number of the bytes at the end of a block in which no match may
+    /// start.
+    ///
+    constexpr std::size_t lz4_match_limit = 12;
+
+    ///
+    /// The largest distance to a match.
+    ///
+    constexpr std::size_t lz4_max_offset = 65535;
+
+    ///
+    /// Reads four bytes.
+    ///
+    /// \param p a pointer to the bytes.
+    ///
+    /// \return The bytes as an integer.
+    ///
+    static std::uint32_t read_u32(const std::uint8_t* p) noexcept
+    {
+      std::uint32_t v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    ///
+    /// Gives the index of the hash table of the given four bytes.
+    ///
+    /// \param sequence the bytes.
+    ///
+    /// \return The index.
+    ///
+    static std::uint32_t hash_sequence(const std::uint32_t sequence) noexcept
+    {
+      return (sequence * 2654435761u) >> (32 - lz4_hash_log);
+    }
+
+    ///
+    /// Writes a length that doesn't fit into the four bits of the token as
+    /// a run of bytes.
+    ///
+    /// \param op a reference to the pointer to the output, which is moved
+    /// past the length.
+    /// \param length the part of the length that exceeds 15.
+    ///
+    static void write_length(std::uint8_t*& op, std::size_t length) noexcept
+    {
+      while (255 <= length)
+      {
+        *op++ = 255;
+        length -= 255;
+      }
+
+      *op++ = static_cast<std::uint8_t>(length);
+    }
+
+    ///
+    /// Reads a length that doesn't fit into the four bits of the token.
+    ///
+    /// \param ip a reference to the pointer to the input, which is moved past
+    /// the length.
+    /// \param end a pointer past the end of the input.
+    /// \param length the length, to which the run of bytes is added.
+    ///
+    /// \return Whether or not the length was read.
+    ///
+    static bool read_length(
+        const std::uint8_t*& ip,
+        const std::uint8_t* end,
+        std::size_t& length) noexcept
+    {
+      std::uint8_t byte = 255;
+
+      while (255 == byte)
+      {
+        if (end == ip)
+        {
+          return false;
+        }
+
+        byte = *ip++;
+        length += byte;
+      }
+
+      return true;
+    }
+
+    ///
+    /// Writes a sequence of literals and the match that follows them.
+    ///
+    /// \param op a reference to the pointer to the output, which is moved
+    /// past the sequence.
+    /// \param literals a pointer to the literals.
+    /// \param literal_count the number of the literals.
+    /// \param offset the distance to the match, or zero for the last
+    /// sequence, which has no match.
+    /// \param match_length the length of the match.
+    ///
+    static void write_sequence(
+        std::uint8_t*& op,
+        const std::uint8_t* literals,
+        const std::size_t literal_count,
+        const std::size_t offset,
+        const std::size_t match_length) noexcept
+    {
+      std::uint8_t* const token = op++;
+      const auto extra_match =
+          0 == offset ? 0 : match_length - lz4_min_match;
+
+      *token = static_cast<std::uint8_t>(
+          std::min<std::size_t>(literal_count, 15) << 4 |
+          std::min<std::size_t>(extra_match, 15));
+
+      if (15 <= literal_count)
+      {
+        write_length(op, literal_count - 15);
+      }
+
+      std::memcpy(op, literals, literal_count);
+      op += literal_count;
+
+      if (0 == offset)
+      {
+        return;
+      }
+
+      *op++ = static_cast<std::uint8_t>(offset);
+      *op++ = static_cast<std::uint8_t>(offset >> 8);
+
+      if (15 <= extra_match)
+      {
+        write_length(op, extra_match - 15);
+      }
+    }
+  } // namespace detail
+
+  std::size_t lz4_compress(
+      const std::uint8_t* in,
+      const std::size_t size,
+      std::vector<std::uint8_t>& out)
+  {
+    const auto start = out.size();
+    out.resize(start + lz4_compress_bound(size));
+
+    std::uint8_t* op = out.data() + start;
+    std::size_t anchor = 0;
+
+    if (detail::lz4_match_limit < size)
+    {
+      std::uint32_t table[1 << detail::lz4_hash_log] = {};
+      const auto limit = size - detail::lz4_match_limit;
+      const auto match_end = size - detail::lz4_last_literals;
+      std::size_t ip = 0;
+
+      while (ip < limit)
+      {
+        const auto sequence = detail::read_u32(in + ip);
+        const auto h = detail::hash_sequence(sequence);
+        const std::size_t candidate = table[h];
+
+        table[h] = static_cast<std::uint32_t>(ip);
+
+        if (candidate >= ip || ip - candidate > detail::lz4_max_offset ||
+            detail::read_u32(in + candidate) != sequence)
+        {
+          // The search speeds up over the data that doesn't compress.
+          ip += 1 + ((ip - anchor) >> 6);
+          continue;
+        }
+
+        auto length = detail::lz4_min_match;
+
+        // The matches are extended eight bytes at a time first.
+        while (ip + length + 8 <= match_end &&
+               0 == std::memcmp(in + candidate + length, in + ip + length, 8))
+        {
+          length += 8;
+        }
+
+        while (ip + length < match_end &&
+               in[candidate + length] == in[ip + length])
+        {
+          ++length;
+        }
+
+        detail::write_sequence(
+            op, in + anchor, ip - anchor, ip - candidate, length);
+
+        ip += length;
+        anchor = ip;
+
+        if (ip < limit)
+        {
+          table[detail::hash_sequence(detail::read_u32(in + ip - 2))] =
+              static_cast<std::uint32_t>(ip - 2);
+        }
+      }
+    }
+
+    detail::write_sequence(op, in + anchor, size - anchor, 0, 0);
+
+    const auto written = static_cast<std::size_t>(op - (out.data() + start));
+    out.resize(start + written);
+
+    return written;
+  }
+
+  bool lz4_decompress(
+      const std::uint8_t* in,
+      const std::size_t size,
+      std::uint8_t* out,
+      const std::size_t out_size) noexcept
+  {
+    const std::uint8_t* ip = in;
+    const std::uint8_t* const in_end = in + size;
+    std::uint8_t* op = out;
+    std::uint8_t* const out_end = out + out_size;
+
+    while (ip < in_end)
+    {
+      const auto token = *ip++;
+      std::size_t literals = token >> 4;
+
+      if (15 == literals && !detail::read_length(ip, in_end, literals))
+      {
+        return false;
+      }
+
+      if (literals > static_cast<std::size_t>(in_end - ip) ||
+          literals > static_cast<std::size_t>(out_end - op))
+      {
+        return false;
+      }
+
+      std::memcpy(op, ip, literals);
+      ip += literals;
+      op += literals;
+
+      // The last sequence has no match.
+      if (in_end == ip)
+      {
+        break;
+      }
+
+      if (2 > in_end - ip)
+      {
+        return false;
+      }
+
+      const std::size_t offset = ip[0] | ip[1] << 8;
+      ip += 2;
+
+      std::size_t length = token & 15;
+
+      if (15 == length && !detail::read_length(ip, in_end, length))
+      {
+        return false;
+      }
+
+      length += detail::lz4_min_match;
+
+      if (0 == offset || offset > static_cast<std::size_t>(op - out) ||
+          length > static_cast<std::size_t>(out_end - op))
+      {
+        return false;
+      }
+
+      const std::uint8_t* match = op - offset;
+
+      if (offset >= length)
+      {
+        std::memcpy(op, match, length);
+        op += length;
+      }
+      else
+      {
+        // The match overlaps the output, so it repeats the last bytes.
+        for (std::size_t i = 0; i < length; ++i)
+        {
+          *op++ = *match++;
+        }
+      }
+    }
+
+    return out_end == op;
+  }
+
+} // namespace ode
@@ -7,13 +7,15 @@
 
 #include "ode/framework/platform_manager.h"
 
+#include <utility>
+
 #include <SDL2/SDL.h>
 
 #include "ode/logger.h"
 
 namespace ode
 {
-  platform_manager::platform_manager(system_t* is) : input_system{is}
+  platform_manager::platform_manager(input_handler* ih) : input{ih}
   {
   }
 
@@ -29,10 +31,94 @@ namespace ode
       {
         env.schedule_termination();
       }
-      else
+      else if (nullptr == player)
+      {
+        if (recorder)
+        {
+          recorder->record(tick, event);
+        }
+
+        if (nullptr != input)
+        {
+          input->handle(event);
+        }
+      }
+    }
+
+    if (player)
+    {
+      while (const auto recorded = player->next(tick))
       {
+        if (nullptr != input)
+        {
+          input->handle(*recorded);
+        }
       }
+
+      if (player->is_finished(tick + 1))
+      {
+        env.schedule_termination();
+      }
+    }
+
+    if (nullptr != input)
+    {
+      input->publish();
+    }
+
+    ++tick;
+  }
+
+  void platform_manager::record(std::unique_ptr<input_recorder> r)
+  {
+    recorder = std::move(r);
+  }
+
+  void platform_manager::replay(std::unique_ptr<input_player> p)
+  {
+    player = std::move(p);
+  }
+
+  bool platform_manager::finish(const state& s)
+  {
+    const auto state_checksum = s.checksum(input_checksum_seed);
+
+    if (recorder)
+    {
+      recorder->finish(tick, state_checksum);
+      recorder.reset();
     }
+
+    if (!player)
+    {
+      return true;
+    }
+
+    const auto checksum = player->finish(state_checksum);
+    const bool matched = checksum == player->get_recorded_checksum() &&
+        tick == player->get_tick_count();
+
+    if (matched)
+    {
+      ODE_INFO(
+          "The replay of {} ticks matched the recording, checksum {:#018x}",
+          tick,
+          checksum);
+    }
+    else
+    {
+      ODE_ERROR(
+          "The replay of {} ticks doesn't match the recording of {} ticks, "
+          "checksum {:#018x} instead of {:#018x}",
+          tick,
+          player->get_tick_count(),
+          checksum,
+          player->get_recorded_checksum());
+    }
+
+    player.reset();
+
+    return matched;
   }
 
 } // namespace ode
@@ -0,0 +1,293 @@
+/// The definitions of the types and the functions which save the game state
+/// into snapshots and load it back.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/snapshot.h"
+
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "ode/framework/binary_stream.h"
+#include "ode/framework/lz4.h"
+#include "ode/logger.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The bytes at the start of the snapshots.
+    ///
+    constexpr char snapshot_magic[] = {'O', 'D', 'E', 'S', 'N', 'A', 'P', 'S'};
+
+    ///
+    /// The version of the format of the header of the snapshots.
+    ///
+    constexpr std::uint8_t snapshot_format_version = 1;
+
+    ///
+    /// The size of the header of the snapshots in bytes. The header holds
+    /// the magic bytes, the version of the format, the compression, the
+    /// size of the data, and the size of the stored data.
+    ///
+    constexpr std::size_t snapshot_header_size =
+        sizeof(snapshot_magic) + 2 + 8 + 8;
+
+    ///
+    /// The tag of the section of the state.
+    ///
+    constexpr std::uint32_t state_section_tag = make_section_tag("STAT");
+
+    ///
+    /// Throws the error of an invalid snapshot.
+    ///
+    /// \param reason the reason why the snapshot is invalid.
+    ///
+    [[noreturn]] static void throw_invalid_snapshot(const char* reason)
+    {
+      ODE_ERROR("The snapshot is invalid: {}", reason);
+      throw std::runtime_error{std::string{"Invalid snapshot: "} + reason};
+    }
+  } // namespace detail
+
+  const std::vector<std::uint8_t>& snapshot_encoder::encode(
+      const state& s, const snapshot_compression compression)
+  {
+    body.clear();
+
+    {
+      binary_writer writer{body};
+      const auto marker = writer.begin_section(
+          detail::state_section_tag, state_schema_version);
+      s.serialize(writer);
+      writer.end_section(marker);
+    }
+
+    out.clear();
+
+    // The size of the stored data is written after the data.
+    {
+      binary_writer writer{out};
+      writer.write_array(
+          detail::snapshot_magic, sizeof(detail::snapshot_magic));
+      writer.write(detail::snapshot_format_version);
+      writer.write(compression);
+      writer.write(static_cast<std::uint64_t>(body.size()));
+      writer.write(std::uint64_t{0});
+    }
+
+    std::uint64_t stored = body.size();
+
+    if (snapshot_compression::lz4 == compression)
+    {
+      stored = lz4_compress(body.data(), body.size(), out);
+    }
+    else
+    {
+      out.insert(out.end(), body.begin(), body.end());
+    }
+
+    detail::copy_little_endian<std::uint64_t>(
+        out.data() + detail::snapshot_header_size - sizeof(stored),
+        &stored,
+        1);
+
+    return out;
+  }
+
+  state snapshot_decoder::decode(
+      const std::uint8_t* data, const std::size_t size)
+  {
+    if (detail::snapshot_header_size > size ||
+        0 != std::memcmp(
+                 data,
+                 detail::snapshot_magic,
+                 sizeof(detail::snapshot_magic)))
+    {
+      detail::throw_invalid_snapshot("the header is missing");
+    }
+
+    binary_reader header{
+        data + sizeof(detail::snapshot_magic),
+        detail::snapshot_header_size - sizeof(detail::snapshot_magic)};
+
+    const auto format = header.read<std::uint8_t>();
+    const auto compression = header.read<snapshot_compression>();
+    const auto body_size = header.read<std::uint64_t>();
+    const auto stored = header.read<std::uint64_t>();
+
+    if (detail::snapshot_format_version != format)
+    {
+      detail::throw_invalid_snapshot("the format version is unknown");
+    }
+
+    if (size - detail::snapshot_header_size != stored)
+    {
+      detail::throw_invalid_snapshot("the size doesn't match");
+    }
+
+    const std::uint8_t* stored_data = data + detail::snapshot_header_size;
+    const std::uint8_t* body_data = stored_data;
+
+    if (snapshot_compression::lz4 == compression)
+    {
+      // A byte of the compressed data expands into 255 bytes at most, so a
+      // corrupted size is caught before anything is allocated.
+      if (body_size > lz4_compress_bound(stored) * 255)
+      {
+        detail::throw_invalid_snapshot("the size doesn't match");
+      }
+
+      body.resize(body_size);
+
+      if (!lz4_decompress(stored_data, stored, body.data(), body.size()))
+      {
+        detail::throw_invalid_snapshot("the data can't be decompressed");
+      }
+
+      body_data = body.data();
+    }
+    else if (snapshot_compression::none != compression || body_size != stored)
+    {
+      detail::throw_invalid_snapshot("the compression is unknown");
+    }
+
+    binary_reader reader{body_data, body_size};
+    state s{};
+    bool has_state = false;
+
+    while (auto section = reader.read_section())
+    {
+      if (detail::state_section_tag != section->tag)
+      {
+        continue;
+      }
+
+      if (state_schema_version < section->version)
+      {
+        detail::throw_invalid_snapshot(
+            "the state was written by a newer version");
+      }
+
+      if (!s.deserialize(section->body, section->version) ||
+          !section->body.is_ok())
+      {
+        detail::throw_invalid_snapshot("the state can't be read");
+      }
+
+      has_state = true;
+    }
+
+    if (!reader.is_ok() || !has_state)
+    {
+      detail::throw_invalid_snapshot("the state is missing");
+    }
+
+    return s;
+  }
+
+  void save_snapshot(
+      const std::string& filename,
+      const state& s,
+      const snapshot_compression compression)
+  {
+    snapshot_encoder encoder{};
+    const auto& bytes = encoder.encode(s, compression);
+    const auto temporary = filename + ".tmp";
+
+    {
+      std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+
+      if (!file.write(
+              reinterpret_cast<const char*>(bytes.data()),
+              static_cast<std::streamsize>(bytes.size())))
+      {
+        ODE_ERROR("The snapshot '{}' can't be written", temporary);
+        throw std::runtime_error{"The snapshot can't be written"};
+      }
+    }
+
+    std::error_code error{};
+    std::filesystem::rename(temporary, filename, error);
+
+    if (error)
+    {
+      ODE_ERROR(
+          "The snapshot '{}' can't be moved to '{}': {}",
+          temporary,
+          filename,
+          error.message());
+      throw std::runtime_error{"The snapshot can't be written"};
+    }
+
+    ODE_DEBUG("Saved a snapshot of {} bytes to '{}'", bytes.size(), filename);
+  }
+
+  state load_snapshot(const std::string& filename)
+  {
+    std::ifstream file{filename, std::ios::binary};
+
+    if (!file)
+    {
+      ODE_ERROR("The snapshot '{}' can't be opened", filename);
+      throw std::runtime_error{"The snapshot can't be opened"};
+    }
+
+    const std::vector<std::uint8_t> data{
+        std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+    snapshot_decoder decoder{};
+    return decoder.decode(data.data(), data.size());
+  }
+
+  snapshot_writer::snapshot_writer(job_system& job_threads)
+      : jobs{job_threads},
+        pending{std::make_shared<std::atomic<std::size_t>>(0)},
+        failed{std::make_shared<std::atomic<std::size_t>>(0)}
+  {
+  }
+
+  void snapshot_writer::save(
+      state s, std::string filename, const snapshot_compression compression)
+  {
+    ++*pending;
+
+    jobs.submit([s = std::move(s),
+                 filename = std::move(filename),
+                 compression,
+                 counter = pending,
+                 failures = failed] {
+      try
+      {
+        save_snapshot(filename, s, compression);
+      }
+      catch (const std::exception& e)
+      {
+        ODE_ERROR("The snapshot '{}' can't be saved: {}", filename, e.what());
+        ++*failures;
+      }
+
+      --*counter;
+    });
+  }
+
+  std::size_t snapshot_writer::get_pending_count() const noexcept
+  {
+    return pending->load();
+  }
+
+  std::size_t snapshot_writer::get_failed_count() const noexcept
+  {
+    return failed->load();
+  }
+
+} // namespace ode
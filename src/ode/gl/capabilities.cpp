@@ -0,0 +1,185 @@
+/// The definitions of the functions which create and give the snapshot of the
+/// capabilities of the OpenGL context.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/capabilities.h"
+
+#include <cctype>
+#include <cstddef>
+
+#include <glad/glad.h>
+
+#include "ode/gl/data.h"
+#include "ode/gl/gl_config.h"
+#include "ode/logger.h"
+
+namespace ode::gl
+{
+  namespace detail
+  {
+    ///
+    /// The snapshot of the capabilities of the OpenGL context.
+    ///
+    static capabilities loaded_capabilities{};
+
+    ///
+    /// Gives the value of an integer state of OpenGL.
+    ///
+    /// \param name a symbolic constant with which the value is got.
+    ///
+    /// \return The value.
+    ///
+    static int get_integer(const GLenum name)
+    {
+      GLint value = 0;
+      glGetIntegerv(name, &value);
+      return value;
+    }
+
+    ///
+    /// Parses the version of the OpenGL shading language into the form used
+    /// by the \c #version directive. The version string starts with the
+    /// major version and the two-digit minor version, for example
+    /// "4.60 NVIDIA".
+    ///
+    /// \param version the version string.
+    ///
+    /// \return The version or \c 0 if the string can't be parsed.
+    ///
+    static int parse_shading_language_version(const std::string& version)
+    {
+      int number = 0;
+      int digits = 0;
+
+      for (const char c : version)
+      {
+        if ('.' == c && 0 < digits)
+        {
+          continue;
+        }
+
+        if (!std::isdigit(static_cast<unsigned char>(c)))
+        {
+          break;
+        }
+
+        number = number * 10 + (c - '0');
+        ++digits;
+      }
+
+      return 3 == digits ? number : 0;
+    }
+  } // namespace detail
+
+  capabilities query_capabilities()
+  {
+    capabilities caps{};
+
+    caps.vendor = get_vendor();
+    caps.renderer = get_renderer();
+    caps.version = get_version();
+    caps.shading_language_version = get_shading_language_version();
+
+    if constexpr (disable_gl_calls)
+    {
+      return caps;
+    }
+
+    caps.major_version = detail::get_integer(GL_MAJOR_VERSION);
+    caps.minor_version = detail::get_integer(GL_MINOR_VERSION);
+    caps.shading_language_number =
+        detail::parse_shading_language_version(caps.shading_language_version);
+
+    const auto extension_count = detail::get_integer(GL_NUM_EXTENSIONS);
+
+    caps.extensions.reserve(static_cast<std::size_t>(extension_count));
+
+    for (GLint i = 0; i < extension_count; ++i)
+    {
+      const auto name = reinterpret_cast<const char*>(
+          glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+
+      if (nullptr != name)
+      {
+        caps.extensions.emplace(name);
+      }
+    }
+
+    caps.max_texture_size = detail::get_integer(GL_MAX_TEXTURE_SIZE);
+    caps.max_uniform_block_size =
+        detail::get_integer(GL_MAX_UNIFORM_BLOCK_SIZE);
+    caps.max_texture_units =
+        detail::get_integer(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS);
+    caps.max_vertex_attributes = detail::get_integer(GL_MAX_VERTEX_ATTRIBS);
+    caps.max_samples = detail::get_integer(GL_MAX_SAMPLES);
+
+    // The functions of the features which aren't in the core profile that
+    // the loader targets are only loaded through the extensions, so the
+    // features are only reported if the loader has loaded the functions.
+#if defined(GL_ARB_buffer_storage) && GL_ARB_buffer_storage
+    caps.persistent_mapping = 0 != GLAD_GL_ARB_buffer_storage &&
+        (caps.has_version(4, 4) ||
+         caps.has_extension("GL_ARB_buffer_storage"));
+#endif // !GL_ARB_buffer_storage
+
+    caps.direct_state_access = caps.has_version(4, 5) ||
+        caps.has_extension("GL_ARB_direct_state_access");
+    caps.instancing = caps.has_version(3, 1) ||
+        caps.has_extension("GL_ARB_draw_instanced");
+
+#if defined(GL_ARB_timer_query) && GL_ARB_timer_query
+    caps.timer_query = 0 != GLAD_GL_ARB_timer_query &&
+        (caps.has_version(3, 3) || caps.has_extension("GL_ARB_timer_query"));
+#endif // !GL_ARB_timer_query
+
+#if defined(GL_ARB_get_program_binary) && GL_ARB_get_program_binary
+    caps.program_binary = 0 != GLAD_GL_ARB_get_program_binary &&
+        (caps.has_version(4, 1) ||
+         caps.has_extension("GL_ARB_get_program_binary"));
+#endif // !GL_ARB_get_program_binary
+
+#if defined(GL_KHR_parallel_shader_compile) && GL_KHR_parallel_shader_compile
+    caps.parallel_shader_compile_khr =
+        0 != GLAD_GL_KHR_parallel_shader_compile &&
+        caps.has_extension("GL_KHR_parallel_shader_compile");
+#endif // !GL_KHR_parallel_shader_compile
+
+#if defined(GL_ARB_parallel_shader_compile) && GL_ARB_parallel_shader_compile
+    caps.parallel_shader_compile_arb =
+        0 != GLAD_GL_ARB_parallel_shader_compile &&
+        caps.has_extension("GL_ARB_parallel_shader_compile");
+#endif // !GL_ARB_parallel_shader_compile
+
+    return caps;
+  }
+
+  void load_capabilities()
+  {
+    detail::loaded_capabilities = query_capabilities();
+
+    const auto& caps = detail::loaded_capabilities;
+
+    ODE_DEBUG("The OpenGL vendor is {}", caps.vendor);
+    ODE_DEBUG("The OpenGL renderer is {}", caps.renderer);
+    ODE_DEBUG("The OpenGL version is {}", caps.version);
+    ODE_DEBUG(
+        "The OpenGL shading language version is {}",
+        caps.shading_language_version);
+    ODE_DEBUG("The OpenGL context has {} extensions", caps.extensions.size());
+    ODE_DEBUG(
+        "The largest texture size is {} and the largest uniform block size is "
+        "{} bytes",
+        caps.max_texture_size,
+        caps.max_uniform_block_size);
+  }
+
+  const capabilities& get_capabilities() noexcept
+  {
+    return detail::loaded_capabilities;
+  }
+
+} // namespace ode::gl
@@ -0,0 +1,169 @@
+/// The definition of the type of the timers which measure the GPU time of the
+/// rendering passes.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/gpu_timer.h"
+
+#include "gsl/assert"
+
+#include "ode/gl/capabilities.h"
+#include "ode/logger.h"
+
+namespace ode::gl
+{
+  gpu_timer::gpu_timer(const std::size_t latency) ODE_CONTRACT_NOEXCEPT
+      : frames(latency),
+        current{0},
+        passes{},
+        active{false},
+        supported{false},
+        dropped_count{0}
+  {
+    Expects(0 < latency);
+
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+#if defined(GL_ARB_timer_query) && GL_ARB_timer_query
+
+    supported = get_capabilities().timer_query;
+
+#endif // !GL_ARB_timer_query
+
+    ODE_DEBUG(
+        "The GPU time queries are {}",
+        supported ? "supported" : "not supported");
+  }
+
+  gpu_timer::~gpu_timer()
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    for (auto& f : frames)
+    {
+      if (!f.queries.empty())
+      {
+        glDeleteQueries(
+            static_cast<GLsizei>(f.queries.size()), f.queries.data());
+      }
+    }
+  }
+
+  void gpu_timer::begin_frame()
+  {
+    Expects(!active);
+
+    current = (current + 1) % frames.size();
+
+    auto& f = frames[current];
+
+    if (0 < f.count && !read(f))
+    {
+      ++dropped_count;
+      ODE_TRACE("The GPU times of a frame weren't ready and are dropped");
+    }
+
+    f.count = 0;
+  }
+
+  void gpu_timer::begin(std::string_view name) ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(!active);
+
+    active = true;
+
+    if (!supported)
+    {
+      return;
+    }
+
+    auto& f = frames[current];
+
+    if (f.queries.size() == f.count)
+    {
+      GLuint query = 0;
+      glGenQueries(1, &query);
+      f.queries.push_back(query);
+      f.names.emplace_back();
+    }
+
+    f.names[f.count] = name;
+
+#if defined(GL_ARB_timer_query) && GL_ARB_timer_query
+
+    glBeginQuery(GL_TIME_ELAPSED, f.queries[f.count]);
+
+#endif // !GL_ARB_timer_query
+
+    ++f.count;
+  }
+
+  void gpu_timer::end() ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(active);
+
+    active = false;
+
+    if (!supported)
+    {
+      return;
+    }
+
+#if defined(GL_ARB_timer_query) && GL_ARB_timer_query
+
+    glEndQuery(GL_TIME_ELAPSED);
+
+#endif // !GL_ARB_timer_query
+  }
+
+  std::chrono::nanoseconds gpu_timer::get_frame_time() const noexcept
+  {
+    auto time = std::chrono::nanoseconds::zero();
+
+    for (const auto& pass : passes)
+    {
+      time += pass.time;
+    }
+
+    return time;
+  }
+
+  bool gpu_timer::read(const frame& f)
+  {
+    // The queries finish in order, so the whole frame is ready when its last
+    // query is.
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(
+        f.queries[f.count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+    if (GL_TRUE != available)
+    {
+      return false;
+    }
+
+    passes.clear();
+
+#if defined(GL_ARB_timer_query) && GL_ARB_timer_query
+
+    for (std::size_t i = 0; i < f.count; ++i)
+    {
+      GLuint64 time = 0;
+      glGetQueryObjectui64v(f.queries[i], GL_QUERY_RESULT, &time);
+      passes.push_back({f.names[i], std::chrono::nanoseconds{time}});
+    }
+
+#endif // !GL_ARB_timer_query
+
+    return true;
+  }
+
+} // namespace ode::gl
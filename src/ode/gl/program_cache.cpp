@@ -0,0 +1,349 @@
+/// The definition of the type of the caches which compile the shader programs
+/// and keep their binaries between the runs of the program.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/program_cache.h"
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "gsl/assert"
+
+#include "ode/__config"
+#include "ode/filesystem/path.h"
+#include "ode/gl/capabilities.h"
+#include "ode/gl/data.h"
+#include "ode/gl/gl_config.h"
+#include "ode/gl/shader.h"
+#include "ode/logger.h"
+
+namespace ode::gl
+{
+  namespace detail
+  {
+    ///
+    /// The offset basis of the 64-bit FNV-1a hash.
+    ///
+    constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ull;
+
+    ///
+    /// The prime of the 64-bit FNV-1a hash.
+    ///
+    constexpr std::uint64_t fnv_prime = 1099511628211ull;
+
+    static std::uint64_t hash(std::uint64_t h, std::string_view s) noexcept
+    {
+      for (const char c : s)
+      {
+        h ^= static_cast<std::uint8_t>(c);
+        h *= fnv_prime;
+      }
+
+      // The terminating null character is hashed too so that the
+      // concatenations of different strings don't collide.
+      return h * fnv_prime;
+    }
+
+    template <typename T> static void write(std::ostream& os, const T& t)
+    {
+      os.write(reinterpret_cast<const char*>(&t), sizeof(T));
+    }
+
+    template <typename T> static bool read(std::istream& is, T& t)
+    {
+      return static_cast<bool>(
+          is.read(reinterpret_cast<char*>(&t), sizeof(T)));
+    }
+  } // namespace detail
+
+  program_cache::program_cache(std::string directory)
+      : directory{std::move(directory)},
+        driver{},
+        binary_support{false},
+        entries{},
+        ids{},
+        compile_count{0},
+        binary_count{0}
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    driver = get_renderer() + ' ' + get_version();
+
+#if defined(GL_KHR_parallel_shader_compile) && GL_KHR_parallel_shader_compile
+
+    if (get_capabilities().parallel_shader_compile_khr)
+    {
+      // Let the driver choose the number of the compiler threads.
+      glMaxShaderCompilerThreadsKHR(0xffffffffu);
+      ODE_DEBUG("The shader programs are compiled in parallel");
+    }
+
+#endif // !GL_KHR_parallel_shader_compile
+
+#if defined(GL_ARB_parallel_shader_compile) && GL_ARB_parallel_shader_compile
+
+    if (!get_capabilities().parallel_shader_compile_khr &&
+        get_capabilities().parallel_shader_compile_arb)
+    {
+      glMaxShaderCompilerThreadsARB(0xffffffffu);
+      ODE_DEBUG("The shader programs are compiled in parallel");
+    }
+
+#endif // !GL_ARB_parallel_shader_compile
+
+#if defined(GL_ARB_get_program_binary) && GL_ARB_get_program_binary
+
+    if (get_capabilities().program_binary)
+    {
+      GLint formats = 0;
+      glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+      binary_support = 0 < formats;
+    }
+
+#endif // !GL_ARB_get_program_binary
+
+    ODE_DEBUG(
+        "The program binaries are {}",
+        binary_support ? "supported" : "not supported");
+  }
+
+  program_cache::~program_cache()
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    for (const auto& e : entries)
+    {
+      if (0 != e.program)
+      {
+        glDeleteProgram(e.program);
+      }
+    }
+  }
+
+  std::size_t program_cache::request(
+      std::string_view vertex_source,
+      std::string_view fragment_source,
+      std::initializer_list<const char*> attributes)
+  {
+    auto h = detail::hash(detail::fnv_offset_basis, vertex_source);
+    h = detail::hash(h, fragment_source);
+
+    for (const char* attribute : attributes)
+    {
+      h = detail::hash(h, attribute);
+    }
+
+    if (const auto it = ids.find(h); ids.end() != it)
+    {
+      return it->second;
+    }
+
+    const std::size_t id = entries.size();
+
+    ids.emplace(h, id);
+
+    if constexpr (disable_gl_calls)
+    {
+      entries.push_back({h, 0, program_state::ready});
+      return id;
+    }
+
+    if (const GLuint program = load_binary(h); 0 != program)
+    {
+      ++binary_count;
+      entries.push_back({h, program, program_state::ready});
+      return id;
+    }
+
+    const std::string vertex{vertex_source};
+    const std::string fragment{fragment_source};
+
+    const GLuint program = begin_program(
+        vertex.c_str(), fragment.c_str(), attributes, binary_support);
+
+    ++compile_count;
+    entries.push_back({h, program, program_state::compiling});
+
+    return id;
+  }
+
+  bool program_cache::is_ready(const std::size_t id) const
+  {
+    Expects(id < entries.size());
+
+    const auto& e = entries[id];
+
+    return program_state::compiling != e.state ||
+           is_program_complete(e.program);
+  }
+
+  GLuint program_cache::get(const std::size_t id)
+  {
+    Expects(id < entries.size());
+
+    auto& e = entries[id];
+
+    if (program_state::compiling == e.state)
+    {
+      try
+      {
+        finish_program(e.program);
+      }
+      catch (...)
+      {
+        e.program = 0;
+        e.state = program_state::failed;
+        throw;
+      }
+
+      e.state = program_state::ready;
+
+      save_binary(e.hash, e.program);
+    }
+
+    if (program_state::failed == e.state)
+    {
+      throw std::runtime_error{"The shader program linking failed"};
+    }
+
+    return e.program;
+  }
+
+  std::string program_cache::get_binary_filename(
+      const std::uint64_t hash) const
+  {
+    const auto h = detail::hash(hash, driver);
+
+    constexpr char digits[] = "0123456789abcdef";
+    std::string name(16, '0');
+
+    for (std::size_t i = 0; i < name.size(); ++i)
+    {
+      name[name.size() - 1 - i] = digits[(h >> (4 * i)) & 0xf];
+    }
+
+    return directory + filesystem::path::preferred_separator + name + ".bin";
+  }
+
+  GLuint program_cache::load_binary(const std::uint64_t hash) const
+  {
+    if (!binary_support || directory.empty())
+    {
+      return 0;
+    }
+
+    const auto filename = get_binary_filename(hash);
+    std::ifstream file{filename, std::ios::binary};
+
+    if (!file)
+    {
+      return 0;
+    }
+
+    std::uint64_t file_hash = 0;
+    std::uint32_t driver_length = 0;
+
+    if (!detail::read(file, file_hash) || hash != file_hash ||
+        !detail::read(file, driver_length) || driver.size() != driver_length)
+    {
+      ODE_DEBUG("The program binary '{}' is for other sources", filename);
+      return 0;
+    }
+
+    std::string file_driver(driver_length, '\0');
+    GLenum format = 0;
+
+    if (!file.read(file_driver.data(), driver_length) ||
+        driver != file_driver || !detail::read(file, format))
+    {
+      ODE_DEBUG("The program binary '{}' is for another driver", filename);
+      return 0;
+    }
+
+    const std::string binary{
+        std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+    const GLuint program = glCreateProgram();
+
+#if defined(GL_ARB_get_program_binary) && GL_ARB_get_program_binary
+
+    glProgramBinary(
+        program,
+        format,
+        binary.data(),
+        static_cast<GLsizei>(binary.size()));
+
+#endif // !GL_ARB_get_program_binary
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+
+    if (GL_TRUE != status)
+    {
+      ODE_DEBUG(
+          "The program binary '{}' is rejected, compiling the sources",
+          filename);
+      glDeleteProgram(program);
+      return 0;
+    }
+
+    ODE_TRACE("Loaded the shader program {} from '{}'", program, filename);
+
+    return program;
+  }
+
+  void program_cache::save_binary(
+      const std::uint64_t hash, const GLuint program) const
+  {
+    if (!binary_support || directory.empty())
+    {
+      return;
+    }
+
+#if defined(GL_ARB_get_program_binary) && GL_ARB_get_program_binary
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+    if (0 >= length)
+    {
+      return;
+    }
+
+    std::string binary(static_cast<std::size_t>(length), '\0');
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    const auto filename = get_binary_filename(hash);
+    std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+
+    if (!file)
+    {
+      ODE_WARN("The program binary '{}' can't be written", filename);
+      return;
+    }
+
+    detail::write(file, hash);
+    detail::write(file, static_cast<std::uint32_t>(driver.size()));
+    file.write(driver.data(), static_cast<std::streamsize>(driver.size()));
+    detail::write(file, format);
+    file.write(binary.data(), length);
+
+    ODE_TRACE("Wrote the shader program {} into '{}'", program, filename);
+
+#endif // !GL_ARB_get_program_binary
+  }
+
+} // namespace ode::gl
@@ -0,0 +1,182 @@
+/// The definitions of the utility functions for compiling OpenGL shaders and
+/// linking shader programs.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/shader.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include "ode/gl/capabilities.h"
+#include "ode/logger.h"
+
+namespace ode::gl
+{
+  GLuint compile_shader(const GLenum type, const char* source)
+  {
+    const GLuint shader = glCreateShader(type);
+
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+
+    if (GL_TRUE != status)
+    {
+      GLint length = 0;
+      glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+
+      std::string log(static_cast<std::size_t>(length), '\0');
+      glGetShaderInfoLog(shader, length, nullptr, log.data());
+      glDeleteShader(shader);
+
+      ODE_ERROR("The shader can't be compiled: {}", log);
+
+      throw std::runtime_error{"The shader compilation failed"};
+    }
+
+    return shader;
+  }
+
+  GLuint make_program(
+      const char* vertex_source,
+      const char* fragment_source,
+      std::initializer_list<const char*> attributes)
+  {
+    const GLuint program =
+        begin_program(vertex_source, fragment_source, attributes);
+    finish_program(program);
+    return program;
+  }
+
+  GLuint begin_program(
+      const char* vertex_source,
+      const char* fragment_source,
+      std::initializer_list<const char*> attributes,
+      const bool retrievable)
+  {
+    const GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
+    const GLuint fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
+
+    glShaderSource(vertex_shader, 1, &vertex_source, nullptr);
+    glShaderSource(fragment_shader, 1, &fragment_source, nullptr);
+    glCompileShader(vertex_shader);
+    glCompileShader(fragment_shader);
+
+    const GLuint program = glCreateProgram();
+
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+
+    GLuint location = 0;
+
+    for (const char* attribute : attributes)
+    {
+      glBindAttribLocation(program, location++, attribute);
+    }
+
+#if defined(GL_ARB_get_program_binary) && GL_ARB_get_program_binary
+
+    if (retrievable && get_capabilities().program_binary)
+    {
+      glProgramParameteri(
+          program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+#endif // !GL_ARB_get_program_binary
+
+    glLinkProgram(program);
+
+    return program;
+  }
+
+  bool is_program_complete(const GLuint program)
+  {
+#if defined(GL_KHR_parallel_shader_compile) && GL_KHR_parallel_shader_compile
+
+    if (get_capabilities().parallel_shader_compile_khr)
+    {
+      GLint status = GL_TRUE;
+      glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &status);
+      return GL_TRUE == status;
+    }
+
+#endif // !GL_KHR_parallel_shader_compile
+
+#if defined(GL_ARB_parallel_shader_compile) && GL_ARB_parallel_shader_compile
+
+    if (get_capabilities().parallel_shader_compile_arb)
+    {
+      GLint status = GL_TRUE;
+      glGetProgramiv(program, GL_COMPLETION_STATUS_ARB, &status);
+      return GL_TRUE == status;
+    }
+
+#endif // !GL_ARB_parallel_shader_compile
+
+    return true;
+  }
+
+  void finish_program(const GLuint program)
+  {
+    GLuint shaders[2] = {0, 0};
+    GLsizei count = 0;
+    glGetAttachedShaders(program, 2, &count, shaders);
+
+    bool compiled = true;
+
+    for (GLsizei i = 0; i < count; ++i)
+    {
+      GLint status = GL_FALSE;
+      glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &status);
+
+      if (GL_TRUE != status)
+      {
+        GLint length = 0;
+        glGetShaderiv(shaders[i], GL_INFO_LOG_LENGTH, &length);
+
+        std::string log(static_cast<std::size_t>(length), '\0');
+        glGetShaderInfoLog(shaders[i], length, nullptr, log.data());
+
+        ODE_ERROR("The shader can't be compiled: {}", log);
+
+        compiled = false;
+      }
+
+      glDetachShader(program, shaders[i]);
+      glDeleteShader(shaders[i]);
+    }
+
+    if (!compiled)
+    {
+      glDeleteProgram(program);
+      throw std::runtime_error{"The shader compilation failed"};
+    }
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+
+    if (GL_TRUE != status)
+    {
+      GLint length = 0;
+      glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+
+      std::string log(static_cast<std::size_t>(length), '\0');
+      glGetProgramInfoLog(program, length, nullptr, log.data());
+      glDeleteProgram(program);
+
+      ODE_ERROR("The shader program can't be linked: {}", log);
+
+      throw std::runtime_error{"The shader program linking failed"};
+    }
+
+    ODE_TRACE("Linked the shader program {}", program);
+  }
+
+} // namespace ode::gl
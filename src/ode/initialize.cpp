@@ -28,7 +28,10 @@ namespace ode
   window_t initialize_window(const execution_info& info)
   {
     window_t window = sdl::create_window(
-        {info.window_width, info.window_height, info.window_name});
+        {info.window_width,
+         info.window_height,
+         info.window_name,
+         !info.replay_file.empty()});
 
     ODE_DEBUG("The main window of {} is created", ode_name);
 
@@ -0,0 +1,170 @@
+/// The definition of the service which executes Lua workloads in isolated Lua
+/// states on worker threads.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/execution_service.h"
+
+#include <exception>
+#include <thread>
+#include <utility>
+
+#include "gsl/assert"
+
+#include "ode/framework/message_queue.h"
+#include "ode/logger.h"
+#include "ode/lua/state.h"
+
+namespace ode::lua
+{
+  class execution_service::worker final
+  {
+  public:
+    worker(
+        execution_service& service,
+        const std::size_t index,
+        const initializer_t& initializer)
+        : state{make_state()}
+    {
+      thread = std::thread{[this, &service, index, initializer] {
+        run(service, index, initializer);
+      }};
+    }
+
+    ~worker()
+    {
+      jobs.close();
+
+      if (thread.joinable())
+      {
+        thread.join();
+      }
+    }
+
+    bool submit(job_t job)
+    {
+      return jobs.push(std::move(job));
+    }
+
+  private:
+    void run(
+        execution_service& service,
+        const std::size_t index,
+        const initializer_t& initializer)
+    {
+      ODE_DEBUG("Starting the Lua worker {}", index);
+
+      if (initializer)
+      {
+        initializer(state.get());
+      }
+      else
+      {
+        luaL_openlibs(state.get());
+      }
+
+      while (auto job = jobs.pop())
+      {
+        try
+        {
+          (*job)(state.get());
+        }
+        catch (const std::exception& e)
+        {
+          ODE_ERROR("A job on the Lua worker {} failed: {}", index, e.what());
+        }
+
+        clean(state.get());
+        service.finish_job();
+      }
+
+      ODE_DEBUG("Stopping the Lua worker {}", index);
+    }
+
+    state_t state;
+    message_queue<job_t> jobs;
+    std::thread thread;
+  };
+
+  execution_service::execution_service(
+      std::size_t shard_count, initializer_t initializer)
+      : workers{}, pending_mutex{}, pending_condition{}, pending_jobs{0}
+  {
+    if (0 == shard_count)
+    {
+      shard_count = std::thread::hardware_concurrency();
+    }
+
+    if (0 == shard_count)
+    {
+      shard_count = 1;
+    }
+
+    ODE_DEBUG("Creating a Lua execution service with {} shards", shard_count);
+
+    workers.reserve(shard_count);
+
+    for (std::size_t i = 0; i < shard_count; ++i)
+    {
+      workers.push_back(std::make_unique<worker>(*this, i, initializer));
+    }
+  }
+
+  execution_service::~execution_service()
+  {
+    workers.clear();
+  }
+
+  void execution_service::submit(const std::size_t shard, job_t job)
+  {
+    Expects(job);
+
+    {
+      std::lock_guard<std::mutex> lock{pending_mutex};
+      ++pending_jobs;
+    }
+
+    if (!workers[shard % workers.size()]->submit(std::move(job)))
+    {
+      finish_job();
+    }
+  }
+
+  void execution_service::broadcast(const job_t& job)
+  {
+    for (std::size_t i = 0; i < workers.size(); ++i)
+    {
+      submit(i, job);
+    }
+  }
+
+  void execution_service::wait()
+  {
+    std::unique_lock<std::mutex> lock{pending_mutex};
+    pending_condition.wait(lock, [this] { return 0 == pending_jobs; });
+  }
+
+  std::size_t execution_service::get_shard_count() const noexcept
+  {
+    return workers.size();
+  }
+
+  void execution_service::finish_job()
+  {
+    bool finished = false;
+
+    {
+      std::lock_guard<std::mutex> lock{pending_mutex};
+      finished = 0 == --pending_jobs;
+    }
+
+    if (finished)
+    {
+      pending_condition.notify_all();
+    }
+  }
+
+} // namespace ode::lua
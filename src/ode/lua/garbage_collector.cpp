@@ -0,0 +1,136 @@
+/// The definition of the pacer which runs the garbage collection of Lua states
+/// in bounded increments.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/garbage_collector.h"
+
+#include <algorithm>
+
+#include "ode/logger.h"
+#include "ode/lua/lua_config.h"
+
+namespace ode::lua
+{
+  namespace detail
+  {
+    ///
+    /// The size which is stored for a Lua state that is in the middle of a
+    /// cycle so that it is stepped until the cycle finishes.
+    ///
+    constexpr int cycle_in_progress = -1;
+  } // namespace detail
+
+  garbage_collector::garbage_collector()
+      : states{}, collected_sizes{}, completed{}, cursor{0}
+  {
+  }
+
+  void garbage_collector::attach(const state_ptr_t state)
+  {
+    if (std::find(states.begin(), states.end(), state.get()) != states.end())
+    {
+      return;
+    }
+
+    lua_gc(state, LUA_GCSTOP, 0);
+    states.push_back(state);
+    collected_sizes.push_back(lua_gc(state, LUA_GCCOUNT, 0));
+    completed.push_back(false);
+
+    ODE_TRACE(
+        "A Lua state is attached to the garbage collector, {} states in total",
+        states.size());
+  }
+
+  void garbage_collector::detach(const state_ptr_t state)
+  {
+    const auto it = std::find(states.begin(), states.end(), state.get());
+
+    if (states.end() == it)
+    {
+      return;
+    }
+
+    const auto index = it - states.begin();
+
+    states.erase(it);
+    collected_sizes.erase(collected_sizes.begin() + index);
+    completed.erase(completed.begin() + index);
+    lua_gc(state, LUA_GCRESTART, 0);
+
+    cursor = states.empty() ? 0 : cursor % states.size();
+  }
+
+  gc_statistics garbage_collector::step(
+      const std::chrono::nanoseconds budget) noexcept
+  {
+    using clock = std::chrono::steady_clock;
+
+    gc_statistics statistics{};
+
+    if (states.empty())
+    {
+      return statistics;
+    }
+
+    const auto start = clock::now();
+
+    // A state is done for this call once it finishes a cycle, as stepping it
+    // again would only start a new one, or if it hasn't allocated anything
+    // since its latest cycle and isn't in the middle of one, so that it has
+    // no debt to pay.
+    std::size_t pending = 0;
+
+    for (std::size_t i = 0; i < states.size(); ++i)
+    {
+      completed[i] =
+          lua_gc(states[i], LUA_GCCOUNT, 0) <= collected_sizes[i];
+
+      if (!completed[i])
+      {
+        ++pending;
+      }
+    }
+
+    while (0 < pending)
+    {
+      const auto index = cursor;
+      cursor = (cursor + 1) % states.size();
+
+      if (completed[index])
+      {
+        continue;
+      }
+
+      lua_State* state = states[index];
+
+      if (1 == lua_gc(state, LUA_GCSTEP, gc_step_size))
+      {
+        collected_sizes[index] = lua_gc(state, LUA_GCCOUNT, 0);
+        completed[index] = true;
+        --pending;
+        ++statistics.cycles;
+      }
+      else
+      {
+        collected_sizes[index] = detail::cycle_in_progress;
+      }
+
+      ++statistics.steps;
+      statistics.time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          clock::now() - start);
+
+      if (statistics.steps >= gc_minimum_steps && statistics.time >= budget)
+      {
+        break;
+      }
+    }
+
+    return statistics;
+  }
+
+} // namespace ode::lua
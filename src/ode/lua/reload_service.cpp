@@ -0,0 +1,416 @@
+/// The definition of the service which reloads changed Lua scripts while the
+/// program runs.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/reload_service.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+#include "ode/filesystem/file_watcher.h"
+#include "ode/logger.h"
+#include "ode/lua/lua_config.h"
+#include "ode/lua/state.h"
+
+namespace ode::lua
+{
+  namespace detail
+  {
+    static std::optional<std::string> read_script(const std::string& filename)
+    {
+      std::ifstream file{filename, std::ios::binary};
+
+      if (!file)
+      {
+        ODE_ERROR("The script '{}' can't be read", filename);
+        return std::nullopt;
+      }
+
+      return std::string{
+          std::istreambuf_iterator<char>{file},
+          std::istreambuf_iterator<char>{}};
+    }
+
+    static std::string normalize(const std::string& filename)
+    {
+      std::error_code ec{};
+      const std::filesystem::path p{filename};
+      const auto absolute = std::filesystem::absolute(p, ec);
+      return (ec ? p : absolute).lexically_normal().string();
+    }
+
+    static int write_chunk(
+        lua_State*, const void* p, std::size_t size, void* data)
+    {
+      static_cast<std::string*>(data)->append(
+          static_cast<const char*>(p), size);
+      return 0;
+    }
+
+    static std::optional<std::string> compile_script(
+        const std::string& filename, const std::string& source)
+    {
+      auto state = make_state();
+      const auto chunkname = "@" + filename;
+
+      const auto load_error = luaL_loadbuffer(
+          state.get(), source.data(), source.size(), chunkname.c_str());
+
+      if (LUA_OK != load_error)
+      {
+        ODE_ERROR(
+            "The script '{}' can't be compiled: {}",
+            filename,
+            lua_tostring(state.get(), stack_top));
+        return std::nullopt;
+      }
+
+      std::string bytecode{};
+      lua_dump(state.get(), write_chunk, &bytecode, 0);
+
+      return bytecode;
+    }
+
+    static std::vector<std::string> find_loaded_modules(
+        lua_State* state, const std::string& normalized)
+    {
+      std::vector<std::string> names{};
+
+      if (LUA_TTABLE != lua_getglobal(state, "package"))
+      {
+        lua_pop(state, 1);
+        return names;
+      }
+
+      const int package = lua_gettop(state);
+      const int loaded = package + 1;
+      const int searchpath = package + 2;
+      const int path = package + 3;
+
+      lua_getfield(state, package, "loaded");
+      lua_getfield(state, package, "searchpath");
+      lua_getfield(state, package, "path");
+
+      if (!lua_istable(state, loaded) || !lua_isfunction(state, searchpath) ||
+          !lua_isstring(state, path))
+      {
+        lua_settop(state, package - 1);
+        return names;
+      }
+
+      lua_pushnil(state);
+
+      while (0 != lua_next(state, loaded))
+      {
+        if (LUA_TSTRING == lua_type(state, -2))
+        {
+          lua_pushvalue(state, searchpath);
+          lua_pushvalue(state, -3);
+          lua_pushvalue(state, path);
+
+          if (LUA_OK == lua_pcall(state, 2, 1, 0) &&
+              LUA_TSTRING == lua_type(state, stack_top) &&
+              normalize(lua_tostring(state, stack_top)) == normalized)
+          {
+            names.emplace_back(lua_tostring(state, -3));
+          }
+
+          lua_pop(state, 1);
+        }
+
+        lua_pop(state, 1);
+      }
+
+      lua_settop(state, package - 1);
+
+      return names;
+    }
+
+    static bool run_module(
+        lua_State* state,
+        const std::string& filename,
+        const std::string& bytecode,
+        const std::string& name)
+    {
+      const auto chunkname = "@" + filename;
+
+      const auto error = luaL_loadbuffer(
+          state, bytecode.data(), bytecode.size(), chunkname.c_str());
+
+      if (LUA_OK == error)
+      {
+        lua_pushstring(state, name.c_str());
+      }
+
+      if (LUA_OK != error || LUA_OK != lua_pcall(state, 1, 1, 0))
+      {
+        ODE_ERROR(
+            "The module '{}' can't be reloaded: {}",
+            name,
+            lua_tostring(state, stack_top));
+        lua_pop(state, 1);
+        return false;
+      }
+
+      const int result = lua_gettop(state);
+      const int loaded = result + 1;
+      const int previous = result + 2;
+
+      lua_getglobal(state, "package");
+      lua_getfield(state, stack_top, "loaded");
+      lua_remove(state, -2);
+      lua_getfield(state, loaded, name.c_str());
+
+      if (lua_istable(state, result) && lua_istable(state, previous))
+      {
+        // The fields are copied into the previous table so that the code
+        // which holds a reference to the module sees the new functions.
+        lua_pushnil(state);
+
+        while (0 != lua_next(state, result))
+        {
+          lua_pushvalue(state, -2);
+          lua_insert(state, -2);
+          lua_rawset(state, previous);
+        }
+      }
+      else if (!lua_isnil(state, result))
+      {
+        lua_pushvalue(state, result);
+        lua_setfield(state, loaded, name.c_str());
+      }
+
+      lua_settop(state, result - 1);
+
+      return true;
+    }
+  } // namespace detail
+
+  reload_service::reload_service()
+      : requests{},
+        roots{},
+        compiled{},
+        modules{},
+        running{false},
+        worker{}
+  {
+  }
+
+  reload_service::~reload_service()
+  {
+    running = false;
+
+    if (worker.joinable())
+    {
+      worker.join();
+    }
+  }
+
+  void reload_service::track(const state_ptr_t state, std::string_view filename)
+  {
+    std::string name{filename};
+    auto& states = modules[name];
+
+    if (std::find(states.begin(), states.end(), state.get()) != states.end())
+    {
+      return;
+    }
+
+    states.push_back(state);
+
+    if (1 == states.size())
+    {
+      // The contents are hashed on the calling thread so that a change made
+      // before the worker gets to the script isn't taken as the baseline.
+      const auto source = detail::read_script(name);
+      const auto hash = source ? std::hash<std::string>{}(*source) : 0;
+
+      requests.push({std::move(name), hash});
+    }
+
+    start();
+  }
+
+  void reload_service::untrack(const state_ptr_t state)
+  {
+    for (auto& [filename, states] : modules)
+    {
+      states.erase(
+          std::remove(states.begin(), states.end(), state.get()),
+          states.end());
+    }
+  }
+
+  void reload_service::watch(std::string_view root)
+  {
+    roots.push(std::string{root});
+    start();
+  }
+
+  std::size_t reload_service::apply()
+  {
+    std::size_t count = 0;
+
+    while (auto script = compiled.try_pop())
+    {
+      const auto chunkname = "@" + script->filename;
+      const auto normalized = detail::normalize(script->filename);
+      bool reloaded = false;
+
+      std::vector<lua_State*> states{};
+
+      for (const auto& [filename, loaded] : modules)
+      {
+        for (lua_State* state : loaded)
+        {
+          if (std::find(states.begin(), states.end(), state) == states.end())
+          {
+            states.push_back(state);
+          }
+        }
+      }
+
+      for (lua_State* state : states)
+      {
+        for (const auto& name : detail::find_loaded_modules(state, normalized))
+        {
+          reloaded = detail::run_module(
+                         state, script->filename, script->bytecode, name) ||
+              reloaded;
+        }
+      }
+
+      const auto it = modules.find(script->filename);
+
+      if (modules.end() == it)
+      {
+        if (reloaded)
+        {
+          ODE_DEBUG("The module '{}' is reloaded", script->filename);
+          ++count;
+        }
+
+        continue;
+      }
+
+      for (lua_State* state : it->second)
+      {
+        const auto error = luaL_loadbuffer(
+            state,
+            script->bytecode.data(),
+            script->bytecode.size(),
+            chunkname.c_str());
+
+        if (LUA_OK != error || LUA_OK != lua_pcall(state, 0, 0, 0))
+        {
+          ODE_ERROR(
+              "The script '{}' can't be reloaded: {}",
+              script->filename,
+              lua_tostring(state, stack_top));
+          lua_pop(state, 1);
+          continue;
+        }
+
+        reloaded = true;
+      }
+
+      if (reloaded)
+      {
+        ODE_DEBUG("The script '{}' is reloaded", script->filename);
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  void reload_service::start()
+  {
+    if (!worker.joinable())
+    {
+      running = true;
+      worker = std::thread{&reload_service::run, this};
+    }
+  }
+
+  void reload_service::run()
+  {
+    ODE_DEBUG("Starting the script-reloading worker");
+
+    filesystem::file_watcher watcher{};
+    std::unordered_map<std::string, std::size_t> hashes{};
+
+    const std::chrono::milliseconds interval{reload_poll_interval};
+
+    while (running)
+    {
+      std::vector<std::string> changed{};
+
+      while (auto root = roots.try_pop())
+      {
+        watcher.add_directory(*root);
+      }
+
+      while (auto script = requests.try_pop())
+      {
+        if (watcher.add(script->filename))
+        {
+          // The script may have changed before the watcher started to watch
+          // it, so it's compared against the tracked contents right away.
+          hashes[script->filename] = script->hash;
+          changed.push_back(std::move(script->filename));
+        }
+      }
+
+      auto polled = watcher.poll(interval);
+      std::move(polled.begin(), polled.end(), std::back_inserter(changed));
+
+      for (const auto& filename : changed)
+      {
+        // The other files in the watched directories are only reloaded if
+        // they are Lua scripts.
+        if (0 == hashes.count(filename) &&
+            ".lua" != std::filesystem::path{filename}.extension())
+        {
+          continue;
+        }
+
+        const auto source = detail::read_script(filename);
+
+        if (!source)
+        {
+          continue;
+        }
+
+        const auto hash = std::hash<std::string>{}(*source);
+
+        if (hashes[filename] == hash)
+        {
+          ODE_TRACE("The script '{}' is unchanged", filename);
+          continue;
+        }
+
+        hashes[filename] = hash;
+
+        if (auto bytecode = detail::compile_script(filename, *source))
+        {
+          compiled.push({filename, std::move(*bytecode)});
+        }
+      }
+    }
+
+    ODE_DEBUG("Stopping the script-reloading worker");
+  }
+
+} // namespace ode::lua
@@ -7,12 +7,26 @@
 
 #include "ode/lua/script.h"
 
+#include <cstddef>
+
 #include "gsl/assert"
 
 #include "ode/logger.h"
+#include "ode/lua/state.h"
 
 namespace ode::lua
 {
+  namespace detail
+  {
+    static int write_bytecode(
+        lua_State* state, const void* p, std::size_t size, void* data)
+    {
+      static_cast<std::string*>(data)->append(
+          static_cast<const char*>(p), size);
+      return 0;
+    }
+  } // namespace detail
+
   int load_script_file(const state_ptr_t state, std::string_view filename)
       ODE_CONTRACT_NOEXCEPT
   {
@@ -36,4 +50,100 @@ namespace ode::lua
 
     return load_error;
   }
+
+  result<void> try_load_script_file(
+      const state_ptr_t state, std::string_view filename)
+  {
+    const int top = lua_gettop(state);
+
+    lua_pushcfunction(state, message_handler);
+
+    auto status = luaL_loadfile(state, filename.data());
+
+    if (LUA_OK == status)
+    {
+      status = lua_pcall(state, 0, 0, top + 1);
+    }
+
+    if (LUA_OK != status)
+    {
+      auto e = make_error(state, status);
+      lua_settop(state, top);
+
+      ODE_TRACE(
+          "The script '{}' failed with code {}: {}",
+          filename.data(),
+          e.code,
+          e.message);
+
+      return e;
+    }
+
+    lua_settop(state, top);
+
+    return {};
+  }
+
+  result<std::string> compile_script_file(std::string_view filename)
+  {
+    auto state = make_state();
+
+    // The string view may not be terminated, and the Lua API needs a C
+    // string.
+    const std::string name{filename};
+    const auto status = luaL_loadfile(state.get(), name.c_str());
+
+    if (LUA_OK != status)
+    {
+      auto e = make_error(state.get(), status);
+
+      ODE_TRACE(
+          "The script '{}' can't be compiled with code {}: {}",
+          name,
+          e.code,
+          e.message);
+
+      return e;
+    }
+
+    std::string bytecode{};
+    lua_dump(state.get(), detail::write_bytecode, &bytecode, 0);
+
+    return bytecode;
+  }
+
+  result<void> try_load_bytecode(
+      const state_ptr_t state,
+      std::string_view bytecode,
+      std::string_view chunkname)
+  {
+    const int top = lua_gettop(state);
+    const std::string name{chunkname};
+
+    lua_pushcfunction(state, message_handler);
+
+    auto status = luaL_loadbufferx(
+        state, bytecode.data(), bytecode.size(), name.c_str(), "b");
+
+    if (LUA_OK == status)
+    {
+      status = lua_pcall(state, 0, 0, top + 1);
+    }
+
+    if (LUA_OK != status)
+    {
+      auto e = make_error(state, status);
+      lua_settop(state, top);
+
+      ODE_TRACE(
+          "The chunk '{}' failed with code {}: {}", name, e.code, e.message);
+
+      return e;
+    }
+
+    lua_settop(state, top);
+
+    return {};
+  }
+
 } // namespace ode::lua
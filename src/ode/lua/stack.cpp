@@ -7,10 +7,13 @@
 
 #include "ode/lua/stack.h"
 
+#include <algorithm>
+
 #include "gsl/assert"
 
 #include "ode/logger.h"
 #include "ode/lua/lua_config.h"
+#include "ode/lua/state.h"
 
 namespace ode::lua
 {
@@ -63,4 +66,84 @@ namespace ode::lua
 
     return true;
   }
+
+  namespace detail
+  {
+    ///
+    /// Looks up the dotted path given as the first argument. The function
+    /// is run through \c lua_pcall, so the errors raised by the \c __index
+    /// metamethods on the path are caught instead of reaching the panic
+    /// handler. It doesn't create any C++ objects, as an error unwinds past
+    /// it.
+    ///
+    /// \param state the Lua state.
+    ///
+    /// \return The number of the values returned to Lua, which are a
+    /// boolean that tells whether the variable was found and the variable.
+    ///
+    static int look_up_path(lua_State* state)
+    {
+      std::size_t size = 0;
+      const char* path = lua_tolstring(state, 1, &size);
+      const char* end = path + size;
+
+      lua_pushglobaltable(state);
+
+      for (const char* begin = path;; ++begin)
+      {
+        const char* dot = std::find(begin, end, '.');
+
+        if (1 != lua_istable(state, stack_top))
+        {
+          lua_pushboolean(state, 0);
+          lua_pushnil(state);
+          return 2;
+        }
+
+        lua_pushlstring(state, begin, static_cast<std::size_t>(dot - begin));
+        lua_gettable(state, -2);
+        lua_remove(state, -2);
+
+        if (1 == lua_isnil(state, stack_top) || end == dot)
+        {
+          lua_pushboolean(state, 0 == lua_isnil(state, stack_top));
+          lua_insert(state, -2);
+          return 2;
+        }
+
+        begin = dot;
+      }
+    }
+  } // namespace detail
+
+  result<void> try_to_stack(const state_ptr_t state, std::string_view var)
+  {
+    const int top = lua_gettop(state);
+    const int handler = top + 1;
+
+    lua_pushcfunction(state, message_handler);
+    lua_pushcfunction(state, detail::look_up_path);
+    lua_pushlstring(state, var.data(), var.size());
+
+    const auto call_error = lua_pcall(state, 1, 2, handler);
+
+    if (LUA_OK != call_error)
+    {
+      auto e = make_error(state, call_error);
+      lua_settop(state, top);
+      return e;
+    }
+
+    if (0 == lua_toboolean(state, -2))
+    {
+      lua_settop(state, top);
+      return error{LUA_ERRRUN, "'" + std::string{var} + "' is not defined"};
+    }
+
+    // The variable replaces the message handler.
+    lua_copy(state, stack_top, handler);
+    lua_settop(state, handler);
+
+    return {};
+  }
 } // namespace ode::lua
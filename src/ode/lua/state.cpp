@@ -7,6 +7,8 @@
 
 #include "ode/lua/state.h"
 
+#include "ode/lua/lua_config.h"
+
 namespace ode::lua
 {
   state_t make_state() noexcept
@@ -19,4 +21,24 @@ namespace ode::lua
     lua_pop(state, lua_gettop(state));
   }
 
+  int message_handler(lua_State* state)
+  {
+    const char* message = lua_tostring(state, 1);
+
+    if (nullptr == message)
+    {
+      message = "(an error object that is not a string)";
+    }
+
+    luaL_traceback(state, state, message, 1);
+
+    return 1;
+  }
+
+  error make_error(const state_ptr_t state, const int code)
+  {
+    const char* message = lua_tostring(state, stack_top);
+    return error{code, nullptr == message ? "(no error message)" : message};
+  }
+
 } // namespace ode::lua
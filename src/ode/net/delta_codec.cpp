@@ -0,0 +1,314 @@
+/// The definitions of the types which encode the changes between two
+/// replication frames into bit-packed deltas and decode them back.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/net/delta_codec.h"
+
+#include "gsl/assert"
+
+#include "ode/net/bit_stream.h"
+
+namespace ode::net
+{
+  namespace detail
+  {
+    ///
+    /// Gives the mask of the fields that differ between the given values.
+    ///
+    /// \param old_values a pointer to the values in the baseline.
+    /// \param new_values a pointer to the values in the current frame.
+    /// \param count the number of the fields.
+    ///
+    /// \return The mask in which the lowest bit is the first field.
+    ///
+    static std::uint32_t changed_fields(
+        const std::uint32_t* old_values,
+        const std::uint32_t* new_values,
+        const std::size_t count) noexcept
+    {
+      std::uint32_t mask = 0;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        mask |= static_cast<std::uint32_t>(old_values[i] != new_values[i])
+            << i;
+      }
+
+      return mask;
+    }
+  } // namespace detail
+
+  void delta_encoder::encode(
+      const replication_frame& baseline,
+      const replication_frame& current,
+      std::vector<std::uint8_t>& out)
+  {
+    const auto& schema = current.get_schema();
+
+    Expects(
+        schema.get_component_count() ==
+        baseline.get_schema().get_component_count());
+
+    bit_writer writer{out};
+
+    for (std::size_t c = 0; c < schema.get_component_count(); ++c)
+    {
+      const auto& fields = schema.get_fields(c);
+      const auto field_count = static_cast<int>(fields.size());
+      const auto& old_entities = baseline.get_entities(c);
+      const auto& new_entities = current.get_entities(c);
+
+      removed.clear();
+      added.clear();
+      kept.clear();
+
+      std::size_t i = 0;
+      std::size_t j = 0;
+
+      while (i < old_entities.size() || j < new_entities.size())
+      {
+        if (j == new_entities.size() ||
+            (i < old_entities.size() && old_entities[i] < new_entities[j]))
+        {
+          removed.push_back(i++);
+        }
+        else if (
+            i == old_entities.size() || new_entities[j] < old_entities[i])
+        {
+          added.push_back(j++);
+        }
+        else
+        {
+          kept.emplace_back(i++, j++);
+        }
+      }
+
+      // The indices and the identifiers are written as the gaps from the
+      // previous ones, which are small when the entities are dense.
+      writer.write_varint(static_cast<std::uint32_t>(removed.size()));
+
+      std::size_t next_index = 0;
+
+      for (const auto r : removed)
+      {
+        writer.write_varint(static_cast<std::uint32_t>(r - next_index));
+        next_index = r + 1;
+      }
+
+      writer.write_varint(static_cast<std::uint32_t>(added.size()));
+
+      std::uint32_t next_entity = 0;
+
+      for (const auto a : added)
+      {
+        const auto* values = current.get_values(c, a);
+
+        writer.write_varint(new_entities[a] - next_entity);
+        next_entity = new_entities[a] + 1;
+
+        for (int f = 0; f < field_count; ++f)
+        {
+          writer.write(values[f], fields[f].bits);
+        }
+      }
+
+      std::uint32_t skipped = 0;
+
+      for (const auto& [old_index, new_index] : kept)
+      {
+        const auto* old_values = baseline.get_values(c, old_index);
+        const auto* new_values = current.get_values(c, new_index);
+        const auto mask =
+            detail::changed_fields(old_values, new_values, fields.size());
+
+        if (0 == mask)
+        {
+          ++skipped;
+          continue;
+        }
+
+        writer.write_varint(skipped);
+        writer.write(mask, field_count);
+        skipped = 0;
+
+        for (int f = 0; f < field_count; ++f)
+        {
+          if (0 != (mask & (std::uint32_t{1} << f)))
+          {
+            // The difference wraps around, so it is exact for the fields
+            // of 32 bits too.
+            writer.write_varint(zigzag_encode(
+                static_cast<std::int32_t>(new_values[f] - old_values[f])));
+          }
+        }
+      }
+
+      // The decoder stops when the skipped entities reach the end, so the
+      // last run is written only if the last entity didn't change.
+      if (0 < skipped)
+      {
+        writer.write_varint(skipped);
+      }
+    }
+  }
+
+  bool delta_decoder::decode(
+      const replication_frame& baseline,
+      const std::uint8_t* data,
+      const std::size_t size,
+      replication_frame& out)
+  {
+    Expects(&baseline != &out);
+
+    const auto& schema = out.get_schema();
+
+    Expects(
+        schema.get_component_count() ==
+        baseline.get_schema().get_component_count());
+
+    bit_reader reader{data, size};
+
+    out.clear();
+
+    for (std::size_t c = 0; c < schema.get_component_count(); ++c)
+    {
+      const auto& fields = schema.get_fields(c);
+      const auto field_count = fields.size();
+      const auto& old_entities = baseline.get_entities(c);
+
+      removed.assign(old_entities.size(), false);
+
+      const std::size_t removed_count = reader.read_varint();
+
+      if (removed_count > old_entities.size())
+      {
+        return false;
+      }
+
+      std::size_t next_index = 0;
+
+      for (std::size_t k = 0; k < removed_count; ++k)
+      {
+        const auto index = next_index + reader.read_varint();
+
+        if (index >= old_entities.size())
+        {
+          return false;
+        }
+
+        removed[index] = true;
+        next_index = index + 1;
+      }
+
+      const std::size_t added_count = reader.read_varint();
+
+      // Each added entity takes at least a bit for each field, which bounds
+      // the count before anything is allocated.
+      if (added_count * (1 + field_count) > size * 8)
+      {
+        return false;
+      }
+
+      added_entities.clear();
+      added_values.clear();
+
+      std::uint64_t next_entity = 0;
+
+      for (std::size_t k = 0; k < added_count; ++k)
+      {
+        const auto entity = next_entity + reader.read_varint();
+
+        if (entity > ~std::uint32_t{0})
+        {
+          return false;
+        }
+
+        added_entities.push_back(static_cast<std::uint32_t>(entity));
+        next_entity = entity + 1;
+
+        for (const auto& f : fields)
+        {
+          added_values.push_back(reader.read(f.bits));
+        }
+      }
+
+      kept_entities.clear();
+      kept_values.clear();
+
+      for (std::size_t i = 0; i < old_entities.size(); ++i)
+      {
+        if (!removed[i])
+        {
+          const auto* values = baseline.get_values(c, i);
+
+          kept_entities.push_back(old_entities[i]);
+          kept_values.insert(kept_values.end(), values, values + field_count);
+        }
+      }
+
+      std::size_t index = 0;
+
+      while (index < kept_entities.size())
+      {
+        index += reader.read_varint();
+
+        if (index >= kept_entities.size())
+        {
+          break;
+        }
+
+        const auto mask = reader.read(static_cast<int>(field_count));
+        auto* values = kept_values.data() + index * field_count;
+
+        for (std::size_t f = 0; f < field_count; ++f)
+        {
+          if (0 != (mask & (std::uint32_t{1} << f)))
+          {
+            values[f] += static_cast<std::uint32_t>(
+                zigzag_decode(reader.read_varint()));
+          }
+        }
+
+        ++index;
+      }
+
+      if (!reader.is_ok() || index > kept_entities.size())
+      {
+        return false;
+      }
+
+      std::size_t i = 0;
+      std::size_t j = 0;
+
+      while (i < kept_entities.size() || j < added_entities.size())
+      {
+        if (j == added_entities.size() ||
+            (i < kept_entities.size() && kept_entities[i] < added_entities[j]))
+        {
+          out.add_quantized(
+              c, kept_entities[i], kept_values.data() + i * field_count);
+          ++i;
+        }
+        else if (
+            i == kept_entities.size() || added_entities[j] < kept_entities[i])
+        {
+          out.add_quantized(
+              c, added_entities[j], added_values.data() + j * field_count);
+          ++j;
+        }
+        else
+        {
+          // An entity can't both keep and gain the component.
+          return false;
+        }
+      }
+    }
+
+    return reader.is_ok();
+  }
+
+} // namespace ode::net
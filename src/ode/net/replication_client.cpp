@@ -0,0 +1,264 @@
+/// The definition of the client which receives the replicated state from a
+/// local server.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/net/replication_client.h"
+
+#if __linux__
+#  include <poll.h>
+#  include <sys/socket.h>
+#  include <sys/un.h>
+#  include <unistd.h>
+#endif // __linux__
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "ode/framework/binary_stream.h"
+#include "ode/logger.h"
+
+namespace ode::net
+{
+  namespace detail
+  {
+    ///
+    /// The number of the bytes that are read from the socket at once.
+    ///
+    constexpr std::size_t client_chunk_size = 1 << 16;
+  } // namespace detail
+
+  replication_client::replication_client(
+      const std::string& socket_path, const replication_schema& client_schema)
+      : fd{-1},
+        frame{client_schema},
+        next{client_schema},
+        empty{client_schema},
+        decoder{},
+        incoming{},
+        chunk(detail::client_chunk_size),
+        frame_number{0},
+        bytes_received{0},
+        synced{false}
+  {
+#if __linux__
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path))
+    {
+      ODE_ERROR(
+          "The path of the replication socket '{}' is invalid", socket_path);
+      throw std::runtime_error{"The path of the replication socket is invalid"};
+    }
+
+    std::copy(socket_path.begin(), socket_path.end(), address.sun_path);
+
+    fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (0 > fd ||
+        0 > ::connect(
+                fd,
+                reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)))
+    {
+      const std::string reason{std::strerror(errno)};
+
+      close();
+
+      ODE_ERROR(
+          "The replication client can't connect to '{}': {}",
+          socket_path,
+          reason);
+      throw std::runtime_error{"The replication client can't connect"};
+    }
+
+#else
+
+    ODE_ERROR("The replication client isn't supported on this system");
+    throw std::runtime_error{"The replication client requires Linux"};
+
+#endif // __linux__
+  }
+
+  replication_client::~replication_client()
+  {
+    close();
+  }
+
+  bool replication_client::wait(const std::chrono::milliseconds timeout)
+  {
+#if __linux__
+
+    if (0 > fd)
+    {
+      return false;
+    }
+
+    pollfd p{fd, POLLIN, 0};
+
+    return 0 < ::poll(&p, 1, static_cast<int>(timeout.count()));
+
+#else
+
+    return false;
+
+#endif // __linux__
+  }
+
+  std::size_t replication_client::receive()
+  {
+#if __linux__
+
+    while (0 <= fd)
+    {
+      const auto received =
+          ::recv(fd, chunk.data(), chunk.size(), MSG_DONTWAIT);
+
+      if (0 < received)
+      {
+        incoming.insert(
+            incoming.end(), chunk.begin(), chunk.begin() + received);
+        bytes_received += static_cast<std::uint64_t>(received);
+        continue;
+      }
+
+      if (0 > received && EINTR == errno)
+      {
+        continue;
+      }
+
+      if (0 > received && (EAGAIN == errno || EWOULDBLOCK == errno))
+      {
+        break;
+      }
+
+      ODE_DEBUG("The replication server closed the connection");
+      close();
+    }
+
+#endif // __linux__
+
+    std::size_t applied = 0;
+    std::size_t consumed = 0;
+
+    while (replication_header_size <= incoming.size() - consumed)
+    {
+      binary_reader header{
+          incoming.data() + consumed, replication_header_size};
+
+      const auto size = header.read<std::uint32_t>();
+      const auto number = header.read<std::uint32_t>();
+      const auto kind = header.read<replication_message>();
+
+      if (replication_max_message_size < size)
+      {
+        ODE_ERROR("The replication server sent a message that is too large");
+        close();
+        consumed = incoming.size();
+        break;
+      }
+
+      if (replication_header_size + size > incoming.size() - consumed)
+      {
+        break;
+      }
+
+      if (apply(
+              kind,
+              number,
+              incoming.data() + consumed + replication_header_size,
+              size))
+      {
+        ++applied;
+      }
+
+      consumed += replication_header_size + size;
+    }
+
+    incoming.erase(
+        incoming.begin(),
+        incoming.begin() + static_cast<std::ptrdiff_t>(consumed));
+
+    return applied;
+  }
+
+  bool replication_client::is_connected() const noexcept
+  {
+    return 0 <= fd;
+  }
+
+  const replication_frame& replication_client::get_frame() const noexcept
+  {
+    return frame;
+  }
+
+  std::uint32_t replication_client::get_frame_number() const noexcept
+  {
+    return frame_number;
+  }
+
+  std::uint64_t replication_client::get_bytes_received() const noexcept
+  {
+    return bytes_received;
+  }
+
+  bool replication_client::apply(
+      const replication_message kind,
+      const std::uint32_t number,
+      const std::uint8_t* data,
+      const std::size_t size)
+  {
+    bool decoded = false;
+
+    if (replication_message::keyframe == kind)
+    {
+      decoded = decoder.decode(empty, data, size, next);
+    }
+    else if (
+        replication_message::delta == kind && synced &&
+        frame_number + 1 == number)
+    {
+      decoded = decoder.decode(frame, data, size, next);
+    }
+    else
+    {
+      // The deltas are skipped until the server sends a full frame.
+      return false;
+    }
+
+    if (!decoded)
+    {
+      ODE_WARN("The replicated frame {} is invalid", number);
+      synced = false;
+      return false;
+    }
+
+    std::swap(frame, next);
+    frame_number = number;
+    synced = true;
+
+    return true;
+  }
+
+  void replication_client::close() noexcept
+  {
+#if __linux__
+
+    if (0 <= fd)
+    {
+      ::close(fd);
+      fd = -1;
+    }
+
+#endif // __linux__
+  }
+
+} // namespace ode::net
@@ -0,0 +1,165 @@
+/// The definitions of the types which describe the replicated components
+/// and hold the quantized values of the components in a single frame.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/net/replication_frame.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "gsl/assert"
+
+namespace ode::net
+{
+  namespace detail
+  {
+    static double quantization_steps(const replicated_field& field)
+    {
+      return static_cast<double>(
+          32 == field.bits ? ~std::uint32_t{0}
+                           : (std::uint32_t{1} << field.bits) - 1);
+    }
+  } // namespace detail
+
+  std::uint32_t quantize(const float value, const replicated_field& field)
+  {
+    const auto t = (static_cast<double>(value) - field.min) /
+        (static_cast<double>(field.max) - field.min);
+
+    // The comparison also maps a NaN to the smallest value.
+    const auto clamped = 0.0 < t ? std::min(t, 1.0) : 0.0;
+
+    return static_cast<std::uint32_t>(
+        std::llround(clamped * detail::quantization_steps(field)));
+  }
+
+  float dequantize(const std::uint32_t value, const replicated_field& field)
+  {
+    const auto t = static_cast<double>(value) /
+        detail::quantization_steps(field);
+
+    return static_cast<float>(
+        field.min + t * (static_cast<double>(field.max) - field.min));
+  }
+
+  std::size_t replication_schema::add_component(
+      std::vector<replicated_field> fields)
+  {
+    Expects(!fields.empty() && 32 >= fields.size());
+
+    for (const auto& f : fields)
+    {
+      Expects(f.min < f.max && 1 <= f.bits && 32 >= f.bits);
+    }
+
+    components.push_back(std::move(fields));
+
+    return components.size() - 1;
+  }
+
+  std::size_t replication_schema::get_component_count() const noexcept
+  {
+    return components.size();
+  }
+
+  const std::vector<replicated_field>& replication_schema::get_fields(
+      const std::size_t component) const
+  {
+    Expects(component < components.size());
+    return components[component];
+  }
+
+  replication_frame::replication_frame(const replication_schema& frame_schema)
+      : schema{&frame_schema},
+        components(frame_schema.get_component_count())
+  {
+  }
+
+  void replication_frame::clear() noexcept
+  {
+    for (auto& c : components)
+    {
+      c.entities.clear();
+      c.values.clear();
+    }
+  }
+
+  void replication_frame::add(
+      const std::size_t component,
+      const std::uint32_t entity,
+      const float* values)
+  {
+    Expects(component < components.size());
+
+    const auto& fields = schema->get_fields(component);
+    auto& table = components[component];
+
+    Expects(table.entities.empty() || table.entities.back() < entity);
+
+    table.entities.push_back(entity);
+
+    for (std::size_t i = 0; i < fields.size(); ++i)
+    {
+      table.values.push_back(quantize(values[i], fields[i]));
+    }
+  }
+
+  void replication_frame::add_quantized(
+      const std::size_t component,
+      const std::uint32_t entity,
+      const std::uint32_t* values)
+  {
+    Expects(component < components.size());
+
+    const auto field_count = schema->get_fields(component).size();
+    auto& table = components[component];
+
+    Expects(table.entities.empty() || table.entities.back() < entity);
+
+    table.entities.push_back(entity);
+    table.values.insert(table.values.end(), values, values + field_count);
+  }
+
+  const replication_schema& replication_frame::get_schema() const noexcept
+  {
+    return *schema;
+  }
+
+  const std::vector<std::uint32_t>& replication_frame::get_entities(
+      const std::size_t component) const
+  {
+    Expects(component < components.size());
+    return components[component].entities;
+  }
+
+  const std::uint32_t* replication_frame::get_values(
+      const std::size_t component, const std::size_t index) const
+  {
+    Expects(component < components.size());
+
+    const auto field_count = schema->get_fields(component).size();
+    const auto& table = components[component];
+
+    Expects(index < table.entities.size());
+
+    return table.values.data() + index * field_count;
+  }
+
+  float replication_frame::get_value(
+      const std::size_t component,
+      const std::size_t index,
+      const std::size_t field) const
+  {
+    const auto& fields = schema->get_fields(component);
+
+    Expects(field < fields.size());
+
+    return dequantize(get_values(component, index)[field], fields[field]);
+  }
+
+} // namespace ode::net
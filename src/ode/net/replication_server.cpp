@@ -0,0 +1,547 @@
+/// The definition of the server which sends the replicated state to local
+/// subscribers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/net/replication_server.h"
+
+#if __linux__
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <sys/socket.h>
+#  include <sys/un.h>
+#  include <unistd.h>
+#endif // __linux__
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include "ode/framework/binary_stream.h"
+#include "ode/logger.h"
+
+namespace ode::net
+{
+  namespace detail
+  {
+#if __linux__
+
+    ///
+    /// Changes the events for which the given \c epoll instance watches a
+    /// file descriptor.
+    ///
+    /// \param epoll_fd the \c epoll instance.
+    /// \param operation the operation of \c epoll_ctl.
+    /// \param fd the file descriptor.
+    /// \param events the events.
+    ///
+    /// \return \c true if the events were changed, otherwise \c false.
+    ///
+    static bool control_epoll(
+        const int epoll_fd,
+        const int operation,
+        const int fd,
+        const std::uint32_t events) noexcept
+    {
+      epoll_event event{};
+      event.events = events;
+      event.data.fd = fd;
+
+      return 0 == ::epoll_ctl(epoll_fd, operation, fd, &event);
+    }
+
+    ///
+    /// Wakes the thread that waits on the given event.
+    ///
+    /// \param fd the event.
+    ///
+    static void signal_event(const int fd) noexcept
+    {
+      const std::uint64_t value = 1;
+
+      // The write only fails if the counter would overflow, in which case
+      // the thread is woken anyway.
+      [[maybe_unused]] const auto written = ::write(fd, &value, sizeof(value));
+    }
+
+    ///
+    /// The events for which the sockets of the subscribers are watched when
+    /// nothing waits to be written.
+    ///
+    constexpr std::uint32_t subscriber_events = EPOLLIN | EPOLLRDHUP;
+
+#endif // __linux__
+  } // namespace detail
+
+  replication_server::replication_server(
+      const std::string& socket_path, const replication_schema& server_schema)
+      : path{socket_path},
+        previous{server_schema},
+        empty{server_schema},
+        encoder{},
+        frame_number{0},
+        listen_fd{-1},
+        epoll_fd{-1},
+        wake_fd{-1},
+        mutex{},
+        outbox{},
+        subscribers{},
+        waiting{0},
+        subscriber_count{0},
+        bytes_sent{0},
+        running{true},
+        thread{}
+  {
+#if __linux__
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    if (path.empty() || path.size() >= sizeof(address.sun_path))
+    {
+      ODE_ERROR("The path of the replication socket '{}' is invalid", path);
+      throw std::runtime_error{"The path of the replication socket is invalid"};
+    }
+
+    std::copy(path.begin(), path.end(), address.sun_path);
+
+    // A socket left behind by a server that crashed would make the binding
+    // fail.
+    std::error_code error{};
+
+    if (std::filesystem::is_socket(path, error))
+    {
+      std::filesystem::remove(path, error);
+    }
+
+    listen_fd =
+        ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    wake_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (0 > listen_fd || 0 > epoll_fd || 0 > wake_fd ||
+        0 > ::bind(
+                listen_fd,
+                reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)) ||
+        0 > ::listen(listen_fd, SOMAXCONN) ||
+        !detail::control_epoll(epoll_fd, EPOLL_CTL_ADD, listen_fd, EPOLLIN) ||
+        !detail::control_epoll(epoll_fd, EPOLL_CTL_ADD, wake_fd, EPOLLIN))
+    {
+      const std::string reason{std::strerror(errno)};
+
+      close_sockets();
+      std::filesystem::remove(path, error);
+
+      ODE_ERROR(
+          "The replication socket '{}' can't be created: {}", path, reason);
+      throw std::runtime_error{"The replication socket can't be created"};
+    }
+
+    thread = std::thread{[this] { run(); }};
+
+    ODE_DEBUG("Replicating the state on '{}'", path);
+
+#else
+
+    ODE_ERROR("The replication server isn't supported on this system");
+    throw std::runtime_error{"The replication server requires Linux"};
+
+#endif // __linux__
+  }
+
+  replication_server::~replication_server()
+  {
+#if __linux__
+
+    running = false;
+    detail::signal_event(wake_fd);
+    thread.join();
+
+    for (const auto& s : subscribers)
+    {
+      ::close(s.first);
+    }
+
+    close_sockets();
+
+    std::error_code error{};
+    std::filesystem::remove(path, error);
+
+#endif // __linux__
+  }
+
+  void replication_server::publish(const replication_frame& frame)
+  {
+    ++frame_number;
+
+    // The deltas are only needed by the subscribers that have the previous
+    // frame, and the ones that connect later are sent a full frame.
+    if (0 == subscriber_count.load())
+    {
+      previous = frame;
+      return;
+    }
+
+    outgoing_frame message{
+        make_message(replication_message::delta, previous, frame), nullptr};
+
+    if (0 < waiting.load())
+    {
+      message.keyframe =
+          make_message(replication_message::keyframe, empty, frame);
+    }
+
+    previous = frame;
+
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      outbox.push_back(std::move(message));
+    }
+
+#if __linux__
+    detail::signal_event(wake_fd);
+#endif // __linux__
+  }
+
+  std::size_t replication_server::get_subscriber_count() const noexcept
+  {
+    return subscriber_count.load();
+  }
+
+  std::uint64_t replication_server::get_bytes_sent() const noexcept
+  {
+    return bytes_sent.load();
+  }
+
+  std::uint32_t replication_server::get_frame_number() const noexcept
+  {
+    return frame_number;
+  }
+
+  std::shared_ptr<const std::vector<std::uint8_t>>
+  replication_server::make_message(
+      const replication_message kind,
+      const replication_frame& baseline,
+      const replication_frame& frame)
+  {
+    auto message = std::make_shared<std::vector<std::uint8_t>>();
+
+    // The size of the data is written after the data.
+    {
+      binary_writer writer{*message};
+      writer.write(std::uint32_t{0});
+      writer.write(frame_number);
+      writer.write(kind);
+    }
+
+    encoder.encode(baseline, frame, *message);
+
+    const auto size =
+        static_cast<std::uint32_t>(message->size() - replication_header_size);
+    ode::detail::copy_little_endian<std::uint32_t>(message->data(), &size, 1);
+
+    return message;
+  }
+
+  void replication_server::run()
+  {
+#if __linux__
+
+    std::array<epoll_event, 64> events{};
+    std::vector<outgoing_frame> frames{};
+
+    while (running.load())
+    {
+      const auto count = ::epoll_wait(
+          epoll_fd, events.data(), static_cast<int>(events.size()), -1);
+
+      if (0 > count)
+      {
+        if (EINTR == errno)
+        {
+          continue;
+        }
+
+        ODE_ERROR(
+            "The replication server can't wait for the sockets: {}",
+            std::strerror(errno));
+        return;
+      }
+
+      for (int i = 0; i < count; ++i)
+      {
+        const auto fd = events[i].data.fd;
+        const auto flags = events[i].events;
+
+        if (wake_fd == fd)
+        {
+          std::uint64_t value = 0;
+          [[maybe_unused]] const auto read = ::read(fd, &value, sizeof(value));
+
+          {
+            std::lock_guard<std::mutex> lock{mutex};
+            frames.swap(outbox);
+          }
+
+          for (const auto& f : frames)
+          {
+            queue(f);
+          }
+
+          frames.clear();
+        }
+        else if (listen_fd == fd)
+        {
+          accept_subscribers();
+        }
+        else
+        {
+          const auto found = subscribers.find(fd);
+
+          if (subscribers.end() == found)
+          {
+            continue;
+          }
+
+          if (0 != (flags & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)))
+          {
+            disconnect(fd);
+            continue;
+          }
+
+          if (0 != (flags & EPOLLIN))
+          {
+            // The subscribers don't send anything, so the data is only
+            // read to notice when they disconnect.
+            std::array<std::uint8_t, 256> discarded{};
+            const auto received =
+                ::recv(fd, discarded.data(), discarded.size(), 0);
+
+            if (0 == received ||
+                (0 > received && EAGAIN != errno && EWOULDBLOCK != errno))
+            {
+              disconnect(fd);
+              continue;
+            }
+          }
+
+          if (0 != (flags & EPOLLOUT))
+          {
+            flush(fd, found->second);
+          }
+        }
+      }
+    }
+
+#endif // __linux__
+  }
+
+  void replication_server::accept_subscribers()
+  {
+#if __linux__
+
+    while (true)
+    {
+      const auto fd =
+          ::accept4(listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+      if (0 > fd)
+      {
+        if (EAGAIN != errno && EWOULDBLOCK != errno)
+        {
+          ODE_WARN(
+              "A subscriber of '{}' can't be accepted: {}",
+              path,
+              std::strerror(errno));
+        }
+
+        return;
+      }
+
+      if (!detail::control_epoll(
+              epoll_fd, EPOLL_CTL_ADD, fd, detail::subscriber_events))
+      {
+        ODE_WARN(
+            "A subscriber of '{}' can't be watched: {}",
+            path,
+            std::strerror(errno));
+        ::close(fd);
+        continue;
+      }
+
+      subscribers.emplace(fd, subscriber{{}, 0, false, false});
+      ++waiting;
+      ++subscriber_count;
+
+      ODE_DEBUG("A subscriber connected to '{}'", path);
+    }
+
+#endif // __linux__
+  }
+
+  void replication_server::queue(const outgoing_frame& frame)
+  {
+    for (auto i = subscribers.begin(); subscribers.end() != i;)
+    {
+      // The subscriber may be disconnected while it is flushed.
+      const auto fd = i->first;
+      auto& s = i->second;
+      ++i;
+
+      const auto backlog = s.pending.size() - s.sent;
+      const std::vector<std::uint8_t>* message = nullptr;
+
+      if (s.synced && replication_max_pending_bytes < backlog)
+      {
+        ODE_DEBUG("A subscriber of '{}' fell behind", path);
+        s.synced = false;
+        ++waiting;
+      }
+
+      if (s.synced)
+      {
+        message = frame.delta.get();
+      }
+      else if (frame.keyframe && replication_max_pending_bytes >= backlog)
+      {
+        message = frame.keyframe.get();
+        s.synced = true;
+        --waiting;
+      }
+
+      if (!message)
+      {
+        continue;
+      }
+
+      if (0 < s.sent)
+      {
+        s.pending.erase(
+            s.pending.begin(),
+            s.pending.begin() + static_cast<std::ptrdiff_t>(s.sent));
+        s.sent = 0;
+      }
+
+      s.pending.insert(s.pending.end(), message->begin(), message->end());
+
+      // A subscriber whose socket is full is flushed when it can be
+      // written again.
+      if (!s.writing)
+      {
+        flush(fd, s);
+      }
+    }
+  }
+
+  bool replication_server::flush(const int fd, subscriber& s)
+  {
+#if __linux__
+
+    while (s.sent < s.pending.size())
+    {
+      const auto written = ::send(
+          fd,
+          s.pending.data() + s.sent,
+          s.pending.size() - s.sent,
+          MSG_NOSIGNAL);
+
+      if (0 < written)
+      {
+        s.sent += static_cast<std::size_t>(written);
+        bytes_sent += static_cast<std::uint64_t>(written);
+        continue;
+      }
+
+      if (0 > written && EINTR == errno)
+      {
+        continue;
+      }
+
+      if (0 > written && (EAGAIN == errno || EWOULDBLOCK == errno))
+      {
+        if (!s.writing)
+        {
+          s.writing = detail::control_epoll(
+              epoll_fd,
+              EPOLL_CTL_MOD,
+              fd,
+              detail::subscriber_events | EPOLLOUT);
+        }
+
+        return true;
+      }
+
+      disconnect(fd);
+      return false;
+    }
+
+    s.pending.clear();
+    s.sent = 0;
+
+    if (s.writing)
+    {
+      s.writing = !detail::control_epoll(
+          epoll_fd, EPOLL_CTL_MOD, fd, detail::subscriber_events);
+    }
+
+    return true;
+
+#else
+
+    return false;
+
+#endif // __linux__
+  }
+
+  void replication_server::disconnect(const int fd)
+  {
+#if __linux__
+
+    const auto found = subscribers.find(fd);
+
+    if (subscribers.end() == found)
+    {
+      return;
+    }
+
+    if (!found->second.synced)
+    {
+      --waiting;
+    }
+
+    detail::control_epoll(epoll_fd, EPOLL_CTL_DEL, fd, 0);
+    ::close(fd);
+    subscribers.erase(found);
+    --subscriber_count;
+
+    ODE_DEBUG("A subscriber disconnected from '{}'", path);
+
+#endif // __linux__
+  }
+
+  void replication_server::close_sockets() noexcept
+  {
+#if __linux__
+
+    for (auto* fd : {&listen_fd, &epoll_fd, &wake_fd})
+    {
+      if (0 <= *fd)
+      {
+        ::close(*fd);
+        *fd = -1;
+      }
+    }
+
+#endif // __linux__
+  }
+
+} // namespace ode::net
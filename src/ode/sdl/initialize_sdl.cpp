@@ -18,7 +18,7 @@ namespace ode::sdl
 {
   void initialize()
   {
-    if (0 != SDL_Init(SDL_INIT_VIDEO))
+    if (0 != SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER))
     {
       ODE_ERROR("The Simple DirectMedia Layer initialization failed");
       const std::string error = std::string{SDL_GetError()};
@@ -46,6 +46,11 @@ namespace ode::sdl
     Uint32 flags = SDL_WINDOW_OPENGL;
 #endif // !ODE_MACOS
 
+    if (info.hidden)
+    {
+      flags |= SDL_WINDOW_HIDDEN;
+    }
+
     window_t window = {
         SDL_CreateWindow(
             info.window_name.data(),
@@ -38,6 +38,11 @@ namespace ode::sdl
     /// The initial name of the window.
     ///
     const std::string window_name = "null"s;
+
+    ///
+    /// Whether or not the window is hidden.
+    ///
+    const bool hidden = false;
   };
 
   ///
@@ -0,0 +1,94 @@
+/// The definitions of the utilities for selecting the SIMD instruction sets
+/// at runtime.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/simd.h"
+
+#if ODE_SIMD_X86 && defined(_MSC_VER)
+#  include <immintrin.h>
+#  include <intrin.h>
+#endif // ODE_SIMD_X86 && defined(_MSC_VER)
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// Queries the highest SIMD level from the processor.
+    ///
+    /// \return The SIMD level.
+    ///
+    static simd_level query_simd_level() noexcept
+    {
+#if ODE_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+      __builtin_cpu_init();
+
+      if (__builtin_cpu_supports("avx2"))
+      {
+        return simd_level::avx2;
+      }
+
+      if (__builtin_cpu_supports("sse2"))
+      {
+        return simd_level::sse;
+      }
+#elif ODE_SIMD_X86 && defined(_MSC_VER)
+      int info[4] = {};
+
+      __cpuid(info, 0);
+
+      const int max_leaf = info[0];
+
+      __cpuid(info, 1);
+
+      const bool sse2 = 0 != (info[3] & (1 << 26));
+      const bool osxsave = 0 != (info[2] & (1 << 27));
+      const bool avx = 0 != (info[2] & (1 << 28));
+
+      // The operating system must save the YMM registers on the context
+      // switches before AVX can be used.
+      if (7 <= max_leaf && osxsave && avx && 6 == (_xgetbv(0) & 6))
+      {
+        __cpuidex(info, 7, 0);
+
+        if (0 != (info[1] & (1 << 5)))
+        {
+          return simd_level::avx2;
+        }
+      }
+
+      if (sse2)
+      {
+        return simd_level::sse;
+      }
+#endif // ODE_SIMD_X86
+
+      return simd_level::scalar;
+    }
+  } // namespace detail
+
+  simd_level get_simd_level() noexcept
+  {
+    static const simd_level level = detail::query_simd_level();
+    return level;
+  }
+
+  const char* get_simd_level_name(const simd_level level) noexcept
+  {
+    if (simd_level::avx2 == level)
+    {
+      return "AVX2";
+    }
+    else if (simd_level::sse == level)
+    {
+      return "SSE";
+    }
+
+    return "scalar";
+  }
+
+} // namespace ode
@@ -0,0 +1,95 @@
+/// The definition of the type of the audio devices which play the output of
+/// a mixer through Simple DirectMedia Layer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/audio_device.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "ode/logger.h"
+#include "ode/systems/audio/audio_config.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The audio callback of Simple DirectMedia Layer. It is called on the
+    /// audio thread.
+    ///
+    /// \param userdata a pointer to the mixer.
+    /// \param stream a pointer to the memory of the output samples.
+    /// \param len the size of the memory in bytes.
+    ///
+    static void audio_callback(void* userdata, Uint8* stream, int len)
+    {
+      auto* mixer = static_cast<audio_mixer*>(userdata);
+      const auto frames =
+          static_cast<std::size_t>(len) / (sizeof(float) * audio_channels);
+
+      mixer->mix(reinterpret_cast<float*>(stream), frames);
+    }
+  } // namespace detail
+
+  audio_device::audio_device(audio_mixer& m) : mixer{m}, id{0}, spec{}
+  {
+    if (0 != SDL_InitSubSystem(SDL_INIT_AUDIO))
+    {
+      ODE_ERROR("The Simple DirectMedia Layer audio initialization failed");
+      throw std::runtime_error{
+          std::string{"The Simple DirectMedia Layer audio initialization "
+                      "failed, '"} +
+          SDL_GetError() + "'"};
+    }
+
+    SDL_AudioSpec desired{};
+    desired.freq = audio_sample_rate;
+    desired.format = AUDIO_F32SYS;
+    desired.channels = audio_channels;
+    desired.samples = static_cast<Uint16>(audio_buffer_frames);
+    desired.callback = detail::audio_callback;
+    desired.userdata = &mixer;
+
+    // No changes are allowed, so Simple DirectMedia Layer converts the
+    // output if the hardware uses another format.
+    id = SDL_OpenAudioDevice(nullptr, 0, &desired, &spec, 0);
+
+    if (0 == id)
+    {
+      const std::string error = std::string{SDL_GetError()};
+      ODE_ERROR("The audio device can't be opened, '{}'", error);
+      SDL_QuitSubSystem(SDL_INIT_AUDIO);
+      throw std::runtime_error{
+          std::string{"The audio device can't be opened, '"} + error + "'"};
+    }
+
+    ODE_DEBUG(
+        "Opened the audio device with the driver '{}' at {} Hz",
+        SDL_GetCurrentAudioDriver(),
+        spec.freq);
+
+    SDL_PauseAudioDevice(id, 0);
+  }
+
+  audio_device::~audio_device()
+  {
+    SDL_CloseAudioDevice(id);
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  }
+
+  int audio_device::get_sample_rate() const noexcept
+  {
+    return spec.freq;
+  }
+
+  int audio_device::get_buffer_frames() const noexcept
+  {
+    return spec.samples;
+  }
+
+} // namespace ode
@@ -0,0 +1,574 @@
+/// The definition of the type of the real-time mixers which play the sounds
+/// and the streams.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/audio_mixer.h"
+
+#include <algorithm>
+#include <utility>
+
+#if ODE_SIMD_X86
+#  include <immintrin.h>
+#endif // ODE_SIMD_X86
+
+#include "gsl/assert"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// Adds the given interleaved stereo samples multiplied by the gains of
+    /// the channels to the output.
+    ///
+    /// \param out a pointer to the output samples.
+    /// \param in a pointer to the input samples.
+    /// \param frames the number of the frames.
+    /// \param left the gain of the left channel.
+    /// \param right the gain of the right channel.
+    ///
+    static void accumulate_scalar(
+        float* out,
+        const float* in,
+        const std::size_t frames,
+        const float left,
+        const float right) noexcept
+    {
+      for (std::size_t i = 0; i < frames; ++i)
+      {
+        out[i * 2] += in[i * 2] * left;
+        out[i * 2 + 1] += in[i * 2 + 1] * right;
+      }
+    }
+
+    ///
+    /// Multiplies the given samples by the volume and clamps them to the
+    /// range from -1 to 1.
+    ///
+    /// \param out a pointer to the samples.
+    /// \param count the number of the samples.
+    /// \param volume the volume.
+    ///
+    static void finish_scalar(
+        float* out, const std::size_t count, const float volume) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        out[i] = std::clamp(out[i] * volume, -1.0f, 1.0f);
+      }
+    }
+
+#if ODE_SIMD_X86
+    ///
+    /// Adds the given interleaved stereo samples multiplied by the gains of
+    /// the channels to the output with SSE. Two frames fit in a vector, so
+    /// the gains alternate in the lanes.
+    ///
+    /// \param out a pointer to the output samples.
+    /// \param in a pointer to the input samples.
+    /// \param frames the number of the frames.
+    /// \param left the gain of the left channel.
+    /// \param right the gain of the right channel.
+    ///
+    ODE_TARGET_SSE static void accumulate_sse(
+        float* out,
+        const float* in,
+        const std::size_t frames,
+        const float left,
+        const float right) noexcept
+    {
+      const __m128 gain = _mm_setr_ps(left, right, left, right);
+      const std::size_t count = frames * 2;
+
+      std::size_t i = 0;
+
+      for (; i + 8 <= count; i += 8)
+      {
+        const __m128 a = _mm_loadu_ps(in + i);
+        const __m128 b = _mm_loadu_ps(in + i + 4);
+        _mm_storeu_ps(
+            out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(a, gain)));
+        _mm_storeu_ps(
+            out + i + 4,
+            _mm_add_ps(_mm_loadu_ps(out + i + 4), _mm_mul_ps(b, gain)));
+      }
+
+      accumulate_scalar(out + i, in + i, (count - i) / 2, left, right);
+    }
+
+    ///
+    /// Multiplies the given samples by the volume and clamps them to the
+    /// range from -1 to 1 with SSE.
+    ///
+    /// \param out a pointer to the samples.
+    /// \param count the number of the samples.
+    /// \param volume the volume.
+    ///
+    ODE_TARGET_SSE static void finish_sse(
+        float* out, const std::size_t count, const float volume) noexcept
+    {
+      const __m128 v = _mm_set1_ps(volume);
+      const __m128 low = _mm_set1_ps(-1.0f);
+      const __m128 high = _mm_set1_ps(1.0f);
+
+      std::size_t i = 0;
+
+      for (; i + 4 <= count; i += 4)
+      {
+        const __m128 x = _mm_mul_ps(_mm_loadu_ps(out + i), v);
+        _mm_storeu_ps(out + i, _mm_min_ps(_mm_max_ps(x, low), high));
+      }
+
+      finish_scalar(out + i, count - i, volume);
+    }
+
+    ///
+    /// Adds the given interleaved stereo samples multiplied by the gains of
+    /// the channels to the output with AVX2. Four frames fit in a vector, so
+    /// the gains alternate in the lanes.
+    ///
+    /// \param out a pointer to the output samples.
+    /// \param in a pointer to the input samples.
+    /// \param frames the number of the frames.
+    /// \param left the gain of the left channel.
+    /// \param right the gain of the right channel.
+    ///
+    ODE_TARGET_AVX2 static void accumulate_avx2(
+        float* out,
+        const float* in,
+        const std::size_t frames,
+        const float left,
+        const float right) noexcept
+    {
+      const __m256 gain =
+          _mm256_setr_ps(left, right, left, right, left, right, left, right);
+      const std::size_t count = frames * 2;
+
+      std::size_t i = 0;
+
+      for (; i + 16 <= count; i += 16)
+      {
+        const __m256 a = _mm256_loadu_ps(in + i);
+        const __m256 b = _mm256_loadu_ps(in + i + 8);
+        _mm256_storeu_ps(
+            out + i,
+            _mm256_add_ps(_mm256_loadu_ps(out + i), _mm256_mul_ps(a, gain)));
+        _mm256_storeu_ps(
+            out + i + 8,
+            _mm256_add_ps(
+                _mm256_loadu_ps(out + i + 8), _mm256_mul_ps(b, gain)));
+      }
+
+      accumulate_scalar(out + i, in + i, (count - i) / 2, left, right);
+    }
+
+    ///
+    /// Multiplies the given samples by the volume and clamps them to the
+    /// range from -1 to 1 with AVX2.
+    ///
+    /// \param out a pointer to the samples.
+    /// \param count the number of the samples.
+    /// \param volume the volume.
+    ///
+    ODE_TARGET_AVX2 static void finish_avx2(
+        float* out, const std::size_t count, const float volume) noexcept
+    {
+      const __m256 v = _mm256_set1_ps(volume);
+      const __m256 low = _mm256_set1_ps(-1.0f);
+      const __m256 high = _mm256_set1_ps(1.0f);
+
+      std::size_t i = 0;
+
+      for (; i + 8 <= count; i += 8)
+      {
+        const __m256 x = _mm256_mul_ps(_mm256_loadu_ps(out + i), v);
+        _mm256_storeu_ps(
+            out + i, _mm256_min_ps(_mm256_max_ps(x, low), high));
+      }
+
+      finish_scalar(out + i, count - i, volume);
+    }
+#endif // ODE_SIMD_X86
+
+    ///
+    /// Adds the given samples to the output with the kernel of the given
+    /// SIMD level.
+    ///
+    /// \param level the SIMD level.
+    /// \param out a pointer to the output samples.
+    /// \param in a pointer to the input samples.
+    /// \param frames the number of the frames.
+    /// \param left the gain of the left channel.
+    /// \param right the gain of the right channel.
+    ///
+    static void accumulate(
+        const simd_level level,
+        float* out,
+        const float* in,
+        const std::size_t frames,
+        const float left,
+        const float right) noexcept
+    {
+#if ODE_SIMD_X86
+      if (simd_level::avx2 == level)
+      {
+        accumulate_avx2(out, in, frames, left, right);
+      }
+      else if (simd_level::sse == level)
+      {
+        accumulate_sse(out, in, frames, left, right);
+      }
+      else
+      {
+        accumulate_scalar(out, in, frames, left, right);
+      }
+#else
+      accumulate_scalar(out, in, frames, left, right);
+#endif // !ODE_SIMD_X86
+    }
+
+    ///
+    /// Multiplies the samples by the volume and clamps them with the kernel
+    /// of the given SIMD level.
+    ///
+    /// \param level the SIMD level.
+    /// \param out a pointer to the samples.
+    /// \param count the number of the samples.
+    /// \param volume the volume.
+    ///
+    static void finish(
+        const simd_level level,
+        float* out,
+        const std::size_t count,
+        const float volume) noexcept
+    {
+#if ODE_SIMD_X86
+      if (simd_level::avx2 == level)
+      {
+        finish_avx2(out, count, volume);
+      }
+      else if (simd_level::sse == level)
+      {
+        finish_sse(out, count, volume);
+      }
+      else
+      {
+        finish_scalar(out, count, volume);
+      }
+#else
+      finish_scalar(out, count, volume);
+#endif // !ODE_SIMD_X86
+    }
+
+    ///
+    /// Gives the gain of the left channel for the given volume and position.
+    ///
+    /// \param volume the volume.
+    /// \param pan the position from -1 to 1.
+    ///
+    /// \return The gain.
+    ///
+    static float get_left_gain(const float volume, const float pan) noexcept
+    {
+      return volume * std::min(1.0f, 1.0f - std::clamp(pan, -1.0f, 1.0f));
+    }
+
+    ///
+    /// Gives the gain of the right channel for the given volume and
+    /// position.
+    ///
+    /// \param volume the volume.
+    /// \param pan the position from -1 to 1.
+    ///
+    /// \return The gain.
+    ///
+    static float get_right_gain(const float volume, const float pan) noexcept
+    {
+      return volume * std::min(1.0f, 1.0f + std::clamp(pan, -1.0f, 1.0f));
+    }
+  } // namespace detail
+
+  audio_mixer::audio_mixer(const std::size_t command_capacity)
+      : commands{command_capacity},
+        ended{command_capacity + max_audio_voices},
+        max_playing{command_capacity + max_audio_voices},
+        voices(max_audio_voices),
+        voice_count{0},
+        master_volume{1.0f},
+        scratch(audio_buffer_frames * 2),
+        level{ode::get_simd_level()},
+        next_id{1},
+        playing{}
+  {
+  }
+
+  std::uint32_t audio_mixer::play(
+      std::shared_ptr<const sound_buffer> sound,
+      const float volume,
+      const float pan,
+      const bool loop)
+  {
+    Expects(sound);
+
+    command c{};
+    c.type = command_type::play;
+    c.loop = loop;
+    c.samples = sound->get_samples();
+    c.frames = sound->get_frame_count();
+    c.left = detail::get_left_gain(volume, pan);
+    c.right = detail::get_right_gain(volume, pan);
+
+    return start(c, nullptr, std::move(sound));
+  }
+
+  std::uint32_t audio_mixer::play(
+      audio_stream& stream, const float volume, const float pan)
+  {
+    command c{};
+    c.type = command_type::play;
+    c.stream = &stream;
+    c.left = detail::get_left_gain(volume, pan);
+    c.right = detail::get_right_gain(volume, pan);
+
+    return start(c, &stream, nullptr);
+  }
+
+  bool audio_mixer::stop(const std::uint32_t voice) noexcept
+  {
+    command c{};
+    c.type = command_type::stop;
+    c.voice = voice;
+    return commands.try_push(c);
+  }
+
+  bool audio_mixer::set_volume(
+      const std::uint32_t voice, const float volume, const float pan) noexcept
+  {
+    command c{};
+    c.type = command_type::set_volume;
+    c.voice = voice;
+    c.left = detail::get_left_gain(volume, pan);
+    c.right = detail::get_right_gain(volume, pan);
+    return commands.try_push(c);
+  }
+
+  bool audio_mixer::set_master_volume(const float volume) noexcept
+  {
+    command c{};
+    c.type = command_type::set_master_volume;
+    c.left = volume;
+    return commands.try_push(c);
+  }
+
+  void audio_mixer::update()
+  {
+    while (const auto id = ended.try_pop())
+    {
+      const auto it = std::find_if(
+          playing.begin(), playing.end(), [id](const playing_voice& v) {
+            return *id == v.id;
+          });
+
+      if (playing.end() != it)
+      {
+        // The audio thread no longer reads the sound of the voice, so it can
+        // be released.
+        *it = std::move(playing.back());
+        playing.pop_back();
+      }
+    }
+
+    for (const auto& v : playing)
+    {
+      if (nullptr != v.stream)
+      {
+        v.stream->pump();
+      }
+    }
+  }
+
+  bool audio_mixer::is_playing(const std::uint32_t voice) const noexcept
+  {
+    return std::any_of(
+        playing.begin(), playing.end(), [voice](const playing_voice& v) {
+          return voice == v.id;
+        });
+  }
+
+  std::size_t audio_mixer::get_playing_count() const noexcept
+  {
+    return playing.size();
+  }
+
+  void audio_mixer::mix(float* out, const std::size_t frames) noexcept
+  {
+    apply_commands();
+
+    const auto l = level.load(std::memory_order_relaxed);
+    const auto block = scratch.size() / 2;
+
+    for (std::size_t first = 0; first < frames; first += block)
+    {
+      const auto n = std::min(block, frames - first);
+      float* const samples = out + first * 2;
+
+      std::fill_n(samples, n * 2, 0.0f);
+      mix_block(samples, n, l);
+      detail::finish(l, samples, n * 2, master_volume);
+    }
+  }
+
+  void audio_mixer::set_simd_level(const simd_level level) noexcept
+  {
+    this->level.store(
+        std::min(level, ode::get_simd_level()), std::memory_order_relaxed);
+  }
+
+  simd_level audio_mixer::get_simd_level() const noexcept
+  {
+    return level.load(std::memory_order_relaxed);
+  }
+
+  std::uint32_t audio_mixer::start(
+      command c,
+      audio_stream* stream,
+      std::shared_ptr<const sound_buffer> sound)
+  {
+    c.voice = next_id;
+
+    // Each of the voices is reported to have ended only once, so the queue
+    // of the ended voices can't overflow while the number of the voices is
+    // limited to its size.
+    if (max_playing == playing.size() || !commands.try_push(c))
+    {
+      return 0;
+    }
+
+    // Zero is never a valid ID.
+    next_id = 0 == next_id + 1 ? 1 : next_id + 1;
+    playing.push_back({c.voice, stream, std::move(sound)});
+
+    return c.voice;
+  }
+
+  void audio_mixer::apply_commands() noexcept
+  {
+    while (const auto c = commands.try_pop())
+    {
+      if (command_type::set_master_volume == c->type)
+      {
+        master_volume = c->left;
+        continue;
+      }
+
+      if (command_type::play == c->type)
+      {
+        if (voice_count == voices.size())
+        {
+          // The voice is dropped, so the game thread is told that it ended.
+          ended.try_push(c->voice);
+          continue;
+        }
+
+        voices[voice_count++] = {
+            c->voice,
+            c->loop,
+            c->samples,
+            c->frames,
+            0,
+            c->stream,
+            c->left,
+            c->right};
+
+        continue;
+      }
+
+      for (std::size_t i = 0; i < voice_count; ++i)
+      {
+        auto& v = voices[i];
+
+        if (c->voice != v.id)
+        {
+          continue;
+        }
+
+        if (command_type::stop == c->type)
+        {
+          ended.try_push(v.id);
+          v = voices[--voice_count];
+        }
+        else
+        {
+          v.left = c->left;
+          v.right = c->right;
+        }
+
+        break;
+      }
+    }
+  }
+
+  void audio_mixer::mix_block(
+      float* out, const std::size_t frames, const simd_level level) noexcept
+  {
+    std::size_t i = 0;
+
+    while (i < voice_count)
+    {
+      auto& v = voices[i];
+      bool finished = false;
+
+      if (nullptr != v.stream)
+      {
+        const auto n = v.stream->read(scratch.data(), frames);
+
+        detail::accumulate(level, out, scratch.data(), n, v.left, v.right);
+
+        // A stream that runs out before it ends is only silent until the
+        // game thread refills it.
+        finished = n < frames && v.stream->is_finished();
+      }
+      else
+      {
+        std::size_t done = 0;
+
+        while (done < frames && !finished)
+        {
+          const auto n = std::min(frames - done, v.frames - v.position);
+
+          detail::accumulate(
+              level,
+              out + done * 2,
+              v.samples + v.position * 2,
+              n,
+              v.left,
+              v.right);
+
+          done += n;
+          v.position += n;
+
+          if (v.frames == v.position)
+          {
+            finished = !v.loop || 0 == v.frames;
+            v.position = 0;
+          }
+        }
+      }
+
+      if (finished)
+      {
+        ended.try_push(v.id);
+        v = voices[--voice_count];
+      }
+      else
+      {
+        ++i;
+      }
+    }
+  }
+
+} // namespace ode
@@ -0,0 +1,93 @@
+/// The definition of the type of the resamplers which convert the sample
+/// rates of the sounds and the streams to the rate of the mixer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/audio_resampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  audio_resampler::audio_resampler(
+      const int source_rate, const int target_rate)
+      : step{static_cast<double>(source_rate) / target_rate},
+        phase{1.0},
+        previous_left{0.0f},
+        previous_right{0.0f}
+  {
+    Expects(0 < source_rate && 0 < target_rate);
+  }
+
+  std::size_t audio_resampler::process(
+      const float* in,
+      const std::size_t in_frames,
+      float* out,
+      const std::size_t out_frames,
+      std::size_t& consumed) noexcept
+  {
+    if (is_identity())
+    {
+      const auto n = std::min(in_frames, out_frames);
+      std::copy_n(in, n * 2, out);
+      consumed = n;
+      return n;
+    }
+
+    // The carried frame is at the index -1 of the block, so the positions
+    // are counted from it.
+    const auto last = static_cast<double>(in_frames);
+    double p = phase;
+    std::size_t produced = 0;
+
+    while (produced < out_frames && p < last)
+    {
+      const auto i = static_cast<std::size_t>(p);
+      const auto f = static_cast<float>(p - static_cast<double>(i));
+
+      const float l0 = 0 == i ? previous_left : in[(i - 1) * 2];
+      const float r0 = 0 == i ? previous_right : in[(i - 1) * 2 + 1];
+      const float l1 = in[i * 2];
+      const float r1 = in[i * 2 + 1];
+
+      out[produced * 2] = l0 + (l1 - l0) * f;
+      out[produced * 2 + 1] = r0 + (r1 - r0) * f;
+
+      ++produced;
+      p += step;
+    }
+
+    // The frame before the next output frame is carried to the next block.
+    const auto whole = std::min(static_cast<std::size_t>(p), in_frames);
+
+    if (0 < whole)
+    {
+      previous_left = in[(whole - 1) * 2];
+      previous_right = in[(whole - 1) * 2 + 1];
+    }
+
+    consumed = whole;
+    phase = p - static_cast<double>(whole);
+
+    return produced;
+  }
+
+  void audio_resampler::reset() noexcept
+  {
+    phase = 1.0;
+    previous_left = 0.0f;
+    previous_right = 0.0f;
+  }
+
+  bool audio_resampler::is_identity() const noexcept
+  {
+    return 1.0 == step;
+  }
+
+} // namespace ode
@@ -0,0 +1,109 @@
+/// The definition of the type of the streams which decode long tracks
+/// while they are played.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/audio_stream.h"
+
+#include <algorithm>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The number of the frames that a stream decodes from its file at
+    /// once.
+    ///
+    constexpr std::size_t stream_block_frames = 1024;
+  } // namespace detail
+
+  audio_stream::audio_stream(
+      const std::string& filename,
+      const bool looping,
+      const std::size_t frames)
+      : decoder{filename},
+        resampler{decoder.get_sample_rate(), audio_sample_rate},
+        loop{looping},
+        decoded(detail::stream_block_frames * 2),
+        decoded_offset{0},
+        decoded_frames{0},
+        resampled(detail::stream_block_frames * 2),
+        samples{frames * 2},
+        ended{false}
+  {
+    Expects(0 < frames);
+    pump();
+  }
+
+  std::size_t audio_stream::pump()
+  {
+    std::size_t added = 0;
+
+    while (!ended.load(std::memory_order_relaxed))
+    {
+      const auto room = (samples.get_capacity() - samples.size()) / 2;
+
+      if (0 == room)
+      {
+        break;
+      }
+
+      if (decoded_offset == decoded_frames)
+      {
+        decoded_offset = 0;
+        decoded_frames =
+            decoder.read(decoded.data(), detail::stream_block_frames);
+
+        if (0 == decoded_frames)
+        {
+          // The resampler isn't reset, so the loop point is seamless.
+          if (loop && 0 < decoder.get_frame_count())
+          {
+            decoder.rewind();
+            continue;
+          }
+
+          ended.store(true, std::memory_order_release);
+          break;
+        }
+      }
+
+      std::size_t consumed = 0;
+      const auto produced = resampler.process(
+          decoded.data() + decoded_offset * 2,
+          decoded_frames - decoded_offset,
+          resampled.data(),
+          std::min(room, detail::stream_block_frames),
+          consumed);
+
+      decoded_offset += consumed;
+      samples.push(resampled.data(), produced * 2);
+      added += produced;
+    }
+
+    return added;
+  }
+
+  std::size_t audio_stream::read(float* out, const std::size_t frames) noexcept
+  {
+    return samples.pop(out, frames * 2) / 2;
+  }
+
+  bool audio_stream::is_finished() const noexcept
+  {
+    // The flag is set after the last samples are added.
+    return ended.load(std::memory_order_acquire) && samples.empty();
+  }
+
+  std::size_t audio_stream::get_queued_frames() const noexcept
+  {
+    return samples.size() / 2;
+  }
+
+} // namespace ode
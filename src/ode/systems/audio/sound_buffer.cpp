@@ -0,0 +1,85 @@
+/// The definition of the type of the sounds which are decoded into memory.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/sound_buffer.h"
+
+#include <cmath>
+#include <utility>
+
+#include "gsl/assert"
+
+#include "ode/systems/audio/audio_config.h"
+#include "ode/systems/audio/audio_resampler.h"
+#include "ode/systems/audio/wav_decoder.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// Decodes the given WAV file and resamples it to the rate of the mixer.
+    ///
+    /// \param filename the name of the file.
+    ///
+    /// \return The interleaved stereo samples.
+    ///
+    static std::vector<float> decode_sound(const std::string& filename)
+    {
+      wav_decoder decoder{filename};
+
+      std::vector<float> decoded(decoder.get_frame_count() * 2);
+      const auto frames =
+          decoder.read(decoded.data(), decoder.get_frame_count());
+
+      decoded.resize(frames * 2);
+
+      audio_resampler resampler{decoder.get_sample_rate(), audio_sample_rate};
+
+      if (resampler.is_identity())
+      {
+        return decoded;
+      }
+
+      // The resampler may give one frame more than the ratio of the rates.
+      const auto ratio =
+          static_cast<double>(audio_sample_rate) / decoder.get_sample_rate();
+      const auto capacity = static_cast<std::size_t>(
+          std::ceil(static_cast<double>(frames) * ratio)) + 1;
+
+      std::vector<float> resampled(capacity * 2);
+      std::size_t consumed = 0;
+      const auto n = resampler.process(
+          decoded.data(), frames, resampled.data(), capacity, consumed);
+
+      resampled.resize(n * 2);
+
+      return resampled;
+    }
+  } // namespace detail
+
+  sound_buffer::sound_buffer(const std::string& filename)
+      : samples{detail::decode_sound(filename)}
+  {
+  }
+
+  sound_buffer::sound_buffer(std::vector<float> interleaved)
+      : samples{std::move(interleaved)}
+  {
+    Expects(0 == samples.size() % 2);
+  }
+
+  const float* sound_buffer::get_samples() const noexcept
+  {
+    return samples.data();
+  }
+
+  std::size_t sound_buffer::get_frame_count() const noexcept
+  {
+    return samples.size() / 2;
+  }
+
+} // namespace ode
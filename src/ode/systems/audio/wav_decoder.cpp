@@ -0,0 +1,280 @@
+/// The definition of the type of the decoders which read WAV files in
+/// blocks.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/wav_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "ode/logger.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The format tag of the integer samples.
+    ///
+    constexpr std::uint16_t wav_format_pcm = 1;
+
+    ///
+    /// The format tag of the floating-point samples.
+    ///
+    constexpr std::uint16_t wav_format_float = 3;
+
+    ///
+    /// The format tag of the files whose format is given by a subformat.
+    ///
+    constexpr std::uint16_t wav_format_extensible = 0xfffe;
+
+    ///
+    /// Reads a little-endian 16-bit integer.
+    ///
+    /// \param p a pointer to the first byte.
+    ///
+    /// \return The integer.
+    ///
+    static std::uint16_t read_u16(const std::uint8_t* p) noexcept
+    {
+      return static_cast<std::uint16_t>(p[0] | p[1] << 8);
+    }
+
+    ///
+    /// Reads a little-endian 32-bit integer.
+    ///
+    /// \param p a pointer to the first byte.
+    ///
+    /// \return The integer.
+    ///
+    static std::uint32_t read_u32(const std::uint8_t* p) noexcept
+    {
+      return static_cast<std::uint32_t>(p[0]) |
+          static_cast<std::uint32_t>(p[1]) << 8 |
+          static_cast<std::uint32_t>(p[2]) << 16 |
+          static_cast<std::uint32_t>(p[3]) << 24;
+    }
+
+    ///
+    /// Reads a sample of the given format and converts it to the range from
+    /// -1 to 1.
+    ///
+    /// \param p a pointer to the first byte of the sample.
+    /// \param bits the number of the bits in the sample.
+    /// \param floating_point whether or not the sample is a floating-point
+    /// number.
+    ///
+    /// \return The sample.
+    ///
+    static float read_sample(
+        const std::uint8_t* p,
+        const int bits,
+        const bool floating_point) noexcept
+    {
+      if (floating_point)
+      {
+        const auto u = read_u32(p);
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+        return f;
+      }
+
+      if (8 == bits)
+      {
+        // The 8-bit samples are unsigned.
+        return (static_cast<float>(p[0]) - 128.0f) / 128.0f;
+      }
+
+      if (16 == bits)
+      {
+        return static_cast<float>(static_cast<std::int16_t>(read_u16(p))) /
+            32768.0f;
+      }
+
+      const auto u = static_cast<std::uint32_t>(p[0]) << 8 |
+          static_cast<std::uint32_t>(p[1]) << 16 |
+          static_cast<std::uint32_t>(p[2]) << 24;
+
+      return static_cast<float>(static_cast<std::int32_t>(u)) / 2147483648.0f;
+    }
+
+    ///
+    /// Throws the error of a file that isn't a supported WAV file.
+    ///
+    /// \param filename the name of the file.
+    ///
+    [[noreturn]] static void throw_invalid_wav(const std::string& filename)
+    {
+      ODE_ERROR("The file '{}' isn't a supported WAV file", filename);
+      throw std::runtime_error{"The file isn't a supported WAV file"};
+    }
+  } // namespace detail
+
+  wav_decoder::wav_decoder(const std::string& filename)
+      : file{filename, std::ios::binary},
+        data_offset{0},
+        frame_count{0},
+        position{0},
+        sample_rate{0},
+        channels{0},
+        bits{0},
+        floating_point{false},
+        bytes{}
+  {
+    if (!file)
+    {
+      ODE_ERROR("The WAV file '{}' can't be opened", filename);
+      throw std::runtime_error{"The WAV file can't be opened"};
+    }
+
+    std::uint8_t header[12];
+
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+        0 != std::memcmp(header, "RIFF", 4) ||
+        0 != std::memcmp(header + 8, "WAVE", 4))
+    {
+      detail::throw_invalid_wav(filename);
+    }
+
+    bool has_format = false;
+    std::uint8_t chunk[8];
+
+    while (file.read(reinterpret_cast<char*>(chunk), sizeof(chunk)))
+    {
+      const auto size = detail::read_u32(chunk + 4);
+
+      if (0 == std::memcmp(chunk, "fmt ", 4))
+      {
+        std::uint8_t format[40] = {};
+        const auto n = std::min<std::size_t>(size, sizeof(format));
+
+        if (16 > size || !file.read(reinterpret_cast<char*>(format), n))
+        {
+          detail::throw_invalid_wav(filename);
+        }
+
+        auto tag = detail::read_u16(format);
+
+        // The first two bytes of the subformat are the format tag.
+        if (detail::wav_format_extensible == tag && 26 <= n)
+        {
+          tag = detail::read_u16(format + 24);
+        }
+
+        channels = detail::read_u16(format + 2);
+        sample_rate = static_cast<int>(detail::read_u32(format + 4));
+        bits = detail::read_u16(format + 14);
+        floating_point = detail::wav_format_float == tag;
+
+        const bool supported_pcm = detail::wav_format_pcm == tag &&
+            (8 == bits || 16 == bits || 24 == bits);
+        const bool supported_float = floating_point && 32 == bits;
+
+        if (0 == channels || 0 >= sample_rate ||
+            (!supported_pcm && !supported_float))
+        {
+          detail::throw_invalid_wav(filename);
+        }
+
+        has_format = true;
+
+        // The rest of the chunk and its padding byte are skipped.
+        file.seekg(
+            static_cast<std::streamoff>(size - n + (size & 1)),
+            std::ios::cur);
+      }
+      else if (0 == std::memcmp(chunk, "data", 4))
+      {
+        if (!has_format)
+        {
+          detail::throw_invalid_wav(filename);
+        }
+
+        data_offset = file.tellg();
+        frame_count =
+            size / (static_cast<std::size_t>(channels) * (bits / 8));
+
+        ODE_DEBUG(
+            "Opened the WAV file '{}' with {} frames at {} Hz",
+            filename,
+            frame_count,
+            sample_rate);
+
+        return;
+      }
+      else
+      {
+        file.seekg(
+            static_cast<std::streamoff>(size + (size & 1)), std::ios::cur);
+      }
+    }
+
+    detail::throw_invalid_wav(filename);
+  }
+
+  std::size_t wav_decoder::read(float* out, const std::size_t frames)
+  {
+    const auto n = std::min(frames, frame_count - position);
+
+    if (0 == n)
+    {
+      return 0;
+    }
+
+    const auto sample_size = static_cast<std::size_t>(bits / 8);
+    const auto frame_size = sample_size * static_cast<std::size_t>(channels);
+
+    bytes.resize(n * frame_size);
+    file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+
+    // A truncated file ends at the last whole frame.
+    const auto decoded = static_cast<std::size_t>(file.gcount()) / frame_size;
+    const std::size_t right = 1 < channels ? sample_size : 0;
+
+    for (std::size_t i = 0; i < decoded; ++i)
+    {
+      const std::uint8_t* p = bytes.data() + i * frame_size;
+
+      out[i * 2] = detail::read_sample(p, bits, floating_point);
+      out[i * 2 + 1] = detail::read_sample(p + right, bits, floating_point);
+    }
+
+    if (decoded < n)
+    {
+      file.clear();
+      frame_count = position + decoded;
+    }
+
+    position += decoded;
+
+    return decoded;
+  }
+
+  void wav_decoder::rewind()
+  {
+    file.clear();
+    file.seekg(data_offset);
+    position = 0;
+  }
+
+  int wav_decoder::get_sample_rate() const noexcept
+  {
+    return sample_rate;
+  }
+
+  std::size_t wav_decoder::get_frame_count() const noexcept
+  {
+    return frame_count;
+  }
+
+  std::size_t wav_decoder::get_position() const noexcept
+  {
+    return position;
+  }
+
+} // namespace ode
@@ -0,0 +1,320 @@
+/// The definition of the type of the systems which evaluate the animations
+/// of the tiles and the sprites.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/animation_system.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  animation_system::animation_system()
+      : frames{},
+        first_frames{},
+        lengths{},
+        shared_frames{},
+        tiles{},
+        tile_table{},
+        tile_table_changed{false},
+        clock{0},
+        clip_animations{},
+        clip_times{},
+        clip_frames{},
+        clip_playbacks{}
+  {
+  }
+
+  std::uint32_t animation_system::add_animation(
+      const std::vector<animation_frame>& sequence, const tileset& set)
+  {
+    Expects(!sequence.empty());
+    Expects(0 < set.tile_width && 0 < set.tile_height);
+
+    const auto columns =
+        static_cast<std::uint32_t>(get_tileset_columns(set));
+
+    // The tileset may be a part of an atlas page.
+    const auto texture_width = static_cast<float>(
+        0 == set.texture_width ? set.image_width : set.texture_width);
+    const auto texture_height = static_cast<float>(
+        0 == set.texture_height ? set.image_height : set.texture_height);
+
+    const auto index = static_cast<std::uint32_t>(first_frames.size());
+
+    first_frames.push_back(static_cast<std::uint32_t>(frames.size()));
+
+    std::uint32_t end = 0;
+
+    for (const auto& f : sequence)
+    {
+      Expects(0 < f.duration);
+
+      end += f.duration;
+
+      const auto x = static_cast<float>(
+          set.atlas_x + set.margin +
+          static_cast<int>(f.tile % columns) * (set.tile_width + set.spacing));
+      const auto y = static_cast<float>(
+          set.atlas_y + set.margin +
+          static_cast<int>(f.tile / columns) *
+              (set.tile_height + set.spacing));
+
+      frames.push_back(
+          {end,
+           set.first_gid + f.tile,
+           x / texture_width,
+           y / texture_height,
+           (x + static_cast<float>(set.tile_width)) / texture_width,
+           (y + static_cast<float>(set.tile_height)) / texture_height});
+    }
+
+    lengths.push_back(end);
+    shared_frames.push_back(0);
+
+    // The new animation joins the shared clock in the middle of its loop.
+    const auto time = static_cast<std::uint32_t>(clock % end);
+    const auto first = frames.begin() + first_frames.back();
+    const auto last = first + static_cast<std::ptrdiff_t>(sequence.size());
+
+    shared_frames.back() = static_cast<std::uint32_t>(
+        std::upper_bound(
+            first,
+            last,
+            time,
+            [](const std::uint32_t t, const frame_data& f) {
+              return t < f.end;
+            }) -
+        first);
+
+    return index;
+  }
+
+  void animation_system::animate_tile(
+      const std::uint32_t gid, const std::uint32_t animation)
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(0 < gid && 0 == (gid & 0xe0000000u));
+    Expects(animation < first_frames.size());
+
+    if (gid >= tile_table.size())
+    {
+      const auto size = tile_table.size();
+      tile_table.resize(static_cast<std::size_t>(gid) + 1);
+      std::iota(
+          tile_table.begin() + static_cast<std::ptrdiff_t>(size),
+          tile_table.end(),
+          static_cast<std::uint32_t>(size));
+    }
+
+    tiles.push_back({gid, animation});
+    tile_table[gid] =
+        frames[first_frames[animation] + shared_frames[animation]].gid;
+    tile_table_changed = true;
+  }
+
+  std::uint32_t animation_system::add_clip(
+      const std::uint32_t animation, const animation_playback playback)
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(animation < first_frames.size());
+
+    const auto clip = static_cast<std::uint32_t>(clip_animations.size());
+
+    clip_animations.push_back(animation);
+    clip_times.push_back(0);
+    clip_frames.push_back(0);
+    clip_playbacks.push_back(playback);
+
+    if (animation_playback::synchronized == playback)
+    {
+      clip_frames.back() = shared_frames[animation];
+    }
+
+    return clip;
+  }
+
+  void animation_system::play(
+      const std::uint32_t clip,
+      const std::uint32_t animation,
+      const animation_playback playback) ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(clip < clip_animations.size());
+    Expects(animation < first_frames.size());
+
+    clip_animations[clip] = animation;
+    clip_times[clip] = 0;
+    clip_playbacks[clip] = playback;
+    clip_frames[clip] = animation_playback::synchronized == playback
+        ? shared_frames[animation]
+        : 0;
+  }
+
+  void animation_system::remove_clip(const std::uint32_t clip)
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(clip < clip_animations.size());
+
+    clip_animations[clip] = clip_animations.back();
+    clip_times[clip] = clip_times.back();
+    clip_frames[clip] = clip_frames.back();
+    clip_playbacks[clip] = clip_playbacks.back();
+
+    clip_animations.pop_back();
+    clip_times.pop_back();
+    clip_frames.pop_back();
+    clip_playbacks.pop_back();
+  }
+
+  void animation_system::update(const std::uint32_t delta)
+  {
+    update_shared(delta);
+  }
+
+  void animation_system::update(
+      const std::uint32_t delta, std::vector<sprite>& sprites)
+  {
+    Expects(sprites.size() >= clip_animations.size());
+
+    update_shared(delta);
+
+    const auto count = clip_animations.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto animation = clip_animations[i];
+      const auto first = first_frames[animation];
+      auto frame = clip_frames[i];
+
+      if (animation_playback::synchronized == clip_playbacks[i])
+      {
+        frame = shared_frames[animation];
+      }
+      else
+      {
+        const auto length = lengths[animation];
+        auto time = clip_times[i] + delta;
+
+        if (time >= length)
+        {
+          if (animation_playback::loop == clip_playbacks[i])
+          {
+            time %= length;
+            frame = 0;
+          }
+          else
+          {
+            time = length - 1;
+          }
+        }
+
+        // The frames are usually longer than the ticks, so the search rarely
+        // moves more than a frame.
+        while (time >= frames[first + frame].end)
+        {
+          ++frame;
+        }
+
+        clip_times[i] = time;
+      }
+
+      clip_frames[i] = frame;
+
+      const auto& f = frames[first + frame];
+      auto& s = sprites[i];
+
+      s.u0 = f.u0;
+      s.v0 = f.v0;
+      s.u1 = f.u1;
+      s.v1 = f.v1;
+    }
+  }
+
+  const std::vector<std::uint32_t>& animation_system::get_tile_table() const
+      noexcept
+  {
+    return tile_table;
+  }
+
+  bool animation_system::take_tile_table_changed() noexcept
+  {
+    return std::exchange(tile_table_changed, false);
+  }
+
+  std::uint32_t animation_system::get_frame_tile(
+      const std::uint32_t animation) const ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(animation < first_frames.size());
+    return frames[first_frames[animation] + shared_frames[animation]].gid;
+  }
+
+  std::uint32_t animation_system::get_clip_frame(const std::uint32_t clip)
+      const ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(clip < clip_animations.size());
+    return clip_frames[clip];
+  }
+
+  std::size_t animation_system::get_animation_count() const noexcept
+  {
+    return first_frames.size();
+  }
+
+  std::size_t animation_system::get_clip_count() const noexcept
+  {
+    return clip_animations.size();
+  }
+
+  void animation_system::update_shared(const std::uint32_t delta)
+  {
+    clock += delta;
+
+    bool changed = false;
+
+    for (std::size_t a = 0; a < first_frames.size(); ++a)
+    {
+      const auto time = static_cast<std::uint32_t>(clock % lengths[a]);
+      const auto first = first_frames[a];
+      auto frame = shared_frames[a];
+
+      // The clock wrapped around the end of the animation.
+      if (0 < frame && time < frames[first + frame - 1].end)
+      {
+        frame = 0;
+      }
+
+      while (time >= frames[first + frame].end)
+      {
+        ++frame;
+      }
+
+      changed = changed || frame != shared_frames[a];
+      shared_frames[a] = frame;
+    }
+
+    if (!changed)
+    {
+      return;
+    }
+
+    for (const auto& t : tiles)
+    {
+      const auto gid =
+          frames[first_frames[t.animation] + shared_frames[t.animation]].gid;
+
+      if (gid != tile_table[t.gid])
+      {
+        tile_table[t.gid] = gid;
+        tile_table_changed = true;
+      }
+    }
+  }
+
+} // namespace ode
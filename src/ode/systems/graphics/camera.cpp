@@ -0,0 +1,75 @@
+/// The definition of the type of the cameras which describe the visible area
+/// of the world.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/camera.h"
+
+#include <glad/glad.h>
+
+#include "gsl/assert"
+
+#include "ode/gl/gl_config.h"
+#include "ode/systems/graphics/sprite_renderer.h"
+
+namespace ode
+{
+  camera::camera() : camera{viewport{}}
+  {
+  }
+
+  camera::camera(const viewport& v) : port{v}, x{0.0f}, y{0.0f}, zoom{1.0f}
+  {
+  }
+
+  void camera::look_at(const float x, const float y) noexcept
+  {
+    this->x = x;
+    this->y = y;
+  }
+
+  void camera::set_zoom(const float z) ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(z > 0.0f);
+    zoom = z;
+  }
+
+  void camera::set_viewport(const viewport& v) noexcept
+  {
+    port = v;
+  }
+
+  const viewport& camera::get_viewport() const noexcept
+  {
+    return port;
+  }
+
+  rectangle camera::get_view() const noexcept
+  {
+    const float half_width = static_cast<float>(port.width) / zoom / 2.0f;
+    const float half_height = static_cast<float>(port.height) / zoom / 2.0f;
+
+    return {x - half_width, y - half_height, x + half_width, y + half_height};
+  }
+
+  std::array<float, 16> camera::get_projection() const noexcept
+  {
+    const auto view = get_view();
+
+    // The y axis of the world points down, so the top of the view is mapped
+    // to the top of the viewport.
+    return make_orthographic(view.left, view.right, view.bottom, view.top);
+  }
+
+  void camera::apply() const
+  {
+    if constexpr (!disable_gl_calls)
+    {
+      glViewport(port.x, port.y, port.width, port.height);
+    }
+  }
+
+} // namespace ode
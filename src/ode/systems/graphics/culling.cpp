@@ -0,0 +1,47 @@
+/// The definitions of the functions which submit only the visible parts of
+/// the world for drawing.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/culling.h"
+
+namespace ode
+{
+  culling_statistics submit_visible(
+      const camera& view_camera,
+      const visibility_grid& grid,
+      const std::vector<graphics_object>& objects,
+      sprite_batch& batch)
+  {
+    const auto& visible = grid.query(view_camera.get_view());
+
+    for (const std::size_t id : visible)
+    {
+      batch.add(objects[id].get_sprite());
+    }
+
+    const auto count = grid.get_object_count();
+
+    return {visible.size(), count - visible.size()};
+  }
+
+  tile_range get_visible_tiles(
+      const camera& view_camera,
+      const tile_layer& layer,
+      const tileset& set) noexcept
+  {
+    const auto view = view_camera.get_view();
+
+    return layer.get_visible_range(
+        view.left,
+        view.top,
+        view.right,
+        view.bottom,
+        static_cast<float>(set.tile_width),
+        static_cast<float>(set.tile_height));
+  }
+
+} // namespace ode
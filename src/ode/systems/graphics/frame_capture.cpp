@@ -0,0 +1,204 @@
+/// The definition of the type of the objects which read the rendered frames
+/// back from the GPU.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/frame_capture.h"
+
+#include <algorithm>
+
+#include "gsl/assert"
+
+#include "ode/gl/gl_config.h"
+#include "ode/logger.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The time, in nanoseconds, for which the fences are waited on at once.
+    ///
+    constexpr GLuint64 capture_wait_timeout = 1000000000;
+  } // namespace detail
+
+  frame_capture::frame_capture(
+      const int width, const int height, const std::size_t buffer_count)
+      : width{width},
+        height{height},
+        slots(buffer_count, slot{0, nullptr}),
+        first{0},
+        pending{0}
+  {
+    Expects(0 < width && 0 < height);
+    Expects(0 < buffer_count);
+
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    const auto size = static_cast<GLsizeiptr>(width) * height * 4;
+
+    for (auto& s : slots)
+    {
+      glGenBuffers(1, &s.buffer);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, s.buffer);
+      glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+
+  frame_capture::~frame_capture()
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    for (auto& s : slots)
+    {
+      if (nullptr != s.fence)
+      {
+        glDeleteSync(s.fence);
+      }
+
+      glDeleteBuffers(1, &s.buffer);
+    }
+  }
+
+  bool frame_capture::capture()
+  {
+    if (slots.size() == pending)
+    {
+      ODE_WARN("The frame isn't captured as all of the buffers are in use");
+      return false;
+    }
+
+    auto& s = slots[(first + pending) % slots.size()];
+
+    ++pending;
+
+    if constexpr (disable_gl_calls)
+    {
+      return true;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, s.buffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    s.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    return true;
+  }
+
+  std::optional<image> frame_capture::poll()
+  {
+    if (0 == pending)
+    {
+      return std::nullopt;
+    }
+
+    if constexpr (!disable_gl_calls)
+    {
+      // The flush makes sure that the fence reaches the GPU as otherwise it
+      // may never be signaled.
+      const GLenum status =
+          glClientWaitSync(slots[first].fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+      if (GL_ALREADY_SIGNALED != status && GL_CONDITION_SATISFIED != status)
+      {
+        return std::nullopt;
+      }
+    }
+
+    return read();
+  }
+
+  std::optional<image> frame_capture::wait()
+  {
+    if (0 == pending)
+    {
+      return std::nullopt;
+    }
+
+    if constexpr (!disable_gl_calls)
+    {
+      GLenum status = GL_TIMEOUT_EXPIRED;
+
+      while (GL_TIMEOUT_EXPIRED == status)
+      {
+        status = glClientWaitSync(
+            slots[first].fence,
+            GL_SYNC_FLUSH_COMMANDS_BIT,
+            detail::capture_wait_timeout);
+      }
+
+      if (GL_WAIT_FAILED == status)
+      {
+        ODE_ERROR("The wait for the captured frame failed");
+      }
+    }
+
+    return read();
+  }
+
+  std::optional<image> frame_capture::read()
+  {
+    auto& s = slots[first];
+
+    first = (first + 1) % slots.size();
+    --pending;
+
+    auto img = make_image(width, height);
+
+    if constexpr (disable_gl_calls)
+    {
+      return img;
+    }
+
+    glDeleteSync(s.fence);
+    s.fence = nullptr;
+
+    const auto row_size = static_cast<std::size_t>(width) * 4;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, s.buffer);
+
+    const auto* const pixels = static_cast<const std::uint8_t*>(
+        glMapBufferRange(
+            GL_PIXEL_PACK_BUFFER,
+            0,
+            static_cast<GLsizeiptr>(img.pixels.size()),
+            GL_MAP_READ_BIT));
+
+    if (nullptr == pixels)
+    {
+      ODE_ERROR("The pixel buffer of the captured frame can't be mapped");
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+      return std::nullopt;
+    }
+
+    // OpenGL gives the bottom row first, so the rows are flipped.
+    for (int row = 0; row < height; ++row)
+    {
+      const auto* const from =
+          pixels + static_cast<std::size_t>(height - 1 - row) * row_size;
+      std::copy(
+          from,
+          from + row_size,
+          img.pixels.data() + static_cast<std::size_t>(row) * row_size);
+    }
+
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    return img;
+  }
+
+} // namespace ode
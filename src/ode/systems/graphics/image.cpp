@@ -0,0 +1,231 @@
+/// The definitions of the functions which decode and edit images.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/image.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <memory>
+
+#include "gsl/assert"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include "ode/logger.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    static image take_pixels(
+        stbi_uc* const data, const int width, const int height)
+    {
+      const std::unique_ptr<stbi_uc, void (*)(void*)> owner{
+          data, stbi_image_free};
+
+      const auto size = static_cast<std::size_t>(width) * height * 4;
+
+      return {width, height, std::vector<std::uint8_t>(data, data + size)};
+    }
+
+    static std::optional<std::uint8_t> parse_digit(const char c) noexcept
+    {
+      if (c >= '0' && c <= '9')
+      {
+        return static_cast<std::uint8_t>(c - '0');
+      }
+
+      if (c >= 'a' && c <= 'f')
+      {
+        return static_cast<std::uint8_t>(c - 'a' + 10);
+      }
+
+      if (c >= 'A' && c <= 'F')
+      {
+        return static_cast<std::uint8_t>(c - 'A' + 10);
+      }
+
+      return std::nullopt;
+    }
+  } // namespace detail
+
+  image make_image(const int width, const int height)
+  {
+    Expects(width >= 0 && height >= 0);
+
+    const auto size = static_cast<std::size_t>(width) * height * 4;
+
+    return {width, height, std::vector<std::uint8_t>(size)};
+  }
+
+  std::optional<image> load_image(const std::string& filename)
+  {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+
+    // The images are always expanded to four channels so that all of them
+    // can be uploaded and packed the same way.
+    stbi_uc* const data =
+        stbi_load(filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+
+    if (nullptr == data)
+    {
+      ODE_ERROR(
+          "The image '{}' can't be decoded: {}",
+          filename,
+          stbi_failure_reason());
+      return std::nullopt;
+    }
+
+    ODE_TRACE(
+        "Decoded the image '{}' of {}x{} pixels", filename, width, height);
+
+    return detail::take_pixels(data, width, height);
+  }
+
+  std::optional<image> load_image(
+      const std::uint8_t* data, const std::size_t size)
+  {
+    Expects(size <= static_cast<std::size_t>(std::numeric_limits<int>::max()));
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+
+    stbi_uc* const pixels = stbi_load_from_memory(
+        data,
+        static_cast<int>(size),
+        &width,
+        &height,
+        &channels,
+        STBI_rgb_alpha);
+
+    if (nullptr == pixels)
+    {
+      ODE_ERROR("The image can't be decoded: {}", stbi_failure_reason());
+      return std::nullopt;
+    }
+
+    return detail::take_pixels(pixels, width, height);
+  }
+
+  std::optional<std::uint32_t> parse_colour(std::string_view s) noexcept
+  {
+    if (!s.empty() && '#' == s.front())
+    {
+      s.remove_prefix(1);
+    }
+
+    if (6 != s.size())
+    {
+      return std::nullopt;
+    }
+
+    std::uint32_t colour = 0;
+
+    for (const char c : s)
+    {
+      const auto digit = detail::parse_digit(c);
+
+      if (!digit)
+      {
+        return std::nullopt;
+      }
+
+      colour = (colour << 4) | *digit;
+    }
+
+    return colour;
+  }
+
+  std::size_t apply_colour_key(image& img, const std::uint32_t colour) noexcept
+  {
+    const auto r = static_cast<std::uint8_t>((colour >> 16) & 0xff);
+    const auto g = static_cast<std::uint8_t>((colour >> 8) & 0xff);
+    const auto b = static_cast<std::uint8_t>(colour & 0xff);
+
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < img.pixels.size(); i += 4)
+    {
+      auto* const pixel = img.pixels.data() + i;
+
+      if (r == pixel[0] && g == pixel[1] && b == pixel[2])
+      {
+        // The colour is cleared too so that the filtering doesn't bleed the
+        // key colour into the edges of the visible pixels.
+        std::fill(pixel, pixel + 4, std::uint8_t{0});
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  void blit(const image& source, image& target, const int x, const int y)
+  {
+    Expects(x >= 0 && y >= 0);
+    Expects(x + source.width <= target.width);
+    Expects(y + source.height <= target.height);
+
+    const auto row_size = static_cast<std::size_t>(source.width) * 4;
+
+    for (int row = 0; row < source.height; ++row)
+    {
+      const auto* const from =
+          source.pixels.data() + static_cast<std::size_t>(row) * row_size;
+      auto* const to = target.pixels.data() +
+          (static_cast<std::size_t>(y + row) * target.width + x) * 4;
+
+      std::copy(from, from + row_size, to);
+    }
+  }
+
+  bool save_image(const image& img, const std::string& filename)
+  {
+    Expects(img.pixels.size() == static_cast<std::size_t>(img.width) *
+                                     static_cast<std::size_t>(img.height) * 4);
+
+    const int written = stbi_write_png(
+        filename.c_str(),
+        img.width,
+        img.height,
+        4,
+        img.pixels.data(),
+        img.width * 4);
+
+    if (0 == written)
+    {
+      ODE_ERROR("The image '{}' can't be written", filename);
+      return false;
+    }
+
+    return true;
+  }
+
+  bool save_raw_image(const image& img, const std::string& filename)
+  {
+    std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+
+    if (!file ||
+        !file.write(
+            reinterpret_cast<const char*>(img.pixels.data()),
+            static_cast<std::streamsize>(img.pixels.size())))
+    {
+      ODE_ERROR("The image '{}' can't be written", filename);
+      return false;
+    }
+
+    return true;
+  }
+
+} // namespace ode
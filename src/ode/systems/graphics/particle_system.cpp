@@ -0,0 +1,412 @@
+/// The definition of the type of the particle systems.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/particle_system.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#if ODE_SIMD_X86
+#  include <immintrin.h>
+#endif
+
+#include "gsl/assert"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The type of the objects which point to the arrays of the particles
+    /// for the kernels.
+    ///
+    struct particle_arrays final
+    {
+      ///
+      /// The x coordinates of the particles.
+      ///
+      float* x;
+
+      ///
+      /// The y coordinates of the particles.
+      ///
+      float* y;
+
+      ///
+      /// The velocities of the particles along the x axis.
+      ///
+      float* velocity_x;
+
+      ///
+      /// The velocities of the particles along the y axis.
+      ///
+      float* velocity_y;
+
+      ///
+      /// The remaining lifetimes of the particles.
+      ///
+      float* lifetime;
+    };
+
+    ///
+    /// Updates the particles from the given index on without SIMD and
+    /// removes the expired ones. Every particle is written whether or not it
+    /// lives, and the write position advances only past the living ones, so
+    /// the loop has no branches to mispredict.
+    ///
+    /// \param a the arrays of the particles.
+    /// \param first the index of the first particle to update.
+    /// \param next the index to which the first particle is written.
+    /// \param count the number of the particles.
+    /// \param delta the time step.
+    /// \param ax the change of the velocity along the x axis.
+    /// \param ay the change of the velocity along the y axis.
+    ///
+    /// \return The number of the living particles written so far.
+    ///
+    static std::size_t update_scalar(
+        const particle_arrays& a,
+        const std::size_t first,
+        const std::size_t next,
+        const std::size_t count,
+        const float delta,
+        const float ax,
+        const float ay) noexcept
+    {
+      std::size_t j = next;
+
+      for (std::size_t i = first; i < count; ++i)
+      {
+        const float vx = a.velocity_x[i] + ax;
+        const float vy = a.velocity_y[i] + ay;
+        const float life = a.lifetime[i] - delta;
+
+        a.x[j] = a.x[i] + vx * delta;
+        a.y[j] = a.y[i] + vy * delta;
+        a.velocity_x[j] = vx;
+        a.velocity_y[j] = vy;
+        a.lifetime[j] = life;
+        j += 0.0f < life ? 1 : 0;
+      }
+
+      return j;
+    }
+
+#if ODE_SIMD_X86
+    ///
+    /// The type of the tables that tell how the living lanes of a vector of
+    /// eight particles are packed to its start.
+    ///
+    struct lane_table final
+    {
+      ///
+      /// The source lanes of the packed vector for each of the lane masks.
+      ///
+      std::int32_t lanes[256][8];
+
+      ///
+      /// The number of the living lanes for each of the lane masks.
+      ///
+      std::int32_t counts[256];
+    };
+
+    ///
+    /// Builds the table for packing the living lanes of the vectors.
+    ///
+    /// \return The table.
+    ///
+    static constexpr lane_table make_lane_table() noexcept
+    {
+      lane_table table{};
+
+      for (int mask = 0; mask < 256; ++mask)
+      {
+        int n = 0;
+
+        for (int lane = 0; lane < 8; ++lane)
+        {
+          if (0 != (mask & (1 << lane)))
+          {
+            table.lanes[mask][n++] = lane;
+          }
+        }
+
+        table.counts[mask] = n;
+
+        // The lanes past the living ones are filled so the permutations
+        // stay within the vector.
+        for (int lane = n; lane < 8; ++lane)
+        {
+          table.lanes[mask][lane] = lane;
+        }
+      }
+
+      return table;
+    }
+
+    ///
+    /// The table for packing the living lanes of the vectors.
+    ///
+    static constexpr lane_table packing_table = make_lane_table();
+
+    ///
+    /// Updates the particles with SSE, four at a time, and removes the
+    /// expired ones. SSE2 can't permute the lanes by a mask, so the blocks
+    /// with expired particles are packed one particle at a time.
+    ///
+    /// \param a the arrays of the particles.
+    /// \param count the number of the particles.
+    /// \param delta the time step.
+    /// \param ax the change of the velocity along the x axis.
+    /// \param ay the change of the velocity along the y axis.
+    ///
+    /// \return The number of the living particles.
+    ///
+    ODE_TARGET_SSE static std::size_t update_sse(
+        const particle_arrays& a,
+        const std::size_t count,
+        const float delta,
+        const float ax,
+        const float ay) noexcept
+    {
+      const __m128 dt = _mm_set1_ps(delta);
+      const __m128 dvx = _mm_set1_ps(ax);
+      const __m128 dvy = _mm_set1_ps(ay);
+      const __m128 zero = _mm_setzero_ps();
+
+      std::size_t i = 0;
+      std::size_t j = 0;
+
+      for (; i + 4 <= count; i += 4)
+      {
+        const __m128 vx = _mm_add_ps(_mm_load_ps(a.velocity_x + i), dvx);
+        const __m128 vy = _mm_add_ps(_mm_load_ps(a.velocity_y + i), dvy);
+        const __m128 x = _mm_add_ps(_mm_load_ps(a.x + i), _mm_mul_ps(vx, dt));
+        const __m128 y = _mm_add_ps(_mm_load_ps(a.y + i), _mm_mul_ps(vy, dt));
+        const __m128 life = _mm_sub_ps(_mm_load_ps(a.lifetime + i), dt);
+        const int alive = _mm_movemask_ps(_mm_cmpgt_ps(life, zero));
+
+        if (0xf == alive)
+        {
+          _mm_storeu_ps(a.velocity_x + j, vx);
+          _mm_storeu_ps(a.velocity_y + j, vy);
+          _mm_storeu_ps(a.x + j, x);
+          _mm_storeu_ps(a.y + j, y);
+          _mm_storeu_ps(a.lifetime + j, life);
+          j += 4;
+          continue;
+        }
+
+        // The block is stored in place and then packed one particle at a
+        // time.
+        _mm_store_ps(a.velocity_x + i, vx);
+        _mm_store_ps(a.velocity_y + i, vy);
+        _mm_store_ps(a.x + i, x);
+        _mm_store_ps(a.y + i, y);
+        _mm_store_ps(a.lifetime + i, life);
+
+        for (std::size_t k = i; k < i + 4; ++k)
+        {
+          a.x[j] = a.x[k];
+          a.y[j] = a.y[k];
+          a.velocity_x[j] = a.velocity_x[k];
+          a.velocity_y[j] = a.velocity_y[k];
+          a.lifetime[j] = a.lifetime[k];
+          j += 0.0f < a.lifetime[k] ? 1 : 0;
+        }
+      }
+
+      return update_scalar(a, i, j, count, delta, ax, ay);
+    }
+
+    ///
+    /// Updates the particles with AVX2, eight at a time, and removes the
+    /// expired ones. The living lanes of each vector are packed to its start
+    /// with a permutation looked up by the lane mask, and the whole vector
+    /// is stored at the write position, which then advances by the number
+    /// of the living lanes. The lanes stored past them are overwritten by
+    /// the next blocks, and they never reach past the block that is being
+    /// read, so the arrays are compacted in place.
+    ///
+    /// \param a the arrays of the particles.
+    /// \param count the number of the particles.
+    /// \param delta the time step.
+    /// \param ax the change of the velocity along the x axis.
+    /// \param ay the change of the velocity along the y axis.
+    ///
+    /// \return The number of the living particles.
+    ///
+    ODE_TARGET_AVX2 static std::size_t update_avx2(
+        const particle_arrays& a,
+        const std::size_t count,
+        const float delta,
+        const float ax,
+        const float ay) noexcept
+    {
+      const __m256 dt = _mm256_set1_ps(delta);
+      const __m256 dvx = _mm256_set1_ps(ax);
+      const __m256 dvy = _mm256_set1_ps(ay);
+      const __m256 zero = _mm256_setzero_ps();
+
+      std::size_t i = 0;
+      std::size_t j = 0;
+
+      for (; i + 8 <= count; i += 8)
+      {
+        const __m256 vx =
+            _mm256_add_ps(_mm256_load_ps(a.velocity_x + i), dvx);
+        const __m256 vy =
+            _mm256_add_ps(_mm256_load_ps(a.velocity_y + i), dvy);
+        const __m256 x =
+            _mm256_add_ps(_mm256_load_ps(a.x + i), _mm256_mul_ps(vx, dt));
+        const __m256 y =
+            _mm256_add_ps(_mm256_load_ps(a.y + i), _mm256_mul_ps(vy, dt));
+        const __m256 life = _mm256_sub_ps(_mm256_load_ps(a.lifetime + i), dt);
+        const int alive =
+            _mm256_movemask_ps(_mm256_cmp_ps(life, zero, _CMP_GT_OQ));
+
+        const __m256i lanes = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(packing_table.lanes[alive]));
+
+        _mm256_storeu_ps(
+            a.velocity_x + j, _mm256_permutevar8x32_ps(vx, lanes));
+        _mm256_storeu_ps(
+            a.velocity_y + j, _mm256_permutevar8x32_ps(vy, lanes));
+        _mm256_storeu_ps(a.x + j, _mm256_permutevar8x32_ps(x, lanes));
+        _mm256_storeu_ps(a.y + j, _mm256_permutevar8x32_ps(y, lanes));
+        _mm256_storeu_ps(
+            a.lifetime + j, _mm256_permutevar8x32_ps(life, lanes));
+        j += static_cast<std::size_t>(packing_table.counts[alive]);
+      }
+
+      return update_scalar(a, i, j, count, delta, ax, ay);
+    }
+#endif // ODE_SIMD_X86
+  } // namespace detail
+
+  particle_system::particle_system(
+      const std::size_t capacity, const sprite& appearance)
+      : xs(capacity, 0.0f),
+        ys(capacity, 0.0f),
+        velocities_x(capacity, 0.0f),
+        velocities_y(capacity, 0.0f),
+        lifetimes(capacity, 0.0f),
+        count{0},
+        appearance{appearance},
+        gravity_x{0.0f},
+        gravity_y{0.0f},
+        level{ode::get_simd_level()}
+  {
+  }
+
+  bool particle_system::emit(const particle& p) noexcept
+  {
+    if (lifetimes.size() == count || 0.0f >= p.lifetime)
+    {
+      return false;
+    }
+
+    xs[count] = p.x;
+    ys[count] = p.y;
+    velocities_x[count] = p.velocity_x;
+    velocities_y[count] = p.velocity_y;
+    lifetimes[count] = p.lifetime;
+    ++count;
+
+    return true;
+  }
+
+  void particle_system::clear() noexcept
+  {
+    count = 0;
+  }
+
+  void particle_system::update(const float delta) noexcept
+  {
+    if (0 == count)
+    {
+      return;
+    }
+
+    const detail::particle_arrays a{
+        xs.data(),
+        ys.data(),
+        velocities_x.data(),
+        velocities_y.data(),
+        lifetimes.data()};
+    const float ax = gravity_x * delta;
+    const float ay = gravity_y * delta;
+
+#if ODE_SIMD_X86
+    if (simd_level::avx2 == level)
+    {
+      count = detail::update_avx2(a, count, delta, ax, ay);
+    }
+    else if (simd_level::sse == level)
+    {
+      count = detail::update_sse(a, count, delta, ax, ay);
+    }
+    else
+    {
+      count = detail::update_scalar(a, 0, 0, count, delta, ax, ay);
+    }
+#else
+    count = detail::update_scalar(a, 0, 0, count, delta, ax, ay);
+#endif // !ODE_SIMD_X86
+  }
+
+  void particle_system::draw(sprite_batch& batch) const
+  {
+    const float half_width = appearance.width * 0.5f;
+    const float half_height = appearance.height * 0.5f;
+
+    batch.reserve(batch.get_sprite_count() + count);
+
+    sprite s = appearance;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      s.x = xs[i] - half_width;
+      s.y = ys[i] - half_height;
+      batch.add(s);
+    }
+  }
+
+  void particle_system::set_gravity(const float x, const float y) noexcept
+  {
+    gravity_x = x;
+    gravity_y = y;
+  }
+
+  void particle_system::set_simd_level(const simd_level level) noexcept
+  {
+    this->level = std::min(level, ode::get_simd_level());
+  }
+
+  simd_level particle_system::get_simd_level() const noexcept
+  {
+    return level;
+  }
+
+  std::size_t particle_system::get_count() const noexcept
+  {
+    return count;
+  }
+
+  std::size_t particle_system::get_capacity() const noexcept
+  {
+    return lifetimes.size();
+  }
+
+  particle particle_system::get(const std::size_t i) const
+  {
+    Expects(i < count);
+
+    return {xs[i], ys[i], velocities_x[i], velocities_y[i], lifetimes[i]};
+  }
+
+} // namespace ode
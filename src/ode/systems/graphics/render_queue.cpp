@@ -0,0 +1,202 @@
+/// The definition of the type of the queues which sort the recorded draw
+/// commands and submit them to OpenGL.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/render_queue.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include <glad/glad.h>
+
+#include "gsl/assert"
+
+#include "ode/__config"
+#include "ode/gl/gl_config.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The number of the bits sorted in a single pass of the radix sort.
+    ///
+    constexpr int radix_bits = 8;
+
+    ///
+    /// The number of the buckets in a single pass of the radix sort.
+    ///
+    constexpr std::size_t radix_size = 1u << radix_bits;
+
+    static void draw(const render_command& command)
+    {
+      const auto count = static_cast<GLsizei>(command.count);
+      const auto instances = static_cast<GLsizei>(command.instance_count);
+
+      if (0 == command.index_type)
+      {
+        const auto first = static_cast<GLint>(command.first);
+
+        if (1 == instances)
+        {
+          glDrawArrays(command.mode, first, count);
+        }
+        else
+        {
+          glDrawArraysInstanced(command.mode, first, count, instances);
+        }
+
+        return;
+      }
+
+      const auto* offset = reinterpret_cast<const void*>(
+          static_cast<std::uintptr_t>(command.first));
+
+      if (1 == instances)
+      {
+        glDrawElementsBaseVertex(
+            command.mode,
+            count,
+            command.index_type,
+            offset,
+            command.base_vertex);
+      }
+      else
+      {
+        glDrawElementsInstancedBaseVertex(
+            command.mode,
+            count,
+            command.index_type,
+            offset,
+            instances,
+            command.base_vertex);
+      }
+    }
+  } // namespace detail
+
+  void sort_commands(
+      std::vector<render_command>& commands,
+      std::vector<render_command>& scratch)
+  {
+    constexpr int passes = 64 / detail::radix_bits;
+    constexpr auto mask = detail::radix_size - 1;
+
+    // The histograms of all of the passes are counted in a single read of
+    // the keys.
+    std::array<std::array<std::size_t, detail::radix_size>, passes> counts{};
+
+    for (const auto& command : commands)
+    {
+      for (int pass = 0; pass < passes; ++pass)
+      {
+        ++counts[pass][(command.key >> (pass * detail::radix_bits)) & mask];
+      }
+    }
+
+    scratch.resize(commands.size());
+
+    for (int pass = 0; pass < passes; ++pass)
+    {
+      auto& count = counts[pass];
+
+      // If every key has the same digit, the pass wouldn't move anything.
+      if (std::any_of(count.begin(), count.end(), [&commands](auto c) {
+            return commands.size() == c;
+          }))
+      {
+        continue;
+      }
+
+      std::size_t offset = 0;
+
+      for (auto& c : count)
+      {
+        offset += std::exchange(c, offset);
+      }
+
+      const int shift = pass * detail::radix_bits;
+
+      for (const auto& command : commands)
+      {
+        scratch[count[(command.key >> shift) & mask]++] = command;
+      }
+
+      commands.swap(scratch);
+    }
+  }
+
+  render_queue::render_queue(const std::size_t buffer_count)
+      : buffers(buffer_count), commands{}, scratch{}
+  {
+    Expects(0 < buffer_count);
+  }
+
+  command_buffer& render_queue::get_buffer(const std::size_t index)
+  {
+    Expects(index < buffers.size());
+    return buffers[index];
+  }
+
+  const std::vector<render_command>& render_queue::sort()
+  {
+    std::size_t size = 0;
+
+    for (const auto& buffer : buffers)
+    {
+      size += buffer.size();
+    }
+
+    commands.clear();
+    commands.reserve(size);
+
+    for (const auto& buffer : buffers)
+    {
+      const auto& recorded = buffer.get_commands();
+      commands.insert(commands.end(), recorded.begin(), recorded.end());
+    }
+
+    sort_commands(commands, scratch);
+
+    return commands;
+  }
+
+  render_statistics render_queue::submit(render_state_cache& state)
+  {
+    const auto changes = state.get_change_count();
+    const auto skips = state.get_skip_count();
+
+    for (const auto& command : sort())
+    {
+      state.use_program(command.program);
+      state.bind_vertex_array(command.vertex_array);
+      state.bind_texture(command.texture);
+
+      if constexpr (!disable_gl_calls)
+      {
+        detail::draw(command);
+      }
+    }
+
+    clear();
+
+    return {
+        commands.size(),
+        state.get_change_count() - changes,
+        state.get_skip_count() - skips};
+  }
+
+  void render_queue::clear() noexcept
+  {
+    for (auto& buffer : buffers)
+    {
+      buffer.clear();
+    }
+  }
+
+} // namespace ode
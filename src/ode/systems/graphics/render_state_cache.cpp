@@ -0,0 +1,85 @@
+/// The definition of the type of the caches which skip the redundant OpenGL
+/// state changes.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/render_state_cache.h"
+
+#include <glad/glad.h>
+
+#include "ode/gl/gl_config.h"
+
+namespace ode
+{
+  render_state_cache::render_state_cache()
+      : program{},
+        vertex_array{},
+        texture{},
+        change_count{0},
+        skip_count{0}
+  {
+  }
+
+  void render_state_cache::use_program(const std::uint32_t p)
+  {
+    if (program == p)
+    {
+      ++skip_count;
+      return;
+    }
+
+    program = p;
+    ++change_count;
+
+    if constexpr (!disable_gl_calls)
+    {
+      glUseProgram(p);
+    }
+  }
+
+  void render_state_cache::bind_vertex_array(const std::uint32_t a)
+  {
+    if (vertex_array == a)
+    {
+      ++skip_count;
+      return;
+    }
+
+    vertex_array = a;
+    ++change_count;
+
+    if constexpr (!disable_gl_calls)
+    {
+      glBindVertexArray(a);
+    }
+  }
+
+  void render_state_cache::bind_texture(const std::uint32_t t)
+  {
+    if (texture == t)
+    {
+      ++skip_count;
+      return;
+    }
+
+    texture = t;
+    ++change_count;
+
+    if constexpr (!disable_gl_calls)
+    {
+      glActiveTexture(GL_TEXTURE0);
+      glBindTexture(GL_TEXTURE_2D, t);
+    }
+  }
+
+  void render_state_cache::invalidate() noexcept
+  {
+    program.reset();
+    vertex_array.reset();
+    texture.reset();
+  }
+
+} // namespace ode
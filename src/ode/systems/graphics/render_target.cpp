@@ -0,0 +1,108 @@
+/// The definition of the type of the offscreen targets into which the frames
+/// can be rendered.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/render_target.h"
+
+#include <stdexcept>
+
+#include <glad/glad.h>
+
+#include "gsl/assert"
+
+#include "ode/gl/gl_config.h"
+#include "ode/logger.h"
+
+namespace ode
+{
+  render_target::render_target(const int width, const int height)
+      : width{width}, height{height}, framebuffer{0}, texture{0}
+  {
+    Expects(0 < width && 0 < height);
+
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(
+        GL_TEXTURE_2D,
+        0,
+        GL_RGBA8,
+        width,
+        height,
+        0,
+        GL_RGBA,
+        GL_UNSIGNED_BYTE,
+        nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(
+        GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (GL_FRAMEBUFFER_COMPLETE != status)
+    {
+      glDeleteFramebuffers(1, &framebuffer);
+      glDeleteTextures(1, &texture);
+
+      ODE_ERROR("The render target is incomplete: {:#x}", status);
+
+      throw std::runtime_error{"The render target creation failed"};
+    }
+
+    ODE_TRACE(
+        "Created a render target of {}x{} pixels in the framebuffer {}",
+        width,
+        height,
+        framebuffer);
+  }
+
+  render_target::~render_target()
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteTextures(1, &texture);
+  }
+
+  void render_target::bind() const
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, width, height);
+  }
+
+  void render_target::unbind() const
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  }
+
+} // namespace ode
@@ -0,0 +1,154 @@
+/// The definition of the type of the packers which place rectangles in the
+/// pages of the texture atlases.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/skyline_packer.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  skyline_packer::skyline_packer(
+      const int width, const int height) ODE_CONTRACT_NOEXCEPT
+      : width{width}, height{height}, used{0}, skyline{{0, 0, width}}
+  {
+    Expects(width > 0 && height > 0);
+  }
+
+  std::optional<atlas_region> skyline_packer::insert(
+      const int w, const int h)
+  {
+    if (w <= 0 || h <= 0)
+    {
+      return std::nullopt;
+    }
+
+    auto best_index = skyline.size();
+    int best_bottom = std::numeric_limits<int>::max();
+    int best_width = std::numeric_limits<int>::max();
+    int best_y = 0;
+
+    for (std::size_t i = 0; i < skyline.size(); ++i)
+    {
+      const auto y = fit(i, w, h);
+
+      if (!y)
+      {
+        continue;
+      }
+
+      // The ties are broken by the narrower segment so that the wide
+      // segments are left for the wide rectangles.
+      const int bottom = *y + h;
+
+      if (bottom < best_bottom ||
+          (bottom == best_bottom && skyline[i].width < best_width))
+      {
+        best_index = i;
+        best_bottom = bottom;
+        best_width = skyline[i].width;
+        best_y = *y;
+      }
+    }
+
+    if (skyline.size() == best_index)
+    {
+      return std::nullopt;
+    }
+
+    const int x = skyline[best_index].x;
+
+    skyline.insert(
+        skyline.begin() + static_cast<std::ptrdiff_t>(best_index),
+        segment{x, best_bottom, w});
+
+    // Shrink or remove the segments that are now under the new one.
+    for (auto i = best_index + 1; i < skyline.size();)
+    {
+      auto& s = skyline[i];
+      const int overlap = x + w - s.x;
+
+      if (overlap <= 0)
+      {
+        break;
+      }
+
+      if (overlap < s.width)
+      {
+        s.x += overlap;
+        s.width -= overlap;
+        break;
+      }
+
+      skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    // Merge the neighbouring segments on the same row.
+    for (std::size_t i = 0; i + 1 < skyline.size();)
+    {
+      if (skyline[i].y == skyline[i + 1].y)
+      {
+        skyline[i].width += skyline[i + 1].width;
+        skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+      }
+      else
+      {
+        ++i;
+      }
+    }
+
+    used += static_cast<long long>(w) * h;
+
+    return atlas_region{x, best_y, w, h};
+  }
+
+  int skyline_packer::get_width() const noexcept
+  {
+    return width;
+  }
+
+  int skyline_packer::get_height() const noexcept
+  {
+    return height;
+  }
+
+  float skyline_packer::get_occupancy() const noexcept
+  {
+    return static_cast<float>(used) /
+        (static_cast<float>(width) * static_cast<float>(height));
+  }
+
+  std::optional<int> skyline_packer::fit(
+      const std::size_t index, const int w, const int h) const
+  {
+    if (skyline[index].x + w > width)
+    {
+      return std::nullopt;
+    }
+
+    int y = 0;
+    int remaining = w;
+
+    for (auto i = index; remaining > 0; ++i)
+    {
+      y = std::max(y, skyline[i].y);
+
+      if (y + h > height)
+      {
+        return std::nullopt;
+      }
+
+      remaining -= skyline[i].width;
+    }
+
+    return y;
+  }
+
+} // namespace ode
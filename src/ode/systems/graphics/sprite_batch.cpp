@@ -0,0 +1,103 @@
+/// The definition of the type of the batches which collect the sprites drawn
+/// during a frame.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/sprite_batch.h"
+
+#include <algorithm>
+
+#include "ode/systems/graphics/graphics_config.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    static std::uint64_t make_sort_key(const sprite& s) noexcept
+    {
+      // The sign bit of the layer is flipped so that the negative layers are
+      // sorted before the positive ones.
+      const auto layer = static_cast<std::uint16_t>(s.layer ^ 0x8000);
+
+      return (static_cast<std::uint64_t>(layer) << 32) | s.texture;
+    }
+  } // namespace detail
+
+  sprite_batch::sprite_batch() : sprites{}, keys{}, vertices{}, draws{}
+  {
+  }
+
+  void sprite_batch::clear() noexcept
+  {
+    sprites.clear();
+    keys.clear();
+    vertices.clear();
+    draws.clear();
+  }
+
+  void sprite_batch::add(const sprite& s)
+  {
+    keys.emplace_back(
+        detail::make_sort_key(s), static_cast<std::uint32_t>(sprites.size()));
+    sprites.push_back(s);
+  }
+
+  void sprite_batch::reserve(const std::size_t count)
+  {
+    sprites.reserve(count);
+    keys.reserve(count);
+  }
+
+  void sprite_batch::build()
+  {
+    // The indices break the ties so the order of the sprites with equal keys
+    // is kept.
+    std::sort(keys.begin(), keys.end());
+
+    vertices.resize(sprites.size() * 4);
+    draws.clear();
+
+    sprite_vertex* v = vertices.data();
+
+    for (const auto& [key, index] : keys)
+    {
+      const sprite& s = sprites[index];
+      const std::size_t first = static_cast<std::size_t>(v - vertices.data());
+
+      if (draws.empty() || draws.back().texture != s.texture ||
+          sprite_batch_size == draws.back().sprite_count)
+      {
+        draws.push_back({s.texture, first, 0});
+      }
+
+      ++draws.back().sprite_count;
+
+      const float right = s.x + s.width;
+      const float bottom = s.y + s.height;
+
+      *v++ = {s.x, s.y, s.u0, s.v0, s.colour};
+      *v++ = {right, s.y, s.u1, s.v0, s.colour};
+      *v++ = {right, bottom, s.u1, s.v1, s.colour};
+      *v++ = {s.x, bottom, s.u0, s.v1, s.colour};
+    }
+  }
+
+  std::size_t sprite_batch::get_sprite_count() const noexcept
+  {
+    return sprites.size();
+  }
+
+  const std::vector<sprite_vertex>& sprite_batch::get_vertices() const noexcept
+  {
+    return vertices;
+  }
+
+  const std::vector<sprite_draw>& sprite_batch::get_draws() const noexcept
+  {
+    return draws;
+  }
+
+} // namespace ode
@@ -0,0 +1,391 @@
+/// The definition of the type of the renderer which draws batches of sprites.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/sprite_renderer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ode/gl/capabilities.h"
+#include "ode/gl/gl_config.h"
+#include "ode/gl/shader.h"
+#include "ode/logger.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    static constexpr const char* sprite_vertex_shader = R"(#version 150 core
+uniform mat4 projection;
+in vec2 position;
+in vec2 texture_coordinate;
+in vec4 colour;
+out vec2 uv;
+out vec4 tint;
+void main()
+{
+  uv = texture_coordinate;
+  tint = colour;
+  gl_Position = projection * vec4(position, 0.0, 1.0);
+}
+)";
+
+    static constexpr const char* sprite_fragment_shader = R"(#version 150 core
+uniform sampler2D sprite_texture;
+in vec2 uv;
+in vec4 tint;
+out vec4 fragment_colour;
+void main()
+{
+  fragment_colour = texture(sprite_texture, uv) * tint;
+}
+)";
+
+    static std::vector<std::uint16_t> make_sprite_indices()
+    {
+      std::vector<std::uint16_t> indices(sprite_batch_size * 6);
+
+      for (std::size_t i = 0; i < sprite_batch_size; ++i)
+      {
+        const auto first = static_cast<std::uint16_t>(i * 4);
+
+        indices[i * 6] = first;
+        indices[i * 6 + 1] = first + 1;
+        indices[i * 6 + 2] = first + 2;
+        indices[i * 6 + 3] = first + 2;
+        indices[i * 6 + 4] = first + 3;
+        indices[i * 6 + 5] = first;
+      }
+
+      return indices;
+    }
+
+    static constexpr std::size_t sprite_region_bytes =
+        sprite_buffer_size * 4 * sizeof(sprite_vertex);
+  } // namespace detail
+
+  std::array<float, 16> make_orthographic(
+      const float left,
+      const float right,
+      const float bottom,
+      const float top) noexcept
+  {
+    return {
+        2.0f / (right - left),
+        0.0f,
+        0.0f,
+        0.0f,
+        0.0f,
+        2.0f / (top - bottom),
+        0.0f,
+        0.0f,
+        0.0f,
+        0.0f,
+        -1.0f,
+        0.0f,
+        -(right + left) / (right - left),
+        -(top + bottom) / (top - bottom),
+        0.0f,
+        1.0f};
+  }
+
+  sprite_renderer::sprite_renderer()
+      : program{0},
+        projection_location{-1},
+        vertex_array{0},
+        vertex_buffer{0},
+        index_buffer{0},
+        mapped{nullptr},
+        fences{},
+        region{0},
+        persistent{false}
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    program = gl::make_program(
+        detail::sprite_vertex_shader,
+        detail::sprite_fragment_shader,
+        {"position", "texture_coordinate", "colour"});
+    projection_location = glGetUniformLocation(program, "projection");
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "sprite_texture"), 0);
+
+    glGenVertexArrays(1, &vertex_array);
+    glBindVertexArray(vertex_array);
+
+    const auto indices = detail::make_sprite_indices();
+
+    glGenBuffers(1, &index_buffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+    glBufferData(
+        GL_ELEMENT_ARRAY_BUFFER,
+        static_cast<GLsizeiptr>(indices.size() * sizeof(std::uint16_t)),
+        indices.data(),
+        GL_STATIC_DRAW);
+
+    glGenBuffers(1, &vertex_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+
+#if defined(GL_ARB_buffer_storage) && GL_ARB_buffer_storage
+
+    if (gl::get_capabilities().persistent_mapping)
+    {
+      const GLbitfield flags =
+          GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+      const auto size = static_cast<GLsizeiptr>(
+          detail::sprite_region_bytes * sprite_buffer_regions);
+
+      glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+
+      mapped = static_cast<sprite_vertex*>(
+          glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+      persistent = nullptr != mapped;
+
+      if (!persistent)
+      {
+        // The storage of the buffer is immutable so a new buffer is needed
+        // for orphaning.
+        glDeleteBuffers(1, &vertex_buffer);
+        glGenBuffers(1, &vertex_buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+      }
+    }
+
+#endif // defined(GL_ARB_buffer_storage) && GL_ARB_buffer_storage
+
+    if (!persistent)
+    {
+      glBufferData(
+          GL_ARRAY_BUFFER,
+          static_cast<GLsizeiptr>(detail::sprite_region_bytes),
+          nullptr,
+          GL_STREAM_DRAW);
+    }
+
+    constexpr auto stride = static_cast<GLsizei>(sizeof(sprite_vertex));
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(
+        0,
+        2,
+        GL_FLOAT,
+        GL_FALSE,
+        stride,
+        reinterpret_cast<const void*>(offsetof(sprite_vertex, x)));
+
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(
+        1,
+        2,
+        GL_FLOAT,
+        GL_FALSE,
+        stride,
+        reinterpret_cast<const void*>(offsetof(sprite_vertex, u)));
+
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(
+        2,
+        4,
+        GL_UNSIGNED_BYTE,
+        GL_TRUE,
+        stride,
+        reinterpret_cast<const void*>(offsetof(sprite_vertex, colour)));
+
+    glBindVertexArray(0);
+
+    ODE_DEBUG(
+        "Created the sprite renderer with {}",
+        persistent ? "a persistently mapped vertex buffer"
+                   : "an orphaned vertex buffer");
+  }
+
+  sprite_renderer::~sprite_renderer()
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    for (GLsync fence : fences)
+    {
+      if (nullptr != fence)
+      {
+        glDeleteSync(fence);
+      }
+    }
+
+    if (persistent)
+    {
+      glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+      glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
+    glDeleteBuffers(1, &vertex_buffer);
+    glDeleteBuffers(1, &index_buffer);
+    glDeleteVertexArrays(1, &vertex_array);
+    glDeleteProgram(program);
+  }
+
+  std::size_t sprite_renderer::draw(
+      const sprite_batch& batch, const std::array<float, 16>& projection)
+  {
+    const auto& draws = batch.get_draws();
+
+    if constexpr (disable_gl_calls)
+    {
+      return draws.size();
+    }
+
+    if (draws.empty())
+    {
+      return 0;
+    }
+
+    glUseProgram(program);
+    glUniformMatrix4fv(projection_location, 1, GL_FALSE, projection.data());
+
+    glBindVertexArray(vertex_array);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glActiveTexture(GL_TEXTURE0);
+
+    const sprite_vertex* vertices = batch.get_vertices().data();
+
+    std::size_t draw_count = 0;
+    std::size_t first = 0;
+    bool bound = false;
+    std::uint32_t texture = 0;
+
+    while (first < draws.size())
+    {
+      // The draw calls are gathered into a pass until a region of the
+      // buffer is full.
+      std::size_t last = first;
+      std::size_t sprite_count = 0;
+
+      while (draws.size() > last &&
+             sprite_buffer_size >= sprite_count + draws[last].sprite_count)
+      {
+        sprite_count += draws[last].sprite_count;
+        ++last;
+      }
+
+      const std::size_t source = draws[first].first_vertex;
+      sprite_vertex* target = begin_pass();
+
+      if (nullptr == target)
+      {
+        ODE_ERROR("The sprite vertex buffer can't be mapped");
+        break;
+      }
+
+      std::memcpy(
+          target, vertices + source, sprite_count * 4 * sizeof(sprite_vertex));
+
+      if (!persistent)
+      {
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+      }
+
+      const GLint base_vertex = get_base_vertex();
+
+      for (std::size_t i = first; i < last; ++i)
+      {
+        if (!bound || texture != draws[i].texture)
+        {
+          texture = draws[i].texture;
+          bound = true;
+          glBindTexture(GL_TEXTURE_2D, texture);
+        }
+
+        glDrawElementsBaseVertex(
+            GL_TRIANGLES,
+            static_cast<GLsizei>(draws[i].sprite_count * 6),
+            GL_UNSIGNED_SHORT,
+            nullptr,
+            base_vertex + static_cast<GLint>(draws[i].first_vertex - source));
+
+        ++draw_count;
+      }
+
+      end_pass();
+
+      first = last;
+    }
+
+    glBindVertexArray(0);
+
+    return draw_count;
+  }
+
+  bool sprite_renderer::is_persistent() const noexcept
+  {
+    return persistent;
+  }
+
+  sprite_vertex* sprite_renderer::begin_pass()
+  {
+    if (persistent)
+    {
+      region = (region + 1) % sprite_buffer_regions;
+
+      if (GLsync fence = fences[region]; nullptr != fence)
+      {
+        // The fence is flushed on the first wait so that it can't block
+        // forever.
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+
+        while (GL_TIMEOUT_EXPIRED == glClientWaitSync(fence, flags, 1000000))
+        {
+          flags = 0;
+        }
+
+        glDeleteSync(fence);
+        fences[region] = nullptr;
+      }
+
+      return mapped + region * sprite_buffer_size * 4;
+    }
+
+    // The old storage of the buffer is orphaned so that the driver doesn't
+    // need to wait for the previous draw calls that read it.
+    glBufferData(
+        GL_ARRAY_BUFFER,
+        static_cast<GLsizeiptr>(detail::sprite_region_bytes),
+        nullptr,
+        GL_STREAM_DRAW);
+
+    return static_cast<sprite_vertex*>(glMapBufferRange(
+        GL_ARRAY_BUFFER,
+        0,
+        static_cast<GLsizeiptr>(detail::sprite_region_bytes),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+  }
+
+  void sprite_renderer::end_pass()
+  {
+    if (persistent)
+    {
+      fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+  }
+
+  GLint sprite_renderer::get_base_vertex() const noexcept
+  {
+    return persistent ? static_cast<GLint>(region * sprite_buffer_size * 4)
+                      : 0;
+  }
+
+} // namespace ode
@@ -0,0 +1,83 @@
+/// The definition of the type of the builders which lay out images in the
+/// pages of texture atlases.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/texture_atlas.h"
+
+#include <algorithm>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  atlas_builder::atlas_builder(
+      const int page_size, const int padding) ODE_CONTRACT_NOEXCEPT
+      : page_size{page_size}, padding{padding}, pages{}
+  {
+    Expects(page_size > 0 && padding >= 0);
+  }
+
+  atlas_entry atlas_builder::add(const int width, const int height)
+  {
+    Expects(width > 0 && height > 0);
+
+    // The padding is kept on the right and the bottom of each image, and the
+    // edges of the page act as the padding on the other sides.
+    const int padded_width = width + padding;
+    const int padded_height = height + padding;
+
+    for (std::size_t i = 0; i < pages.size(); ++i)
+    {
+      if (const auto region = pages[i].insert(padded_width, padded_height))
+      {
+        return {i, {region->x, region->y, width, height}};
+      }
+    }
+
+    if (width > page_size || height > page_size)
+    {
+      pages.emplace_back(width, height);
+      pages.back().insert(width, height);
+
+      return {pages.size() - 1, {0, 0, width, height}};
+    }
+
+    pages.emplace_back(page_size, page_size);
+
+    const auto region = pages.back().insert(
+        std::min(padded_width, page_size), std::min(padded_height, page_size));
+
+    Ensures(region.has_value());
+
+    return {pages.size() - 1, {region->x, region->y, width, height}};
+  }
+
+  std::size_t atlas_builder::get_page_count() const noexcept
+  {
+    return pages.size();
+  }
+
+  int atlas_builder::get_page_width(
+      const std::size_t page) const ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(page < pages.size());
+    return pages[page].get_width();
+  }
+
+  int atlas_builder::get_page_height(
+      const std::size_t page) const ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(page < pages.size());
+    return pages[page].get_height();
+  }
+
+  image atlas_builder::make_page_image(const std::size_t page) const
+  {
+    return make_image(get_page_width(page), get_page_height(page));
+  }
+
+} // namespace ode
@@ -0,0 +1,116 @@
+/// The definition of the type of the caches which share the GPU textures
+/// between their users.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/texture_cache.h"
+
+#include <glad/glad.h>
+
+#include "ode/gl/gl_config.h"
+#include "ode/logger.h"
+
+namespace ode
+{
+  texture_cache::texture_cache() : entries{}, uploads{0}
+  {
+  }
+
+  texture_cache::~texture_cache()
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    for (auto& [key, e] : entries)
+    {
+      glDeleteTextures(1, &e.texture);
+    }
+  }
+
+  void texture_cache::release(const std::string& key)
+  {
+    const auto it = entries.find(key);
+
+    if (entries.end() == it || 0 != --it->second.references)
+    {
+      return;
+    }
+
+    if constexpr (!disable_gl_calls)
+    {
+      glDeleteTextures(1, &it->second.texture);
+    }
+
+    ODE_TRACE("Deleted the texture '{}'", key);
+
+    entries.erase(it);
+  }
+
+  bool texture_cache::contains(const std::string& key) const
+  {
+    return entries.count(key) > 0;
+  }
+
+  std::size_t texture_cache::get_reference_count(const std::string& key) const
+  {
+    const auto it = entries.find(key);
+    return entries.end() == it ? 0 : it->second.references;
+  }
+
+  std::size_t texture_cache::get_texture_count() const noexcept
+  {
+    return entries.size();
+  }
+
+  std::size_t texture_cache::get_upload_count() const noexcept
+  {
+    return uploads;
+  }
+
+  std::uint32_t texture_cache::insert(const std::string& key, const image& img)
+  {
+    GLuint texture = 0;
+
+    if constexpr (!disable_gl_calls)
+    {
+      glGenTextures(1, &texture);
+      glBindTexture(GL_TEXTURE_2D, texture);
+
+      // The tiles and the sprites are drawn pixel for pixel, and the atlases
+      // have no mipmaps.
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+      glTexImage2D(
+          GL_TEXTURE_2D,
+          0,
+          GL_RGBA8,
+          img.width,
+          img.height,
+          0,
+          GL_RGBA,
+          GL_UNSIGNED_BYTE,
+          img.pixels.data());
+    }
+
+    entries.emplace(key, entry{texture, 1});
+    ++uploads;
+
+    ODE_TRACE(
+        "Uploaded the texture '{}' of {}x{} pixels",
+        key,
+        img.width,
+        img.height);
+
+    return texture;
+  }
+
+} // namespace ode
@@ -0,0 +1,160 @@
+/// The definition of the type of the tile layers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/tile_layer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+#include "gsl/assert"
+
+#include "ode/systems/graphics/graphics_config.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    static int count_chunks(const int tiles) noexcept
+    {
+      return (tiles + tile_chunk_size - 1) / tile_chunk_size;
+    }
+  } // namespace detail
+
+  tile_layer::tile_layer() : tile_layer{0, 0}
+  {
+  }
+
+  tile_layer::tile_layer(const int w, const int h)
+      : tile_layer{
+            w, h, std::vector<std::uint32_t>(static_cast<std::size_t>(w) * h)}
+  {
+  }
+
+  tile_layer::tile_layer(
+      const int w, const int h, std::vector<std::uint32_t> gids)
+      : width{w},
+        height{h},
+        chunk_columns{detail::count_chunks(w)},
+        tiles{std::move(gids)},
+        dirty{},
+        dirty_chunks{}
+  {
+    Expects(w >= 0 && h >= 0);
+    Expects(tiles.size() == static_cast<std::size_t>(w) * h);
+
+    const int chunk_count = chunk_columns * detail::count_chunks(h);
+
+    dirty.assign(static_cast<std::size_t>(chunk_count), true);
+    dirty_chunks.resize(static_cast<std::size_t>(chunk_count));
+    std::iota(dirty_chunks.begin(), dirty_chunks.end(), 0);
+  }
+
+  int tile_layer::get_width() const noexcept
+  {
+    return width;
+  }
+
+  int tile_layer::get_height() const noexcept
+  {
+    return height;
+  }
+
+  std::uint32_t tile_layer::get(const int x, const int y) const
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(x >= 0 && x < width && y >= 0 && y < height);
+    return tiles[static_cast<std::size_t>(y) * width + x];
+  }
+
+  void tile_layer::set(const int x, const int y, const std::uint32_t gid)
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(x >= 0 && x < width && y >= 0 && y < height);
+
+    auto& tile = tiles[static_cast<std::size_t>(y) * width + x];
+
+    if (gid != tile)
+    {
+      tile = gid;
+      mark_dirty(x, y);
+    }
+  }
+
+  const std::uint32_t* tile_layer::get_data() const noexcept
+  {
+    return tiles.data();
+  }
+
+  std::vector<tile_range> tile_layer::take_dirty_chunks()
+  {
+    std::vector<tile_range> ranges{};
+
+    ranges.reserve(dirty_chunks.size());
+
+    for (const int chunk : dirty_chunks)
+    {
+      const int x = chunk % chunk_columns * tile_chunk_size;
+      const int y = chunk / chunk_columns * tile_chunk_size;
+
+      ranges.push_back(
+          {x,
+           y,
+           std::min(tile_chunk_size, width - x),
+           std::min(tile_chunk_size, height - y)});
+
+      dirty[static_cast<std::size_t>(chunk)] = false;
+    }
+
+    dirty_chunks.clear();
+
+    return ranges;
+  }
+
+  std::size_t tile_layer::get_dirty_chunk_count() const noexcept
+  {
+    return dirty_chunks.size();
+  }
+
+  tile_range tile_layer::get_visible_range(
+      const float left,
+      const float top,
+      const float right,
+      const float bottom,
+      const float tile_width,
+      const float tile_height) const noexcept
+  {
+    const auto clamp_column = [this](const float c) {
+      return static_cast<int>(std::clamp(c, 0.0f, static_cast<float>(width)));
+    };
+
+    const auto clamp_row = [this](const float r) {
+      return static_cast<int>(std::clamp(r, 0.0f, static_cast<float>(height)));
+    };
+
+    const int x0 = clamp_column(std::floor(left / tile_width));
+    const int y0 = clamp_row(std::floor(top / tile_height));
+    const int x1 = clamp_column(std::ceil(right / tile_width));
+    const int y1 = clamp_row(std::ceil(bottom / tile_height));
+
+    return {x0, y0, std::max(0, x1 - x0), std::max(0, y1 - y0)};
+  }
+
+  void tile_layer::mark_dirty(const int x, const int y)
+  {
+    const int chunk =
+        y / tile_chunk_size * chunk_columns + x / tile_chunk_size;
+
+    if (!dirty[static_cast<std::size_t>(chunk)])
+    {
+      dirty[static_cast<std::size_t>(chunk)] = true;
+      dirty_chunks.push_back(chunk);
+    }
+  }
+
+} // namespace ode
@@ -0,0 +1,515 @@
+/// The definitions of the types of the renderer which draws tile layers and
+/// the GPU textures of the tile layers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/tile_renderer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "ode/gl/gl_config.h"
+#include "ode/gl/shader.h"
+#include "ode/logger.h"
+#include "ode/systems/graphics/graphics_config.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    // Each instance is a tile, and its corner is taken from the vertex ID of
+    // a triangle strip. The tiles with no tile from the tileset collapse to
+    // a point outside of the view so that they produce no fragments. The
+    // flipping flags of Tiled are in the three highest bits of the global
+    // tile IDs, and the diagonal flip is applied before the horizontal and
+    // the vertical flips. The animated tiles are replaced by looking their
+    // IDs up from the table of the animated tiles, which is empty if none is
+    // given.
+    static constexpr const char* tile_vertex_shader = R"(#version 150 core
+uniform mat4 projection;
+uniform usampler2D tiles;
+uniform ivec2 origin;
+uniform int columns;
+uniform vec2 tile_size;
+uniform uint first_gid;
+uniform int tileset_columns;
+uniform uint tile_count;
+uniform vec2 tile_uv_size;
+uniform vec2 tile_stride;
+uniform vec2 tileset_origin;
+uniform usampler2D tile_table;
+uniform uint tile_table_size;
+out vec2 uv;
+void main()
+{
+  ivec2 tile = origin + ivec2(gl_InstanceID % columns, gl_InstanceID / columns);
+  uint gid = texelFetch(tiles, tile, 0).r;
+  uint id = gid & 0x1fffffffu;
+  if (id < tile_table_size)
+  {
+    int width = textureSize(tile_table, 0).x;
+    id = texelFetch(tile_table, ivec2(int(id) % width, int(id) / width), 0).r;
+  }
+  if (id < first_gid || id - first_gid >= tile_count)
+  {
+    uv = vec2(0.0);
+    gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+    return;
+  }
+  vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+  vec2 texel = corner;
+  if (0u != (gid & 0x20000000u)) texel = texel.yx;
+  if (0u != (gid & 0x80000000u)) texel.x = 1.0 - texel.x;
+  if (0u != (gid & 0x40000000u)) texel.y = 1.0 - texel.y;
+  int index = int(id - first_gid);
+  vec2 cell = vec2(index % tileset_columns, index / tileset_columns);
+  uv = tileset_origin + cell * tile_stride + texel * tile_uv_size;
+  gl_Position = projection * vec4((vec2(tile) + corner) * tile_size, 0.0, 1.0);
+}
+)";
+
+    static constexpr const char* tile_fragment_shader = R"(#version 150 core
+uniform sampler2D tileset;
+uniform float opacity;
+in vec2 uv;
+out vec4 fragment_colour;
+void main()
+{
+  vec4 colour = texture(tileset, uv);
+  if (0.0 == colour.a) discard;
+  fragment_colour = vec4(colour.rgb, colour.a * opacity);
+}
+)";
+  } // namespace detail
+
+  int get_tileset_columns(const tileset& set) noexcept
+  {
+    const int stride = set.tile_width + set.spacing;
+
+    if (0 >= stride)
+    {
+      return 1;
+    }
+
+    return std::max(
+        1, (set.image_width - 2 * set.margin + set.spacing) / stride);
+  }
+
+  std::uint32_t get_tile_count(const tileset& set) noexcept
+  {
+    if (0 != set.tile_count)
+    {
+      return set.tile_count;
+    }
+
+    const int stride = set.tile_height + set.spacing;
+
+    if (0 >= stride)
+    {
+      return 0;
+    }
+
+    const int rows = std::max(
+        0, (set.image_height - 2 * set.margin + set.spacing) / stride);
+
+    return static_cast<std::uint32_t>(get_tileset_columns(set) * rows);
+  }
+
+  tile_layer_texture::tile_layer_texture() : texture{0}, width{0}, height{0}
+  {
+  }
+
+  tile_layer_texture::tile_layer_texture(tile_layer_texture&& a) noexcept
+      : texture{std::exchange(a.texture, 0)},
+        width{std::exchange(a.width, 0)},
+        height{std::exchange(a.height, 0)}
+  {
+  }
+
+  tile_layer_texture::~tile_layer_texture()
+  {
+    if (0 != texture)
+    {
+      glDeleteTextures(1, &texture);
+    }
+  }
+
+  tile_layer_texture& tile_layer_texture::operator=(
+      tile_layer_texture&& a) noexcept
+  {
+    if (this != &a)
+    {
+      if (0 != texture)
+      {
+        glDeleteTextures(1, &texture);
+      }
+
+      texture = std::exchange(a.texture, 0);
+      width = std::exchange(a.width, 0);
+      height = std::exchange(a.height, 0);
+    }
+
+    return *this;
+  }
+
+  std::size_t tile_layer_texture::update(tile_layer& layer)
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return layer.take_dirty_chunks().size();
+    }
+
+    if (0 == texture)
+    {
+      glGenTextures(1, &texture);
+      glBindTexture(GL_TEXTURE_2D, texture);
+
+      // Integer textures can't be filtered.
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    else
+    {
+      glBindTexture(GL_TEXTURE_2D, texture);
+    }
+
+    if (layer.get_width() != width || layer.get_height() != height)
+    {
+      width = layer.get_width();
+      height = layer.get_height();
+
+      glTexImage2D(
+          GL_TEXTURE_2D,
+          0,
+          GL_R32UI,
+          width,
+          height,
+          0,
+          GL_RED_INTEGER,
+          GL_UNSIGNED_INT,
+          layer.get_data());
+
+      const auto chunks = layer.take_dirty_chunks().size();
+
+      ODE_TRACE(
+          "Uploaded the whole tile layer of {}x{} tiles", width, height);
+
+      return chunks;
+    }
+
+    const auto chunks = layer.take_dirty_chunks();
+
+    if (chunks.empty())
+    {
+      return 0;
+    }
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+
+    for (const auto& chunk : chunks)
+    {
+      glTexSubImage2D(
+          GL_TEXTURE_2D,
+          0,
+          chunk.x,
+          chunk.y,
+          chunk.width,
+          chunk.height,
+          GL_RED_INTEGER,
+          GL_UNSIGNED_INT,
+          layer.get_data() + static_cast<std::size_t>(chunk.y) * width +
+              chunk.x);
+    }
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+    ODE_TRACE("Uploaded {} chunks of the tile layer", chunks.size());
+
+    return chunks.size();
+  }
+
+  GLuint tile_layer_texture::get_texture() const noexcept
+  {
+    return texture;
+  }
+
+  tile_table_texture::tile_table_texture() : texture{0}, rows{0}, size{0}
+  {
+  }
+
+  tile_table_texture::tile_table_texture(tile_table_texture&& a) noexcept
+      : texture{std::exchange(a.texture, 0)},
+        rows{std::exchange(a.rows, 0)},
+        size{std::exchange(a.size, 0)}
+  {
+  }
+
+  tile_table_texture::~tile_table_texture()
+  {
+    if (0 != texture)
+    {
+      glDeleteTextures(1, &texture);
+    }
+  }
+
+  tile_table_texture& tile_table_texture::operator=(
+      tile_table_texture&& a) noexcept
+  {
+    if (this != &a)
+    {
+      if (0 != texture)
+      {
+        glDeleteTextures(1, &texture);
+      }
+
+      texture = std::exchange(a.texture, 0);
+      rows = std::exchange(a.rows, 0);
+      size = std::exchange(a.size, 0);
+    }
+
+    return *this;
+  }
+
+  void tile_table_texture::update(const std::vector<std::uint32_t>& table)
+  {
+    size = table.size();
+
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    if (table.empty())
+    {
+      return;
+    }
+
+    if (0 == texture)
+    {
+      glGenTextures(1, &texture);
+      glBindTexture(GL_TEXTURE_2D, texture);
+
+      // Integer textures can't be filtered.
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    else
+    {
+      glBindTexture(GL_TEXTURE_2D, texture);
+    }
+
+    const auto width = static_cast<std::size_t>(tile_table_width);
+    const auto full_rows = static_cast<int>(table.size() / width);
+    const auto rest = static_cast<int>(table.size() % width);
+    const int needed = full_rows + (0 < rest ? 1 : 0);
+
+    if (needed != rows)
+    {
+      rows = needed;
+
+      glTexImage2D(
+          GL_TEXTURE_2D,
+          0,
+          GL_R32UI,
+          tile_table_width,
+          rows,
+          0,
+          GL_RED_INTEGER,
+          GL_UNSIGNED_INT,
+          nullptr);
+    }
+
+    // The last row is only partly covered by the table.
+    if (0 < full_rows)
+    {
+      glTexSubImage2D(
+          GL_TEXTURE_2D,
+          0,
+          0,
+          0,
+          tile_table_width,
+          full_rows,
+          GL_RED_INTEGER,
+          GL_UNSIGNED_INT,
+          table.data());
+    }
+
+    if (0 < rest)
+    {
+      glTexSubImage2D(
+          GL_TEXTURE_2D,
+          0,
+          0,
+          full_rows,
+          rest,
+          1,
+          GL_RED_INTEGER,
+          GL_UNSIGNED_INT,
+          table.data() + static_cast<std::size_t>(full_rows) * width);
+    }
+
+    ODE_TRACE("Uploaded the table of {} animated tile IDs", size);
+  }
+
+  GLuint tile_table_texture::get_texture() const noexcept
+  {
+    return texture;
+  }
+
+  std::size_t tile_table_texture::get_size() const noexcept
+  {
+    return size;
+  }
+
+  tile_renderer::tile_renderer()
+      : program{0},
+        vertex_array{0},
+        projection_location{-1},
+        origin_location{-1},
+        columns_location{-1},
+        tile_size_location{-1},
+        first_gid_location{-1},
+        tileset_columns_location{-1},
+        tile_count_location{-1},
+        tile_uv_size_location{-1},
+        tile_stride_location{-1},
+        tileset_origin_location{-1},
+        tile_table_size_location{-1},
+        opacity_location{-1}
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    program = gl::make_program(
+        detail::tile_vertex_shader, detail::tile_fragment_shader);
+
+    projection_location = glGetUniformLocation(program, "projection");
+    origin_location = glGetUniformLocation(program, "origin");
+    columns_location = glGetUniformLocation(program, "columns");
+    tile_size_location = glGetUniformLocation(program, "tile_size");
+    first_gid_location = glGetUniformLocation(program, "first_gid");
+    tileset_columns_location =
+        glGetUniformLocation(program, "tileset_columns");
+    tile_count_location = glGetUniformLocation(program, "tile_count");
+    tile_uv_size_location = glGetUniformLocation(program, "tile_uv_size");
+    tile_stride_location = glGetUniformLocation(program, "tile_stride");
+    tileset_origin_location = glGetUniformLocation(program, "tileset_origin");
+    tile_table_size_location =
+        glGetUniformLocation(program, "tile_table_size");
+    opacity_location = glGetUniformLocation(program, "opacity");
+
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "tileset"), 0);
+    glUniform1i(glGetUniformLocation(program, "tiles"), 1);
+    glUniform1i(glGetUniformLocation(program, "tile_table"), 2);
+
+    glGenVertexArrays(1, &vertex_array);
+
+    ODE_DEBUG("Created the tile renderer");
+  }
+
+  tile_renderer::~tile_renderer()
+  {
+    if constexpr (disable_gl_calls)
+    {
+      return;
+    }
+
+    glDeleteVertexArrays(1, &vertex_array);
+    glDeleteProgram(program);
+  }
+
+  std::size_t tile_renderer::draw(
+      const tile_layer_texture& layer,
+      const tileset& set,
+      const tile_range& range,
+      const std::array<float, 16>& projection,
+      const float opacity)
+  {
+    return draw(layer, set, tile_table_texture{}, range, projection, opacity);
+  }
+
+  std::size_t tile_renderer::draw(
+      const tile_layer_texture& layer,
+      const tileset& set,
+      const tile_table_texture& table,
+      const tile_range& range,
+      const std::array<float, 16>& projection,
+      const float opacity)
+  {
+    if (is_empty(range) || 0 == set.tile_width || 0 == set.tile_height)
+    {
+      return 0;
+    }
+
+    const auto tiles = static_cast<std::size_t>(range.width) * range.height;
+
+    if constexpr (disable_gl_calls)
+    {
+      return tiles;
+    }
+
+    glUseProgram(program);
+
+    glUniformMatrix4fv(projection_location, 1, GL_FALSE, projection.data());
+    glUniform2i(origin_location, range.x, range.y);
+    glUniform1i(columns_location, range.width);
+    glUniform2f(
+        tile_size_location,
+        static_cast<float>(set.tile_width),
+        static_cast<float>(set.tile_height));
+    glUniform1ui(first_gid_location, set.first_gid);
+    glUniform1i(tileset_columns_location, get_tileset_columns(set));
+    glUniform1ui(tile_count_location, get_tile_count(set));
+
+    // The tileset may be a part of an atlas page.
+    const auto texture_width = static_cast<float>(
+        0 == set.texture_width ? set.image_width : set.texture_width);
+    const auto texture_height = static_cast<float>(
+        0 == set.texture_height ? set.image_height : set.texture_height);
+
+    glUniform2f(
+        tile_uv_size_location,
+        static_cast<float>(set.tile_width) / texture_width,
+        static_cast<float>(set.tile_height) / texture_height);
+    glUniform2f(
+        tile_stride_location,
+        static_cast<float>(set.tile_width + set.spacing) / texture_width,
+        static_cast<float>(set.tile_height + set.spacing) / texture_height);
+    glUniform2f(
+        tileset_origin_location,
+        static_cast<float>(set.atlas_x + set.margin) / texture_width,
+        static_cast<float>(set.atlas_y + set.margin) / texture_height);
+    glUniform1f(opacity_location, opacity);
+
+    const auto table_size = 0 == table.get_texture() ? 0 : table.get_size();
+
+    glUniform1ui(tile_table_size_location, static_cast<GLuint>(table_size));
+
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, table.get_texture());
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, layer.get_texture());
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, set.texture);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    glBindVertexArray(vertex_array);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(tiles));
+    glBindVertexArray(0);
+
+    return tiles;
+  }
+
+} // namespace ode
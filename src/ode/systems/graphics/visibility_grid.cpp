@@ -0,0 +1,184 @@
+/// The definition of the type of the uniform grids which are used to find the
+/// visible objects.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/visibility_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  visibility_grid::visibility_grid(
+      const rectangle& area, const float cell_size) ODE_CONTRACT_NOEXCEPT
+      : area{area},
+        cell_size{cell_size},
+        columns{0},
+        rows{0},
+        cells{},
+        bounds{},
+        present{},
+        object_count{0},
+        visits{},
+        current_query{0},
+        results{}
+  {
+    Expects(cell_size > 0.0f);
+    Expects(area.right >= area.left && area.bottom >= area.top);
+
+    columns = std::max(
+        1, static_cast<int>(std::ceil((area.right - area.left) / cell_size)));
+    rows = std::max(
+        1, static_cast<int>(std::ceil((area.bottom - area.top) / cell_size)));
+
+    cells.resize(static_cast<std::size_t>(columns) * rows);
+  }
+
+  void visibility_grid::insert(const std::size_t id, const rectangle& b)
+  {
+    if (id >= bounds.size())
+    {
+      bounds.resize(id + 1);
+      present.resize(id + 1, false);
+      visits.resize(id + 1, 0);
+    }
+
+    const auto span = get_span(b);
+
+    if (present[id])
+    {
+      const auto old = get_span(bounds[id]);
+
+      // Moving within the same cells is the common case and only the bounds
+      // need to be updated.
+      if (old.x0 != span.x0 || old.y0 != span.y0 || old.x1 != span.x1 ||
+          old.y1 != span.y1)
+      {
+        link(id, old, false);
+        link(id, span, true);
+      }
+    }
+    else
+    {
+      link(id, span, true);
+      present[id] = true;
+      ++object_count;
+    }
+
+    bounds[id] = b;
+  }
+
+  void visibility_grid::remove(const std::size_t id)
+  {
+    if (!contains(id))
+    {
+      return;
+    }
+
+    link(id, get_span(bounds[id]), false);
+    present[id] = false;
+    --object_count;
+  }
+
+  bool visibility_grid::contains(const std::size_t id) const noexcept
+  {
+    return id < present.size() && present[id];
+  }
+
+  std::size_t visibility_grid::get_object_count() const noexcept
+  {
+    return object_count;
+  }
+
+  const std::vector<std::size_t>& visibility_grid::query(
+      const rectangle& view) const
+  {
+    results.clear();
+
+    if (0 == ++current_query)
+    {
+      // The counter has wrapped around, so the old visits could match it.
+      std::fill(visits.begin(), visits.end(), 0);
+      current_query = 1;
+    }
+
+    const auto span = get_span(view);
+
+    for (int y = span.y0; y <= span.y1; ++y)
+    {
+      for (int x = span.x0; x <= span.x1; ++x)
+      {
+        const auto& cell = cells[static_cast<std::size_t>(y) * columns + x];
+
+        for (const std::uint32_t id : cell)
+        {
+          if (current_query == visits[id])
+          {
+            continue;
+          }
+
+          visits[id] = current_query;
+
+          if (intersects(bounds[id], view))
+          {
+            results.push_back(id);
+          }
+        }
+      }
+    }
+
+    return results;
+  }
+
+  visibility_grid::cell_span visibility_grid::get_span(
+      const rectangle& r) const noexcept
+  {
+    const auto column = [this](const float x) {
+      const int c = static_cast<int>(std::floor((x - area.left) / cell_size));
+      return std::clamp(c, 0, columns - 1);
+    };
+
+    const auto row = [this](const float y) {
+      const int r = static_cast<int>(std::floor((y - area.top) / cell_size));
+      return std::clamp(r, 0, rows - 1);
+    };
+
+    return {column(r.left), row(r.top), column(r.right), row(r.bottom)};
+  }
+
+  void visibility_grid::link(
+      const std::size_t id, const cell_span& span, const bool add)
+  {
+    const auto value = static_cast<std::uint32_t>(id);
+
+    for (int y = span.y0; y <= span.y1; ++y)
+    {
+      for (int x = span.x0; x <= span.x1; ++x)
+      {
+        auto& cell = cells[static_cast<std::size_t>(y) * columns + x];
+
+        if (add)
+        {
+          cell.push_back(value);
+        }
+        else
+        {
+          const auto it = std::find(cell.begin(), cell.end(), value);
+
+          if (cell.end() != it)
+          {
+            *it = cell.back();
+            cell.pop_back();
+          }
+        }
+      }
+    }
+  }
+
+} // namespace ode
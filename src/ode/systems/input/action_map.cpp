@@ -0,0 +1,49 @@
+/// The definition of the type of the tables which bind the inputs to the game
+/// actions.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/input/action_map.h"
+
+#include "gsl/assert"
+
+#include "ode/systems/input/input_config.h"
+
+namespace ode
+{
+  void action_map::bind(
+      const input_device device, const int code, const std::size_t action)
+  {
+    Expects(0 <= code);
+    Expects(action < max_input_actions);
+
+    bindings[make_key(device, code)] = action;
+  }
+
+  bool action_map::unbind(const input_device device, const int code)
+  {
+    return 0 != bindings.erase(make_key(device, code));
+  }
+
+  void action_map::clear() noexcept
+  {
+    bindings.clear();
+  }
+
+  std::optional<std::size_t> action_map::find(
+      const input_device device, const int code) const
+  {
+    const auto it = bindings.find(make_key(device, code));
+
+    if (bindings.end() == it)
+    {
+      return std::nullopt;
+    }
+
+    return it->second;
+  }
+
+} // namespace ode
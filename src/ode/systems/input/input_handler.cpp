@@ -0,0 +1,256 @@
+/// The definition of the type of the objects which turn the input events into
+/// the game actions and the input snapshots.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/input/input_handler.h"
+
+#include <algorithm>
+
+#include "ode/logger.h"
+
+namespace ode
+{
+  input_handler::input_handler()
+      : bindings{},
+        current{},
+        held{},
+        snapshots{},
+        latest{0},
+        controllers{}
+  {
+  }
+
+  input_handler::~input_handler()
+  {
+    for (auto* controller : controllers)
+    {
+      SDL_GameControllerClose(controller);
+    }
+  }
+
+  void input_handler::handle(const SDL_Event& event)
+  {
+    if (SDL_KEYDOWN == event.type || SDL_KEYUP == event.type)
+    {
+      // The repeated key presses don't change the state.
+      if (0 == event.key.repeat)
+      {
+        set(input_device::keyboard,
+            event.key.keysym.scancode,
+            SDL_KEYDOWN == event.type);
+      }
+    }
+    else if (SDL_MOUSEMOTION == event.type)
+    {
+      current.mouse_x = event.motion.x;
+      current.mouse_y = event.motion.y;
+      current.mouse_dx += event.motion.xrel;
+      current.mouse_dy += event.motion.yrel;
+    }
+    else if (
+        SDL_MOUSEBUTTONDOWN == event.type || SDL_MOUSEBUTTONUP == event.type)
+    {
+      set(input_device::mouse,
+          event.button.button,
+          SDL_MOUSEBUTTONDOWN == event.type);
+    }
+    else if (SDL_MOUSEWHEEL == event.type)
+    {
+      current.wheel += event.wheel.y;
+    }
+    else if (
+        SDL_CONTROLLERBUTTONDOWN == event.type ||
+        SDL_CONTROLLERBUTTONUP == event.type)
+    {
+      set(input_device::controller,
+          event.cbutton.button,
+          SDL_CONTROLLERBUTTONDOWN == event.type);
+    }
+    else if (SDL_CONTROLLERAXISMOTION == event.type)
+    {
+      if (event.caxis.axis < current.controller_axes.size())
+      {
+        current.controller_axes[event.caxis.axis] = event.caxis.value;
+      }
+    }
+    else if (SDL_CONTROLLERDEVICEADDED == event.type)
+    {
+      if (auto* controller = SDL_GameControllerOpen(event.cdevice.which))
+      {
+        controllers.push_back(controller);
+        ODE_DEBUG("Opened the controller {}", event.cdevice.which);
+      }
+    }
+    else if (SDL_CONTROLLERDEVICEREMOVED == event.type)
+    {
+      auto* controller = SDL_GameControllerFromInstanceID(event.cdevice.which);
+
+      if (nullptr != controller)
+      {
+        controllers.erase(
+            std::remove(controllers.begin(), controllers.end(), controller),
+            controllers.end());
+        SDL_GameControllerClose(controller);
+
+        // The buttons held on the removed controller are never released, so
+        // the controller state is cleared.
+        current.controller_buttons.reset();
+        current.controller_axes.fill(0);
+        recount();
+
+        ODE_DEBUG("Closed the controller {}", event.cdevice.which);
+      }
+    }
+  }
+
+  void input_handler::publish()
+  {
+    const auto next =
+        (latest.load(std::memory_order_relaxed) + 1) % snapshots.size();
+
+    ++current.tick;
+
+    snapshots[next] = current;
+
+    current.mouse_dx = 0;
+    current.mouse_dy = 0;
+    current.wheel = 0;
+    current.pressed.reset();
+    current.released.reset();
+
+    latest.store(next, std::memory_order_release);
+  }
+
+  const input_snapshot& input_handler::get_snapshot() const noexcept
+  {
+    return snapshots[latest.load(std::memory_order_acquire)];
+  }
+
+  void input_handler::bind(
+      const input_device device, const int code, const std::size_t action)
+  {
+    bindings.bind(device, code, action);
+    recount();
+  }
+
+  void input_handler::unbind(const input_device device, const int code)
+  {
+    if (bindings.unbind(device, code))
+    {
+      recount();
+    }
+  }
+
+  bool input_handler::is_down(const input_device device, const int code) const
+  {
+    const auto i = static_cast<std::size_t>(code);
+
+    if (0 > code)
+    {
+      return false;
+    }
+    else if (input_device::keyboard == device)
+    {
+      return i < current.keys.size() && current.keys.test(i);
+    }
+    else if (input_device::mouse == device)
+    {
+      return i < current.mouse_buttons.size() && current.mouse_buttons.test(i);
+    }
+    else
+    {
+      return i < current.controller_buttons.size() &&
+          current.controller_buttons.test(i);
+    }
+  }
+
+  void input_handler::set(
+      const input_device device, const int code, const bool down)
+  {
+    const auto i = static_cast<std::size_t>(code);
+
+    if (0 > code || down == is_down(device, code))
+    {
+      return;
+    }
+    else if (input_device::keyboard == device)
+    {
+      if (i >= current.keys.size())
+      {
+        return;
+      }
+
+      current.keys.set(i, down);
+    }
+    else if (input_device::mouse == device)
+    {
+      if (i >= current.mouse_buttons.size())
+      {
+        return;
+      }
+
+      current.mouse_buttons.set(i, down);
+    }
+    else
+    {
+      if (i >= current.controller_buttons.size())
+      {
+        return;
+      }
+
+      current.controller_buttons.set(i, down);
+    }
+
+    const auto action = bindings.find(device, code);
+
+    if (!action)
+    {
+      return;
+    }
+
+    auto& count = held[*action];
+
+    if (down)
+    {
+      if (0 == count++)
+      {
+        current.actions.set(*action);
+        current.pressed.set(*action);
+      }
+    }
+    else if (0 < count && 0 == --count)
+    {
+      current.actions.reset(*action);
+      current.released.set(*action);
+    }
+  }
+
+  void input_handler::recount()
+  {
+    const auto before = current.actions;
+
+    held.fill(0);
+    current.actions.reset();
+
+    bindings.for_each(
+        [this](const input_device device, const int code, const std::size_t a) {
+          if (is_down(device, code))
+          {
+            ++held[a];
+            current.actions.set(a);
+          }
+        });
+
+    // The actions which start or stop being held because of the change are
+    // reported like the ones changed by the events.
+    const auto after = current.actions;
+
+    current.released |= before & ~after;
+    current.pressed |= after & ~before;
+  }
+
+} // namespace ode
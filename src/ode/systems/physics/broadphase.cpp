@@ -0,0 +1,86 @@
+/// The definition of the type of the broadphases which find the pairs of the
+/// dynamic bodies that may collide.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/physics/broadphase.h"
+
+#include <algorithm>
+
+namespace ode
+{
+  broadphase::broadphase() : entries{}, pairs{}
+  {
+  }
+
+  void broadphase::update(const std::vector<rectangle>& bounds)
+  {
+    const auto count = bounds.size();
+
+    if (entries.size() != count)
+    {
+      // The bodies have been added or removed, so the order is built again.
+      entries.resize(count);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        entries[i] = {bounds[i], static_cast<std::uint32_t>(i)};
+      }
+
+      std::sort(
+          entries.begin(), entries.end(), [](const entry& a, const entry& b) {
+            return a.bounds.left < b.bounds.left;
+          });
+    }
+    else
+    {
+      for (auto& e : entries)
+      {
+        e.bounds = bounds[e.index];
+      }
+
+      for (std::size_t i = 1; i < count; ++i)
+      {
+        auto e = entries[i];
+        auto j = i;
+
+        for (; 0 < j && e.bounds.left < entries[j - 1].bounds.left; --j)
+        {
+          entries[j] = entries[j - 1];
+        }
+
+        entries[j] = e;
+      }
+    }
+
+    pairs.clear();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto& a = entries[i];
+
+      for (auto j = i + 1;
+           j < count && entries[j].bounds.left < a.bounds.right;
+           ++j)
+      {
+        const auto& b = entries[j];
+
+        if (a.bounds.top < b.bounds.bottom && b.bounds.top < a.bounds.bottom)
+        {
+          pairs.push_back(
+              a.index < b.index ? body_pair{a.index, b.index}
+                                : body_pair{b.index, a.index});
+        }
+      }
+    }
+  }
+
+  const std::vector<body_pair>& broadphase::get_pairs() const noexcept
+  {
+    return pairs;
+  }
+
+} // namespace ode
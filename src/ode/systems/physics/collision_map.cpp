@@ -0,0 +1,421 @@
+/// The definition of the type of the collision maps of the tile grids.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/physics/collision_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The tolerance, in tiles, with which an edge that lies on the border
+    /// of two tiles is considered to be only in the tile that the box is in.
+    /// Without it, the rounding errors would let a box that was stopped at
+    /// a border overlap the solid tile behind it.
+    ///
+    constexpr float collision_epsilon = 1.0e-4f;
+
+    ///
+    /// The number of the tiles in each of the words of the bitmaps.
+    ///
+    constexpr int collision_word_bits = 64;
+
+    ///
+    /// The number of the times the movement is continued along the surfaces
+    /// after a hit.
+    ///
+    constexpr int collision_slide_iterations = 3;
+
+    ///
+    /// Gives the first tile that an edge starting at the given coordinate
+    /// overlaps.
+    ///
+    /// \param a the coordinate.
+    /// \param size the size of the tiles.
+    ///
+    /// \return The index of the tile.
+    ///
+    static int first_cell(const float a, const float size) noexcept
+    {
+      return static_cast<int>(std::floor(a / size + collision_epsilon));
+    }
+
+    ///
+    /// Gives the last tile that an edge ending at the given coordinate
+    /// overlaps.
+    ///
+    /// \param b the coordinate.
+    /// \param size the size of the tiles.
+    ///
+    /// \return The index of the tile.
+    ///
+    static int last_cell(const float b, const float size) noexcept
+    {
+      return static_cast<int>(std::ceil(b / size - collision_epsilon)) - 1;
+    }
+
+    ///
+    /// Gives the sign of the given movement.
+    ///
+    /// \param d the movement.
+    ///
+    /// \return \c 1, \c -1, or \c 0.
+    ///
+    static int get_step(const float d) noexcept
+    {
+      return 0.0f < d ? 1 : (0.0f > d ? -1 : 0);
+    }
+  } // namespace detail
+
+  collision_map::collision_map(
+      const int w,
+      const int h,
+      const float tile_width,
+      const float tile_height) ODE_CONTRACT_NOEXCEPT
+      : width{w},
+        height{h},
+        tile_width{tile_width},
+        tile_height{tile_height},
+        row_words{static_cast<std::size_t>(
+            (w + detail::collision_word_bits - 1) /
+            detail::collision_word_bits)},
+        bits(row_words * static_cast<std::size_t>(h), 0)
+  {
+    Expects(0 <= w && 0 <= h);
+    Expects(0.0f < tile_width && 0.0f < tile_height);
+  }
+
+  int collision_map::get_width() const noexcept
+  {
+    return width;
+  }
+
+  int collision_map::get_height() const noexcept
+  {
+    return height;
+  }
+
+  bool collision_map::is_solid(const int x, const int y) const noexcept
+  {
+    if (0 > x || width <= x || 0 > y || height <= y)
+    {
+      return true;
+    }
+
+    const auto word = bits[static_cast<std::size_t>(y) * row_words +
+        static_cast<std::size_t>(x / detail::collision_word_bits)];
+
+    return 0 != ((word >> (x % detail::collision_word_bits)) & 1);
+  }
+
+  void collision_map::set_solid(const int x, const int y, const bool solid)
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(0 <= x && x < width && 0 <= y && y < height);
+
+    auto& word = bits[static_cast<std::size_t>(y) * row_words +
+        static_cast<std::size_t>(x / detail::collision_word_bits)];
+    const std::uint64_t bit = std::uint64_t{1}
+        << (x % detail::collision_word_bits);
+
+    word = solid ? word | bit : word & ~bit;
+  }
+
+  void collision_map::add_layer(const tile_layer& layer) ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(width == layer.get_width() && height == layer.get_height());
+
+    const std::uint32_t* gid = layer.get_data();
+
+    for (int y = 0; y < height; ++y)
+    {
+      auto* const row = bits.data() + static_cast<std::size_t>(y) * row_words;
+
+      for (int x = 0; x < width; ++x, ++gid)
+      {
+        if (0 != *gid)
+        {
+          row[x / detail::collision_word_bits] |= std::uint64_t{1}
+              << (x % detail::collision_word_bits);
+        }
+      }
+    }
+  }
+
+  void collision_map::add_area(const rectangle& area) noexcept
+  {
+    const int x0 = std::max(detail::first_cell(area.left, tile_width), 0);
+    const int y0 = std::max(detail::first_cell(area.top, tile_height), 0);
+    const int x1 =
+        std::min(detail::last_cell(area.right, tile_width), width - 1);
+    const int y1 =
+        std::min(detail::last_cell(area.bottom, tile_height), height - 1);
+
+    for (int y = y0; y <= y1; ++y)
+    {
+      for (int x = x0; x <= x1; ++x)
+      {
+        set_solid(x, y, true);
+      }
+    }
+  }
+
+  bool collision_map::overlaps(const rectangle& area) const noexcept
+  {
+    const int x0 = detail::first_cell(area.left, tile_width);
+    const int y0 = detail::first_cell(area.top, tile_height);
+    const int x1 = detail::last_cell(area.right, tile_width);
+    const int y1 = detail::last_cell(area.bottom, tile_height);
+
+    if (x1 < x0)
+    {
+      return false;
+    }
+
+    for (int y = y0; y <= y1; ++y)
+    {
+      if (is_row_solid(y, x0, x1))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  sweep_result collision_map::sweep(
+      const rectangle& box, const float dx, const float dy) const noexcept
+  {
+    constexpr auto never = std::numeric_limits<float>::infinity();
+
+    const int step_x = detail::get_step(dx);
+    const int step_y = detail::get_step(dy);
+
+    // The leading column and row are the last ones that the box overlaps in
+    // the direction of the movement, and the DDA advances them one at a
+    // time at the moments when the leading edges cross into the next tiles.
+    int lead_x = 0 < step_x ? detail::last_cell(box.right, tile_width)
+                            : detail::first_cell(box.left, tile_width);
+    int lead_y = 0 < step_y ? detail::last_cell(box.bottom, tile_height)
+                            : detail::first_cell(box.top, tile_height);
+
+    float next_x = never;
+    float next_y = never;
+    float delta_x = never;
+    float delta_y = never;
+
+    if (0 != step_x)
+    {
+      const float edge = 0 < step_x ? box.right : box.left;
+      const float border = (0 < step_x ? lead_x + 1 : lead_x) * tile_width;
+      next_x = (border - edge) / dx;
+      delta_x = tile_width / std::abs(dx);
+    }
+
+    if (0 != step_y)
+    {
+      const float edge = 0 < step_y ? box.bottom : box.top;
+      const float border = (0 < step_y ? lead_y + 1 : lead_y) * tile_height;
+      next_y = (border - edge) / dy;
+      delta_y = tile_height / std::abs(dy);
+    }
+
+    sweep_result result{};
+
+    while (next_x <= 1.0f || next_y <= 1.0f)
+    {
+      if (next_x <= next_y)
+      {
+        const float t = next_x;
+        const int column = lead_x + step_x;
+
+        // The trailing edge is computed from the position of the box, and
+        // the leading one is taken from the DDA so that the corner tiles are
+        // only tested after the box has crossed into their row.
+        int y0 = 0 < step_y ? detail::first_cell(box.top + dy * t, tile_height)
+                            : lead_y;
+        int y1 = 0 > step_y
+            ? detail::last_cell(box.bottom + dy * t, tile_height)
+            : lead_y;
+
+        if (0 == step_y)
+        {
+          y0 = detail::first_cell(box.top, tile_height);
+          y1 = detail::last_cell(box.bottom, tile_height);
+        }
+
+        if (is_column_solid(column, std::min(y0, y1), y1))
+        {
+          result.hit = true;
+          result.time = t;
+          result.normal_x = -step_x;
+          result.x = 0 < step_x ? column * tile_width - (box.right - box.left)
+                                : (column + 1) * tile_width;
+          result.y = box.top + dy * t;
+          return result;
+        }
+
+        lead_x = column;
+        next_x += delta_x;
+      }
+      else
+      {
+        const float t = next_y;
+        const int row = lead_y + step_y;
+
+        int x0 = 0 < step_x ? detail::first_cell(box.left + dx * t, tile_width)
+                            : lead_x;
+        int x1 =
+            0 > step_x ? detail::last_cell(box.right + dx * t, tile_width)
+                       : lead_x;
+
+        if (0 == step_x)
+        {
+          x0 = detail::first_cell(box.left, tile_width);
+          x1 = detail::last_cell(box.right, tile_width);
+        }
+
+        if (is_row_solid(row, std::min(x0, x1), x1))
+        {
+          result.hit = true;
+          result.time = t;
+          result.normal_y = -step_y;
+          result.x = box.left + dx * t;
+          result.y = 0 < step_y
+              ? row * tile_height - (box.bottom - box.top)
+              : (row + 1) * tile_height;
+          return result;
+        }
+
+        lead_y = row;
+        next_y += delta_y;
+      }
+    }
+
+    result.x = box.left + dx;
+    result.y = box.top + dy;
+
+    return result;
+  }
+
+  sweep_result collision_map::move(
+      const rectangle& box, const float dx, const float dy) const noexcept
+  {
+    const float w = box.right - box.left;
+    const float h = box.bottom - box.top;
+
+    sweep_result result{};
+    rectangle current = box;
+    float remaining_x = dx;
+    float remaining_y = dy;
+
+    result.x = box.left;
+    result.y = box.top;
+
+    for (int i = 0; i < detail::collision_slide_iterations; ++i)
+    {
+      if (0.0f == remaining_x && 0.0f == remaining_y)
+      {
+        break;
+      }
+
+      const auto r = sweep(current, remaining_x, remaining_y);
+
+      current = {r.x, r.y, r.x + w, r.y + h};
+      result.x = r.x;
+      result.y = r.y;
+
+      if (!r.hit)
+      {
+        break;
+      }
+
+      if (!result.hit)
+      {
+        result.hit = true;
+        result.time = r.time;
+      }
+
+      result.normal_x += r.normal_x;
+      result.normal_y += r.normal_y;
+
+      // The movement continues along the surface that was hit.
+      remaining_x = 0 != r.normal_x ? 0.0f : remaining_x * (1.0f - r.time);
+      remaining_y = 0 != r.normal_y ? 0.0f : remaining_y * (1.0f - r.time);
+    }
+
+    return result;
+  }
+
+  bool collision_map::is_row_solid(const int y, const int x0, const int x1)
+      const noexcept
+  {
+    if (0 > y || height <= y || 0 > x0 || width <= x1)
+    {
+      return true;
+    }
+
+    const auto* const row =
+        bits.data() + static_cast<std::size_t>(y) * row_words;
+    const int first = x0 / detail::collision_word_bits;
+    const int last = x1 / detail::collision_word_bits;
+
+    for (int w = first; w <= last; ++w)
+    {
+      std::uint64_t mask = ~std::uint64_t{0};
+
+      if (first == w)
+      {
+        mask &= ~std::uint64_t{0} << (x0 % detail::collision_word_bits);
+      }
+
+      if (last == w)
+      {
+        mask &= ~std::uint64_t{0} >>
+            (detail::collision_word_bits - 1 -
+             x1 % detail::collision_word_bits);
+      }
+
+      if (0 != (row[w] & mask))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool collision_map::is_column_solid(
+      const int x, const int y0, const int y1) const noexcept
+  {
+    if (0 > x || width <= x || 0 > y0 || height <= y1)
+    {
+      return true;
+    }
+
+    const auto shift = x % detail::collision_word_bits;
+    const auto* word = bits.data() + static_cast<std::size_t>(y0) * row_words +
+        static_cast<std::size_t>(x / detail::collision_word_bits);
+
+    for (int y = y0; y <= y1; ++y, word += row_words)
+    {
+      if (0 != ((*word >> shift) & 1))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+} // namespace ode
@@ -0,0 +1,95 @@
+/// The definition of the type of the physics worlds of the scenes.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/physics/physics_world.h"
+
+#include <utility>
+
+#include "gsl/assert"
+
+namespace ode
+{
+  physics_world::physics_world(collision_map map)
+      : map{std::move(map)}, bounds{}, velocities{}, broad_phase{}
+  {
+  }
+
+  std::size_t physics_world::add_body(
+      const rectangle& bounds, const body_velocity& velocity)
+  {
+    this->bounds.push_back(bounds);
+    velocities.push_back(velocity);
+    return this->bounds.size() - 1;
+  }
+
+  std::size_t physics_world::get_body_count() const noexcept
+  {
+    return bounds.size();
+  }
+
+  const rectangle& physics_world::get_bounds(const std::size_t i) const
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(i < bounds.size());
+    return bounds[i];
+  }
+
+  const body_velocity& physics_world::get_velocity(const std::size_t i) const
+      ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(i < velocities.size());
+    return velocities[i];
+  }
+
+  void physics_world::set_velocity(
+      const std::size_t i, const body_velocity& velocity) ODE_CONTRACT_NOEXCEPT
+  {
+    Expects(i < velocities.size());
+    velocities[i] = velocity;
+  }
+
+  void physics_world::step(const float delta)
+  {
+    for (std::size_t i = 0; i < bounds.size(); ++i)
+    {
+      auto& b = bounds[i];
+      auto& v = velocities[i];
+
+      if (0.0f == v.x && 0.0f == v.y)
+      {
+        continue;
+      }
+
+      const auto r = map.move(b, v.x * delta, v.y * delta);
+
+      b = {r.x, r.y, r.x + (b.right - b.left), r.y + (b.bottom - b.top)};
+
+      if (0 != r.normal_x)
+      {
+        v.x = 0.0f;
+      }
+
+      if (0 != r.normal_y)
+      {
+        v.y = 0.0f;
+      }
+    }
+
+    broad_phase.update(bounds);
+  }
+
+  const std::vector<body_pair>& physics_world::get_pairs() const noexcept
+  {
+    return broad_phase.get_pairs();
+  }
+
+  const collision_map& physics_world::get_map() const noexcept
+  {
+    return map;
+  }
+
+} // namespace ode
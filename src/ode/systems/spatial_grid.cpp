@@ -0,0 +1,467 @@
+/// The definition of the type of the spatial grids which find the objects
+/// near a point or in an area.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/spatial_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+
+#include "gsl/assert"
+
+#include "ode/systems/systems_config.h"
+
+namespace ode
+{
+  namespace detail
+  {
+    ///
+    /// The number of the buckets in a pass of the radix sort.
+    ///
+    constexpr std::size_t radix_size = std::size_t{1}
+        << spatial_grid_radix_bits;
+
+    ///
+    /// Runs the given function for each of the chunks, on the job system if
+    /// one is given.
+    ///
+    /// \param jobs the job system or \c nullptr.
+    /// \param chunk_count the number of the chunks.
+    /// \param f the function, which is given the index of the chunk.
+    ///
+    static void run_chunks(
+        job_system* jobs,
+        const std::size_t chunk_count,
+        const std::function<void(std::size_t)>& f)
+    {
+      if (nullptr == jobs || 1 == chunk_count)
+      {
+        for (std::size_t c = 0; c < chunk_count; ++c)
+        {
+          f(c);
+        }
+
+        return;
+      }
+
+      // Only the chunks are waited for, so the other jobs don't delay the
+      // grid and the grid can be rebuilt from a job.
+      jobs->run_batch(chunk_count, f);
+    }
+
+    ///
+    /// Gives the index of the first element of the given chunk.
+    ///
+    /// \param count the number of the elements.
+    /// \param chunk_count the number of the chunks.
+    /// \param chunk the index of the chunk.
+    ///
+    /// \return The index of the element.
+    ///
+    static std::size_t get_chunk_begin(
+        const std::size_t count,
+        const std::size_t chunk_count,
+        const std::size_t chunk) noexcept
+    {
+      return count * chunk / chunk_count;
+    }
+  } // namespace detail
+
+  spatial_grid::spatial_grid(const rectangle& bounds, const float cell_size)
+      : bounds{bounds},
+        cell_size{cell_size},
+        inverse_cell_size{1.0f / cell_size},
+        columns{0},
+        rows{0},
+        keys{},
+        ids{},
+        xs{},
+        ys{},
+        order{},
+        order_buffer{},
+        histograms{}
+  {
+    Expects(0.0f < cell_size);
+    Expects(bounds.left < bounds.right && bounds.top < bounds.bottom);
+
+    columns = std::max(
+        1u,
+        static_cast<std::uint32_t>(
+            std::ceil((bounds.right - bounds.left) * inverse_cell_size)));
+    rows = std::max(
+        1u,
+        static_cast<std::uint32_t>(
+            std::ceil((bounds.bottom - bounds.top) * inverse_cell_size)));
+
+    Expects(
+        static_cast<std::uint64_t>(columns) * rows <=
+        std::uint64_t{0xffffffff});
+  }
+
+  void spatial_grid::rebuild(const std::vector<spatial_entry>& entries)
+  {
+    build(entries, nullptr);
+  }
+
+  void spatial_grid::rebuild(
+      const std::vector<spatial_entry>& entries, job_system& jobs)
+  {
+    build(entries, &jobs);
+  }
+
+  void spatial_grid::query_area(
+      const rectangle& area, std::vector<std::uint32_t>& ids) const
+  {
+    ids.clear();
+
+    if (keys.empty() || area.left > area.right || area.top > area.bottom)
+    {
+      return;
+    }
+
+    const auto first_column = get_column(area.left);
+    const auto last_column = get_column(area.right);
+
+    for (auto row = get_row(area.top); row <= get_row(area.bottom); ++row)
+    {
+      const auto last = row * columns + last_column;
+
+      for (auto i = find_cell(row, first_column);
+           i < keys.size() && keys[i] <= last;
+           ++i)
+      {
+        if (area.left <= xs[i] && xs[i] <= area.right && area.top <= ys[i] &&
+            ys[i] <= area.bottom)
+        {
+          ids.push_back(this->ids[i]);
+        }
+      }
+    }
+  }
+
+  void spatial_grid::query_radius(
+      const float x,
+      const float y,
+      const float radius,
+      std::vector<std::uint32_t>& ids) const
+  {
+    ids.clear();
+
+    if (keys.empty() || 0.0f > radius)
+    {
+      return;
+    }
+
+    const float radius_squared = radius * radius;
+    const auto first_column = get_column(x - radius);
+    const auto last_column = get_column(x + radius);
+    const auto last_row = get_row(y + radius);
+
+    for (auto row = get_row(y - radius); row <= last_row; ++row)
+    {
+      const auto last = row * columns + last_column;
+
+      for (auto i = find_cell(row, first_column);
+           i < keys.size() && keys[i] <= last;
+           ++i)
+      {
+        const float dx = xs[i] - x;
+        const float dy = ys[i] - y;
+
+        if (dx * dx + dy * dy <= radius_squared)
+        {
+          ids.push_back(this->ids[i]);
+        }
+      }
+    }
+  }
+
+  void spatial_grid::query_nearest(
+      const float x,
+      const float y,
+      const std::size_t count,
+      std::vector<std::uint32_t>& ids) const
+  {
+    ids.clear();
+
+    if (keys.empty() || 0 == count)
+    {
+      return;
+    }
+
+    const auto column = static_cast<std::int64_t>(get_column(x));
+    const auto row = static_cast<std::int64_t>(get_row(y));
+
+    // The point may be outside of the grid, so its distance to the cell in
+    // which the search starts is taken off of the distances of the rings.
+    const float cell_left =
+        bounds.left + static_cast<float>(column) * cell_size;
+    const float cell_top = bounds.top + static_cast<float>(row) * cell_size;
+    const float outside_x =
+        std::max({0.0f, cell_left - x, x - (cell_left + cell_size)});
+    const float outside_y =
+        std::max({0.0f, cell_top - y, y - (cell_top + cell_size)});
+    const float slack =
+        std::sqrt(outside_x * outside_x + outside_y * outside_y);
+
+    // The nearest objects found so far are kept in a heap with the furthest
+    // one on the top.
+    std::vector<std::pair<float, std::uint32_t>> nearest{};
+    nearest.reserve(count + 1);
+
+    const auto visit = [this, x, y, count, &nearest](
+                           const std::int64_t r,
+                           const std::int64_t c0,
+                           const std::int64_t c1) {
+      const auto first = static_cast<std::uint32_t>(std::max<std::int64_t>(
+          0, c0));
+      const auto last = static_cast<std::uint32_t>(std::min<std::int64_t>(
+          columns - 1, c1));
+      const auto last_key = static_cast<std::uint32_t>(r) * columns + last;
+
+      for (auto i = find_cell(static_cast<std::uint32_t>(r), first);
+           i < keys.size() && keys[i] <= last_key;
+           ++i)
+      {
+        const float dx = xs[i] - x;
+        const float dy = ys[i] - y;
+        const float d = dx * dx + dy * dy;
+
+        if (nearest.size() < count || d < nearest.front().first)
+        {
+          nearest.emplace_back(d, this->ids[i]);
+          std::push_heap(nearest.begin(), nearest.end());
+
+          if (nearest.size() > count)
+          {
+            std::pop_heap(nearest.begin(), nearest.end());
+            nearest.pop_back();
+          }
+        }
+      }
+    };
+
+    const auto rings = static_cast<std::int64_t>(std::max(columns, rows));
+
+    for (std::int64_t ring = 0; ring <= rings; ++ring)
+    {
+      const auto top = row - ring;
+      const auto bottom = row + ring;
+
+      if (0 <= top)
+      {
+        visit(top, column - ring, column + ring);
+      }
+
+      if (0 < ring && bottom < static_cast<std::int64_t>(rows))
+      {
+        visit(bottom, column - ring, column + ring);
+      }
+
+      const auto first_side = std::max<std::int64_t>(0, top + 1);
+      const auto last_side = std::min<std::int64_t>(
+          static_cast<std::int64_t>(rows) - 1, bottom - 1);
+
+      for (auto r = first_side; 0 < ring && r <= last_side; ++r)
+      {
+        if (0 <= column - ring)
+        {
+          visit(r, column - ring, column - ring);
+        }
+
+        if (column + ring < static_cast<std::int64_t>(columns))
+        {
+          visit(r, column + ring, column + ring);
+        }
+      }
+
+      // The objects in the next rings are at least this far from the point.
+      const float reach = static_cast<float>(ring) * cell_size - slack;
+
+      if (count == nearest.size() && 0.0f < reach &&
+          reach * reach >= nearest.front().first)
+      {
+        break;
+      }
+    }
+
+    std::sort_heap(nearest.begin(), nearest.end());
+
+    for (const auto& [distance, id] : nearest)
+    {
+      ids.push_back(id);
+    }
+  }
+
+  std::size_t spatial_grid::get_entry_count() const noexcept
+  {
+    return keys.size();
+  }
+
+  std::size_t spatial_grid::get_cell_count() const noexcept
+  {
+    return static_cast<std::size_t>(columns) * rows;
+  }
+
+  std::uint32_t spatial_grid::get_column(const float x) const noexcept
+  {
+    const float column = (x - bounds.left) * inverse_cell_size;
+
+    if (!(0.0f < column))
+    {
+      return 0;
+    }
+
+    return std::min(static_cast<std::uint32_t>(column), columns - 1);
+  }
+
+  std::uint32_t spatial_grid::get_row(const float y) const noexcept
+  {
+    const float row = (y - bounds.top) * inverse_cell_size;
+
+    if (!(0.0f < row))
+    {
+      return 0;
+    }
+
+    return std::min(static_cast<std::uint32_t>(row), rows - 1);
+  }
+
+  std::size_t spatial_grid::find_cell(
+      const std::uint32_t row, const std::uint32_t column) const noexcept
+  {
+    return static_cast<std::size_t>(
+        std::lower_bound(keys.begin(), keys.end(), row * columns + column) -
+        keys.begin());
+  }
+
+  void spatial_grid::build(
+      const std::vector<spatial_entry>& entries, job_system* jobs)
+  {
+    Expects(entries.size() <= std::size_t{0xffffffff});
+
+    const auto count = entries.size();
+    const auto chunk_count =
+        nullptr != jobs && spatial_grid_parallel_threshold <= count
+        ? std::max<std::size_t>(1, jobs->get_thread_count())
+        : std::size_t{1};
+
+    keys.resize(count);
+    order.resize(count);
+    order_buffer.resize(count);
+    histograms.resize(chunk_count * detail::radix_size);
+
+    detail::run_chunks(jobs, chunk_count, [this, &entries, count, chunk_count](
+                                              const std::size_t c) {
+      const auto end = detail::get_chunk_begin(count, chunk_count, c + 1);
+
+      for (auto i = detail::get_chunk_begin(count, chunk_count, c); i < end;
+           ++i)
+      {
+        const auto& e = entries[i];
+        const auto key = get_row(e.y) * columns + get_column(e.x);
+        order[i] = (static_cast<std::uint64_t>(key) << 32) | i;
+      }
+    });
+
+    // The cell keys are sorted together with the indices of the objects,
+    // as the upper and the lower halves of 64-bit values, so each pass
+    // scatters a single array. The keys are sorted by their digits from the
+    // lowest one up, and only as many digits as the largest key has are
+    // sorted. Each pass counts the digits of each chunk, turns the counts
+    // into the positions where the chunks write their values, and then
+    // scatters the values so that the sort stays stable.
+    const auto largest = get_cell_count() - 1;
+
+    for (int shift = 0;
+         shift < 32 && 0 != (largest >> static_cast<unsigned>(shift));
+         shift += spatial_grid_radix_bits)
+    {
+      const auto digit = [shift](const std::uint64_t sort_key) {
+        return (sort_key >> static_cast<unsigned>(32 + shift)) &
+            (detail::radix_size - 1);
+      };
+
+      std::fill(histograms.begin(), histograms.end(), 0);
+
+      detail::run_chunks(
+          jobs, chunk_count, [this, &digit, count, chunk_count](
+                                 const std::size_t c) {
+            auto* histogram = histograms.data() + c * detail::radix_size;
+            const auto end = detail::get_chunk_begin(count, chunk_count, c + 1);
+
+            for (auto i = detail::get_chunk_begin(count, chunk_count, c);
+                 i < end;
+                 ++i)
+            {
+              ++histogram[digit(order[i])];
+            }
+          });
+
+      std::size_t position = 0;
+      bool sorted = false;
+
+      for (std::size_t d = 0; d < detail::radix_size; ++d)
+      {
+        const auto first = position;
+
+        for (std::size_t c = 0; c < chunk_count; ++c)
+        {
+          const auto n = histograms[c * detail::radix_size + d];
+          histograms[c * detail::radix_size + d] = position;
+          position += n;
+        }
+
+        // The pass changes nothing if all of the keys have the same digit.
+        sorted = sorted || count == position - first;
+      }
+
+      if (sorted)
+      {
+        continue;
+      }
+
+      detail::run_chunks(
+          jobs, chunk_count, [this, &digit, count, chunk_count](
+                                 const std::size_t c) {
+            auto* offsets = histograms.data() + c * detail::radix_size;
+            const auto end = detail::get_chunk_begin(count, chunk_count, c + 1);
+
+            for (auto i = detail::get_chunk_begin(count, chunk_count, c);
+                 i < end;
+                 ++i)
+            {
+              order_buffer[offsets[digit(order[i])]++] = order[i];
+            }
+          });
+
+      order.swap(order_buffer);
+    }
+
+    ids.resize(count);
+    xs.resize(count);
+    ys.resize(count);
+
+    detail::run_chunks(jobs, chunk_count, [this, &entries, count, chunk_count](
+                                              const std::size_t c) {
+      const auto end = detail::get_chunk_begin(count, chunk_count, c + 1);
+
+      for (auto i = detail::get_chunk_begin(count, chunk_count, c); i < end;
+           ++i)
+      {
+        const auto& e = entries[order[i] & 0xffffffff];
+        keys[i] = static_cast<std::uint32_t>(order[i] >> 32);
+        ids[i] = e.id;
+        xs[i] = e.x;
+        ys[i] = e.y;
+      }
+    });
+  }
+
+} // namespace ode
@@ -54,6 +54,22 @@ TEST(anthem_parse_arguments, parsed)
   ASSERT_EQ(f.window_name, default_name);
 }
 
+TEST(anthem_parse_arguments, input_files_are_parsed)
+{
+  char* argv_b[] = {"exe", "--record=session.input"};
+  char* argv_c[] = {"exe", "--replay", "session.input"};
+  const auto [parsed_b, b] = anthem::parse_arguments(2, argv_b);
+  const auto [parsed_c, c] = anthem::parse_arguments(3, argv_c);
+
+  ASSERT_TRUE(parsed_b);
+  ASSERT_TRUE(parsed_c);
+  ASSERT_EQ("session.input", b.record_file);
+  ASSERT_TRUE(b.replay_file.empty());
+  ASSERT_TRUE(c.record_file.empty());
+  ASSERT_EQ("session.input", c.replay_file);
+  ASSERT_NE(b, c);
+}
+
 TEST(anthem_parse_arguments, parse_error_is_caught)
 {
   const anthem::arguments a = {};
@@ -10,9 +10,12 @@
 
 #include <gtest/gtest.h>
 
+#include "ode/assets/asset_manager.h"
 #include "ode/filesystem/path.h"
+#include "ode/framework/job_system.h"
 #include "ode/lua/script.h"
 #include "ode/lua/state.h"
+#include "ode/systems/graphics/graphics_config.h"
 
 #include "anthem/config.h"
 
@@ -41,3 +44,136 @@ TEST(anthem_systems_scenes_world_map_loading, height)
   const auto height = anthem::world::load_map_height(state.get(), name);
   ASSERT_EQ(height, 100);
 }
+
+TEST(anthem_systems_scenes_world_map_loading, tile_layers)
+{
+  auto state = ode::lua::make_state();
+  const std::string name = "test";
+  std::string s = std::string{anthem::script_root} +
+      ode::filesystem::path::preferred_separator + "world" +
+      ode::filesystem::path::preferred_separator + name +
+      ode::filesystem::path::preferred_separator + "map.lua";
+  ode::lua::load_script_file(state.get(), s);
+
+  const auto ground = anthem::world::load_tile_layer(state.get(), name, 0);
+  const auto details = anthem::world::load_tile_layer(state.get(), name, 1);
+
+  ASSERT_EQ(100, ground.get_width());
+  ASSERT_EQ(100, ground.get_height());
+  ASSERT_EQ(1, ground.get(0, 0));
+  ASSERT_EQ(100, details.get_width());
+  ASSERT_EQ(0, details.get(0, 0));
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(anthem_systems_scenes_world_map_loading, tilesets)
+{
+  auto state = ode::lua::make_state();
+  const std::string name = "test";
+  std::string s = std::string{anthem::script_root} +
+      ode::filesystem::path::preferred_separator + "world" +
+      ode::filesystem::path::preferred_separator + name +
+      ode::filesystem::path::preferred_separator + "map.lua";
+  ode::lua::load_script_file(state.get(), s);
+
+  ode::texture_cache cache{};
+
+  const auto first = anthem::world::load_tilesets(state.get(), name, cache);
+  const auto second = anthem::world::load_tilesets(state.get(), name, cache);
+
+  ASSERT_EQ(1, first.tilesets.size());
+  ASSERT_EQ(1, first.tilesets[0].first_gid);
+  ASSERT_EQ(16, first.tilesets[0].tile_width);
+  ASSERT_EQ(128, first.tilesets[0].image_width);
+  ASSERT_EQ(0, first.tilesets[0].spacing);
+  ASSERT_EQ(32, first.tilesets[0].tile_count);
+  ASSERT_EQ(0, first.tilesets[0].atlas_x);
+  ASSERT_EQ(ode::texture_atlas_size, first.tilesets[0].texture_width);
+  ASSERT_EQ(0, lua_gettop(state.get()));
+
+  // The maps which share the tilesets share the atlas texture.
+  ASSERT_EQ(1, first.textures.size());
+  ASSERT_EQ(first.textures, second.textures);
+  ASSERT_EQ(1, cache.get_upload_count());
+  ASSERT_EQ(2, cache.get_reference_count(first.textures[0]));
+
+  anthem::world::release_tilesets(first, cache);
+  anthem::world::release_tilesets(second, cache);
+
+  ASSERT_EQ(0, cache.get_texture_count());
+}
+
+TEST(anthem_systems_scenes_world_map_loading, requested_tilesets)
+{
+  auto state = ode::lua::make_state();
+  const std::string name = "test";
+  std::string s = std::string{anthem::script_root} +
+      ode::filesystem::path::preferred_separator + "world" +
+      ode::filesystem::path::preferred_separator + name +
+      ode::filesystem::path::preferred_separator + "map.lua";
+  ode::lua::load_script_file(state.get(), s);
+
+  ode::texture_cache cache{};
+  ode::job_system jobs{1};
+  ode::asset_manager assets{jobs};
+
+  const auto handle =
+      anthem::world::request_tilesets(assets, cache, state.get(), name);
+
+  assets.finish();
+
+  const auto* tilesets = assets.get(handle);
+
+  ASSERT_NE(nullptr, tilesets);
+  ASSERT_EQ(1, tilesets->tilesets.size());
+  ASSERT_EQ(1, tilesets->textures.size());
+  ASSERT_EQ(1, cache.get_reference_count(tilesets->textures[0]));
+  ASSERT_EQ(0, lua_gettop(state.get()));
+
+  assets.release(handle);
+
+  ASSERT_EQ(0, cache.get_texture_count());
+}
+
+TEST(anthem_systems_scenes_world_map_loading, tile_animations)
+{
+  auto state = ode::lua::make_state();
+  const std::string name = "map_loading";
+  std::string s = std::string{anthem::test_script_root} +
+      ode::filesystem::path::preferred_separator + name + ".lua";
+  ode::lua::load_script_file(state.get(), s);
+
+  const auto animations =
+      anthem::world::load_tile_animations(state.get(), name);
+
+  ASSERT_EQ(1, animations.size());
+  ASSERT_EQ(5, animations[0].gid);
+  ASSERT_EQ(0, animations[0].tileset);
+  ASSERT_EQ(3, animations[0].frames.size());
+  ASSERT_EQ(5, animations[0].frames[1].tile);
+  ASSERT_EQ(500, animations[0].frames[2].duration);
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(anthem_systems_scenes_world_map_loading, collision_map)
+{
+  auto state = ode::lua::make_state();
+  const std::string name = "map_loading";
+  std::string s = std::string{anthem::test_script_root} +
+      ode::filesystem::path::preferred_separator + name + ".lua";
+  ode::lua::load_script_file(state.get(), s);
+
+  const auto map = anthem::world::load_collision_map(state.get(), name);
+
+  ASSERT_EQ(100, map.get_width());
+  ASSERT_EQ(100, map.get_height());
+
+  // The ground layer isn't a collision layer, but the details layer and the
+  // object layer are.
+  ASSERT_FALSE(map.is_solid(0, 0));
+  ASSERT_TRUE(map.is_solid(58, 31));
+  ASSERT_TRUE(map.is_solid(34, 43));
+  ASSERT_TRUE(map.is_solid(34, 44));
+  ASSERT_FALSE(map.is_solid(33, 43));
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
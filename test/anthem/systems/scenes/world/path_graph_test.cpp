@@ -0,0 +1,177 @@
+/// The tests of the hierarchical path graphs.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "anthem/systems/scenes/world/path_graph.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace anthem::test
+{
+  static ode::collision_map make_walled_map()
+  {
+    // A wall splits the map in two, and the only gap in it is at the
+    // bottom.
+    ode::collision_map map{64, 64, 16.0f, 16.0f};
+
+    for (int y = 0; y < 60; ++y)
+    {
+      map.set_solid(32, y, true);
+    }
+
+    return map;
+  }
+
+  static bool is_valid_path(
+      const world::path_graph& graph,
+      const std::vector<world::tile_point>& path)
+  {
+    const auto& map = graph.get_map();
+
+    for (std::size_t i = 0; i < path.size(); ++i)
+    {
+      const auto& p = path[i];
+
+      if (map.is_solid(p.x, p.y))
+      {
+        return false;
+      }
+
+      if (0 == i)
+      {
+        continue;
+      }
+
+      const auto& q = path[i - 1];
+      const int dx = p.x - q.x;
+      const int dy = p.y - q.y;
+
+      if (1 < std::abs(dx) || 1 < std::abs(dy) || (0 == dx && 0 == dy))
+      {
+        return false;
+      }
+
+      if (0 != dx && 0 != dy &&
+          (map.is_solid(q.x + dx, q.y) || map.is_solid(q.x, q.y + dy)))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+} // namespace anthem::test
+
+TEST(anthem_systems_scenes_world_path_graph, path_in_cluster)
+{
+  const anthem::world::path_graph graph{
+      ode::collision_map{64, 64, 16.0f, 16.0f}};
+
+  const auto path = graph.find_path({1, 1}, {5, 3});
+
+  ASSERT_EQ(16, graph.get_cluster_count());
+  ASSERT_EQ(5, path.size());
+  ASSERT_EQ((anthem::world::tile_point{1, 1}), path.front());
+  ASSERT_EQ((anthem::world::tile_point{5, 3}), path.back());
+  ASSERT_TRUE(anthem::test::is_valid_path(graph, path));
+}
+
+TEST(anthem_systems_scenes_world_path_graph, path_around_wall)
+{
+  const anthem::world::path_graph graph{anthem::test::make_walled_map()};
+
+  const auto path = graph.find_path({2, 2}, {60, 2});
+
+  ASSERT_FALSE(path.empty());
+  ASSERT_EQ((anthem::world::tile_point{2, 2}), path.front());
+  ASSERT_EQ((anthem::world::tile_point{60, 2}), path.back());
+  ASSERT_TRUE(anthem::test::is_valid_path(graph, path));
+
+  bool through_gap = false;
+
+  for (const auto& p : path)
+  {
+    through_gap = through_gap || (32 == p.x && 60 <= p.y);
+  }
+
+  ASSERT_TRUE(through_gap);
+}
+
+TEST(anthem_systems_scenes_world_path_graph, no_path)
+{
+  anthem::world::path_graph graph{anthem::test::make_walled_map()};
+
+  for (int y = 60; y < 64; ++y)
+  {
+    graph.set_solid(32, y, true);
+  }
+
+  ASSERT_TRUE(graph.is_dirty());
+
+  graph.rebuild();
+
+  ASSERT_FALSE(graph.is_dirty());
+  ASSERT_TRUE(graph.find_path({2, 2}, {60, 2}).empty());
+  ASSERT_TRUE(graph.find_path({2, 2}, {32, 2}).empty());
+}
+
+TEST(anthem_systems_scenes_world_path_graph, rebuild_is_incremental)
+{
+  anthem::world::path_graph graph{anthem::test::make_walled_map()};
+
+  // A new gap is opened in the wall, which changes only the clusters next
+  // to it.
+  graph.set_solid(32, 10, false);
+  graph.rebuild();
+
+  const anthem::world::path_graph fresh{graph.get_map()};
+
+  ASSERT_EQ(fresh.get_node_count(), graph.get_node_count());
+  ASSERT_EQ(fresh.get_edge_count(), graph.get_edge_count());
+
+  const auto path = graph.find_path({30, 10}, {34, 10});
+
+  ASSERT_EQ(5, path.size());
+  ASSERT_TRUE(anthem::test::is_valid_path(graph, path));
+}
+
+TEST(anthem_systems_scenes_world_path_graph, random_paths_are_valid)
+{
+  ode::collision_map map{100, 100, 16.0f, 16.0f};
+
+  std::srand(3);
+
+  for (int y = 0; y < 100; ++y)
+  {
+    for (int x = 0; x < 100; ++x)
+    {
+      if (0 == std::rand() % 5)
+      {
+        map.set_solid(x, y, true);
+      }
+    }
+  }
+
+  const anthem::world::path_graph graph{map};
+  anthem::world::path_scratch scratch{};
+
+  for (int i = 0; i < 200; ++i)
+  {
+    const anthem::world::tile_point start{std::rand() % 100, std::rand() % 100};
+    const anthem::world::tile_point goal{std::rand() % 100, std::rand() % 100};
+    const auto path = graph.find_path(start, goal, scratch);
+
+    if (!path.empty())
+    {
+      ASSERT_EQ(start, path.front());
+      ASSERT_EQ(goal, path.back());
+      ASSERT_TRUE(anthem::test::is_valid_path(graph, path));
+    }
+  }
+}
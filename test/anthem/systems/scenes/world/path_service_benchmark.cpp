@@ -0,0 +1,140 @@
+/// The benchmarks of the path services.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "anthem/systems/scenes/world/path_service.h"
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace anthem::test
+{
+  static ode::collision_map make_benchmark_map(const int size)
+  {
+    std::mt19937 engine{1};
+    std::bernoulli_distribution solid{0.2};
+
+    ode::collision_map map{size, size, 16.0f, 16.0f};
+
+    for (int y = 0; y < size; ++y)
+    {
+      for (int x = 0; x < size; ++x)
+      {
+        if (solid(engine))
+        {
+          map.set_solid(x, y, true);
+        }
+      }
+    }
+
+    return map;
+  }
+
+  static std::vector<world::tile_point> make_benchmark_points(
+      const ode::collision_map& map, const std::size_t count)
+  {
+    std::mt19937 engine{2};
+    std::uniform_int_distribution<int> x{0, map.get_width() - 1};
+    std::uniform_int_distribution<int> y{0, map.get_height() - 1};
+
+    std::vector<world::tile_point> points{};
+
+    while (points.size() < count)
+    {
+      const world::tile_point p{x(engine), y(engine)};
+
+      if (!map.is_solid(p.x, p.y))
+      {
+        points.push_back(p);
+      }
+    }
+
+    return points;
+  }
+} // namespace anthem::test
+
+static void anthem_path_graph_find_path(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+  const anthem::world::path_graph graph{
+      anthem::test::make_benchmark_map(size)};
+  const auto points =
+      anthem::test::make_benchmark_points(graph.get_map(), 1024);
+
+  anthem::world::path_scratch scratch{};
+  std::size_t i = 0;
+
+  for (auto _ : state)
+  {
+    const auto path = graph.find_path(
+        points[i % points.size()], points[(i + 1) % points.size()], scratch);
+    benchmark::DoNotOptimize(path.data());
+    i += 2;
+  }
+
+  state.counters["paths_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(anthem_path_graph_find_path)->Arg(100)->Arg(1024);
+
+static void anthem_path_graph_rebuild(benchmark::State& state)
+{
+  anthem::world::path_graph graph{anthem::test::make_benchmark_map(1024)};
+
+  int i = 0;
+
+  for (auto _ : state)
+  {
+    const int x = (i * 37) % 1024;
+    const int y = (i * 91) % 1024;
+    graph.set_solid(x, y, !graph.get_map().is_solid(x, y));
+    graph.rebuild();
+    ++i;
+  }
+}
+
+BENCHMARK(anthem_path_graph_rebuild);
+
+static void anthem_path_service_batch(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+
+  ode::job_system jobs{};
+  anthem::world::path_service paths{
+      jobs, anthem::test::make_benchmark_map(1024)};
+  const auto points =
+      anthem::test::make_benchmark_points(paths.get_graph().get_map(), 2048);
+
+  std::size_t found = 0;
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      paths.request(
+          points[(2 * i) % points.size()],
+          points[(2 * i + 1) % points.size()]);
+    }
+
+    paths.finish();
+
+    while (const auto result = paths.poll())
+    {
+      found += result->path.empty() ? 0 : 1;
+    }
+  }
+
+  state.counters["paths_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * count),
+      benchmark::Counter::kIsRate);
+  state.counters["found"] = static_cast<double>(found) /
+      static_cast<double>(state.iterations() * count);
+}
+
+BENCHMARK(anthem_path_service_batch)->Arg(256)->UseRealTime();
@@ -0,0 +1,77 @@
+/// The tests of the path services.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "anthem/systems/scenes/world/path_service.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(anthem_systems_scenes_world_path_service, requests_are_batched)
+{
+  ode::job_system jobs{2};
+  anthem::world::path_service paths{
+      jobs, ode::collision_map{64, 64, 16.0f, 16.0f}, 4};
+
+  std::vector<std::uint64_t> ids{};
+
+  for (int i = 0; i < 10; ++i)
+  {
+    ids.push_back(paths.request({0, i}, {63, 63 - i}));
+  }
+
+  ASSERT_EQ(10, paths.get_pending_count());
+
+  paths.finish();
+
+  std::vector<bool> found(ids.size(), false);
+
+  while (const auto result = paths.poll())
+  {
+    ASSERT_LT(result->id, found.size());
+    ASSERT_FALSE(result->path.empty());
+    const anthem::world::tile_point goal{
+        63, 63 - static_cast<int>(result->id)};
+
+    ASSERT_EQ(goal, result->path.back());
+    found[result->id] = true;
+  }
+
+  ASSERT_EQ(0, paths.get_pending_count());
+  ASSERT_EQ(std::vector<bool>(ids.size(), true), found);
+}
+
+TEST(anthem_systems_scenes_world_path_service, changed_tiles_are_used)
+{
+  ode::job_system jobs{1};
+  anthem::world::path_service paths{
+      jobs, ode::collision_map{32, 32, 16.0f, 16.0f}};
+
+  paths.request({0, 0}, {31, 0});
+  paths.update();
+
+  // The goal is walled in while the first request may still be running.
+  paths.set_solid(30, 0, true);
+  paths.set_solid(30, 1, true);
+  paths.set_solid(31, 1, true);
+  paths.request({0, 0}, {31, 0});
+  paths.finish();
+
+  std::vector<anthem::world::path_result> results{};
+
+  while (auto result = paths.poll())
+  {
+    results.push_back(std::move(*result));
+  }
+
+  ASSERT_EQ(2, results.size());
+
+  for (const auto& r : results)
+  {
+    ASSERT_EQ(0 == r.id, !r.path.empty());
+  }
+}
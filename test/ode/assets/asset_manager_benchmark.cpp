@@ -0,0 +1,67 @@
+/// The benchmarks of the asset manager.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/assets/asset_manager.h"
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/systems/graphics/image.h"
+
+static void ode_asset_manager_frame(benchmark::State& state)
+{
+  // Each asset takes a millisecond to decode, which is about the time of
+  // decoding a small image. The benchmark measures how long it takes for all
+  // of the assets to become ready while the main thread keeps running frames
+  // and how many frames that takes.
+  const auto count = static_cast<int>(state.range(0));
+
+  ode::job_system jobs{};
+  std::size_t frames = 0;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+
+    ode::asset_manager assets{jobs};
+    std::vector<ode::asset_handle<ode::image>> handles{};
+
+    for (int i = 0; i < count; ++i)
+    {
+      handles.push_back(assets.request<ode::image>(
+          std::to_string(i),
+          []() -> std::optional<ode::image> {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            return ode::make_image(64, 64);
+          },
+          [](ode::image& img) -> std::size_t { return img.pixels.size(); }));
+    }
+
+    state.ResumeTiming();
+
+    while (assets.get_pending_count() > 0)
+    {
+      assets.update();
+      ++frames;
+    }
+
+    state.PauseTiming();
+    jobs.wait();
+    state.ResumeTiming();
+  }
+
+  state.counters["frames"] = benchmark::Counter(
+      static_cast<double>(frames), benchmark::Counter::kAvgIterations);
+  state.counters["workers"] = static_cast<double>(jobs.get_thread_count());
+}
+
+BENCHMARK(ode_asset_manager_frame)->Arg(16)->Arg(256);
@@ -0,0 +1,153 @@
+/// The tests of the asset manager.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/assets/asset_manager.h"
+
+#include <atomic>
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+
+TEST(ode_asset_manager, assets_become_ready)
+{
+  ode::job_system jobs{2};
+  ode::asset_manager assets{jobs};
+
+  const auto handle = assets.request<int>(
+      "answer",
+      []() -> std::optional<int> { return 42; },
+      [](int&) -> std::size_t { return 0; });
+
+  ASSERT_EQ(ode::asset_state::pending, assets.get_state(handle));
+  ASSERT_EQ(nullptr, assets.get(handle));
+
+  assets.finish();
+
+  ASSERT_EQ(ode::asset_state::ready, assets.get_state(handle));
+  ASSERT_EQ(42, *assets.get(handle));
+  ASSERT_EQ(0, assets.get_pending_count());
+}
+
+TEST(ode_asset_manager, requests_are_shared)
+{
+  ode::job_system jobs{2};
+  ode::asset_manager assets{jobs};
+  std::atomic<int> decodes{0};
+  int unloads = 0;
+
+  const auto decode = [&decodes]() -> std::optional<int> {
+    ++decodes;
+    return 1;
+  };
+  const auto upload = [](int&) -> std::size_t { return 0; };
+  const auto unload = [&unloads](int&) { ++unloads; };
+
+  const auto a = assets.request<int>("shared", decode, upload, unload);
+  const auto b = assets.request<int>("shared", decode, upload, unload);
+
+  assets.finish();
+
+  ASSERT_EQ(a.id, b.id);
+  ASSERT_EQ(1, decodes.load());
+
+  assets.release(a);
+
+  ASSERT_EQ(0, unloads);
+  ASSERT_EQ(1, *assets.get(b));
+
+  assets.release(b);
+
+  ASSERT_EQ(1, unloads);
+}
+
+TEST(ode_asset_manager, failed_assets_are_reported)
+{
+  ode::job_system jobs{1};
+  ode::asset_manager assets{jobs};
+
+  const auto handle = assets.request<int>(
+      "missing",
+      []() -> std::optional<int> { return std::nullopt; },
+      [](int&) -> std::size_t { return 0; });
+
+  assets.finish();
+
+  ASSERT_EQ(ode::asset_state::failed, assets.get_state(handle));
+  ASSERT_EQ(nullptr, assets.get(handle));
+
+  // A failed asset isn't shared, so it can be requested again.
+  const auto retry = assets.request<int>(
+      "missing",
+      []() -> std::optional<int> { return 3; },
+      [](int&) -> std::size_t { return 0; });
+
+  assets.finish();
+
+  ASSERT_NE(handle.id, retry.id);
+  ASSERT_EQ(3, *assets.get(retry));
+  ASSERT_EQ(ode::asset_state::failed, assets.get_state(handle));
+
+  assets.release(handle);
+
+  ASSERT_EQ(3, *assets.get(retry));
+
+  assets.release(retry);
+}
+
+TEST(ode_asset_manager, shared_assets_have_one_type)
+{
+  ode::job_system jobs{1};
+  ode::asset_manager assets{jobs};
+
+  const auto handle = assets.request<int>(
+      "typed",
+      []() -> std::optional<int> { return 1; },
+      [](int&) -> std::size_t { return 0; });
+
+  assets.finish();
+
+#if defined(GSL_THROW_ON_CONTRACT_VIOLATION) && \
+    GSL_THROW_ON_CONTRACT_VIOLATION
+
+  ASSERT_ANY_THROW(assets.request<float>(
+      "typed",
+      []() -> std::optional<float> { return 1.0f; },
+      [](float&) -> std::size_t { return 0; }));
+
+#endif // defined(GSL_THROW_ON_CONTRACT_VIOLATION) && \
+    GSL_THROW_ON_CONTRACT_VIOLATION
+
+  ASSERT_EQ(1, *assets.get(handle));
+}
+
+TEST(ode_asset_manager, uploads_are_budgeted)
+{
+  ode::job_system jobs{2};
+  ode::asset_manager assets{jobs, 100};
+  int uploads = 0;
+
+  for (int i = 0; i < 10; ++i)
+  {
+    assets.request<int>(
+        "asset" + std::to_string(i),
+        [i]() -> std::optional<int> { return i; },
+        [&uploads](int&) -> std::size_t {
+          ++uploads;
+          return 50;
+        });
+  }
+
+  jobs.wait();
+
+  // Two uploads fit in the budget of each frame.
+  ASSERT_EQ(2, assets.update());
+  ASSERT_EQ(2, uploads);
+  ASSERT_EQ(8, assets.get_pending_count());
+  ASSERT_EQ(2, assets.update());
+  ASSERT_EQ(4, uploads);
+}
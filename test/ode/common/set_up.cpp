@@ -13,6 +13,7 @@
 #include "ode/config.h"
 #include "ode/filesystem/path.h"
 #include "ode/framework/platform_manager.h"
+#include "ode/gl/capabilities.h"
 #include "ode/gl/gl_config.h"
 #include "ode/logger.h"
 #include "ode/logging_config.h"
@@ -60,6 +61,11 @@ namespace ode::test
       Uint32 flags = SDL_WINDOW_OPENGL;
 #endif // !ODE_MACOS
 
+      if constexpr (test_offscreen)
+      {
+        flags |= SDL_WINDOW_HIDDEN;
+      }
+
       test_window = SDL_CreateWindow(
           "info.window_name.data()",
           SDL_WINDOWPOS_CENTERED,
@@ -83,6 +89,7 @@ namespace ode::test
       test_gl_context = SDL_GL_CreateContext(window);
       SDL_GL_SwapWindow(window);
       gladLoadGLLoader(static_cast<GLADloadproc>(SDL_GL_GetProcAddress));
+      ode::gl::load_capabilities();
       SDL_GL_SetSwapInterval(opengl_swap_interval);
     }
   } // namespace detail
@@ -0,0 +1,125 @@
+/// The tests of the file watcher.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/filesystem/file_watcher.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace ode::test
+{
+  static std::string make_watched_file(const std::string& name)
+  {
+    const auto p = std::filesystem::temp_directory_path() / name;
+
+    std::ofstream{p} << "first = 1\n";
+
+    return p.string();
+  }
+
+  static std::vector<std::string> poll_until_changed(
+      ode::filesystem::file_watcher& watcher)
+  {
+    for (int i = 0; i < 50; ++i)
+    {
+      auto changed = watcher.poll(100ms);
+
+      if (!changed.empty())
+      {
+        return changed;
+      }
+    }
+
+    return {};
+  }
+} // namespace ode::test
+
+TEST(ode_filesystem_file_watcher, missing_file_is_not_watched)
+{
+  ode::filesystem::file_watcher watcher{};
+
+  ASSERT_FALSE(watcher.add("ode_file_watcher_not_real.lua"));
+}
+
+TEST(ode_filesystem_file_watcher, modification_is_detected)
+{
+  const auto filename =
+      ode::test::make_watched_file("ode_file_watcher_modified.lua");
+
+  ode::filesystem::file_watcher watcher{};
+
+  ASSERT_TRUE(watcher.add(filename));
+  ASSERT_TRUE(watcher.poll(10ms).empty());
+
+  // The modification times of some file systems have a resolution of a
+  // second.
+  if (!watcher.is_notified())
+  {
+    std::this_thread::sleep_for(1100ms);
+  }
+
+  std::ofstream{filename} << "first = 2\n";
+
+  const auto changed = ode::test::poll_until_changed(watcher);
+
+  ASSERT_EQ(1, changed.size());
+  ASSERT_EQ(filename, changed.front());
+
+  std::filesystem::remove(filename);
+}
+
+TEST(ode_filesystem_file_watcher, unwatched_file_is_ignored)
+{
+  const auto watched =
+      ode::test::make_watched_file("ode_file_watcher_watched.lua");
+  const auto unwatched =
+      ode::test::make_watched_file("ode_file_watcher_unwatched.lua");
+
+  ode::filesystem::file_watcher watcher{};
+
+  ASSERT_TRUE(watcher.add(watched));
+
+  std::ofstream{unwatched} << "first = 2\n";
+
+  ASSERT_TRUE(watcher.poll(100ms).empty());
+
+  std::filesystem::remove(watched);
+  std::filesystem::remove(unwatched);
+}
+
+TEST(ode_filesystem_file_watcher, new_file_in_directory_is_detected)
+{
+  const auto directory =
+      std::filesystem::temp_directory_path() / "ode_file_watcher_directory";
+
+  std::filesystem::create_directories(directory / "nested");
+
+  ode::filesystem::file_watcher watcher{};
+
+  ASSERT_TRUE(watcher.add_directory(directory.string()));
+  ASSERT_TRUE(watcher.poll(10ms).empty());
+
+  const auto filename = directory / "nested" / "created.lua";
+
+  std::ofstream{filename} << "first = 1\n";
+
+  const auto changed = ode::test::poll_until_changed(watcher);
+
+  ASSERT_EQ(1, changed.size());
+  ASSERT_EQ(
+      std::filesystem::absolute(filename).lexically_normal().string(),
+      changed.front());
+
+  std::filesystem::remove_all(directory);
+}
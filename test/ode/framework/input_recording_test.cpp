@@ -0,0 +1,145 @@
+/// The tests of the recording and the playback of the input events.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/input_recording.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <SDL2/SDL.h>
+#include <gtest/gtest.h>
+
+namespace ode::test
+{
+  static std::string make_recording_filename(const std::string& name)
+  {
+    return (std::filesystem::temp_directory_path() / name).string();
+  }
+
+  static SDL_Event make_key_event(
+      const SDL_Scancode scancode, const bool down)
+  {
+    SDL_Event event{};
+    event.type = down ? SDL_KEYDOWN : SDL_KEYUP;
+    event.key.keysym.scancode = scancode;
+    return event;
+  }
+
+  static SDL_Event make_motion_event(const int x, const int y)
+  {
+    SDL_Event event{};
+    event.type = SDL_MOUSEMOTION;
+    event.motion.x = x;
+    event.motion.y = y;
+    event.motion.xrel = -x;
+    event.motion.yrel = -y;
+    return event;
+  }
+} // namespace ode::test
+
+TEST(ode_input_recording, events_are_encoded_and_decoded)
+{
+  std::vector<std::uint8_t> buffer{};
+
+  SDL_Event axis{};
+  axis.type = SDL_CONTROLLERAXISMOTION;
+  axis.caxis.axis = SDL_CONTROLLER_AXIS_LEFTY;
+  axis.caxis.value = -32768;
+
+  ASSERT_TRUE(ode::encode_input_event(
+      ode::test::make_key_event(SDL_SCANCODE_SPACE, true), buffer));
+  ASSERT_TRUE(
+      ode::encode_input_event(ode::test::make_motion_event(-5, 300), buffer));
+  ASSERT_TRUE(ode::encode_input_event(axis, buffer));
+
+  SDL_Event window{};
+  window.type = SDL_WINDOWEVENT;
+
+  ASSERT_FALSE(ode::encode_input_event(window, buffer));
+
+  const std::uint8_t* data = buffer.data();
+  const std::uint8_t* const end = data + buffer.size();
+
+  const auto key = ode::decode_input_event(data, end);
+  const auto motion = ode::decode_input_event(data, end);
+  const auto controller = ode::decode_input_event(data, end);
+
+  ASSERT_TRUE(key && motion && controller);
+  ASSERT_EQ(end, data);
+
+  ASSERT_EQ(SDL_KEYDOWN, key->type);
+  ASSERT_EQ(SDL_SCANCODE_SPACE, key->key.keysym.scancode);
+  ASSERT_EQ(SDL_MOUSEMOTION, motion->type);
+  ASSERT_EQ(-5, motion->motion.x);
+  ASSERT_EQ(300, motion->motion.y);
+  ASSERT_EQ(5, motion->motion.xrel);
+  ASSERT_EQ(-300, motion->motion.yrel);
+  ASSERT_EQ(SDL_CONTROLLERAXISMOTION, controller->type);
+  ASSERT_EQ(SDL_CONTROLLER_AXIS_LEFTY, controller->caxis.axis);
+  ASSERT_EQ(-32768, controller->caxis.value);
+}
+
+TEST(ode_input_recording, session_is_played_back)
+{
+  const auto filename =
+      ode::test::make_recording_filename("ode_input_recording_test.bin");
+
+  std::uint64_t recorded = 0;
+
+  {
+    ode::input_recorder recorder{filename};
+
+    recorder.record(0, ode::test::make_key_event(SDL_SCANCODE_A, true));
+    recorder.record(0, ode::test::make_motion_event(10, 20));
+    recorder.record(3, ode::test::make_key_event(SDL_SCANCODE_A, false));
+    recorder.record(200, ode::test::make_motion_event(11, 22));
+
+    ASSERT_EQ(4, recorder.get_event_count());
+
+    recorded = recorder.finish(240, 42);
+  }
+
+  ode::input_player player{filename};
+
+  ASSERT_EQ(240, player.get_tick_count());
+  ASSERT_EQ(recorded, player.get_recorded_checksum());
+
+  std::vector<std::uint64_t> ticks{};
+
+  for (std::uint64_t tick = 0; !player.is_finished(tick); ++tick)
+  {
+    while (const auto event = player.next(tick))
+    {
+      ticks.push_back(tick);
+    }
+  }
+
+  ASSERT_EQ((std::vector<std::uint64_t>{0, 0, 3, 200}), ticks);
+  ASSERT_EQ(recorded, player.finish(42));
+  ASSERT_NE(recorded, player.finish(43));
+
+  std::filesystem::remove(filename);
+}
+
+TEST(ode_input_recording, invalid_files_are_rejected)
+{
+  const auto filename =
+      ode::test::make_recording_filename("ode_input_recording_invalid.bin");
+
+  {
+    std::ofstream file{filename, std::ios::binary};
+    file << "This isn't an input recording at all.";
+  }
+
+  ASSERT_THROW(ode::input_player{filename}, std::runtime_error);
+
+  std::filesystem::remove(filename);
+}
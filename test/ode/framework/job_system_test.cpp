@@ -0,0 +1,103 @@
+/// The tests of the job system.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/job_system.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+TEST(ode_job_system, threads_are_created)
+{
+  ode::job_system jobs{3};
+
+  ASSERT_EQ(3, jobs.get_thread_count());
+}
+
+TEST(ode_job_system, jobs_are_run)
+{
+  ode::job_system jobs{4};
+  std::atomic<int> sum{0};
+
+  for (int i = 1; i <= 100; ++i)
+  {
+    jobs.submit([&sum, i] { sum += i; });
+  }
+
+  jobs.wait();
+
+  ASSERT_EQ(5050, sum.load());
+}
+
+TEST(ode_job_system, failing_jobs_are_finished)
+{
+  ode::job_system jobs{1};
+  std::atomic<int> count{0};
+
+  jobs.submit([] { throw std::runtime_error{"failure"}; });
+  jobs.submit([&count] { ++count; });
+  jobs.wait();
+
+  ASSERT_EQ(1, count.load());
+}
+
+TEST(ode_job_system, batches_are_run)
+{
+  ode::job_system jobs{3};
+  std::atomic<int> sum{0};
+
+  jobs.run_batch(100, [&sum](const std::size_t i) {
+    sum += static_cast<int>(i) + 1;
+  });
+
+  ASSERT_EQ(5050, sum.load());
+}
+
+TEST(ode_job_system, batches_can_be_run_from_jobs)
+{
+  ode::job_system jobs{1};
+  std::atomic<int> count{0};
+  std::atomic<bool> released{false};
+
+  // The job keeps the only worker busy, so the batch run inside it must be
+  // finished by the job itself and it must not wait for the other jobs.
+  jobs.submit([&jobs, &count, &released] {
+    jobs.submit([&released] {
+      while (!released)
+      {
+        std::this_thread::yield();
+      }
+    });
+    jobs.run_batch(10, [&count](const std::size_t) { ++count; });
+    released = true;
+  });
+  jobs.wait();
+
+  ASSERT_EQ(10, count.load());
+}
+
+TEST(ode_job_system, batch_failures_are_rethrown)
+{
+  ode::job_system jobs{2};
+  std::atomic<int> count{0};
+
+  ASSERT_THROW(
+      jobs.run_batch(
+          8,
+          [&count](const std::size_t i) {
+            ++count;
+
+            if (3 == i)
+            {
+              throw std::runtime_error{"failure"};
+            }
+          }),
+      std::runtime_error);
+  ASSERT_EQ(8, count.load());
+}
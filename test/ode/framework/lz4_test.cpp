@@ -0,0 +1,111 @@
+/// The tests of the LZ4 block compression.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/lz4.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace ode::test
+{
+  static std::vector<std::uint8_t> round_trip(
+      const std::vector<std::uint8_t>& data)
+  {
+    std::vector<std::uint8_t> compressed{};
+    lz4_compress(data.data(), data.size(), compressed);
+
+    std::vector<std::uint8_t> decompressed(data.size());
+
+    if (!lz4_decompress(
+            compressed.data(),
+            compressed.size(),
+            decompressed.data(),
+            decompressed.size()))
+    {
+      return {};
+    }
+
+    return decompressed;
+  }
+} // namespace ode::test
+
+TEST(ode_lz4, short_data_is_restored)
+{
+  for (std::size_t size = 1; size < 40; ++size)
+  {
+    std::vector<std::uint8_t> data(size);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      data[i] = static_cast<std::uint8_t>(i % 3);
+    }
+
+    ASSERT_EQ(data, ode::test::round_trip(data));
+  }
+}
+
+TEST(ode_lz4, repetitive_data_is_compressed)
+{
+  std::vector<std::uint8_t> data(100000);
+
+  for (std::size_t i = 0; i < data.size(); ++i)
+  {
+    data[i] = static_cast<std::uint8_t>((i / 7) % 13);
+  }
+
+  std::vector<std::uint8_t> compressed{};
+  const auto size = ode::lz4_compress(data.data(), data.size(), compressed);
+
+  ASSERT_EQ(size, compressed.size());
+  ASSERT_GT(data.size() / 10, size);
+  ASSERT_EQ(data, ode::test::round_trip(data));
+}
+
+TEST(ode_lz4, random_data_is_restored)
+{
+  std::mt19937 engine{1};
+  std::vector<std::uint8_t> data(70000);
+
+  for (auto& b : data)
+  {
+    b = static_cast<std::uint8_t>(engine());
+  }
+
+  // A part of the data repeats beyond the largest offset.
+  std::copy_n(data.begin(), 1000, data.begin() + 68000);
+
+  std::vector<std::uint8_t> compressed{};
+  ode::lz4_compress(data.data(), data.size(), compressed);
+
+  ASSERT_GE(ode::lz4_compress_bound(data.size()), compressed.size());
+  ASSERT_EQ(data, ode::test::round_trip(data));
+}
+
+TEST(ode_lz4, corrupted_data_is_rejected)
+{
+  std::vector<std::uint8_t> data(1000, 42);
+  std::vector<std::uint8_t> compressed{};
+  ode::lz4_compress(data.data(), data.size(), compressed);
+
+  std::vector<std::uint8_t> out(data.size());
+
+  ASSERT_FALSE(ode::lz4_decompress(
+      compressed.data(), compressed.size() - 1, out.data(), out.size()));
+  ASSERT_FALSE(ode::lz4_decompress(
+      compressed.data(), compressed.size(), out.data(), out.size() - 1));
+
+  // The offset of the first match points before the start of the data.
+  compressed[2] = 0xff;
+  compressed[3] = 0xff;
+
+  ASSERT_FALSE(ode::lz4_decompress(
+      compressed.data(), compressed.size(), out.data(), out.size()));
+}
@@ -0,0 +1,180 @@
+/// The benchmarks of the binary streams and the compression of the
+/// snapshots.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/snapshot.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/framework/binary_stream.h"
+#include "ode/framework/lz4.h"
+
+namespace ode::test
+{
+  ///
+  /// The type of the components which are written field by field, like
+  /// the components of the state will be.
+  ///
+  struct benchmark_body final
+  {
+    float x;
+    float y;
+    float velocity_x;
+    float velocity_y;
+    std::uint32_t tile;
+    std::uint16_t flags;
+
+    void serialize(binary_writer& writer) const
+    {
+      writer.write(x);
+      writer.write(y);
+      writer.write(velocity_x);
+      writer.write(velocity_y);
+      writer.write(tile);
+      writer.write(flags);
+    }
+
+    void deserialize(binary_reader& reader)
+    {
+      x = reader.read<float>();
+      y = reader.read<float>();
+      velocity_x = reader.read<float>();
+      velocity_y = reader.read<float>();
+      tile = reader.read<std::uint32_t>();
+      flags = reader.read<std::uint16_t>();
+    }
+  };
+
+  static std::vector<benchmark_body> make_bodies(const std::size_t count)
+  {
+    std::mt19937 engine{1};
+    std::uniform_real_distribution<float> position{0.0f, 4096.0f};
+    std::uniform_int_distribution<std::uint32_t> tile{0, 63};
+
+    std::vector<benchmark_body> bodies(count);
+
+    for (auto& b : bodies)
+    {
+      // The velocities and the flags are mostly zero, as in a real scene.
+      b = {position(engine), position(engine), 0.0f, 0.0f, tile(engine), 0};
+    }
+
+    return bodies;
+  }
+
+  static std::vector<std::uint8_t> serialize_bodies(
+      const std::vector<benchmark_body>& bodies)
+  {
+    std::vector<std::uint8_t> buffer{};
+
+    {
+      binary_writer writer{buffer};
+      writer.write_vector(bodies);
+    }
+
+    return buffer;
+  }
+} // namespace ode::test
+
+static void ode_binary_stream_serialize(benchmark::State& state)
+{
+  const auto bodies = ode::test::make_bodies(
+      static_cast<std::size_t>(state.range(0)));
+  std::vector<std::uint8_t> buffer{};
+
+  for (auto _ : state)
+  {
+    buffer.clear();
+    ode::binary_writer writer{buffer};
+    writer.write_vector(bodies);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+
+  state.SetBytesProcessed(
+      static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+
+BENCHMARK(ode_binary_stream_serialize)->Arg(1 << 10)->Arg(1 << 16);
+
+static void ode_binary_stream_deserialize(benchmark::State& state)
+{
+  const auto buffer = ode::test::serialize_bodies(
+      ode::test::make_bodies(static_cast<std::size_t>(state.range(0))));
+  std::vector<ode::test::benchmark_body> bodies{};
+
+  for (auto _ : state)
+  {
+    ode::binary_reader reader{buffer.data(), buffer.size()};
+    reader.read_vector(bodies);
+    benchmark::DoNotOptimize(bodies.data());
+  }
+
+  state.SetBytesProcessed(
+      static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+
+BENCHMARK(ode_binary_stream_deserialize)->Arg(1 << 10)->Arg(1 << 16);
+
+static void ode_lz4_compress(benchmark::State& state)
+{
+  const auto buffer =
+      ode::test::serialize_bodies(ode::test::make_bodies(1 << 16));
+  std::vector<std::uint8_t> compressed{};
+
+  for (auto _ : state)
+  {
+    compressed.clear();
+    ode::lz4_compress(buffer.data(), buffer.size(), compressed);
+    benchmark::DoNotOptimize(compressed.data());
+  }
+
+  state.SetBytesProcessed(
+      static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  state.counters["ratio"] = static_cast<double>(buffer.size()) /
+      static_cast<double>(compressed.size());
+}
+
+BENCHMARK(ode_lz4_compress);
+
+static void ode_lz4_decompress(benchmark::State& state)
+{
+  const auto buffer =
+      ode::test::serialize_bodies(ode::test::make_bodies(1 << 16));
+  std::vector<std::uint8_t> compressed{};
+  ode::lz4_compress(buffer.data(), buffer.size(), compressed);
+
+  std::vector<std::uint8_t> out(buffer.size());
+
+  for (auto _ : state)
+  {
+    ode::lz4_decompress(
+        compressed.data(), compressed.size(), out.data(), out.size());
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetBytesProcessed(
+      static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+
+BENCHMARK(ode_lz4_decompress);
+
+static void ode_snapshot_encode(benchmark::State& state)
+{
+  ode::snapshot_encoder encoder{};
+  const ode::state s{};
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(encoder.encode(s).data());
+  }
+}
+
+BENCHMARK(ode_snapshot_encode);
@@ -0,0 +1,226 @@
+/// The tests of the binary streams and the snapshots of the state.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/snapshot.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ode/framework/binary_stream.h"
+#include "ode/framework/job_system.h"
+#include "ode/framework/state.h"
+
+namespace ode::test
+{
+  struct serialized_body final
+  {
+    float x;
+    float y;
+    std::uint32_t tile;
+    bool solid;
+
+    void serialize(binary_writer& writer) const
+    {
+      writer.write(x);
+      writer.write(y);
+      writer.write(tile);
+      writer.write(solid);
+    }
+
+    void deserialize(binary_reader& reader)
+    {
+      x = reader.read<float>();
+      y = reader.read<float>();
+      tile = reader.read<std::uint32_t>();
+      solid = reader.read<bool>();
+    }
+  };
+} // namespace ode::test
+
+TEST(ode_binary_stream, values_are_read_back)
+{
+  std::vector<std::uint8_t> buffer{};
+
+  const std::vector<double> values{1.5, -2.25, 1e9};
+  const std::vector<ode::test::serialized_body> bodies{
+      {1.0f, 2.0f, 3, true}, {-4.0f, 5.5f, 6, false}};
+
+  {
+    ode::binary_writer writer{buffer};
+    writer.write(std::int16_t{-3});
+    writer.write(std::uint64_t{0x0102030405060708});
+    writer.write_string("save");
+    writer.write_vector(values);
+    writer.write_vector(bodies);
+
+    ASSERT_EQ(2 + 8 + 4 + 4 + 4 + 24 + 4 + 2 * 13, writer.get_size());
+  }
+
+  // The layout is little-endian on every processor.
+  ASSERT_EQ(0xfd, buffer[0]);
+  ASSERT_EQ(0xff, buffer[1]);
+  ASSERT_EQ(0x08, buffer[2]);
+
+  ode::binary_reader reader{buffer.data(), buffer.size()};
+  std::vector<double> read_values{};
+  std::vector<ode::test::serialized_body> read_bodies{};
+
+  ASSERT_EQ(-3, reader.read<std::int16_t>());
+  ASSERT_EQ(0x0102030405060708u, reader.read<std::uint64_t>());
+  ASSERT_EQ("save", reader.read_string());
+  ASSERT_TRUE(reader.read_vector(read_values));
+  ASSERT_TRUE(reader.read_vector(read_bodies));
+  ASSERT_TRUE(reader.is_at_end());
+
+  ASSERT_EQ(values, read_values);
+  ASSERT_EQ(2, read_bodies.size());
+  ASSERT_FLOAT_EQ(5.5f, read_bodies[1].y);
+  ASSERT_EQ(6, read_bodies[1].tile);
+  ASSERT_TRUE(read_bodies[0].solid);
+}
+
+TEST(ode_binary_stream, reading_past_end_fails)
+{
+  const std::uint8_t data[] = {1, 2, 3};
+  ode::binary_reader reader{data, sizeof(data)};
+
+  ASSERT_EQ(0, reader.read<std::uint32_t>());
+  ASSERT_FALSE(reader.is_ok());
+  ASSERT_EQ(0, reader.read<std::uint8_t>());
+
+  // A corrupted count doesn't allocate.
+  const std::uint8_t count[] = {0xff, 0xff, 0xff, 0xff};
+  ode::binary_reader vector_reader{count, sizeof(count)};
+  std::vector<std::uint32_t> values{};
+
+  ASSERT_FALSE(vector_reader.read_vector(values));
+  ASSERT_TRUE(values.empty());
+}
+
+TEST(ode_binary_stream, unknown_sections_are_skipped)
+{
+  std::vector<std::uint8_t> buffer{};
+
+  {
+    ode::binary_writer writer{buffer};
+
+    auto marker = writer.begin_section(ode::make_section_tag("NEWS"), 7);
+    writer.write_string("from a newer version");
+    writer.end_section(marker);
+
+    marker = writer.begin_section(ode::make_section_tag("KNOW"), 1);
+    writer.write(std::int32_t{42});
+    writer.end_section(marker);
+  }
+
+  ode::binary_reader reader{buffer.data(), buffer.size()};
+  int value = 0;
+
+  while (auto section = reader.read_section())
+  {
+    if (ode::make_section_tag("KNOW") == section->tag)
+    {
+      ASSERT_EQ(1, section->version);
+      value = section->body.read<std::int32_t>();
+    }
+  }
+
+  ASSERT_TRUE(reader.is_ok());
+  ASSERT_EQ(42, value);
+}
+
+TEST(ode_snapshot, state_is_decoded)
+{
+  ode::snapshot_encoder encoder{};
+  ode::snapshot_decoder decoder{};
+  const ode::state s{};
+
+  for (const auto compression :
+       {ode::snapshot_compression::none, ode::snapshot_compression::lz4})
+  {
+    const auto& bytes = encoder.encode(s, compression);
+    const auto decoded = decoder.decode(bytes.data(), bytes.size());
+
+    ASSERT_EQ(s.checksum(1), decoded.checksum(1));
+  }
+}
+
+TEST(ode_snapshot, invalid_snapshot_throws)
+{
+  ode::snapshot_encoder encoder{};
+  ode::snapshot_decoder decoder{};
+
+  auto bytes = encoder.encode(ode::state{});
+
+  ASSERT_THROW(decoder.decode(bytes.data(), 4), std::runtime_error);
+  ASSERT_THROW(
+      decoder.decode(bytes.data(), bytes.size() - 1), std::runtime_error);
+
+  bytes[8] = 2;
+
+  ASSERT_THROW(decoder.decode(bytes.data(), bytes.size()), std::runtime_error);
+}
+
+TEST(ode_snapshot, newer_state_is_rejected)
+{
+  std::vector<std::uint8_t> body{};
+
+  {
+    ode::binary_writer writer{body};
+    const auto marker = writer.begin_section(
+        ode::make_section_tag("STAT"), ode::state_schema_version + 1);
+    writer.end_section(marker);
+  }
+
+  std::vector<std::uint8_t> bytes{};
+
+  {
+    ode::binary_writer writer{bytes};
+    writer.write_array("ODESNAPS", 8);
+    writer.write(std::uint8_t{1});
+    writer.write(ode::snapshot_compression::none);
+    writer.write(static_cast<std::uint64_t>(body.size()));
+    writer.write(static_cast<std::uint64_t>(body.size()));
+  }
+
+  bytes.insert(bytes.end(), body.begin(), body.end());
+
+  ode::snapshot_decoder decoder{};
+
+  ASSERT_THROW(decoder.decode(bytes.data(), bytes.size()), std::runtime_error);
+}
+
+TEST(ode_snapshot, snapshot_is_saved_in_background)
+{
+  const auto filename =
+      (std::filesystem::temp_directory_path() / "ode_snapshot_test.sav")
+          .string();
+
+  std::filesystem::remove(filename);
+
+  ode::job_system jobs{1};
+  ode::snapshot_writer writer{jobs};
+
+  writer.save(ode::state{}, filename);
+  jobs.wait();
+
+  ASSERT_EQ(0, writer.get_pending_count());
+  ASSERT_EQ(0, writer.get_failed_count());
+  ASSERT_TRUE(std::filesystem::exists(filename));
+  ASSERT_FALSE(std::filesystem::exists(filename + ".tmp"));
+  ASSERT_NO_THROW(ode::load_snapshot(filename));
+
+  writer.save(ode::state{}, "/nonexistent/directory/snapshot.sav");
+  jobs.wait();
+
+  ASSERT_EQ(1, writer.get_failed_count());
+}
@@ -0,0 +1,89 @@
+/// The tests of the single-producer, single-consumer queues.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/framework/spsc_queue.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+TEST(ode_spsc_queue, capacity_is_rounded_to_power_of_two)
+{
+  ode::spsc_queue<int> queue{5};
+
+  ASSERT_EQ(8, queue.get_capacity());
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(ode_spsc_queue, values_are_popped_in_order)
+{
+  ode::spsc_queue<int> queue{4};
+
+  ASSERT_TRUE(queue.try_push(1));
+  ASSERT_TRUE(queue.try_push(2));
+  ASSERT_TRUE(queue.try_push(3));
+  ASSERT_TRUE(queue.try_push(4));
+  ASSERT_FALSE(queue.try_push(5));
+
+  ASSERT_EQ(1, queue.try_pop());
+  ASSERT_EQ(2, queue.try_pop());
+
+  // The next values wrap around the end of the ring.
+  const int values[] = {6, 7, 8};
+  ASSERT_EQ(2, queue.push(values, 3));
+
+  int out[4] = {};
+  ASSERT_EQ(4, queue.pop(out, 4));
+  ASSERT_EQ(3, out[0]);
+  ASSERT_EQ(4, out[1]);
+  ASSERT_EQ(6, out[2]);
+  ASSERT_EQ(7, out[3]);
+  ASSERT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(ode_spsc_queue, values_are_passed_between_threads)
+{
+  constexpr int count = 100000;
+  ode::spsc_queue<int> queue{64};
+
+  std::thread producer{[&queue] {
+    for (int i = 0; i < count;)
+    {
+      if (queue.try_push(i))
+      {
+        ++i;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  long long sum = 0;
+  int expected = 0;
+  bool ordered = true;
+
+  while (expected < count)
+  {
+    if (const auto value = queue.try_pop())
+    {
+      ordered = ordered && expected == *value;
+      sum += *value;
+      ++expected;
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  producer.join();
+
+  ASSERT_TRUE(ordered);
+  ASSERT_EQ(static_cast<long long>(count) * (count - 1) / 2, sum);
+}
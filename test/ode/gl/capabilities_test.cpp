@@ -0,0 +1,75 @@
+/// The tests of the snapshot of the capabilities of the OpenGL context.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/capabilities.h"
+
+#include <cstddef>
+
+#include <glad/glad.h>
+#include <gtest/gtest.h>
+
+#include "ode/gl/data.h"
+#include "ode/gl/gl_config.h"
+
+TEST(ode_gl_capabilities, versions_are_compared)
+{
+  ode::gl::capabilities caps{};
+
+  caps.major_version = 3;
+  caps.minor_version = 2;
+
+  ASSERT_TRUE(caps.has_version(2, 1));
+  ASSERT_TRUE(caps.has_version(3, 0));
+  ASSERT_TRUE(caps.has_version(3, 2));
+  ASSERT_FALSE(caps.has_version(3, 3));
+  ASSERT_FALSE(caps.has_version(4, 0));
+}
+
+TEST(ode_gl_capabilities, extensions_are_looked_up)
+{
+  ode::gl::capabilities caps{};
+
+  caps.extensions.emplace("GL_ARB_buffer_storage");
+
+  ASSERT_TRUE(caps.has_extension("GL_ARB_buffer_storage"));
+  ASSERT_FALSE(caps.has_extension("GL_ARB_buffer"));
+  ASSERT_FALSE(caps.has_extension("GL_ARB_direct_state_access"));
+}
+
+TEST(ode_gl_capabilities, snapshot_matches_the_context)
+{
+  const auto& caps = ode::gl::get_capabilities();
+
+  if constexpr (ode::disable_gl_calls)
+  {
+    ASSERT_EQ(ode::gl::data::disabled_string_value, caps.version);
+    ASSERT_EQ(0, caps.major_version);
+    ASSERT_TRUE(caps.extensions.empty());
+    ASSERT_FALSE(caps.persistent_mapping);
+  }
+  else
+  {
+    GLint major = 0;
+    GLint minor = 0;
+    GLint extensions = 0;
+
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+
+    ASSERT_EQ(major, caps.major_version);
+    ASSERT_EQ(minor, caps.minor_version);
+    ASSERT_EQ(static_cast<std::size_t>(extensions), caps.extensions.size());
+    ASSERT_EQ(ode::gl::get_version(), caps.version);
+    ASSERT_TRUE(caps.has_version(
+        ode::opengl_version_major, ode::opengl_version_minor));
+    ASSERT_LE(150, caps.shading_language_number);
+    ASSERT_LE(1024, caps.max_texture_size);
+    ASSERT_LE(16384, caps.max_uniform_block_size);
+    ASSERT_TRUE(caps.instancing);
+  }
+}
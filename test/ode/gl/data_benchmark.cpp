@@ -10,6 +10,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include "ode/gl/capabilities.h"
+
 static void ode_gl_data_vendor(benchmark::State& state)
 {
   for (auto _ : state)
@@ -49,3 +51,15 @@ static void ode_gl_data_shading_language_version(benchmark::State& state)
 }
 
 BENCHMARK(ode_gl_data_shading_language_version);
+
+static void ode_gl_capabilities_extension(benchmark::State& state)
+{
+  const auto& caps = ode::gl::get_capabilities();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(caps.has_extension("GL_ARB_buffer_storage"));
+  }
+}
+
+BENCHMARK(ode_gl_capabilities_extension);
@@ -0,0 +1,60 @@
+/// The tests of the GPU timers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/gpu_timer.h"
+
+#include <cstddef>
+
+#include <glad/glad.h>
+#include <gtest/gtest.h>
+
+#include "ode/gl/gl_config.h"
+
+TEST(ode_gpu_timer, results_are_read_after_the_latency)
+{
+  constexpr std::size_t latency = 3;
+
+  ode::gl::gpu_timer timer{latency};
+
+  for (std::size_t i = 0; i < latency; ++i)
+  {
+    timer.begin_frame();
+
+    timer.begin("clear");
+
+    if constexpr (!ode::disable_gl_calls)
+    {
+      glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    timer.end();
+
+    // The results of the frames are not read before the ring wraps around.
+    ASSERT_TRUE(timer.get_passes().empty());
+  }
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    glFinish();
+  }
+
+  timer.begin_frame();
+
+  if (timer.is_supported())
+  {
+    ASSERT_EQ(1, timer.get_passes().size());
+    ASSERT_EQ("clear", timer.get_passes().front().name);
+    ASSERT_LE(0, timer.get_frame_time().count());
+    ASSERT_EQ(0, timer.get_dropped_count());
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+  }
+  else
+  {
+    ASSERT_TRUE(timer.get_passes().empty());
+    ASSERT_EQ(0, timer.get_frame_time().count());
+  }
+}
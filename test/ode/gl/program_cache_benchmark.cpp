@@ -0,0 +1,80 @@
+/// The benchmarks of the shader program caches.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/program_cache.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ode::test
+{
+  static std::vector<std::string> make_fragment_shaders(
+      const std::size_t count)
+  {
+    std::vector<std::string> sources{};
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      sources.push_back(
+          "#version 150 core\nout vec4 fragment_colour;\nvoid main()\n{\n"
+          "  fragment_colour = vec4(" +
+          std::to_string(static_cast<float>(i) / count) + ");\n}\n");
+    }
+
+    return sources;
+  }
+} // namespace ode::test
+
+static void ode_program_cache_startup(benchmark::State& state)
+{
+  constexpr auto vertex_source =
+      "#version 150 core\nin vec2 position;\nvoid main()\n{\n"
+      "  gl_Position = vec4(position, 0.0, 1.0);\n}\n";
+
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const bool warm = 0 != state.range(1);
+  const auto fragment_sources = ode::test::make_fragment_shaders(count);
+
+  const auto directory = std::filesystem::temp_directory_path() /
+                         "ode_program_cache_benchmark";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+
+  const auto cache_directory = warm ? directory.string() : std::string{};
+
+  std::size_t binaries = 0;
+
+  for (auto _ : state)
+  {
+    ode::gl::program_cache cache{cache_directory};
+    std::vector<std::size_t> ids{};
+
+    for (const auto& fragment_source : fragment_sources)
+    {
+      ids.push_back(cache.request(vertex_source, fragment_source));
+    }
+
+    for (const auto id : ids)
+    {
+      benchmark::DoNotOptimize(cache.get(id));
+    }
+
+    binaries = cache.get_binary_count();
+  }
+
+  state.counters["binaries"] = static_cast<double>(binaries);
+
+  std::filesystem::remove_all(directory);
+}
+
+BENCHMARK(ode_program_cache_startup)
+    ->Args({16, 0})
+    ->Args({16, 1})
+    ->Unit(benchmark::kMillisecond);
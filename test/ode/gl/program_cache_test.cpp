@@ -0,0 +1,160 @@
+/// The tests of the shader program caches.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/gl/program_cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <glad/glad.h>
+#include <gtest/gtest.h>
+
+#include "ode/gl/gl_config.h"
+
+namespace ode::test
+{
+  constexpr auto test_vertex_shader = R"(#version 150 core
+in vec2 position;
+void main()
+{
+  gl_Position = vec4(position, 0.0, 1.0);
+}
+)";
+
+  constexpr auto test_fragment_shader = R"(#version 150 core
+out vec4 fragment_colour;
+void main()
+{
+  fragment_colour = vec4(1.0);
+}
+)";
+
+  static std::filesystem::path make_cache_directory()
+  {
+    const auto directory =
+        std::filesystem::temp_directory_path() / "ode_program_cache_test";
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    return directory;
+  }
+} // namespace ode::test
+
+TEST(ode_program_cache, same_sources_are_shared)
+{
+  ode::gl::program_cache cache{};
+
+  const auto first = cache.request(
+      ode::test::test_vertex_shader,
+      ode::test::test_fragment_shader,
+      {"position"});
+  const auto second = cache.request(
+      ode::test::test_vertex_shader,
+      ode::test::test_fragment_shader,
+      {"position"});
+
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(1, cache.get_program_count());
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    const GLuint program = cache.get(first);
+
+    ASSERT_NE(0, program);
+    ASSERT_TRUE(cache.is_ready(first));
+    ASSERT_EQ(program, cache.get(second));
+    ASSERT_EQ(1, cache.get_compile_count());
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+  }
+}
+
+TEST(ode_program_cache, invalid_sources_throw)
+{
+  if constexpr (!ode::disable_gl_calls)
+  {
+    ode::gl::program_cache cache{};
+
+    const auto id = cache.request(
+        ode::test::test_vertex_shader, "#version 150 core\nnot glsl");
+
+    ASSERT_THROW(cache.get(id), std::runtime_error);
+    ASSERT_THROW(cache.get(id), std::runtime_error);
+  }
+}
+
+TEST(ode_program_cache, binaries_are_reused)
+{
+  const auto directory = ode::test::make_cache_directory();
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    {
+      ode::gl::program_cache cache{directory.string()};
+
+      const auto id = cache.request(
+          ode::test::test_vertex_shader, ode::test::test_fragment_shader);
+
+      ASSERT_NE(0, cache.get(id));
+      ASSERT_EQ(1, cache.get_compile_count());
+    }
+
+    ode::gl::program_cache cache{directory.string()};
+
+    const auto id = cache.request(
+        ode::test::test_vertex_shader, ode::test::test_fragment_shader);
+
+    ASSERT_NE(0, cache.get(id));
+
+    if (cache.has_binary_support())
+    {
+      ASSERT_EQ(1, cache.get_binary_count());
+      ASSERT_EQ(0, cache.get_compile_count());
+    }
+    else
+    {
+      ASSERT_EQ(0, cache.get_binary_count());
+      ASSERT_EQ(1, cache.get_compile_count());
+    }
+  }
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST(ode_program_cache, invalid_binaries_are_recompiled)
+{
+  const auto directory = ode::test::make_cache_directory();
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    {
+      ode::gl::program_cache cache{directory.string()};
+      cache.get(cache.request(
+          ode::test::test_vertex_shader, ode::test::test_fragment_shader));
+    }
+
+    for (const auto& file : std::filesystem::directory_iterator{directory})
+    {
+      std::ofstream{file.path(), std::ios::binary | std::ios::trunc}
+          << "garbage";
+    }
+
+    ode::gl::program_cache cache{directory.string()};
+
+    const auto id = cache.request(
+        ode::test::test_vertex_shader, ode::test::test_fragment_shader);
+
+    ASSERT_NE(0, cache.get(id));
+    ASSERT_EQ(0, cache.get_binary_count());
+    ASSERT_EQ(1, cache.get_compile_count());
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+  }
+
+  std::filesystem::remove_all(directory);
+}
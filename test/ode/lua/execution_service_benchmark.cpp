@@ -0,0 +1,62 @@
+/// The benchmarks of the Lua execution service.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/execution_service.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/config.h"
+#include "ode/filesystem/path.h"
+#include "ode/lua/script.h"
+#include "ode/lua/virtual_machine.h"
+
+namespace ode::test
+{
+  constexpr int execution_service_job_count = 64;
+  constexpr int execution_service_work_size = 10000;
+
+  static void load_execution_service_benchmark_script(
+      const ode::lua::state_ptr_t state)
+  {
+    luaL_openlibs(state);
+
+    const std::string filename = std::string{ode::test_script_root} +
+        ode::filesystem::path::preferred_separator + "execution_service.lua";
+
+    ode::lua::load_script_file(state, filename);
+  }
+} // namespace ode::test
+
+static void ode_lua_execution_service(benchmark::State& state)
+{
+  ode::lua::execution_service service{
+      static_cast<std::size_t>(state.range(0)),
+      ode::test::load_execution_service_benchmark_script};
+
+  for (auto _ : state)
+  {
+    for (int i = 0; i < ode::test::execution_service_job_count; ++i)
+    {
+      service.submit(i, [](const ode::lua::state_ptr_t l) {
+        benchmark::DoNotOptimize(ode::lua::call<int>(
+            l, "work", ode::test::execution_service_work_size));
+      });
+    }
+
+    service.wait();
+  }
+
+  state.SetItemsProcessed(
+      state.iterations() * ode::test::execution_service_job_count);
+}
+
+BENCHMARK(ode_lua_execution_service)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,182 @@
+/// The tests of the Lua execution service.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/execution_service.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ode/config.h"
+#include "ode/filesystem/path.h"
+#include "ode/framework/message_queue.h"
+#include "ode/lua/script.h"
+#include "ode/lua/virtual_machine.h"
+
+namespace ode::test
+{
+  static void load_execution_service_script(const ode::lua::state_ptr_t state)
+  {
+    luaL_openlibs(state);
+
+    const std::string filename = std::string{ode::test_script_root} +
+        ode::filesystem::path::preferred_separator + "execution_service.lua";
+
+    ode::lua::load_script_file(state, filename);
+  }
+} // namespace ode::test
+
+TEST(ode_lua_execution_service, shards_are_created)
+{
+  ode::lua::execution_service service{3};
+
+  ASSERT_EQ(3, service.get_shard_count());
+
+  ode::lua::execution_service hardware_service{};
+
+  ASSERT_LT(0, hardware_service.get_shard_count());
+}
+
+TEST(ode_lua_execution_service, jobs_are_ordered_within_shard)
+{
+  ode::lua::execution_service service{
+      2, ode::test::load_execution_service_script};
+
+  std::vector<int> totals{};
+
+  for (int i = 1; i <= 10; ++i)
+  {
+    service.submit(0, [&totals, i](const ode::lua::state_ptr_t state) {
+      totals.push_back(ode::lua::call<int>(state, "accumulate", i));
+    });
+  }
+
+  service.wait();
+
+  ASSERT_EQ(10, totals.size());
+  ASSERT_EQ(1, totals.front());
+  ASSERT_EQ(55, totals.back());
+}
+
+TEST(ode_lua_execution_service, states_are_isolated)
+{
+  ode::lua::execution_service service{
+      2, ode::test::load_execution_service_script};
+
+  std::atomic<int> first{0};
+  std::atomic<int> second{0};
+
+  service.submit(0, [&first](const ode::lua::state_ptr_t state) {
+    ode::lua::call<int>(state, "accumulate", 5);
+    first = ode::lua::get<int>(state, "total");
+  });
+
+  service.submit(1, [&second](const ode::lua::state_ptr_t state) {
+    second = ode::lua::get<int>(state, "total");
+  });
+
+  service.wait();
+
+  ASSERT_EQ(5, first);
+  ASSERT_EQ(0, second);
+}
+
+TEST(ode_lua_execution_service, shard_index_is_wrapped)
+{
+  ode::lua::execution_service service{
+      2, ode::test::load_execution_service_script};
+
+  std::atomic<int> total{0};
+
+  service.submit(1, [](const ode::lua::state_ptr_t state) {
+    ode::lua::call<int>(state, "accumulate", 4);
+  });
+
+  service.submit(3, [&total](const ode::lua::state_ptr_t state) {
+    total = ode::lua::call<int>(state, "accumulate", 3);
+  });
+
+  service.wait();
+
+  ASSERT_EQ(7, total);
+}
+
+TEST(ode_lua_execution_service, messages_are_passed_between_states)
+{
+  ode::lua::execution_service service{
+      2, ode::test::load_execution_service_script};
+
+  ode::message_queue<int> queue{};
+
+  service.submit(0, [&queue](const ode::lua::state_ptr_t state) {
+    for (int i = 1; i <= 4; ++i)
+    {
+      queue.push(ode::lua::call<int>(state, "work", i));
+    }
+
+    queue.close();
+  });
+
+  std::atomic<int> total{0};
+
+  service.submit(1, [&queue, &total](const ode::lua::state_ptr_t state) {
+    while (auto message = queue.pop())
+    {
+      total = ode::lua::call<int>(state, "accumulate", *message);
+    }
+  });
+
+  service.wait();
+
+  // work(1) + work(2) + work(3) + work(4) = 1 + 5 + 7 + 9
+  ASSERT_EQ(22, total);
+  ASSERT_FALSE(queue.push(1));
+}
+
+TEST(ode_lua_execution_service, jobs_are_broadcast)
+{
+  ode::lua::execution_service service{
+      4, ode::test::load_execution_service_script};
+
+  std::atomic<int> count{0};
+
+  service.broadcast([&count](const ode::lua::state_ptr_t state) {
+    count += ode::lua::call<int>(state, "accumulate", 1);
+  });
+
+  service.wait();
+
+  ASSERT_EQ(4, count);
+}
+
+#if defined(GSL_THROW_ON_CONTRACT_VIOLATION) && \
+    GSL_THROW_ON_CONTRACT_VIOLATION
+
+TEST(ode_lua_execution_service, failing_job_is_contained)
+{
+  ode::lua::execution_service service{
+      1, ode::test::load_execution_service_script};
+
+  std::atomic<int> total{0};
+
+  service.submit(0, [](const ode::lua::state_ptr_t state) {
+    ode::lua::get<int>(state, "not.real");
+  });
+
+  service.submit(0, [&total](const ode::lua::state_ptr_t state) {
+    total = ode::lua::call<int>(state, "accumulate", 2);
+  });
+
+  service.wait();
+
+  ASSERT_EQ(2, total);
+}
+
+#endif // defined(GSL_THROW_ON_CONTRACT_VIOLATION) && \
+    GSL_THROW_ON_CONTRACT_VIOLATION
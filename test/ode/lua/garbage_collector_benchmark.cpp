@@ -0,0 +1,47 @@
+/// The benchmarks of the Lua garbage collector.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/garbage_collector.h"
+
+#include <chrono>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/config.h"
+#include "ode/filesystem/path.h"
+#include "ode/lua/script.h"
+#include "ode/lua/state.h"
+#include "ode/lua/virtual_machine.h"
+
+static void ode_lua_garbage_collector_step(benchmark::State& state)
+{
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "garbage_collector.lua";
+
+  auto l = ode::lua::make_state();
+
+  luaL_openlibs(l.get());
+  ode::lua::load_script_file(l.get(), filename);
+
+  ode::lua::garbage_collector gc{};
+
+  gc.attach(l.get());
+
+  const std::chrono::microseconds budget{state.range(0)};
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    ode::lua::call(l.get(), "make_garbage", 1000);
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(gc.step(budget));
+  }
+}
+
+BENCHMARK(ode_lua_garbage_collector_step)->Arg(0)->Arg(100)->Arg(1000);
@@ -0,0 +1,129 @@
+/// The tests of the Lua garbage collector.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/garbage_collector.h"
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "ode/config.h"
+#include "ode/filesystem/path.h"
+#include "ode/lua/lua_config.h"
+#include "ode/lua/script.h"
+#include "ode/lua/state.h"
+#include "ode/lua/virtual_machine.h"
+
+using namespace std::chrono_literals;
+
+namespace ode::test
+{
+  static ode::lua::state_t make_garbage_collector_state()
+  {
+    auto state = ode::lua::make_state();
+
+    luaL_openlibs(state.get());
+
+    const std::string filename = std::string{ode::test_script_root} +
+        ode::filesystem::path::preferred_separator + "garbage_collector.lua";
+
+    ode::lua::load_script_file(state.get(), filename);
+
+    return state;
+  }
+} // namespace ode::test
+
+TEST(ode_lua_garbage_collector, automatic_collection_is_stopped)
+{
+  auto state = ode::test::make_garbage_collector_state();
+
+  ode::lua::garbage_collector gc{};
+
+  gc.attach(state.get());
+  gc.attach(state.get());
+
+  ASSERT_EQ(1, gc.get_state_count());
+  ASSERT_EQ(0, lua_gc(state.get(), LUA_GCISRUNNING, 0));
+
+  gc.detach(state.get());
+
+  ASSERT_EQ(0, gc.get_state_count());
+  ASSERT_EQ(1, lua_gc(state.get(), LUA_GCISRUNNING, 0));
+}
+
+TEST(ode_lua_garbage_collector, minimum_steps_are_run)
+{
+  auto state = ode::test::make_garbage_collector_state();
+
+  ode::lua::garbage_collector gc{};
+
+  gc.attach(state.get());
+
+  ode::lua::call(state.get(), "make_garbage", 10000);
+
+  const auto statistics = gc.step(0ns);
+
+  ASSERT_LE(ode::lua::gc_minimum_steps, statistics.steps);
+}
+
+TEST(ode_lua_garbage_collector, garbage_is_collected)
+{
+  auto state = ode::test::make_garbage_collector_state();
+
+  ode::lua::garbage_collector gc{};
+
+  gc.attach(state.get());
+
+  const auto before = lua_gc(state.get(), LUA_GCCOUNT, 0);
+
+  ode::lua::call(state.get(), "make_garbage", 100000);
+
+  const auto peak = lua_gc(state.get(), LUA_GCCOUNT, 0);
+
+  ASSERT_LT(before, peak);
+
+  const auto statistics = gc.step(10s);
+
+  ASSERT_LE(1, statistics.cycles);
+  ASSERT_GT(peak, lua_gc(state.get(), LUA_GCCOUNT, 0));
+}
+
+TEST(ode_lua_garbage_collector, collection_stops_after_cycle)
+{
+  auto first = ode::test::make_garbage_collector_state();
+  auto second = ode::test::make_garbage_collector_state();
+
+  ode::lua::garbage_collector gc{};
+
+  gc.attach(first.get());
+  gc.attach(second.get());
+
+  ode::lua::call(first.get(), "make_garbage", 100000);
+
+  // Only the state with garbage is stepped, and only until its cycle ends.
+  const auto statistics = gc.step(10s);
+
+  ASSERT_EQ(1, statistics.cycles);
+
+  // Nothing has been allocated since the cycle, so there is no work left.
+  const auto idle = gc.step(10s);
+
+  ASSERT_EQ(0, idle.steps);
+  ASSERT_EQ(0, idle.cycles);
+}
+
+TEST(ode_lua_garbage_collector, empty_collector_does_nothing)
+{
+  ode::lua::garbage_collector gc{};
+
+  const auto statistics = gc.step(1ms);
+
+  ASSERT_EQ(0, statistics.steps);
+  ASSERT_EQ(0, statistics.cycles);
+  ASSERT_EQ(0ns, statistics.time);
+}
@@ -0,0 +1,180 @@
+/// The tests of the Lua script-reloading service.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/reload_service.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "ode/lua/script.h"
+#include "ode/lua/state.h"
+#include "ode/lua/virtual_machine.h"
+
+using namespace std::chrono_literals;
+
+namespace ode::test
+{
+  static std::string write_reloaded_script(
+      const std::string& name, const std::string& source)
+  {
+    const auto p = std::filesystem::temp_directory_path() / name;
+
+    std::ofstream{p} << source;
+
+    return p.string();
+  }
+
+  static std::size_t apply_until_reloaded(ode::lua::reload_service& service)
+  {
+    for (int i = 0; i < 50; ++i)
+    {
+      if (const auto count = service.apply(); count > 0)
+      {
+        return count;
+      }
+
+      std::this_thread::sleep_for(100ms);
+    }
+
+    return 0;
+  }
+} // namespace ode::test
+
+TEST(ode_lua_reload_service, nothing_is_applied_without_changes)
+{
+  ode::lua::reload_service service{};
+
+  ASSERT_EQ(0, service.apply());
+}
+
+TEST(ode_lua_reload_service, changed_script_is_reloaded)
+{
+  const auto filename = ode::test::write_reloaded_script(
+      "ode_reload_service_changed.lua", "value = 1\nkept = 3\n");
+
+  auto state = ode::lua::make_state();
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  ode::lua::reload_service service{};
+
+  service.track(state.get(), filename);
+
+  // Give the worker time to start watching the script.
+  std::this_thread::sleep_for(1100ms);
+
+  ode::test::write_reloaded_script(
+      "ode_reload_service_changed.lua", "value = 2\n");
+
+  ASSERT_EQ(1, ode::test::apply_until_reloaded(service));
+  ASSERT_EQ(2, ode::lua::get<int>(state.get(), "value"));
+  ASSERT_EQ(3, ode::lua::get<int>(state.get(), "kept"));
+
+  service.untrack(state.get());
+  std::filesystem::remove(filename);
+}
+
+TEST(ode_lua_reload_service, broken_script_is_not_applied)
+{
+  const auto filename = ode::test::write_reloaded_script(
+      "ode_reload_service_broken.lua", "value = 1\n");
+
+  auto state = ode::lua::make_state();
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  ode::lua::reload_service service{};
+
+  service.track(state.get(), filename);
+
+  std::this_thread::sleep_for(1100ms);
+
+  ode::test::write_reloaded_script(
+      "ode_reload_service_broken.lua", "value = = 2\n");
+
+  std::this_thread::sleep_for(500ms);
+
+  ASSERT_EQ(0, service.apply());
+  ASSERT_EQ(1, ode::lua::get<int>(state.get(), "value"));
+
+  ode::test::write_reloaded_script(
+      "ode_reload_service_broken.lua", "value = 3\n");
+
+  ASSERT_EQ(1, ode::test::apply_until_reloaded(service));
+  ASSERT_EQ(3, ode::lua::get<int>(state.get(), "value"));
+
+  service.untrack(state.get());
+  std::filesystem::remove(filename);
+}
+
+TEST(ode_lua_reload_service, failing_script_is_contained)
+{
+  const auto filename = ode::test::write_reloaded_script(
+      "ode_reload_service_failing.lua", "value = 1\n");
+
+  auto state = ode::lua::make_state();
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  ode::lua::reload_service service{};
+
+  service.track(state.get(), filename);
+
+  std::this_thread::sleep_for(1100ms);
+
+  ode::test::write_reloaded_script(
+      "ode_reload_service_failing.lua", "value = 2\nerror('failed')\n");
+
+  ASSERT_EQ(1, ode::test::apply_until_reloaded(service));
+  ASSERT_EQ(2, ode::lua::get<int>(state.get(), "value"));
+  ASSERT_EQ(0, lua_gettop(state.get()));
+
+  service.untrack(state.get());
+  std::filesystem::remove(filename);
+}
+
+TEST(ode_lua_reload_service, required_module_is_reloaded)
+{
+  const auto directory =
+      std::filesystem::temp_directory_path() / "ode_reload_service_modules";
+
+  std::filesystem::create_directories(directory);
+
+  const auto module = directory / "ode_reload_module.lua";
+
+  std::ofstream{module} << "return { value = 1 }\n";
+
+  const auto filename = ode::test::write_reloaded_script(
+      "ode_reload_service_requiring.lua",
+      "package.path = '" + (directory / "?.lua").string() + "'\n" +
+          "required = require 'ode_reload_module'\n");
+
+  auto state = ode::lua::make_state();
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  ode::lua::reload_service service{};
+
+  service.track(state.get(), filename);
+  service.watch(directory.string());
+
+  std::this_thread::sleep_for(1100ms);
+
+  std::ofstream{module} << "return { value = 2 }\n";
+
+  ASSERT_EQ(1, ode::test::apply_until_reloaded(service));
+  ASSERT_EQ(2, ode::lua::get<int>(state.get(), "required.value"));
+
+  service.untrack(state.get());
+  std::filesystem::remove(filename);
+  std::filesystem::remove_all(directory);
+}
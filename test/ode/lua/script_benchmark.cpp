@@ -28,3 +28,20 @@ static void ode_load_script_file(benchmark::State& state)
 }
 
 BENCHMARK(ode_load_script_file);
+
+static void ode_try_load_script_file(benchmark::State& state)
+{
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "script.lua";
+
+  lua_State* l = luaL_newstate();
+
+  for (auto _ : state)
+  {
+    ode::lua::try_load_script_file(l, filename.c_str());
+  }
+
+  lua_close(l);
+}
+
+BENCHMARK(ode_try_load_script_file);
@@ -50,3 +50,31 @@ TEST(ode_lua_load_script_file, file_is_loaded)
 #endif // defined(GSL_THROW_ON_CONTRACT_VIOLATION) && \
     GSL_THROW_ON_CONTRACT_VIOLATION
 }
+
+TEST(ode_lua_try_load_script_file, file_is_loaded)
+{
+  auto state = ode::lua::make_state();
+
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "script.lua";
+
+  const auto result = ode::lua::try_load_script_file(state.get(), filename);
+
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(ode_lua_try_load_script_file, error_is_returned)
+{
+  auto state = ode::lua::make_state();
+
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "not_script.lua";
+
+  const auto result = ode::lua::try_load_script_file(state.get(), filename);
+
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(LUA_ERRFILE, result.get_error().code);
+  ASSERT_FALSE(result.get_error().message.empty());
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
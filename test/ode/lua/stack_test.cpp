@@ -7,6 +7,8 @@
 
 #include "ode/lua/stack.h"
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "ode/config.h"
@@ -35,6 +37,62 @@ TEST(ode_lua_to_stack, is_set_to_stack)
   lua_close(l);
 }
 
+TEST(ode_lua_try_to_stack, is_set_to_stack)
+{
+  lua_State* l = luaL_newstate();
+
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "stack.lua";
+
+  luaL_openlibs(l);
+
+  const auto error_code = luaL_loadfile(l, filename.c_str());
+
+  lua_pcall(l, 0, 0, 0);
+
+  ASSERT_TRUE(ode::lua::try_to_stack(l, "testing.lua.stack"));
+  ASSERT_EQ(1, lua_gettop(l));
+  ASSERT_EQ(1, lua_tointeger(l, -1));
+
+  lua_pop(l, 1);
+
+  ASSERT_FALSE(ode::lua::try_to_stack(l, "testing.not.real"));
+  ASSERT_FALSE(ode::lua::try_to_stack(l, "testing.lua.stack.deeper"));
+  ASSERT_FALSE(ode::lua::try_to_stack(l, "not_real"));
+  ASSERT_EQ(0, lua_gettop(l));
+
+  lua_close(l);
+}
+
+TEST(ode_lua_try_to_stack, metamethod_error_is_returned)
+{
+  lua_State* l = luaL_newstate();
+
+  luaL_openlibs(l);
+
+  // A strict-globals guard raises an error for every undefined name.
+  luaL_dostring(
+      l,
+      "proxy = setmetatable({}, {__index = function(t, k) "
+      "error('no field ' .. k) end}) "
+      "setmetatable(_G, {__index = function(t, k) "
+      "error('undefined global ' .. k) end})");
+
+  const auto global = ode::lua::try_to_stack(l, "not_real");
+  const auto field = ode::lua::try_to_stack(l, "proxy.value");
+
+  ASSERT_FALSE(global);
+  ASSERT_NE(
+      std::string::npos,
+      global.get_error().message.find("undefined global not_real"));
+  ASSERT_FALSE(field);
+  ASSERT_NE(
+      std::string::npos, field.get_error().message.find("no field value"));
+  ASSERT_EQ(0, lua_gettop(l));
+
+  lua_close(l);
+}
+
 TEST(ode_lua_push, is_pushed_to_stack)
 {
   lua_State* l = luaL_newstate();
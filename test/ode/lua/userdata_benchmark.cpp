@@ -0,0 +1,117 @@
+/// The benchmarks of the Lua userdata utilities.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/userdata.h"
+
+#include <array>
+#include <cmath>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/config.h"
+#include "ode/filesystem/path.h"
+#include "ode/lua/script.h"
+#include "ode/lua/state.h"
+#include "ode/lua/virtual_machine.h"
+
+namespace ode::test
+{
+  struct benchmark_vector2 final
+  {
+    float x;
+    float y;
+
+    float length() const noexcept
+    {
+      return std::sqrt(x * x + y * y);
+    }
+  };
+
+  constexpr int method_calls = 1000;
+} // namespace ode::test
+
+namespace ode::lua
+{
+  template <> struct userdata_traits<test::benchmark_vector2>
+  {
+    static constexpr const char* name = "vector2";
+
+    static constexpr std::array methods{
+        luaL_Reg{"length", &bind<&test::benchmark_vector2::length>}};
+  };
+} // namespace ode::lua
+
+static void ode_lua_push_userdata(benchmark::State& state)
+{
+  auto l = ode::lua::make_state();
+
+  for (auto _ : state)
+  {
+    ode::lua::push_userdata(l.get(), ode::test::benchmark_vector2{3.0f, 4.0f});
+    lua_pop(l.get(), 1);
+  }
+}
+
+BENCHMARK(ode_lua_push_userdata);
+
+static void ode_lua_push_reference(benchmark::State& state)
+{
+  auto l = ode::lua::make_state();
+
+  ode::test::benchmark_vector2 v{3.0f, 4.0f};
+
+  for (auto _ : state)
+  {
+    ode::lua::push_reference(l.get(), &v);
+    lua_pop(l.get(), 1);
+  }
+}
+
+BENCHMARK(ode_lua_push_reference);
+
+static void ode_lua_to_userdata(benchmark::State& state)
+{
+  auto l = ode::lua::make_state();
+
+  ode::lua::push_userdata(l.get(), ode::test::benchmark_vector2{3.0f, 4.0f});
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(
+        ode::lua::to_userdata<ode::test::benchmark_vector2>(
+            l.get(), ode::lua::stack_top));
+  }
+}
+
+BENCHMARK(ode_lua_to_userdata);
+
+static void ode_lua_userdata_method(benchmark::State& state)
+{
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "userdata.lua";
+
+  auto l = ode::lua::make_state();
+
+  luaL_openlibs(l.get());
+  ode::lua::load_script_file(l.get(), filename);
+
+  ode::test::benchmark_vector2 v{3.0f, 4.0f};
+
+  ode::lua::push_reference(l.get(), &v);
+  lua_setglobal(l.get(), "shared");
+
+  for (auto _ : state)
+  {
+    const auto s = ode::lua::call<float>(
+        l.get(), "sum_lengths", ode::test::method_calls);
+  }
+
+  state.SetItemsProcessed(state.iterations() * ode::test::method_calls);
+}
+
+BENCHMARK(ode_lua_userdata_method);
@@ -0,0 +1,297 @@
+/// The tests of the Lua userdata utilities.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/lua/userdata.h"
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "ode/config.h"
+#include "ode/filesystem/path.h"
+#include "ode/lua/script.h"
+#include "ode/lua/tile_layer_userdata.h"
+#include "ode/lua/state.h"
+#include "ode/lua/virtual_machine.h"
+
+namespace ode::test
+{
+  static int vector2_destructions = 0;
+
+  struct vector2 final
+  {
+    float x;
+    float y;
+    std::string name;
+
+    vector2(const float x, const float y) : x{x}, y{y}, name{}
+    {
+    }
+
+    vector2(const vector2& a) = default;
+
+    ~vector2()
+    {
+      ++vector2_destructions;
+    }
+
+    float get_x() const noexcept
+    {
+      return x;
+    }
+
+    float length() const noexcept
+    {
+      return std::sqrt(x * x + y * y);
+    }
+
+    void scale(const float f) noexcept
+    {
+      x *= f;
+      y *= f;
+    }
+
+    void shift(const int n) noexcept
+    {
+      x += static_cast<float>(n);
+    }
+
+    vector2 add(const vector2& a) const
+    {
+      return {x + a.x, y + a.y};
+    }
+
+    void rename(std::string s)
+    {
+      if (s.empty())
+      {
+        throw std::invalid_argument{"The name is empty"};
+      }
+
+      name = std::move(s);
+    }
+  };
+} // namespace ode::test
+
+namespace ode::lua
+{
+  template <> struct userdata_traits<test::vector2>
+  {
+    static constexpr const char* name = "vector2";
+
+    static constexpr std::array methods{
+        luaL_Reg{"new", &construct<test::vector2, float, float>},
+        luaL_Reg{"get_x", &bind<&test::vector2::get_x>},
+        luaL_Reg{"length", &bind<&test::vector2::length>},
+        luaL_Reg{"scale", &bind<&test::vector2::scale>},
+        luaL_Reg{"shift", &bind<&test::vector2::shift>},
+        luaL_Reg{"add", &bind<&test::vector2::add>},
+        luaL_Reg{"rename", &bind<&test::vector2::rename>}};
+  };
+} // namespace ode::lua
+
+namespace ode::test
+{
+  static ode::lua::state_t make_userdata_state()
+  {
+    auto state = ode::lua::make_state();
+
+    luaL_openlibs(state.get());
+    ode::lua::register_userdata<vector2>(state.get());
+
+    const std::string filename = std::string{ode::test_script_root} +
+        ode::filesystem::path::preferred_separator + "userdata.lua";
+
+    ode::lua::load_script_file(state.get(), filename);
+
+    return state;
+  }
+} // namespace ode::test
+
+TEST(ode_lua_userdata, objects_are_constructed_in_lua)
+{
+  auto state = ode::test::make_userdata_state();
+
+  ode::lua::call(state.get(), "make", 3.0f, 4.0f);
+
+  lua_getglobal(state.get(), "made");
+
+  const auto* v = ode::lua::to_userdata<ode::test::vector2>(
+      state.get(), ode::lua::stack_top);
+
+  ASSERT_NE(nullptr, v);
+  ASSERT_EQ(3.0f, v->x);
+  ASSERT_EQ(4.0f, v->y);
+
+  lua_pop(state.get(), 1);
+}
+
+TEST(ode_lua_userdata, methods_are_called)
+{
+  auto state = ode::test::make_userdata_state();
+
+  ode::test::vector2 v{3.0f, 4.0f};
+
+  ode::lua::push_reference(state.get(), &v);
+  lua_setglobal(state.get(), "shared");
+
+  const auto length =
+      ode::lua::try_call<float>(state.get(), "length_of_shared");
+
+  ASSERT_TRUE(length);
+  ASSERT_EQ(5.0f, length.get_value());
+
+  ode::lua::call(state.get(), "scale_shared", 2.0f);
+
+  ASSERT_EQ(6.0f, v.x);
+  ASSERT_EQ(8.0f, v.y);
+
+  ASSERT_EQ(5.0f, ode::lua::call<float>(state.get(), "sum_x", 2.0f, 3.0f));
+}
+
+TEST(ode_lua_userdata, owned_objects_are_destructed)
+{
+  {
+    auto state = ode::test::make_userdata_state();
+
+    ode::test::vector2_destructions = 0;
+
+    ode::lua::push_userdata(state.get(), ode::test::vector2{1.0f, 2.0f});
+    lua_pop(state.get(), 1);
+
+    // The temporary is destructed when the userdata is pushed.
+    ASSERT_EQ(1, ode::test::vector2_destructions);
+
+    lua_gc(state.get(), LUA_GCCOLLECT, 0);
+
+    ASSERT_EQ(2, ode::test::vector2_destructions);
+  }
+
+  ode::test::vector2 v{1.0f, 2.0f};
+
+  {
+    auto state = ode::test::make_userdata_state();
+
+    ode::test::vector2_destructions = 0;
+
+    ode::lua::push_reference(state.get(), &v);
+    lua_pop(state.get(), 1);
+  }
+
+  ASSERT_EQ(0, ode::test::vector2_destructions);
+}
+
+TEST(ode_lua_userdata, other_values_are_rejected)
+{
+  auto state = ode::test::make_userdata_state();
+
+  int i = 0;
+
+  ode::lua::push_light(state.get(), &i);
+  lua_newtable(state.get());
+  lua_newuserdata(state.get(), sizeof(ode::test::vector2));
+
+  ASSERT_EQ(nullptr, ode::lua::to_userdata<ode::test::vector2>(state.get(), 1));
+  ASSERT_EQ(nullptr, ode::lua::to_userdata<ode::test::vector2>(state.get(), 2));
+  ASSERT_EQ(nullptr, ode::lua::to_userdata<ode::test::vector2>(state.get(), 3));
+  ASSERT_EQ(&i, ode::lua::to_light<int>(state.get(), 1));
+  ASSERT_EQ(nullptr, ode::lua::to_light<int>(state.get(), 3));
+
+  lua_pop(state.get(), 3);
+}
+
+TEST(ode_lua_userdata, errors_are_raised_in_lua)
+{
+  auto state = ode::test::make_userdata_state();
+
+  ode::test::vector2 v{3.0f, 4.0f};
+
+  ode::lua::push_reference(state.get(), &v);
+  lua_setglobal(state.get(), "shared");
+
+  const auto wrong_type =
+      ode::lua::try_call<float>(state.get(), "add_wrong_type");
+
+  ASSERT_FALSE(wrong_type);
+  ASSERT_EQ(LUA_ERRRUN, wrong_type.get_error().code);
+
+  const auto thrown =
+      ode::lua::try_call(state.get(), "rename_shared", std::string{});
+
+  ASSERT_FALSE(thrown);
+  ASSERT_NE(
+      std::string::npos,
+      thrown.get_error().message.find("The name is empty"));
+
+  const auto renamed =
+      ode::lua::try_call(state.get(), "rename_shared", std::string{"v"});
+
+  ASSERT_TRUE(renamed);
+  ASSERT_EQ(std::string{"v"}, v.name);
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(ode_lua_userdata, fractions_are_rejected_as_integers)
+{
+  auto state = ode::test::make_userdata_state();
+
+  ode::test::vector2 v{3.0f, 4.0f};
+
+  ode::lua::push_reference(state.get(), &v);
+  lua_setglobal(state.get(), "shared");
+
+  const auto fraction = ode::lua::try_call(state.get(), "shift_shared", 1.5f);
+
+  ASSERT_FALSE(fraction);
+  ASSERT_EQ(LUA_ERRRUN, fraction.get_error().code);
+  ASSERT_EQ(3.0f, v.x);
+
+  const auto whole = ode::lua::try_call(state.get(), "shift_shared", 2.0f);
+
+  ASSERT_TRUE(whole);
+  ASSERT_EQ(5.0f, v.x);
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(ode_lua_userdata, constant_objects_are_pushed)
+{
+  auto state = ode::test::make_userdata_state();
+
+  const ode::test::vector2 v{3.0f, 4.0f};
+
+  ode::lua::push_reference(state.get(), &v);
+  lua_setglobal(state.get(), "shared");
+
+  const auto length =
+      ode::lua::try_call<float>(state.get(), "length_of_shared");
+
+  ASSERT_TRUE(length);
+  ASSERT_EQ(5.0f, length.get_value());
+}
+
+TEST(ode_lua_userdata, tile_layers_are_changed_in_place)
+{
+  auto state = ode::test::make_userdata_state();
+
+  ode::tile_layer layer{3, 2};
+
+  ode::lua::push_reference(state.get(), &layer);
+  lua_setglobal(state.get(), "layer");
+
+  ode::lua::call(state.get(), "fill_layer", 7);
+
+  ASSERT_EQ(7, layer.get(0, 0));
+  ASSERT_EQ(7, layer.get(2, 1));
+
+  const auto outside =
+      ode::lua::try_call<int>(state.get(), "read_outside_layer");
+
+  ASSERT_FALSE(outside);
+}
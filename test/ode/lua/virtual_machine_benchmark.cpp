@@ -443,3 +443,99 @@ static void ode_lua_call_pow(benchmark::State& state)
 }
 
 BENCHMARK(ode_lua_call_pow);
+
+static void ode_lua_try_get_int(benchmark::State& state)
+{
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator +
+      "virtual_machine_benchmark.lua";
+
+  lua_State* l = luaL_newstate();
+
+  luaL_openlibs(l);
+
+  const auto error_code = luaL_loadfile(l, filename.c_str());
+
+  lua_pcall(l, 0, 0, 0);
+
+  for (auto _ : state)
+  {
+    const auto i = ode::lua::try_get<int>(l, "int");
+  }
+
+  lua_close(l);
+}
+
+BENCHMARK(ode_lua_try_get_int);
+
+static void ode_lua_try_get_table_str(benchmark::State& state)
+{
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator +
+      "virtual_machine_benchmark.lua";
+
+  lua_State* l = luaL_newstate();
+
+  luaL_openlibs(l);
+
+  const auto error_code = luaL_loadfile(l, filename.c_str());
+
+  lua_pcall(l, 0, 0, 0);
+
+  for (auto _ : state)
+  {
+    const auto s = ode::lua::try_get<std::string>(l, "table.str");
+  }
+
+  lua_close(l);
+}
+
+BENCHMARK(ode_lua_try_get_table_str);
+
+static void ode_lua_try_call_add(benchmark::State& state)
+{
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator +
+      "virtual_machine_benchmark.lua";
+
+  lua_State* l = luaL_newstate();
+
+  luaL_openlibs(l);
+
+  const auto error_code = luaL_loadfile(l, filename.c_str());
+
+  lua_pcall(l, 0, 0, 0);
+
+  for (auto _ : state)
+  {
+    const auto i = ode::lua::try_call<int>(l, "add", 688, 12);
+  }
+
+  lua_close(l);
+}
+
+BENCHMARK(ode_lua_try_call_add);
+
+static void ode_lua_try_call_pow(benchmark::State& state)
+{
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator +
+      "virtual_machine_benchmark.lua";
+
+  lua_State* l = luaL_newstate();
+
+  luaL_openlibs(l);
+
+  const auto error_code = luaL_loadfile(l, filename.c_str());
+
+  lua_pcall(l, 0, 0, 0);
+
+  for (auto _ : state)
+  {
+    const auto i = ode::lua::try_call<int>(l, "pow", 2, 7);
+  }
+
+  lua_close(l);
+}
+
+BENCHMARK(ode_lua_try_call_pow);
@@ -7,12 +7,16 @@
 
 #include "ode/lua/virtual_machine.h"
 
+#include <string>
+#include <tuple>
+
 #include "gsl/util"
 
 #include <gtest/gtest.h>
 
 #include "ode/config.h"
 #include "ode/filesystem/path.h"
+#include "ode/lua/script.h"
 
 TEST(ode_lua_make_state, values_are_got)
 {
@@ -98,3 +102,100 @@ TEST(ode_lua_call, called)
 
   state = nullptr;
 }
+
+TEST(ode_lua_try_get, values_are_got)
+{
+  auto state = ode::lua::make_state();
+
+  luaL_openlibs(state.get());
+
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "virtual_machine.lua";
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  const auto str = ode::lua::try_get<std::string>(state.get(), "table.str");
+  const auto integer = ode::lua::try_get<int>(state.get(), "integer");
+  const auto floating = ode::lua::try_get<float>(state.get(), "floating_point");
+  const auto boolean = ode::lua::try_get<bool>(state.get(), "boolean");
+
+  ASSERT_EQ(std::string{"Hello!"}, str.get_value());
+  ASSERT_EQ(3, integer.get_value());
+  ASSERT_EQ(7.4f, floating.get_value());
+  ASSERT_EQ(true, boolean.get_value());
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(ode_lua_try_get, errors_are_returned)
+{
+  auto state = ode::lua::make_state();
+
+  luaL_openlibs(state.get());
+
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "virtual_machine.lua";
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  const auto made_up = ode::lua::try_get<int>(state.get(), "not.real");
+  const auto wrong_type = ode::lua::try_get<int>(state.get(), "table");
+  const auto fraction = ode::lua::try_get<int>(state.get(), "floating_point");
+  const auto not_boolean = ode::lua::try_get<bool>(state.get(), "integer");
+
+  ASSERT_FALSE(made_up.has_value());
+  ASSERT_FALSE(wrong_type.has_value());
+  ASSERT_FALSE(fraction.has_value());
+  ASSERT_FALSE(not_boolean.has_value());
+  ASSERT_EQ(5, made_up.get_value_or(5));
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(ode_lua_try_call, called)
+{
+  auto state = ode::lua::make_state();
+
+  luaL_openlibs(state.get());
+
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "virtual_machine.lua";
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  const auto add_ret = ode::lua::try_call<int>(state.get(), "add", 4, 6);
+  const auto pair_ret =
+      ode::lua::try_call<int, std::string>(state.get(), "pair", 2);
+  const auto no_ret = ode::lua::try_call(state.get(), "add", 1, 2);
+
+  ASSERT_EQ(10, add_ret.get_value());
+  ASSERT_EQ(2, std::get<0>(pair_ret.get_value()));
+  ASSERT_EQ(std::string{"pair"}, std::get<1>(pair_ret.get_value()));
+  ASSERT_TRUE(no_ret.has_value());
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
+
+TEST(ode_lua_try_call, errors_are_returned)
+{
+  auto state = ode::lua::make_state();
+
+  luaL_openlibs(state.get());
+
+  const std::string filename = std::string{ode::test_script_root} +
+      ode::filesystem::path::preferred_separator + "virtual_machine.lua";
+
+  ode::lua::load_script_file(state.get(), filename);
+
+  const auto failed = ode::lua::try_call<int>(state.get(), "fail");
+  const auto made_up = ode::lua::try_call<int>(state.get(), "not_real");
+  const auto wrong_type =
+      ode::lua::try_call<int, int>(state.get(), "pair", 2);
+
+  ASSERT_FALSE(failed.has_value());
+  ASSERT_EQ(LUA_ERRRUN, failed.get_error().code);
+  ASSERT_NE(
+      std::string::npos, failed.get_error().message.find("failed on purpose"));
+  ASSERT_NE(
+      std::string::npos, failed.get_error().message.find("stack traceback"));
+  ASSERT_FALSE(made_up.has_value());
+  ASSERT_FALSE(wrong_type.has_value());
+  ASSERT_EQ(0, lua_gettop(state.get()));
+}
@@ -0,0 +1,216 @@
+/// The tests of the bit streams and the deltas of the replicated frames.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/net/delta_codec.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ode/net/bit_stream.h"
+#include "ode/net/replication_frame.h"
+
+namespace ode::test
+{
+  static ode::net::replication_schema make_schema()
+  {
+    ode::net::replication_schema schema{};
+
+    // The position of a body and its tile.
+    schema.add_component({{0.0f, 4096.0f, 20}, {0.0f, 4096.0f, 20}});
+    schema.add_component({{0.0f, 255.0f, 8}});
+
+    return schema;
+  }
+
+  static void expect_equal(
+      const ode::net::replication_frame& expected,
+      const ode::net::replication_frame& actual)
+  {
+    const auto& schema = expected.get_schema();
+
+    for (std::size_t c = 0; c < schema.get_component_count(); ++c)
+    {
+      const auto& entities = expected.get_entities(c);
+      const auto field_count = schema.get_fields(c).size();
+
+      ASSERT_EQ(entities, actual.get_entities(c));
+
+      for (std::size_t i = 0; i < entities.size(); ++i)
+      {
+        for (std::size_t f = 0; f < field_count; ++f)
+        {
+          ASSERT_EQ(
+              expected.get_values(c, i)[f], actual.get_values(c, i)[f]);
+        }
+      }
+    }
+  }
+} // namespace ode::test
+
+TEST(ode_bit_stream, values_are_read_back)
+{
+  std::vector<std::uint8_t> buffer{};
+
+  {
+    ode::net::bit_writer writer{buffer};
+    writer.write(5, 3);
+    writer.write_bit(true);
+    writer.write(0xdeadbeef, 32);
+    writer.write_varint(7);
+    writer.write_varint(200);
+    writer.write_varint(40000);
+    writer.write_varint(0x12345678);
+    writer.write(1, 1);
+  }
+
+  ASSERT_EQ((4 + 32 + 5 + 10 + 19 + 35 + 1 + 7) / 8, buffer.size());
+
+  ode::net::bit_reader reader{buffer.data(), buffer.size()};
+
+  ASSERT_EQ(5, reader.read(3));
+  ASSERT_TRUE(reader.read_bit());
+  ASSERT_EQ(0xdeadbeef, reader.read(32));
+  ASSERT_EQ(7, reader.read_varint());
+  ASSERT_EQ(200, reader.read_varint());
+  ASSERT_EQ(40000, reader.read_varint());
+  ASSERT_EQ(0x12345678, reader.read_varint());
+  ASSERT_EQ(1, reader.read(1));
+  ASSERT_TRUE(reader.is_ok());
+
+  ASSERT_EQ(0, reader.read(16));
+  ASSERT_FALSE(reader.is_ok());
+}
+
+TEST(ode_bit_stream, zigzag_keeps_small_values_small)
+{
+  ASSERT_EQ(0, ode::net::zigzag_encode(0));
+  ASSERT_EQ(1, ode::net::zigzag_encode(-1));
+  ASSERT_EQ(2, ode::net::zigzag_encode(1));
+
+  for (const std::int32_t value : {-70000, -3, 0, 9, 2147483647, -2147483647})
+  {
+    ASSERT_EQ(
+        value, ode::net::zigzag_decode(ode::net::zigzag_encode(value)));
+  }
+}
+
+TEST(ode_replication_frame, values_are_quantized)
+{
+  const ode::net::replicated_field field{-1.0f, 1.0f, 10};
+
+  ASSERT_EQ(0, ode::net::quantize(-2.0f, field));
+  ASSERT_EQ(1023, ode::net::quantize(2.0f, field));
+
+  for (const auto value : {-1.0f, -0.3f, 0.0f, 0.77f, 1.0f})
+  {
+    const auto q = ode::net::quantize(value, field);
+
+    // The error is at most half of a step.
+    ASSERT_NEAR(value, ode::net::dequantize(q, field), 1.0f / 1023.0f);
+  }
+}
+
+TEST(ode_delta_codec, frames_are_rebuilt_from_deltas)
+{
+  const auto schema = ode::test::make_schema();
+
+  ode::net::replication_frame empty{schema};
+  ode::net::replication_frame first{schema};
+  ode::net::replication_frame second{schema};
+
+  for (std::uint32_t e = 0; e < 100; ++e)
+  {
+    const float position[] = {e * 10.0f, 20.0f};
+    first.add(0, e, position);
+  }
+
+  const float tile[] = {3.0f};
+  first.add(1, 7, tile);
+
+  // Some of the bodies move, one is removed, and three are added.
+  for (std::uint32_t e = 1; e < 102; ++e)
+  {
+    const float position[] = {e * 10.0f + (0 == e % 10 ? 1.5f : 0.0f), 20.0f};
+    second.add(0, e, position);
+  }
+
+  const float far_away[] = {4000.0f, 4000.0f};
+  second.add(0, 5000, far_away);
+  second.add(1, 7, tile);
+
+  ode::net::delta_encoder encoder{};
+  ode::net::delta_decoder decoder{};
+
+  std::vector<std::uint8_t> keyframe{};
+  std::vector<std::uint8_t> delta{};
+
+  encoder.encode(empty, first, keyframe);
+  encoder.encode(first, second, delta);
+
+  ASSERT_GT(keyframe.size() / 4, delta.size());
+
+  ode::net::replication_frame received{schema};
+  ode::net::replication_frame next{schema};
+
+  ASSERT_TRUE(
+      decoder.decode(empty, keyframe.data(), keyframe.size(), received));
+  ode::test::expect_equal(first, received);
+
+  ASSERT_TRUE(decoder.decode(received, delta.data(), delta.size(), next));
+  ode::test::expect_equal(second, next);
+  ASSERT_NEAR(101.5f, next.get_value(0, 9, 0), 0.01f);
+}
+
+TEST(ode_delta_codec, unchanged_frame_is_small)
+{
+  const auto schema = ode::test::make_schema();
+  ode::net::replication_frame frame{schema};
+
+  for (std::uint32_t e = 0; e < 10000; ++e)
+  {
+    const float position[] = {1.0f, 2.0f};
+    frame.add(0, e, position);
+  }
+
+  ode::net::delta_encoder encoder{};
+  std::vector<std::uint8_t> delta{};
+  encoder.encode(frame, frame, delta);
+
+  ASSERT_GE(8, delta.size());
+}
+
+TEST(ode_delta_codec, invalid_delta_is_rejected)
+{
+  const auto schema = ode::test::make_schema();
+
+  ode::net::replication_frame empty{schema};
+  ode::net::replication_frame frame{schema};
+
+  for (std::uint32_t e = 0; e < 50; ++e)
+  {
+    const float position[] = {e * 1.0f, 2.0f};
+    frame.add(0, e, position);
+  }
+
+  ode::net::delta_encoder encoder{};
+  ode::net::delta_decoder decoder{};
+  std::vector<std::uint8_t> keyframe{};
+  encoder.encode(empty, frame, keyframe);
+
+  ode::net::replication_frame out{schema};
+
+  ASSERT_FALSE(
+      decoder.decode(empty, keyframe.data(), keyframe.size() / 2, out));
+
+  // The delta removes entities that the baseline doesn't have.
+  std::vector<std::uint8_t> removal{};
+  encoder.encode(frame, empty, removal);
+
+  ASSERT_FALSE(decoder.decode(empty, removal.data(), removal.size(), out));
+}
@@ -0,0 +1,254 @@
+/// The benchmarks of the deltas of the replicated frames and of the
+/// replication server with simulated clients.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/net/replication_server.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/net/delta_codec.h"
+#include "ode/net/replication_client.h"
+#include "ode/net/replication_frame.h"
+
+namespace ode::test
+{
+  ///
+  /// The type of the simulated scene whose bodies are replicated. A quarter
+  /// of the bodies move on each frame, and the rest stand still, as in a
+  /// real scene.
+  ///
+  class replicated_scene final
+  {
+  public:
+    explicit replicated_scene(const std::size_t count)
+        : positions(count * 2), velocities(count * 2), frame{0}
+    {
+      std::mt19937 engine{1};
+      std::uniform_real_distribution<float> position{0.0f, 4096.0f};
+      std::uniform_real_distribution<float> velocity{-4.0f, 4.0f};
+
+      for (std::size_t i = 0; i < positions.size(); ++i)
+      {
+        positions[i] = position(engine);
+        velocities[i] = velocity(engine);
+      }
+    }
+
+    void step()
+    {
+      ++frame;
+
+      for (std::size_t i = frame % 4; i < positions.size() / 2; i += 4)
+      {
+        for (std::size_t j = i * 2; j < i * 2 + 2; ++j)
+        {
+          positions[j] += velocities[j];
+
+          if (0.0f > positions[j] || 4096.0f < positions[j])
+          {
+            velocities[j] = -velocities[j];
+            positions[j] += 2.0f * velocities[j];
+          }
+        }
+      }
+    }
+
+    void fill(ode::net::replication_frame& out) const
+    {
+      out.clear();
+
+      for (std::size_t i = 0; i < positions.size() / 2; ++i)
+      {
+        const float values[] = {
+            positions[i * 2],
+            positions[i * 2 + 1],
+            velocities[i * 2],
+            velocities[i * 2 + 1]};
+        out.add(0, static_cast<std::uint32_t>(i), values);
+
+        // Every eighth body has a sprite that doesn't change.
+        if (0 == i % 8)
+        {
+          const float tile[] = {static_cast<float>(i % 256)};
+          out.add(1, static_cast<std::uint32_t>(i), tile);
+        }
+      }
+    }
+
+  private:
+    std::vector<float> positions;
+    std::vector<float> velocities;
+    std::size_t frame;
+  };
+
+  static ode::net::replication_schema make_replicated_schema()
+  {
+    ode::net::replication_schema schema{};
+
+    schema.add_component(
+        {{0.0f, 4096.0f, 20},
+         {0.0f, 4096.0f, 20},
+         {-8.0f, 8.0f, 12},
+         {-8.0f, 8.0f, 12}});
+    schema.add_component({{0.0f, 255.0f, 8}});
+
+    return schema;
+  }
+
+  constexpr std::size_t replicated_body_count = 4096;
+} // namespace ode::test
+
+static void ode_delta_encode(benchmark::State& state)
+{
+  const auto schema = ode::test::make_replicated_schema();
+  ode::test::replicated_scene scene{ode::test::replicated_body_count};
+
+  ode::net::replication_frame empty{schema};
+  ode::net::replication_frame previous{schema};
+  ode::net::replication_frame current{schema};
+  ode::net::delta_encoder encoder{};
+  std::vector<std::uint8_t> delta{};
+
+  scene.fill(current);
+  encoder.encode(empty, current, delta);
+
+  const auto keyframe_size = delta.size();
+  std::size_t delta_bytes = 0;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    std::swap(previous, current);
+    scene.step();
+    scene.fill(current);
+    state.ResumeTiming();
+
+    delta.clear();
+    encoder.encode(previous, current, delta);
+    delta_bytes += delta.size();
+  }
+
+  state.counters["keyframe_bytes"] = static_cast<double>(keyframe_size);
+  state.counters["delta_bytes"] = benchmark::Counter(
+      static_cast<double>(delta_bytes), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(ode_delta_encode);
+
+static void ode_delta_decode(benchmark::State& state)
+{
+  const auto schema = ode::test::make_replicated_schema();
+  ode::test::replicated_scene scene{ode::test::replicated_body_count};
+
+  ode::net::replication_frame previous{schema};
+  ode::net::replication_frame current{schema};
+  ode::net::replication_frame decoded{schema};
+  ode::net::delta_encoder encoder{};
+  ode::net::delta_decoder decoder{};
+  std::vector<std::uint8_t> delta{};
+
+  scene.fill(previous);
+  scene.step();
+  scene.fill(current);
+  encoder.encode(previous, current, delta);
+
+  for (auto _ : state)
+  {
+    decoder.decode(previous, delta.data(), delta.size(), decoded);
+    benchmark::DoNotOptimize(decoded.get_entities(0).data());
+  }
+
+  state.SetBytesProcessed(
+      static_cast<std::int64_t>(state.iterations() * delta.size()));
+}
+
+BENCHMARK(ode_delta_decode);
+
+static void ode_replication_server(benchmark::State& state)
+{
+  using namespace std::chrono_literals;
+
+  const auto schema = ode::test::make_replicated_schema();
+  const auto path = (std::filesystem::temp_directory_path() /
+                     "ode_replication_benchmark.sock")
+                        .string();
+  const auto client_count = static_cast<std::size_t>(state.range(0));
+
+  ode::test::replicated_scene scene{ode::test::replicated_body_count};
+  ode::net::replication_frame frame{schema};
+  ode::net::replication_server server{path, schema};
+  std::vector<std::unique_ptr<ode::net::replication_client>> clients{};
+
+  for (std::size_t i = 0; i < client_count; ++i)
+  {
+    clients.push_back(
+        std::make_unique<ode::net::replication_client>(path, schema));
+  }
+
+  while (client_count != server.get_subscriber_count())
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const auto receive_all = [&clients, &server] {
+    for (auto& c : clients)
+    {
+      while (c->is_connected() &&
+             c->get_frame_number() < server.get_frame_number())
+      {
+        c->wait(100ms);
+        c->receive();
+      }
+    }
+  };
+
+  // The full frames that the clients start from aren't counted.
+  scene.fill(frame);
+  server.publish(frame);
+  receive_all();
+
+  const auto first_bytes = server.get_bytes_sent();
+  const auto first_clock = std::clock();
+
+  for (auto _ : state)
+  {
+    scene.step();
+    scene.fill(frame);
+    server.publish(frame);
+    receive_all();
+  }
+
+  // The simulated clients run in the same process, so the processor time
+  // includes both sending and decoding the frames.
+  const auto client_frames =
+      static_cast<double>(state.iterations() * client_count);
+  const auto seconds =
+      static_cast<double>(std::clock() - first_clock) / CLOCKS_PER_SEC;
+
+  state.counters["bytes_per_client_frame"] =
+      static_cast<double>(server.get_bytes_sent() - first_bytes) /
+      client_frames;
+  state.counters["cpu_us_per_client_frame"] = seconds * 1e6 / client_frames;
+}
+
+BENCHMARK(ode_replication_server)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
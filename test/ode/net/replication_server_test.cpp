@@ -0,0 +1,157 @@
+/// The tests of the replication server and its clients.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/net/replication_server.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "ode/net/replication_client.h"
+#include "ode/net/replication_frame.h"
+
+using namespace std::chrono_literals;
+
+namespace ode::test
+{
+  static std::string make_socket_path(const std::string& name)
+  {
+    return (std::filesystem::temp_directory_path() / name).string();
+  }
+
+  static void fill_frame(
+      ode::net::replication_frame& frame,
+      const std::uint32_t count,
+      const float offset)
+  {
+    frame.clear();
+
+    for (std::uint32_t e = 0; e < count; ++e)
+    {
+      const float position[] = {e + offset, 100.0f};
+      frame.add(0, e, position);
+    }
+  }
+
+  static bool receive_until(
+      ode::net::replication_client& client, const std::uint32_t frame_number)
+  {
+    for (int i = 0; i < 100 && client.get_frame_number() < frame_number; ++i)
+    {
+      client.wait(20ms);
+      client.receive();
+    }
+
+    return frame_number == client.get_frame_number();
+  }
+
+  static bool wait_for_subscribers(
+      const ode::net::replication_server& server, const std::size_t count)
+  {
+    for (int i = 0; i < 100 && count != server.get_subscriber_count(); ++i)
+    {
+      std::this_thread::sleep_for(10ms);
+    }
+
+    return count == server.get_subscriber_count();
+  }
+} // namespace ode::test
+
+TEST(ode_replication_server, subscribers_receive_frames)
+{
+  ode::net::replication_schema schema{};
+  schema.add_component({{0.0f, 1024.0f, 16}, {0.0f, 1024.0f, 16}});
+
+  const auto path = ode::test::make_socket_path("ode_replication_test.sock");
+  ode::net::replication_server server{path, schema};
+  ode::net::replication_frame frame{schema};
+
+  ode::net::replication_client first{path, schema};
+  ASSERT_TRUE(ode::test::wait_for_subscribers(server, 1));
+
+  for (int i = 1; i <= 3; ++i)
+  {
+    ode::test::fill_frame(frame, 200, static_cast<float>(i));
+    server.publish(frame);
+  }
+
+  ASSERT_TRUE(ode::test::receive_until(first, 3));
+  ASSERT_EQ(200, first.get_frame().get_entities(0).size());
+  ASSERT_NEAR(3.0f, first.get_frame().get_value(0, 0, 0), 0.01f);
+
+  // A subscriber that connects later starts from a full frame.
+  ode::net::replication_client second{path, schema};
+  ASSERT_TRUE(ode::test::wait_for_subscribers(server, 2));
+
+  ode::test::fill_frame(frame, 150, 10.0f);
+  server.publish(frame);
+
+  ASSERT_TRUE(ode::test::receive_until(first, 4));
+  ASSERT_TRUE(ode::test::receive_until(second, 4));
+
+  for (const auto* client : {&first, &second})
+  {
+    ASSERT_EQ(150, client->get_frame().get_entities(0).size());
+    ASSERT_NEAR(159.0f, client->get_frame().get_value(0, 149, 0), 0.02f);
+  }
+
+  // The server counts the bytes after the clients may have read them.
+  const auto received =
+      first.get_bytes_received() + second.get_bytes_received();
+
+  for (int i = 0; i < 100 && received != server.get_bytes_sent(); ++i)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+
+  ASSERT_EQ(received, server.get_bytes_sent());
+}
+
+TEST(ode_replication_server, disconnected_subscriber_is_removed)
+{
+  ode::net::replication_schema schema{};
+  schema.add_component({{0.0f, 1.0f, 8}});
+
+  const auto path = ode::test::make_socket_path("ode_replication_gone.sock");
+  ode::net::replication_server server{path, schema};
+
+  {
+    ode::net::replication_client client{path, schema};
+    ASSERT_TRUE(ode::test::wait_for_subscribers(server, 1));
+  }
+
+  ASSERT_TRUE(ode::test::wait_for_subscribers(server, 0));
+
+  // Publishing without subscribers doesn't queue anything.
+  ode::net::replication_frame frame{schema};
+  server.publish(frame);
+
+  ASSERT_EQ(1, server.get_frame_number());
+  ASSERT_EQ(0, server.get_bytes_sent());
+}
+
+TEST(ode_replication_server, socket_is_removed)
+{
+  ode::net::replication_schema schema{};
+  schema.add_component({{0.0f, 1.0f, 8}});
+
+  const auto path = ode::test::make_socket_path("ode_replication_end.sock");
+
+  {
+    ode::net::replication_server server{path, schema};
+    ASSERT_TRUE(std::filesystem::exists(path));
+  }
+
+  ASSERT_FALSE(std::filesystem::exists(path));
+  ASSERT_THROW(
+      (ode::net::replication_client{path, schema}), std::runtime_error);
+}
@@ -0,0 +1,61 @@
+/// The benchmarks of the real-time audio mixers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/audio_mixer.h"
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/systems/audio/audio_config.h"
+#include "ode/systems/audio/sound_buffer.h"
+
+static void ode_audio_mixer_mix(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const std::size_t frames = ode::audio_sample_rate;
+
+  std::vector<float> samples(frames * 2);
+
+  for (std::size_t i = 0; i < samples.size(); ++i)
+  {
+    samples[i] = static_cast<float>(i % 200) / 400.0f - 0.25f;
+  }
+
+  const auto sound = std::make_shared<const ode::sound_buffer>(samples);
+
+  ode::audio_mixer mixer{};
+  mixer.set_simd_level(static_cast<ode::simd_level>(state.range(1)));
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    mixer.play(sound, 0.1f, 0.0f, true);
+  }
+
+  std::vector<float> out(ode::audio_buffer_frames * 2);
+
+  for (auto _ : state)
+  {
+    mixer.mix(out.data(), ode::audio_buffer_frames);
+    benchmark::ClobberMemory();
+  }
+
+  // A voice is counted once for every buffer of the audio callback that it
+  // is mixed into.
+  state.SetLabel(ode::get_simd_level_name(mixer.get_simd_level()));
+  state.counters["voices_per_ms"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * count) / 1000.0,
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(ode_audio_mixer_mix)
+    ->ArgsProduct(
+        {{8, 32, 128},
+         {static_cast<int>(ode::simd_level::scalar),
+          static_cast<int>(ode::simd_level::sse),
+          static_cast<int>(ode::simd_level::avx2)}});
@@ -0,0 +1,210 @@
+/// The tests of the real-time audio mixers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/audio_mixer.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ode/simd.h"
+#include "ode/systems/audio/audio_config.h"
+#include "ode/systems/audio/sound_buffer.h"
+
+TEST(ode_audio_mixer, sound_is_mixed_with_volume_and_pan)
+{
+  const auto sound =
+      std::make_shared<ode::sound_buffer>(std::vector<float>(64 * 2, 0.5f));
+  ode::audio_mixer mixer{};
+
+  const auto voice = mixer.play(sound, 0.5f, 1.0f);
+
+  ASSERT_NE(0, voice);
+  ASSERT_TRUE(mixer.is_playing(voice));
+
+  std::vector<float> out(32 * 2, 1.0f);
+  mixer.mix(out.data(), 32);
+
+  for (std::size_t i = 0; i < 32; ++i)
+  {
+    ASSERT_FLOAT_EQ(0.0f, out[i * 2]);
+    ASSERT_FLOAT_EQ(0.25f, out[i * 2 + 1]);
+  }
+}
+
+TEST(ode_audio_mixer, ended_sound_is_reported)
+{
+  const auto sound =
+      std::make_shared<ode::sound_buffer>(std::vector<float>(100 * 2, 0.25f));
+  ode::audio_mixer mixer{};
+
+  const auto voice = mixer.play(sound);
+
+  std::vector<float> out(256 * 2);
+  mixer.mix(out.data(), 256);
+
+  ASSERT_FLOAT_EQ(0.25f, out[99 * 2]);
+  ASSERT_FLOAT_EQ(0.0f, out[100 * 2]);
+  ASSERT_TRUE(mixer.is_playing(voice));
+
+  mixer.update();
+
+  ASSERT_FALSE(mixer.is_playing(voice));
+  ASSERT_EQ(0, mixer.get_playing_count());
+}
+
+TEST(ode_audio_mixer, sound_lives_until_voice_ends)
+{
+  auto sound =
+      std::make_shared<ode::sound_buffer>(std::vector<float>(100 * 2, 0.5f));
+  const std::weak_ptr<ode::sound_buffer> observer = sound;
+  ode::audio_mixer mixer{};
+
+  mixer.play(std::move(sound));
+
+  std::vector<float> out(64 * 2);
+  mixer.mix(out.data(), 64);
+  mixer.update();
+
+  ASSERT_FALSE(observer.expired());
+  ASSERT_FLOAT_EQ(0.5f, out[0]);
+
+  mixer.mix(out.data(), 64);
+
+  // The audio thread has finished the voice, but the game thread hasn't
+  // been told yet.
+  ASSERT_FALSE(observer.expired());
+
+  mixer.update();
+
+  ASSERT_TRUE(observer.expired());
+}
+
+TEST(ode_audio_mixer, looping_sound_wraps)
+{
+  const auto sound = std::make_shared<ode::sound_buffer>(
+      std::vector<float>{0.1f, 0.1f, 0.2f, 0.2f, 0.3f, 0.3f});
+  ode::audio_mixer mixer{};
+
+  const auto voice = mixer.play(sound, 1.0f, 0.0f, true);
+
+  std::vector<float> out(7 * 2);
+  mixer.mix(out.data(), 7);
+  mixer.update();
+
+  const float expected[] = {0.1f, 0.2f, 0.3f, 0.1f, 0.2f, 0.3f, 0.1f};
+
+  for (std::size_t i = 0; i < 7; ++i)
+  {
+    ASSERT_FLOAT_EQ(expected[i], out[i * 2]);
+  }
+
+  ASSERT_TRUE(mixer.is_playing(voice));
+}
+
+TEST(ode_audio_mixer, stopped_voice_is_silent)
+{
+  const auto sound =
+      std::make_shared<ode::sound_buffer>(std::vector<float>(1024 * 2, 0.5f));
+  ode::audio_mixer mixer{};
+
+  const auto voice = mixer.play(sound, 1.0f, 0.0f, true);
+
+  std::vector<float> out(16 * 2);
+  mixer.mix(out.data(), 16);
+
+  ASSERT_TRUE(mixer.stop(voice));
+  mixer.mix(out.data(), 16);
+  mixer.update();
+
+  ASSERT_FLOAT_EQ(0.0f, out[0]);
+  ASSERT_FALSE(mixer.is_playing(voice));
+}
+
+TEST(ode_audio_mixer, output_is_clamped)
+{
+  const auto sound =
+      std::make_shared<ode::sound_buffer>(std::vector<float>(16 * 2, 0.75f));
+  ode::audio_mixer mixer{};
+
+  mixer.play(sound);
+  mixer.play(sound);
+  mixer.set_master_volume(0.5f);
+
+  std::vector<float> out(16 * 2);
+  mixer.mix(out.data(), 16);
+
+  ASSERT_FLOAT_EQ(0.75f, out[0]);
+
+  mixer.set_master_volume(2.0f);
+  mixer.play(sound);
+  mixer.mix(out.data(), 16);
+
+  ASSERT_FLOAT_EQ(1.0f, out[0]);
+}
+
+TEST(ode_audio_mixer, full_pool_drops_voice)
+{
+  const auto sound =
+      std::make_shared<ode::sound_buffer>(std::vector<float>(16 * 2, 0.0f));
+  ode::audio_mixer mixer{};
+  std::uint32_t last = 0;
+
+  for (std::size_t i = 0; i <= ode::max_audio_voices; ++i)
+  {
+    last = mixer.play(sound, 1.0f, 0.0f, true);
+  }
+
+  std::vector<float> out(16 * 2);
+  mixer.mix(out.data(), 16);
+  mixer.update();
+
+  ASSERT_FALSE(mixer.is_playing(last));
+  ASSERT_EQ(ode::max_audio_voices, mixer.get_playing_count());
+}
+
+TEST(ode_audio_mixer, simd_levels_agree)
+{
+  constexpr std::size_t frames = 1500;
+  std::vector<std::shared_ptr<ode::sound_buffer>> sounds{};
+
+  for (int v = 0; v < 9; ++v)
+  {
+    std::vector<float> samples(frames * 2);
+
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+      samples[i] = static_cast<float>((i * 37 + v * 11) % 101) / 200.0f;
+    }
+
+    sounds.push_back(std::make_shared<ode::sound_buffer>(samples));
+  }
+
+  const auto mix_at = [&sounds](const ode::simd_level level) {
+    ode::audio_mixer mixer{};
+    mixer.set_simd_level(level);
+
+    for (std::size_t v = 0; v < sounds.size(); ++v)
+    {
+      mixer.play(sounds[v], 0.3f, static_cast<float>(v) / 4.0f - 1.0f);
+    }
+
+    std::vector<float> out(frames * 2);
+    mixer.mix(out.data(), frames);
+    return out;
+  };
+
+  const auto scalar = mix_at(ode::simd_level::scalar);
+  const auto vector = mix_at(ode::get_simd_level());
+
+  for (std::size_t i = 0; i < scalar.size(); ++i)
+  {
+    ASSERT_NEAR(scalar[i], vector[i], 1e-5f);
+  }
+}
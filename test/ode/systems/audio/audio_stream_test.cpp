@@ -0,0 +1,203 @@
+/// The tests of the WAV decoders, the resamplers, and the audio streams.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/audio/audio_stream.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ode/systems/audio/audio_config.h"
+#include "ode/systems/audio/audio_mixer.h"
+#include "ode/systems/audio/audio_resampler.h"
+#include "ode/systems/audio/sound_buffer.h"
+#include "ode/systems/audio/wav_decoder.h"
+
+namespace ode::test
+{
+  static void write_u16(std::ofstream& out, const std::uint16_t value)
+  {
+    const char bytes[] = {
+        static_cast<char>(value & 0xff), static_cast<char>(value >> 8)};
+    out.write(bytes, sizeof(bytes));
+  }
+
+  static void write_u32(std::ofstream& out, const std::uint32_t value)
+  {
+    write_u16(out, static_cast<std::uint16_t>(value & 0xffff));
+    write_u16(out, static_cast<std::uint16_t>(value >> 16));
+  }
+
+  static std::string write_mono_wav(
+      const std::string& name,
+      const int sample_rate,
+      const std::vector<std::int16_t>& samples)
+  {
+    const auto p = std::filesystem::temp_directory_path() / name;
+    const auto size = static_cast<std::uint32_t>(samples.size() * 2);
+
+    std::ofstream out{p, std::ios::binary};
+    out.write("RIFF", 4);
+    write_u32(out, 36 + size);
+    out.write("WAVE", 4);
+    out.write("fmt ", 4);
+    write_u32(out, 16);
+    write_u16(out, 1);
+    write_u16(out, 1);
+    write_u32(out, static_cast<std::uint32_t>(sample_rate));
+    write_u32(out, static_cast<std::uint32_t>(sample_rate * 2));
+    write_u16(out, 2);
+    write_u16(out, 16);
+    out.write("data", 4);
+    write_u32(out, size);
+
+    for (const auto s : samples)
+    {
+      write_u16(out, static_cast<std::uint16_t>(s));
+    }
+
+    return p.string();
+  }
+} // namespace ode::test
+
+TEST(ode_wav_decoder, mono_samples_are_decoded_to_stereo)
+{
+  const auto filename = ode::test::write_mono_wav(
+      "ode_wav_decoder_test.wav", ode::audio_sample_rate, {16384, -32768, 0});
+
+  ode::wav_decoder decoder{filename};
+
+  ASSERT_EQ(ode::audio_sample_rate, decoder.get_sample_rate());
+  ASSERT_EQ(3, decoder.get_frame_count());
+
+  float out[8] = {};
+  ASSERT_EQ(3, decoder.read(out, 4));
+  ASSERT_FLOAT_EQ(0.5f, out[0]);
+  ASSERT_FLOAT_EQ(0.5f, out[1]);
+  ASSERT_FLOAT_EQ(-1.0f, out[2]);
+  ASSERT_FLOAT_EQ(0.0f, out[4]);
+  ASSERT_EQ(0, decoder.read(out, 4));
+
+  decoder.rewind();
+
+  ASSERT_EQ(1, decoder.read(out, 1));
+  ASSERT_FLOAT_EQ(0.5f, out[0]);
+}
+
+TEST(ode_wav_decoder, invalid_file_throws)
+{
+  const auto p =
+      std::filesystem::temp_directory_path() / "ode_wav_decoder_invalid.wav";
+
+  std::ofstream{p} << "not a wav file";
+
+  ASSERT_THROW(ode::wav_decoder{p.string()}, std::runtime_error);
+}
+
+TEST(ode_audio_resampler, rate_is_doubled)
+{
+  ode::audio_resampler resampler{24000, 48000};
+  const float in[] = {0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f};
+
+  float out[16] = {};
+  std::size_t consumed = 0;
+
+  ASSERT_EQ(4, resampler.process(in, 3, out, 8, consumed));
+  ASSERT_EQ(3, consumed);
+  ASSERT_FLOAT_EQ(0.0f, out[0]);
+  ASSERT_FLOAT_EQ(0.5f, out[2]);
+  ASSERT_FLOAT_EQ(1.0f, out[4]);
+  ASSERT_FLOAT_EQ(1.5f, out[6]);
+
+  // The last frame is carried to the next block.
+  const float next[] = {3.0f, 3.0f};
+
+  ASSERT_EQ(2, resampler.process(next, 1, out, 8, consumed));
+  ASSERT_FLOAT_EQ(2.0f, out[0]);
+  ASSERT_FLOAT_EQ(2.5f, out[2]);
+}
+
+TEST(ode_sound_buffer, sound_is_resampled)
+{
+  const std::vector<std::int16_t> samples(ode::audio_sample_rate / 4, 1000);
+  const auto filename = ode::test::write_mono_wav(
+      "ode_sound_buffer_test.wav", ode::audio_sample_rate / 2, samples);
+
+  ode::sound_buffer sound{filename};
+
+  ASSERT_NEAR(ode::audio_sample_rate / 2, sound.get_frame_count(), 2);
+}
+
+TEST(ode_audio_stream, long_track_is_streamed)
+{
+  std::vector<std::int16_t> samples(10000);
+
+  for (std::size_t i = 0; i < samples.size(); ++i)
+  {
+    samples[i] = static_cast<std::int16_t>(i);
+  }
+
+  const auto filename = ode::test::write_mono_wav(
+      "ode_audio_stream_test.wav", ode::audio_sample_rate, samples);
+
+  ode::audio_stream stream{filename, false, 4096};
+
+  ASSERT_EQ(4096, stream.get_queued_frames());
+
+  std::vector<float> out(10000 * 2);
+  std::size_t read = 0;
+
+  while (!stream.is_finished())
+  {
+    read += stream.read(out.data() + read * 2, 1000);
+    stream.pump();
+  }
+
+  ASSERT_EQ(10000, read);
+  ASSERT_FLOAT_EQ(9999.0f / 32768.0f, out[9999 * 2]);
+}
+
+TEST(ode_audio_stream, looping_stream_never_finishes)
+{
+  const auto filename = ode::test::write_mono_wav(
+      "ode_audio_stream_loop.wav", ode::audio_sample_rate, {1, 2, 3});
+
+  ode::audio_stream stream{filename, true, 64};
+
+  float out[64 * 2] = {};
+  ASSERT_EQ(64, stream.read(out, 64));
+  ASSERT_FLOAT_EQ(out[0], out[6]);
+  ASSERT_FALSE(stream.is_finished());
+}
+
+TEST(ode_audio_stream, stream_is_played_by_mixer)
+{
+  const std::vector<std::int16_t> samples(3000, 8192);
+  const auto filename = ode::test::write_mono_wav(
+      "ode_audio_stream_mixer.wav", ode::audio_sample_rate, samples);
+
+  ode::audio_stream stream{filename, false, 1024};
+  ode::audio_mixer mixer{};
+
+  const auto voice = mixer.play(stream);
+
+  std::vector<float> out(512 * 2);
+
+  for (int i = 0; i < 8; ++i)
+  {
+    mixer.mix(out.data(), 512);
+    mixer.update();
+  }
+
+  ASSERT_FALSE(mixer.is_playing(voice));
+  ASSERT_FLOAT_EQ(0.0f, out[0]);
+}
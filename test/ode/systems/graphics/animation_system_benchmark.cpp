@@ -0,0 +1,54 @@
+/// The benchmarks of the animation systems.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/animation_system.h"
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+static void ode_animation_system_update(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+
+  ode::animation_system animations{};
+  const ode::tileset set{0, 1, 16, 16, 512, 512};
+
+  // The clips share a small number of animations as the characters of a
+  // map do.
+  for (std::uint32_t a = 0; a < 64; ++a)
+  {
+    animations.add_animation(
+        {{a * 4, 100}, {a * 4 + 1, 120}, {a * 4 + 2, 80}, {a * 4 + 3, 100}},
+        set);
+    animations.animate_tile(a * 4 + 1, a);
+  }
+
+  std::mt19937 engine{1};
+  std::uniform_int_distribution<std::uint32_t> animation{0, 63};
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    animations.add_clip(animation(engine));
+  }
+
+  std::vector<ode::sprite> sprites(count);
+
+  for (auto _ : state)
+  {
+    animations.update(16, sprites);
+    benchmark::DoNotOptimize(sprites.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.counters["clips_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * count),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(ode_animation_system_update)->Arg(1 << 10)->Arg(1 << 16);
@@ -0,0 +1,139 @@
+/// The tests of the animation systems.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/animation_system.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace ode::test
+{
+  static tileset make_animation_tileset()
+  {
+    // A tileset of 8x4 tiles of 16x16 pixels on a page of 256x256 pixels.
+    return {0, 1, 16, 16, 128, 64, 32, 16, 256, 256};
+  }
+} // namespace ode::test
+
+TEST(ode_animation_system, shared_frames_follow_the_clock)
+{
+  ode::animation_system animations{};
+
+  const auto a = animations.add_animation(
+      {{4, 100}, {5, 100}, {6, 200}}, ode::test::make_animation_tileset());
+
+  ASSERT_EQ(5, animations.get_frame_tile(a));
+
+  animations.update(99);
+  ASSERT_EQ(5, animations.get_frame_tile(a));
+
+  animations.update(1);
+  ASSERT_EQ(6, animations.get_frame_tile(a));
+
+  animations.update(150);
+  ASSERT_EQ(7, animations.get_frame_tile(a));
+
+  // The clock wraps around the end of the animation.
+  animations.update(150);
+  ASSERT_EQ(5, animations.get_frame_tile(a));
+
+  // A step longer than the animation lands on the right frame.
+  animations.update(1450);
+  ASSERT_EQ(7, animations.get_frame_tile(a));
+}
+
+TEST(ode_animation_system, tile_table_changes_with_the_frames)
+{
+  ode::animation_system animations{};
+
+  const auto a = animations.add_animation(
+      {{4, 100}, {5, 100}}, ode::test::make_animation_tileset());
+
+  animations.animate_tile(5, a);
+
+  const auto& table = animations.get_tile_table();
+
+  ASSERT_EQ(6, table.size());
+  ASSERT_EQ(3, table[3]);
+  ASSERT_EQ(5, table[5]);
+  ASSERT_TRUE(animations.take_tile_table_changed());
+  ASSERT_FALSE(animations.take_tile_table_changed());
+
+  animations.update(50);
+  ASSERT_FALSE(animations.take_tile_table_changed());
+
+  animations.update(50);
+  ASSERT_TRUE(animations.take_tile_table_changed());
+  ASSERT_EQ(6, table[5]);
+}
+
+TEST(ode_animation_system, clips_write_the_frames_into_the_sprites)
+{
+  ode::animation_system animations{};
+
+  const auto a = animations.add_animation(
+      {{0, 100}, {9, 100}}, ode::test::make_animation_tileset());
+
+  const auto looping = animations.add_clip(a);
+  const auto once = animations.add_clip(a, ode::animation_playback::once);
+
+  std::vector<ode::sprite> sprites(2);
+
+  animations.update(10, sprites);
+
+  ASSERT_EQ(0, animations.get_clip_frame(looping));
+  ASSERT_FLOAT_EQ(32.0f / 256.0f, sprites[0].u0);
+  ASSERT_FLOAT_EQ(16.0f / 256.0f, sprites[0].v0);
+  ASSERT_FLOAT_EQ(48.0f / 256.0f, sprites[0].u1);
+  ASSERT_FLOAT_EQ(32.0f / 256.0f, sprites[0].v1);
+
+  animations.update(100, sprites);
+
+  ASSERT_EQ(1, animations.get_clip_frame(looping));
+  ASSERT_EQ(1, animations.get_clip_frame(once));
+  ASSERT_FLOAT_EQ(48.0f / 256.0f, sprites[1].u0);
+  ASSERT_FLOAT_EQ(32.0f / 256.0f, sprites[1].v0);
+
+  animations.update(100, sprites);
+
+  ASSERT_EQ(0, animations.get_clip_frame(looping));
+  ASSERT_EQ(1, animations.get_clip_frame(once));
+
+  // Restarting a clip starts it from its first frame.
+  animations.play(once, a, ode::animation_playback::once);
+  animations.update(10, sprites);
+
+  ASSERT_EQ(0, animations.get_clip_frame(once));
+}
+
+TEST(ode_animation_system, synchronized_clips_share_the_frame)
+{
+  ode::animation_system animations{};
+
+  const auto a = animations.add_animation(
+      {{0, 100}, {1, 100}}, ode::test::make_animation_tileset());
+
+  animations.update(150);
+
+  const auto own = animations.add_clip(a);
+  const auto shared =
+      animations.add_clip(a, ode::animation_playback::synchronized);
+
+  std::vector<ode::sprite> sprites(2);
+
+  animations.update(10, sprites);
+
+  ASSERT_EQ(0, animations.get_clip_frame(own));
+  ASSERT_EQ(1, animations.get_clip_frame(shared));
+
+  // The last clip takes the place of the removed one.
+  animations.remove_clip(own);
+
+  ASSERT_EQ(1, animations.get_clip_count());
+  ASSERT_EQ(1, animations.get_clip_frame(own));
+}
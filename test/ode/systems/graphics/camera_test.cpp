@@ -0,0 +1,79 @@
+/// The tests of the cameras and the culling.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/camera.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ode/systems/graphics/culling.h"
+
+TEST(ode_camera, view_is_centred)
+{
+  ode::camera c{{0, 0, 640, 360}};
+
+  c.look_at(1000.0f, 500.0f);
+
+  const auto view = c.get_view();
+
+  ASSERT_FLOAT_EQ(680.0f, view.left);
+  ASSERT_FLOAT_EQ(320.0f, view.top);
+  ASSERT_FLOAT_EQ(1320.0f, view.right);
+  ASSERT_FLOAT_EQ(680.0f, view.bottom);
+
+  c.set_zoom(2.0f);
+
+  const auto zoomed = c.get_view();
+
+  ASSERT_FLOAT_EQ(840.0f, zoomed.left);
+  ASSERT_FLOAT_EQ(1160.0f, zoomed.right);
+}
+
+TEST(ode_camera, only_visible_objects_are_submitted)
+{
+  ode::camera c{{0, 0, 640, 360}};
+  ode::visibility_grid grid{{0.0f, 0.0f, 10000.0f, 10000.0f}, 256.0f};
+  std::vector<ode::graphics_object> objects{};
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ode::sprite s{};
+    s.x = static_cast<float>(i) * 100.0f;
+    s.y = 100.0f;
+    s.width = 32.0f;
+    s.height = 32.0f;
+
+    objects.emplace_back(s);
+    grid.insert(objects.size() - 1, objects.back().get_bounds());
+  }
+
+  c.look_at(320.0f, 180.0f);
+
+  ode::sprite_batch batch{};
+  const auto statistics = ode::submit_visible(c, grid, objects, batch);
+
+  ASSERT_EQ(7, statistics.submitted);
+  ASSERT_EQ(93, statistics.culled);
+  ASSERT_EQ(7, batch.get_sprite_count());
+}
+
+TEST(ode_camera, visible_tiles_are_clipped)
+{
+  ode::camera c{{0, 0, 640, 360}};
+  const ode::tile_layer layer{100, 100};
+  const ode::tileset set{0, 1, 16, 16, 128, 64};
+
+  c.look_at(0.0f, 0.0f);
+
+  const auto range = ode::get_visible_tiles(c, layer, set);
+
+  ASSERT_EQ(0, range.x);
+  ASSERT_EQ(0, range.y);
+  ASSERT_EQ(20, range.width);
+  ASSERT_EQ(12, range.height);
+}
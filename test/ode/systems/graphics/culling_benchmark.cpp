@@ -0,0 +1,84 @@
+/// The benchmarks of the culling.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/culling.h"
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+static void ode_culling_submit_visible(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const float world_size = 100000.0f;
+
+  ode::camera c{{0, 0, 1280, 720}};
+  ode::visibility_grid grid{{0.0f, 0.0f, world_size, world_size}};
+  std::vector<ode::graphics_object> objects{};
+
+  std::mt19937 engine{1};
+  std::uniform_real_distribution<float> position{0.0f, world_size};
+
+  objects.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ode::sprite s{};
+    s.x = position(engine);
+    s.y = position(engine);
+    s.width = 32.0f;
+    s.height = 32.0f;
+
+    objects.emplace_back(s);
+    grid.insert(i, objects.back().get_bounds());
+  }
+
+  c.look_at(world_size / 2.0f, world_size / 2.0f);
+
+  ode::sprite_batch batch{};
+  ode::culling_statistics statistics{};
+
+  for (auto _ : state)
+  {
+    batch.clear();
+    statistics = ode::submit_visible(c, grid, objects, batch);
+    benchmark::DoNotOptimize(batch.get_sprite_count());
+  }
+
+  state.counters["submitted"] = static_cast<double>(statistics.submitted);
+  state.counters["culled"] = static_cast<double>(statistics.culled);
+}
+
+BENCHMARK(ode_culling_submit_visible)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+static void ode_culling_visible_tiles(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+
+  ode::camera c{{0, 0, 1280, 720}};
+  const ode::tile_layer layer{size, size};
+  const ode::tileset set{0, 1, 16, 16, 128, 64};
+
+  c.look_at(size * 8.0f, size * 8.0f);
+
+  ode::tile_range range{};
+
+  for (auto _ : state)
+  {
+    range = ode::get_visible_tiles(c, layer, set);
+    benchmark::DoNotOptimize(range);
+  }
+
+  const auto visible = static_cast<double>(range.width) * range.height;
+  const auto tiles = static_cast<double>(size) * size;
+
+  state.counters["submitted"] = visible;
+  state.counters["culled"] = tiles - visible;
+}
+
+BENCHMARK(ode_culling_visible_tiles)->Arg(1000)->Arg(4000);
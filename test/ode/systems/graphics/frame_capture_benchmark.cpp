@@ -0,0 +1,57 @@
+/// The benchmarks of the frame capture.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/frame_capture.h"
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+#include <glad/glad.h>
+
+#include "ode/gl/gl_config.h"
+#include "ode/systems/graphics/render_target.h"
+
+static void ode_frame_capture_read_back(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+
+  ode::render_target target{size, size};
+  ode::frame_capture capture{size, size};
+
+  target.bind();
+
+  for (auto _ : state)
+  {
+    if constexpr (!ode::disable_gl_calls)
+    {
+      glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    // Only the oldest frame is waited for, so the reads overlap with the
+    // rendering of the next frames.
+    if (!capture.capture())
+    {
+      benchmark::DoNotOptimize(capture.wait());
+      capture.capture();
+    }
+  }
+
+  while (0 < capture.get_pending_count())
+  {
+    capture.wait();
+  }
+
+  target.unbind();
+
+  state.SetBytesProcessed(
+      static_cast<std::int64_t>(state.iterations()) * size * size * 4);
+}
+
+BENCHMARK(ode_frame_capture_read_back)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Unit(benchmark::kMicrosecond);
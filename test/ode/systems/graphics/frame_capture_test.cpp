@@ -0,0 +1,156 @@
+/// The tests of the offscreen render targets and the frame capture.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/frame_capture.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+
+#include <glad/glad.h>
+#include <gtest/gtest.h>
+
+#include "ode/gl/gl_config.h"
+#include "ode/systems/graphics/image.h"
+#include "ode/systems/graphics/render_target.h"
+
+namespace ode::test
+{
+  constexpr int golden_size = 64;
+
+  static void fill(
+      ode::image& img,
+      const int x,
+      const int y,
+      const int width,
+      const int height,
+      const std::uint32_t colour)
+  {
+    auto rect = ode::make_image(width, height);
+
+    for (std::size_t i = 0; i < rect.pixels.size(); i += 4)
+    {
+      rect.pixels[i] = static_cast<std::uint8_t>(colour >> 16);
+      rect.pixels[i + 1] = static_cast<std::uint8_t>(colour >> 8);
+      rect.pixels[i + 2] = static_cast<std::uint8_t>(colour);
+      rect.pixels[i + 3] = 0xff;
+    }
+
+    ode::blit(rect, img, x, y);
+  }
+
+  static void clear(
+      const int x,
+      const int y,
+      const int width,
+      const int height,
+      const std::uint32_t colour)
+  {
+    // The images have their top row first but OpenGL starts from the bottom.
+    glScissor(x, golden_size - y - height, width, height);
+    glClearColor(
+        static_cast<float>((colour >> 16) & 0xff) / 255.0f,
+        static_cast<float>((colour >> 8) & 0xff) / 255.0f,
+        static_cast<float>(colour & 0xff) / 255.0f,
+        1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+  }
+
+  static bool matches(
+      const ode::image& actual, const ode::image& expected, const int tolerance)
+  {
+    if (actual.pixels.size() != expected.pixels.size())
+    {
+      return false;
+    }
+
+    for (std::size_t i = 0; i < actual.pixels.size(); ++i)
+    {
+      if (tolerance < std::abs(actual.pixels[i] - expected.pixels[i]))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+} // namespace ode::test
+
+TEST(ode_frame_capture, frames_are_read_in_order)
+{
+  ode::render_target target{4, 4};
+  ode::frame_capture capture{4, 4, 2};
+
+  target.bind();
+
+  ASSERT_TRUE(capture.capture());
+  ASSERT_TRUE(capture.capture());
+
+  // The ring is full until a frame is read.
+  ASSERT_FALSE(capture.capture());
+  ASSERT_EQ(2, capture.get_pending_count());
+
+  target.unbind();
+
+  const auto first = capture.wait();
+
+  ASSERT_TRUE(first);
+  ASSERT_EQ(4, first->width);
+  ASSERT_EQ(4, first->height);
+  ASSERT_EQ(4 * 4 * 4, first->pixels.size());
+  ASSERT_TRUE(capture.wait());
+  ASSERT_FALSE(capture.wait());
+  ASSERT_FALSE(capture.poll());
+  ASSERT_EQ(0, capture.get_pending_count());
+}
+
+TEST(ode_frame_capture, rendered_frame_matches_golden_image)
+{
+  if constexpr (ode::disable_gl_calls)
+  {
+    return;
+  }
+
+  constexpr auto size = ode::test::golden_size;
+
+  ode::render_target target{size, size};
+  ode::frame_capture capture{size, size};
+
+  auto expected = ode::make_image(size, size);
+
+  ode::test::fill(expected, 0, 0, size, size, 0x203040);
+  ode::test::fill(expected, 8, 4, 16, 24, 0xff0000);
+  ode::test::fill(expected, 32, 40, 24, 8, 0x00ff80);
+
+  target.bind();
+
+  glEnable(GL_SCISSOR_TEST);
+  ode::test::clear(0, 0, size, size, 0x203040);
+  ode::test::clear(8, 4, 16, 24, 0xff0000);
+  ode::test::clear(32, 40, 24, 8, 0x00ff80);
+  glDisable(GL_SCISSOR_TEST);
+
+  ASSERT_TRUE(capture.capture());
+
+  target.unbind();
+
+  const auto actual = capture.wait();
+
+  ASSERT_TRUE(actual);
+  ASSERT_EQ(GL_NO_ERROR, glGetError());
+
+  if (!ode::test::matches(*actual, expected, 1))
+  {
+    const auto path = std::filesystem::temp_directory_path() /
+        "ode_frame_capture_test.png";
+
+    ode::save_image(*actual, path.string());
+
+    FAIL() << "The rendered frame differs from the golden image, see "
+           << path.string();
+  }
+}
@@ -0,0 +1,56 @@
+/// The tests of the image functions.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/image.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+TEST(ode_image, colours_are_parsed)
+{
+  ASSERT_EQ(0xff00ff, ode::parse_colour("#ff00ff"));
+  ASSERT_EQ(0x12abCD, ode::parse_colour("12ABcd"));
+  ASSERT_FALSE(ode::parse_colour(""));
+  ASSERT_FALSE(ode::parse_colour("#ff00f"));
+  ASSERT_FALSE(ode::parse_colour("#gg0000"));
+}
+
+TEST(ode_image, colour_key_clears_pixels)
+{
+  auto img = ode::make_image(2, 1);
+
+  img.pixels = {0xff, 0x00, 0xff, 0xff, 0x10, 0x20, 0x30, 0xff};
+
+  ASSERT_EQ(1, ode::apply_colour_key(img, 0xff00ff));
+  ASSERT_EQ(0, img.pixels[3]);
+  ASSERT_EQ(0, img.pixels[0]);
+  ASSERT_EQ(0xff, img.pixels[7]);
+}
+
+TEST(ode_image, images_are_copied)
+{
+  auto source = ode::make_image(2, 2);
+  auto target = ode::make_image(4, 4);
+
+  std::fill(source.pixels.begin(), source.pixels.end(), std::uint8_t{0xff});
+
+  ode::blit(source, target, 1, 2);
+
+  ASSERT_EQ(0, target.pixels[(2 * 4 + 0) * 4]);
+  ASSERT_EQ(0xff, target.pixels[(2 * 4 + 1) * 4]);
+  ASSERT_EQ(0xff, target.pixels[(3 * 4 + 2) * 4 + 3]);
+  ASSERT_EQ(0, target.pixels[(3 * 4 + 3) * 4]);
+}
+
+TEST(ode_image, invalid_data_is_not_decoded)
+{
+  const std::uint8_t data[] = {0x00, 0x01, 0x02, 0x03};
+
+  ASSERT_FALSE(ode::load_image(data, sizeof(data)));
+}
@@ -0,0 +1,110 @@
+/// The benchmarks of the particle systems.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/particle_system.h"
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+static void ode_particle_system_update(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+
+  ode::particle_system particles{count, ode::sprite{}};
+  particles.set_simd_level(static_cast<ode::simd_level>(state.range(1)));
+  particles.set_gravity(0.0f, 9.8f);
+
+  std::mt19937 engine{1};
+  std::uniform_real_distribution<float> value{-100.0f, 100.0f};
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    // The particles live long enough that the count stays constant.
+    particles.emit({value(engine), value(engine), value(engine), 0.0f, 1e9f});
+  }
+
+  for (auto _ : state)
+  {
+    particles.update(1.0f / 60.0f);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetLabel(ode::get_simd_level_name(particles.get_simd_level()));
+  state.counters["particles_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * count),
+      benchmark::Counter::kIsRate);
+}
+
+// The smaller systems fit in the cache, and the larger ones are bound by
+// the memory bandwidth.
+BENCHMARK(ode_particle_system_update)
+    ->ArgsProduct(
+        {{1 << 14, 1 << 20},
+         {static_cast<int>(ode::simd_level::scalar),
+          static_cast<int>(ode::simd_level::sse),
+          static_cast<int>(ode::simd_level::avx2)}});
+
+static void ode_particle_system_update_with_expiry(benchmark::State& state)
+{
+  const std::size_t count = 1 << 20;
+
+  ode::particle_system particles{count, ode::sprite{}};
+
+  std::mt19937 engine{1};
+  std::uniform_real_distribution<float> lifetime{0.1f, 2.0f};
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+
+    while (particles.get_count() < count)
+    {
+      particles.emit({0.0f, 0.0f, 1.0f, 1.0f, lifetime(engine)});
+    }
+
+    state.ResumeTiming();
+
+    particles.update(1.0f / 60.0f);
+  }
+
+  state.counters["particles_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * count),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(ode_particle_system_update_with_expiry);
+
+static void ode_particle_system_draw(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+
+  ode::sprite appearance{};
+  appearance.width = 4.0f;
+  appearance.height = 4.0f;
+
+  ode::particle_system particles{count, appearance};
+  ode::sprite_batch batch{};
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    particles.emit({0.0f, 0.0f, 0.0f, 0.0f, 1.0f});
+  }
+
+  for (auto _ : state)
+  {
+    batch.clear();
+    particles.draw(batch);
+    benchmark::DoNotOptimize(batch.get_sprite_count());
+  }
+
+  state.counters["particles_per_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * count),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(ode_particle_system_draw)->Arg(1 << 16);
@@ -0,0 +1,135 @@
+/// The tests of the particle systems.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/particle_system.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace ode::test
+{
+  static sprite make_particle_sprite()
+  {
+    sprite s{};
+    s.texture = 3;
+    s.width = 4.0f;
+    s.height = 2.0f;
+    return s;
+  }
+
+  static void fill_particles(particle_system& particles)
+  {
+    // The lifetimes differ so that the particles expire in a scattered
+    // order, and the count isn't a multiple of the vector widths.
+    for (int i = 0; i < 103; ++i)
+    {
+      const float f = static_cast<float>(i);
+      particles.emit({f, -f, 1.0f + f, 2.0f, 0.05f + 0.01f * (i % 7)});
+    }
+  }
+} // namespace ode::test
+
+TEST(ode_particle_system, emit_respects_capacity)
+{
+  ode::particle_system particles{2, ode::test::make_particle_sprite()};
+
+  ASSERT_TRUE(particles.emit({0.0f, 0.0f, 0.0f, 0.0f, 1.0f}));
+  ASSERT_FALSE(particles.emit({0.0f, 0.0f, 0.0f, 0.0f, 0.0f}));
+  ASSERT_TRUE(particles.emit({1.0f, 0.0f, 0.0f, 0.0f, 1.0f}));
+  ASSERT_FALSE(particles.emit({2.0f, 0.0f, 0.0f, 0.0f, 1.0f}));
+  ASSERT_EQ(2, particles.get_count());
+  ASSERT_EQ(2, particles.get_capacity());
+}
+
+TEST(ode_particle_system, update_moves_and_expires_particles)
+{
+  ode::particle_system particles{8, ode::test::make_particle_sprite()};
+
+  particles.set_gravity(0.0f, 10.0f);
+  particles.emit({0.0f, 0.0f, 2.0f, 0.0f, 1.0f});
+  particles.emit({5.0f, 5.0f, 0.0f, 0.0f, 0.25f});
+  particles.emit({9.0f, 0.0f, -1.0f, 0.0f, 2.0f});
+
+  particles.update(0.5f);
+
+  ASSERT_EQ(2, particles.get_count());
+
+  const auto first = particles.get(0);
+  const auto second = particles.get(1);
+
+  ASSERT_FLOAT_EQ(1.0f, first.x);
+  ASSERT_FLOAT_EQ(2.5f, first.y);
+  ASSERT_FLOAT_EQ(5.0f, first.velocity_y);
+  ASSERT_FLOAT_EQ(0.5f, first.lifetime);
+  ASSERT_FLOAT_EQ(8.5f, second.x);
+  ASSERT_FLOAT_EQ(1.5f, second.lifetime);
+}
+
+TEST(ode_particle_system, kernels_agree)
+{
+  for (const auto level : {ode::simd_level::sse, ode::simd_level::avx2})
+  {
+    ode::particle_system scalar{128, ode::test::make_particle_sprite()};
+    ode::particle_system simd{128, ode::test::make_particle_sprite()};
+
+    scalar.set_simd_level(ode::simd_level::scalar);
+    scalar.set_gravity(0.0f, -9.8f);
+    simd.set_simd_level(level);
+    simd.set_gravity(0.0f, -9.8f);
+
+    ASSERT_EQ(ode::simd_level::scalar, scalar.get_simd_level());
+    ASSERT_EQ(std::min(level, ode::get_simd_level()), simd.get_simd_level());
+
+    ode::test::fill_particles(scalar);
+    ode::test::fill_particles(simd);
+
+    for (int step = 0; step < 8; ++step)
+    {
+      scalar.update(0.01f);
+      simd.update(0.01f);
+
+      ASSERT_EQ(scalar.get_count(), simd.get_count());
+
+      for (std::size_t i = 0; i < scalar.get_count(); ++i)
+      {
+        const auto a = scalar.get(i);
+        const auto b = simd.get(i);
+
+        ASSERT_FLOAT_EQ(a.x, b.x);
+        ASSERT_FLOAT_EQ(a.y, b.y);
+        ASSERT_FLOAT_EQ(a.velocity_y, b.velocity_y);
+        ASSERT_FLOAT_EQ(a.lifetime, b.lifetime);
+        ASSERT_LT(0.0f, b.lifetime);
+      }
+    }
+
+    ASSERT_LT(0, simd.get_count());
+    ASSERT_GT(103, simd.get_count());
+  }
+}
+
+TEST(ode_particle_system, draw_adds_centred_sprites)
+{
+  ode::particle_system particles{4, ode::test::make_particle_sprite()};
+  ode::sprite_batch batch{};
+
+  particles.emit({10.0f, 20.0f, 0.0f, 0.0f, 1.0f});
+  particles.emit({30.0f, 40.0f, 0.0f, 0.0f, 1.0f});
+  particles.draw(batch);
+  batch.build();
+
+  const auto& vertices = batch.get_vertices();
+
+  ASSERT_EQ(2, batch.get_sprite_count());
+  ASSERT_EQ(1, batch.get_draws().size());
+  ASSERT_EQ(3, batch.get_draws().front().texture);
+  ASSERT_FLOAT_EQ(8.0f, vertices[0].x);
+  ASSERT_FLOAT_EQ(19.0f, vertices[0].y);
+  ASSERT_FLOAT_EQ(32.0f, vertices[6].x);
+  ASSERT_FLOAT_EQ(41.0f, vertices[6].y);
+}
@@ -0,0 +1,84 @@
+/// The benchmarks of the render queues.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/render_queue.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ode::test
+{
+  static std::vector<render_command> make_commands(const std::size_t count)
+  {
+    std::mt19937 engine{1};
+    std::uniform_int_distribution<std::uint32_t> layer{0, 7};
+    std::uniform_int_distribution<std::uint32_t> program{1, 8};
+    std::uniform_int_distribution<std::uint32_t> texture{1, 64};
+
+    std::vector<render_command> commands(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto& c = commands[i];
+      c.program = program(engine);
+      c.texture = texture(engine);
+      c.key = make_sort_key(
+          static_cast<std::uint8_t>(layer(engine)),
+          c.program,
+          c.texture,
+          static_cast<std::uint16_t>(i));
+    }
+
+    return commands;
+  }
+} // namespace ode::test
+
+static void ode_render_queue_radix_sort(benchmark::State& state)
+{
+  const auto source =
+      ode::test::make_commands(static_cast<std::size_t>(state.range(0)));
+
+  std::vector<ode::render_command> commands{};
+  std::vector<ode::render_command> scratch{};
+
+  for (auto _ : state)
+  {
+    commands = source;
+    ode::sort_commands(commands, scratch);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ode_render_queue_radix_sort)->Arg(1024)->Arg(16384);
+
+static void ode_render_queue_comparison_sort(benchmark::State& state)
+{
+  const auto source =
+      ode::test::make_commands(static_cast<std::size_t>(state.range(0)));
+
+  std::vector<ode::render_command> commands{};
+
+  for (auto _ : state)
+  {
+    commands = source;
+    std::stable_sort(
+        commands.begin(), commands.end(), [](const auto& a, const auto& b) {
+          return a.key < b.key;
+        });
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ode_render_queue_comparison_sort)->Arg(1024)->Arg(16384);
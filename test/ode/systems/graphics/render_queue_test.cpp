@@ -0,0 +1,160 @@
+/// The tests of the render queues.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/render_queue.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <glad/glad.h>
+#include <gtest/gtest.h>
+
+#include "ode/framework/job_system.h"
+#include "ode/gl/gl_config.h"
+#include "ode/gl/shader.h"
+
+namespace ode::test
+{
+  static render_command make_command(
+      const std::uint64_t key, const std::uint32_t sequence = 0)
+  {
+    return {key, 0, 0, 0, GL_TRIANGLES, 0, sequence, 0, 1, 0};
+  }
+} // namespace ode::test
+
+TEST(ode_render_queue, sort_is_stable)
+{
+  std::mt19937_64 engine{1};
+  std::uniform_int_distribution<std::uint64_t> key{0, 15};
+
+  std::vector<ode::render_command> commands{};
+
+  for (std::uint32_t i = 0; i < 1000; ++i)
+  {
+    // Only the highest and the lowest bytes differ so that the passes over
+    // the other bytes are skipped.
+    const auto k = key(engine);
+    commands.push_back(ode::test::make_command(k << 60 | (k & 3), i));
+  }
+
+  auto expected = commands;
+  std::stable_sort(
+      expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return a.key < b.key;
+      });
+
+  std::vector<ode::render_command> scratch{};
+  ode::sort_commands(commands, scratch);
+
+  ASSERT_EQ(expected.size(), commands.size());
+
+  for (std::size_t i = 0; i < commands.size(); ++i)
+  {
+    ASSERT_EQ(expected[i].key, commands[i].key);
+    ASSERT_EQ(expected[i].first, commands[i].first);
+  }
+}
+
+TEST(ode_render_queue, keys_order_layers_before_states)
+{
+  ASSERT_LT(
+      ode::make_sort_key(0, 9, 9, 9), ode::make_sort_key(1, 0, 0, 0));
+  ASSERT_LT(
+      ode::make_sort_key(1, 1, 9, 9), ode::make_sort_key(1, 2, 0, 0));
+  ASSERT_LT(
+      ode::make_sort_key(1, 1, 1, 9), ode::make_sort_key(1, 1, 2, 0));
+}
+
+TEST(ode_render_queue, buffers_are_merged_in_order)
+{
+  ode::render_queue queue{2};
+
+  queue.get_buffer(1).push(ode::test::make_command(5, 2));
+  queue.get_buffer(1).push(ode::test::make_command(1, 3));
+  queue.get_buffer(0).push(ode::test::make_command(5, 0));
+  queue.get_buffer(0).push(ode::test::make_command(5, 1));
+
+  const auto& commands = queue.sort();
+
+  ASSERT_EQ(4, commands.size());
+  ASSERT_EQ(3, commands[0].first);
+  ASSERT_EQ(0, commands[1].first);
+  ASSERT_EQ(1, commands[2].first);
+  ASSERT_EQ(2, commands[3].first);
+}
+
+TEST(ode_render_queue, redundant_state_changes_are_skipped)
+{
+  ode::render_queue queue{};
+  ode::render_state_cache state{};
+
+  GLuint program = 0;
+  GLuint vertex_array = 0;
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    program = ode::gl::make_program(
+        "#version 150 core\nvoid main()\n{\n  gl_Position = vec4(0.0);\n}\n",
+        "#version 150 core\nout vec4 c;\n"
+        "void main()\n{\n  c = vec4(1.0);\n}\n");
+    glGenVertexArrays(1, &vertex_array);
+  }
+
+  for (std::uint16_t i = 0; i < 3; ++i)
+  {
+    auto command = ode::test::make_command(
+        ode::make_sort_key(0, program, 0, i));
+    command.program = program;
+    command.vertex_array = vertex_array;
+    queue.get_buffer(0).push(command);
+  }
+
+  const auto statistics = queue.submit(state);
+
+  ASSERT_EQ(3, statistics.draws);
+  ASSERT_EQ(3, statistics.state_changes);
+  ASSERT_EQ(6, statistics.skipped_changes);
+  ASSERT_EQ(0, queue.get_buffer(0).size());
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+
+    glBindVertexArray(0);
+    glDeleteVertexArrays(1, &vertex_array);
+    glUseProgram(0);
+    glDeleteProgram(program);
+  }
+}
+
+TEST(ode_render_queue, commands_are_recorded_in_parallel)
+{
+  ode::job_system jobs{};
+  ode::render_queue queue{jobs.get_thread_count()};
+
+  for (std::size_t i = 0; i < queue.get_buffer_count(); ++i)
+  {
+    jobs.submit([&buffer = queue.get_buffer(i), i]() {
+      for (std::uint32_t j = 0; j < 100; ++j)
+      {
+        buffer.push(ode::test::make_command(j, static_cast<std::uint32_t>(i)));
+      }
+    });
+  }
+
+  jobs.wait();
+
+  const auto& commands = queue.sort();
+
+  ASSERT_EQ(100 * queue.get_buffer_count(), commands.size());
+  ASSERT_TRUE(std::is_sorted(
+      commands.begin(), commands.end(), [](const auto& a, const auto& b) {
+        return a.key < b.key;
+      }));
+}
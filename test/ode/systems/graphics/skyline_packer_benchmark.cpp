@@ -0,0 +1,52 @@
+/// The benchmarks of the skyline packers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/skyline_packer.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+static void ode_skyline_packer_insert(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+
+  std::mt19937 engine{1};
+  std::uniform_int_distribution<int> size{8, 64};
+  std::vector<std::pair<int, int>> sizes(count);
+
+  for (auto& s : sizes)
+  {
+    s = {size(engine), size(engine)};
+  }
+
+  std::size_t packed = 0;
+  float occupancy = 0.0f;
+
+  for (auto _ : state)
+  {
+    ode::skyline_packer packer{2048, 2048};
+    packed = 0;
+
+    for (const auto& [width, height] : sizes)
+    {
+      if (packer.insert(width, height))
+      {
+        ++packed;
+      }
+    }
+
+    occupancy = packer.get_occupancy();
+  }
+
+  state.counters["packed"] = static_cast<double>(packed);
+  state.counters["occupancy"] = occupancy;
+}
+
+BENCHMARK(ode_skyline_packer_insert)->Arg(100)->Arg(1000)->Arg(4000);
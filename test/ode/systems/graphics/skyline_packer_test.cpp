@@ -0,0 +1,76 @@
+/// The tests of the skyline packers and the atlas builders.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/skyline_packer.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ode/systems/graphics/texture_atlas.h"
+
+namespace ode::test
+{
+  static bool overlap(const ode::atlas_region& a, const ode::atlas_region& b)
+  {
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+        a.y < b.y + b.height && b.y < a.y + a.height;
+  }
+} // namespace ode::test
+
+TEST(ode_skyline_packer, rectangles_do_not_overlap)
+{
+  ode::skyline_packer packer{256, 256};
+  std::vector<ode::atlas_region> regions{};
+
+  for (int i = 0; i < 40; ++i)
+  {
+    const auto region = packer.insert(16 + (i % 5) * 8, 16 + (i % 3) * 8);
+
+    ASSERT_TRUE(region.has_value());
+    ASSERT_LE(region->x + region->width, 256);
+    ASSERT_LE(region->y + region->height, 256);
+
+    for (const auto& other : regions)
+    {
+      ASSERT_FALSE(ode::test::overlap(*region, other));
+    }
+
+    regions.push_back(*region);
+  }
+
+  ASSERT_GT(packer.get_occupancy(), 0.0f);
+}
+
+TEST(ode_skyline_packer, full_area_rejects_rectangles)
+{
+  ode::skyline_packer packer{64, 64};
+
+  ASSERT_TRUE(packer.insert(64, 32).has_value());
+  ASSERT_TRUE(packer.insert(32, 32).has_value());
+  ASSERT_TRUE(packer.insert(32, 32).has_value());
+  ASSERT_FALSE(packer.insert(1, 1).has_value());
+  ASSERT_FLOAT_EQ(1.0f, packer.get_occupancy());
+}
+
+TEST(ode_atlas_builder, pages_are_added)
+{
+  ode::atlas_builder builder{256, 1};
+
+  const auto a = builder.add(200, 100);
+  const auto b = builder.add(200, 100);
+  const auto c = builder.add(200, 100);
+  const auto large = builder.add(300, 20);
+
+  ASSERT_EQ(0, a.page);
+  ASSERT_EQ(0, b.page);
+  ASSERT_EQ(101, b.region.y);
+  ASSERT_EQ(1, c.page);
+  ASSERT_EQ(2, large.page);
+  ASSERT_EQ(300, builder.get_page_width(2));
+  ASSERT_EQ(3, builder.get_page_count());
+}
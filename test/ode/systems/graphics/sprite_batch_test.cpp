@@ -0,0 +1,109 @@
+/// The tests of the sprite batches.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/sprite_batch.h"
+
+#include <gtest/gtest.h>
+
+#include "ode/systems/graphics/graphics_config.h"
+
+TEST(ode_sprite_batch, empty_batch_has_no_draws)
+{
+  ode::sprite_batch batch{};
+
+  batch.build();
+
+  ASSERT_EQ(0, batch.get_sprite_count());
+  ASSERT_TRUE(batch.get_vertices().empty());
+  ASSERT_TRUE(batch.get_draws().empty());
+}
+
+TEST(ode_sprite_batch, sprites_are_sorted_by_layer_and_texture)
+{
+  ode::sprite_batch batch{};
+
+  batch.add({2, 1, 0.0f, 0.0f, 1.0f, 1.0f});
+  batch.add({1, 1, 1.0f, 0.0f, 1.0f, 1.0f});
+  batch.add({2, -1, 2.0f, 0.0f, 1.0f, 1.0f});
+  batch.add({2, 1, 3.0f, 0.0f, 1.0f, 1.0f});
+
+  batch.build();
+
+  const auto& draws = batch.get_draws();
+  const auto& vertices = batch.get_vertices();
+
+  ASSERT_EQ(4, batch.get_sprite_count());
+  ASSERT_EQ(16, vertices.size());
+  ASSERT_EQ(3, draws.size());
+
+  ASSERT_EQ(2, draws[0].texture);
+  ASSERT_EQ(1, draws[0].sprite_count);
+  ASSERT_EQ(1, draws[1].texture);
+  ASSERT_EQ(1, draws[1].sprite_count);
+  ASSERT_EQ(2, draws[2].texture);
+  ASSERT_EQ(2, draws[2].sprite_count);
+  ASSERT_EQ(8, draws[2].first_vertex);
+
+  // The sprites with the same key keep the order in which they are added.
+  ASSERT_EQ(2.0f, vertices[0].x);
+  ASSERT_EQ(1.0f, vertices[4].x);
+  ASSERT_EQ(0.0f, vertices[8].x);
+  ASSERT_EQ(3.0f, vertices[12].x);
+}
+
+TEST(ode_sprite_batch, vertices_cover_the_sprite)
+{
+  ode::sprite_batch batch{};
+
+  batch.add(
+      {1, 0, 10.0f, 20.0f, 4.0f, 8.0f, 0.25f, 0.5f, 0.75f, 1.0f, 0xff0000ff});
+  batch.build();
+
+  const auto& v = batch.get_vertices();
+
+  ASSERT_EQ(10.0f, v[0].x);
+  ASSERT_EQ(20.0f, v[0].y);
+  ASSERT_EQ(0.25f, v[0].u);
+  ASSERT_EQ(0.5f, v[0].v);
+  ASSERT_EQ(14.0f, v[2].x);
+  ASSERT_EQ(28.0f, v[2].y);
+  ASSERT_EQ(0.75f, v[2].u);
+  ASSERT_EQ(1.0f, v[2].v);
+  ASSERT_EQ(0xff0000ff, v[3].colour);
+}
+
+TEST(ode_sprite_batch, draws_are_split_at_batch_size)
+{
+  ode::sprite_batch batch{};
+
+  for (std::size_t i = 0; i < ode::sprite_batch_size + 1; ++i)
+  {
+    batch.add({1, 0, 0.0f, 0.0f, 1.0f, 1.0f});
+  }
+
+  batch.build();
+
+  const auto& draws = batch.get_draws();
+
+  ASSERT_EQ(2, draws.size());
+  ASSERT_EQ(ode::sprite_batch_size, draws[0].sprite_count);
+  ASSERT_EQ(1, draws[1].sprite_count);
+  ASSERT_EQ(ode::sprite_batch_size * 4, draws[1].first_vertex);
+}
+
+TEST(ode_sprite_batch, batch_is_cleared)
+{
+  ode::sprite_batch batch{};
+
+  batch.add({1, 0, 0.0f, 0.0f, 1.0f, 1.0f});
+  batch.build();
+  batch.clear();
+  batch.build();
+
+  ASSERT_EQ(0, batch.get_sprite_count());
+  ASSERT_TRUE(batch.get_draws().empty());
+}
@@ -0,0 +1,86 @@
+/// The benchmarks of the sprite renderer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/sprite_renderer.h"
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/gl/gl_config.h"
+#include "ode/systems/graphics/sprite_batch.h"
+
+namespace ode::test
+{
+  constexpr std::size_t benchmark_sprites = 100000;
+  constexpr std::uint32_t benchmark_textures = 8;
+  constexpr std::int16_t benchmark_layers = 4;
+
+  static void add_benchmark_sprites(ode::sprite_batch& batch)
+  {
+    for (std::size_t i = 0; i < benchmark_sprites; ++i)
+    {
+      const auto x = static_cast<float>(i % 200);
+      const auto y = static_cast<float>(i / 200);
+
+      batch.add(
+          {static_cast<std::uint32_t>(i * 7 % benchmark_textures + 1),
+           static_cast<std::int16_t>(i % benchmark_layers),
+           x,
+           y,
+           16.0f,
+           16.0f});
+    }
+  }
+} // namespace ode::test
+
+static void ode_sprite_batch_build(benchmark::State& state)
+{
+  ode::sprite_batch batch{};
+
+  for (auto _ : state)
+  {
+    batch.clear();
+    ode::test::add_benchmark_sprites(batch);
+    batch.build();
+  }
+
+  state.counters["sprites"] = static_cast<double>(batch.get_sprite_count());
+  state.counters["draw_calls"] =
+      static_cast<double>(batch.get_draws().size());
+}
+
+BENCHMARK(ode_sprite_batch_build)->Unit(benchmark::kMicrosecond);
+
+static void ode_sprite_renderer_draw(benchmark::State& state)
+{
+  ode::sprite_renderer renderer{};
+  ode::sprite_batch batch{};
+
+  ode::test::add_benchmark_sprites(batch);
+  batch.build();
+
+  const auto projection = ode::make_orthographic(0.0f, 200.0f, 500.0f, 0.0f);
+
+  std::size_t draw_calls = 0;
+
+  for (auto _ : state)
+  {
+    draw_calls = renderer.draw(batch, projection);
+
+    if constexpr (!ode::disable_gl_calls)
+    {
+      glFinish();
+    }
+  }
+
+  state.counters["sprites"] = static_cast<double>(batch.get_sprite_count());
+  state.counters["draw_calls"] = static_cast<double>(draw_calls);
+  state.counters["persistent"] = renderer.is_persistent() ? 1.0 : 0.0;
+}
+
+BENCHMARK(ode_sprite_renderer_draw)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,81 @@
+/// The tests of the sprite renderer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/sprite_renderer.h"
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ode/gl/gl_config.h"
+#include "ode/systems/graphics/graphics_config.h"
+
+namespace ode::test
+{
+  static GLuint make_sprite_texture()
+  {
+    const std::uint32_t pixel = 0xffffffff;
+
+    GLuint texture = 0;
+
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(
+        GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &pixel);
+
+    return texture;
+  }
+} // namespace ode::test
+
+TEST(ode_sprite_renderer, orthographic_projection_maps_the_corners)
+{
+  const auto m = ode::make_orthographic(0.0f, 200.0f, 100.0f, 0.0f);
+
+  // The top-left corner of the view is mapped to (-1, 1) and the
+  // bottom-right one to (1, -1).
+  ASSERT_FLOAT_EQ(-1.0f, m[12]);
+  ASSERT_FLOAT_EQ(1.0f, m[13]);
+  ASSERT_FLOAT_EQ(1.0f, 200.0f * m[0] + m[12]);
+  ASSERT_FLOAT_EQ(-1.0f, 100.0f * m[5] + m[13]);
+}
+
+TEST(ode_sprite_renderer, batches_are_drawn)
+{
+  ode::sprite_renderer renderer{};
+  ode::sprite_batch batch{};
+
+  GLuint texture = 0;
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    texture = ode::test::make_sprite_texture();
+  }
+
+  // The sprites don't fit in a single pass so the buffer is written more
+  // than once.
+  const std::size_t count = ode::sprite_buffer_size + ode::sprite_batch_size;
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    batch.add({texture, 0, 0.0f, 0.0f, 1.0f, 1.0f});
+  }
+
+  batch.build();
+
+  const auto projection = ode::make_orthographic(0.0f, 200.0f, 200.0f, 0.0f);
+
+  ASSERT_EQ(batch.get_draws().size(), renderer.draw(batch, projection));
+  ASSERT_EQ(batch.get_draws().size(), renderer.draw(batch, projection));
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+    glDeleteTextures(1, &texture);
+  }
+}
@@ -0,0 +1,61 @@
+/// The tests of the texture caches.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/texture_cache.h"
+
+#include <optional>
+
+#include <glad/glad.h>
+#include <gtest/gtest.h>
+
+#include "ode/gl/gl_config.h"
+
+TEST(ode_texture_cache, shared_textures_are_uploaded_once)
+{
+  ode::texture_cache cache{};
+
+  int loads = 0;
+
+  const auto load = [&loads]() -> std::optional<ode::image> {
+    ++loads;
+    return ode::make_image(4, 4);
+  };
+
+  const auto first = cache.acquire("tileset", load);
+  const auto second = cache.acquire("tileset", load);
+
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(1, loads);
+  ASSERT_EQ(1, cache.get_upload_count());
+  ASSERT_EQ(2, cache.get_reference_count("tileset"));
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    ASSERT_NE(0, first);
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+  }
+
+  cache.release("tileset");
+
+  ASSERT_TRUE(cache.contains("tileset"));
+
+  cache.release("tileset");
+
+  ASSERT_FALSE(cache.contains("tileset"));
+  ASSERT_EQ(0, cache.get_texture_count());
+}
+
+TEST(ode_texture_cache, failed_loads_are_not_cached)
+{
+  ode::texture_cache cache{};
+
+  const auto texture = cache.acquire(
+      "missing", []() -> std::optional<ode::image> { return std::nullopt; });
+
+  ASSERT_EQ(0, texture);
+  ASSERT_FALSE(cache.contains("missing"));
+}
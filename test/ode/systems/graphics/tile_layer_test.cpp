@@ -0,0 +1,82 @@
+/// The tests of the tile layers.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/tile_layer.h"
+
+#include <gtest/gtest.h>
+
+#include "ode/systems/graphics/graphics_config.h"
+
+TEST(ode_tile_layer, new_layer_is_dirty)
+{
+  ode::tile_layer layer{100, 40};
+
+  ASSERT_EQ(100, layer.get_width());
+  ASSERT_EQ(40, layer.get_height());
+  ASSERT_EQ(0, layer.get(99, 39));
+
+  const auto chunks = layer.take_dirty_chunks();
+
+  ASSERT_EQ(8, chunks.size());
+  ASSERT_EQ(0, layer.get_dirty_chunk_count());
+
+  // The chunks on the edges are clipped to the layer.
+  ASSERT_EQ(96, chunks[3].x);
+  ASSERT_EQ(4, chunks[3].width);
+  ASSERT_EQ(32, chunks[7].y);
+  ASSERT_EQ(8, chunks[7].height);
+}
+
+TEST(ode_tile_layer, changed_chunks_are_dirty)
+{
+  ode::tile_layer layer{100, 100};
+
+  layer.take_dirty_chunks();
+
+  layer.set(0, 0, 0);
+
+  ASSERT_EQ(0, layer.get_dirty_chunk_count());
+
+  layer.set(40, 70, 3);
+  layer.set(41, 71, 4);
+
+  ASSERT_EQ(3, layer.get(40, 70));
+  ASSERT_EQ(1, layer.get_dirty_chunk_count());
+
+  const auto chunks = layer.take_dirty_chunks();
+
+  ASSERT_EQ(1, chunks.size());
+  ASSERT_EQ(ode::tile_chunk_size, chunks[0].x);
+  ASSERT_EQ(ode::tile_chunk_size * 2, chunks[0].y);
+  ASSERT_TRUE(layer.take_dirty_chunks().empty());
+}
+
+TEST(ode_tile_layer, visible_range_is_clipped)
+{
+  ode::tile_layer layer{100, 100};
+
+  const auto inside =
+      layer.get_visible_range(20.0f, 40.0f, 100.0f, 72.0f, 16.0f, 16.0f);
+
+  ASSERT_EQ(1, inside.x);
+  ASSERT_EQ(2, inside.y);
+  ASSERT_EQ(6, inside.width);
+  ASSERT_EQ(3, inside.height);
+
+  const auto partial =
+      layer.get_visible_range(-64.0f, 1590.0f, 32.0f, 1700.0f, 16.0f, 16.0f);
+
+  ASSERT_EQ(0, partial.x);
+  ASSERT_EQ(99, partial.y);
+  ASSERT_EQ(2, partial.width);
+  ASSERT_EQ(1, partial.height);
+
+  const auto outside =
+      layer.get_visible_range(1700.0f, 0.0f, 1800.0f, 100.0f, 16.0f, 16.0f);
+
+  ASSERT_TRUE(ode::is_empty(outside));
+}
@@ -0,0 +1,64 @@
+/// The benchmarks of the tile renderer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/tile_renderer.h"
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ode/gl/gl_config.h"
+#include "ode/systems/graphics/sprite_renderer.h"
+
+static void ode_tile_renderer_draw(benchmark::State& state)
+{
+  const auto size = static_cast<int>(state.range(0));
+
+  ode::tile_renderer renderer{};
+  ode::tile_layer layer{size, size};
+  ode::tile_layer_texture texture{};
+
+  texture.update(layer);
+
+  const ode::tileset set{0, 1, 16, 16, 128, 64};
+  const auto range =
+      layer.get_visible_range(0.0f, 0.0f, 640.0f, 360.0f, 16.0f, 16.0f);
+  const auto projection = ode::make_orthographic(0.0f, 640.0f, 360.0f, 0.0f);
+
+  std::size_t tiles = 0;
+
+  for (auto _ : state)
+  {
+    tiles = renderer.draw(texture, set, range, projection);
+  }
+
+  state.counters["tiles"] = static_cast<double>(tiles);
+  state.counters["map_tiles"] = static_cast<double>(size) * size;
+}
+
+BENCHMARK(ode_tile_renderer_draw)->Arg(100)->Arg(1000)->Arg(4000);
+
+static void ode_tile_layer_texture_update(benchmark::State& state)
+{
+  ode::tile_layer layer{1000, 1000};
+  ode::tile_layer_texture texture{};
+
+  texture.update(layer);
+
+  std::uint32_t gid = 0;
+  std::size_t chunks = 0;
+
+  for (auto _ : state)
+  {
+    layer.set(500, 500, ++gid);
+    chunks = texture.update(layer);
+  }
+
+  state.counters["chunks"] = static_cast<double>(chunks);
+}
+
+BENCHMARK(ode_tile_layer_texture_update);
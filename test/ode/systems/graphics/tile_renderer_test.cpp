@@ -0,0 +1,107 @@
+/// The tests of the tile renderer.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/tile_renderer.h"
+
+#include <gtest/gtest.h>
+
+#include "ode/gl/gl_config.h"
+#include "ode/systems/graphics/animation_system.h"
+#include "ode/systems/graphics/sprite_renderer.h"
+
+TEST(ode_tile_renderer, spacing_and_margin_are_counted)
+{
+  ode::tileset set{};
+  set.tile_width = 16;
+  set.tile_height = 16;
+  set.image_width = 16 * 4 + 2 * 3 + 2 * 1;
+  set.image_height = 16 * 2 + 2 * 1 + 2 * 1;
+  set.spacing = 2;
+  set.margin = 1;
+
+  ASSERT_EQ(4, ode::get_tileset_columns(set));
+  ASSERT_EQ(8, ode::get_tile_count(set));
+
+  set.tile_count = 6;
+
+  ASSERT_EQ(6, ode::get_tile_count(set));
+}
+
+TEST(ode_tile_renderer, only_dirty_chunks_are_uploaded)
+{
+  ode::tile_layer layer{100, 100};
+  ode::tile_layer_texture texture{};
+
+  ASSERT_EQ(16, texture.update(layer));
+  ASSERT_EQ(0, texture.update(layer));
+
+  layer.set(5, 5, 2);
+  layer.set(99, 99, 2);
+
+  ASSERT_EQ(2, texture.update(layer));
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    ASSERT_NE(0, texture.get_texture());
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+  }
+}
+
+TEST(ode_tile_renderer, visible_range_is_drawn)
+{
+  ode::tile_renderer renderer{};
+  ode::tile_layer layer{100, 100};
+  ode::tile_layer_texture texture{};
+
+  layer.set(1, 1, 1);
+  texture.update(layer);
+
+  const ode::tileset set{0, 1, 16, 16, 128, 64};
+  const auto range =
+      layer.get_visible_range(0.0f, 0.0f, 200.0f, 200.0f, 16.0f, 16.0f);
+  const auto projection = ode::make_orthographic(0.0f, 200.0f, 200.0f, 0.0f);
+
+  ASSERT_EQ(169, renderer.draw(texture, set, range, projection));
+  ASSERT_EQ(0, renderer.draw(texture, set, {0, 0, 0, 0}, projection));
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+  }
+}
+
+TEST(ode_tile_renderer, animated_tiles_are_drawn_through_the_table)
+{
+  ode::tile_renderer renderer{};
+  ode::animation_system animations{};
+  ode::tile_layer layer{10, 10};
+  ode::tile_layer_texture texture{};
+  ode::tile_table_texture table{};
+
+  const ode::tileset set{0, 1, 16, 16, 128, 64};
+
+  animations.animate_tile(300, animations.add_animation({{1, 100}}, set));
+  layer.set(1, 1, 300);
+  texture.update(layer);
+
+  ASSERT_TRUE(animations.take_tile_table_changed());
+
+  table.update(animations.get_tile_table());
+
+  ASSERT_EQ(301, table.get_size());
+
+  const auto projection = ode::make_orthographic(0.0f, 160.0f, 160.0f, 0.0f);
+
+  ASSERT_EQ(
+      100, renderer.draw(texture, set, table, {0, 0, 10, 10}, projection));
+
+  if constexpr (!ode::disable_gl_calls)
+  {
+    ASSERT_NE(0, table.get_texture());
+    ASSERT_EQ(GL_NO_ERROR, glGetError());
+  }
+}
@@ -0,0 +1,59 @@
+/// The tests of the visibility grids.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/graphics/visibility_grid.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(ode_visibility_grid, query_finds_overlapping_objects)
+{
+  ode::visibility_grid grid{{0.0f, 0.0f, 1000.0f, 1000.0f}, 100.0f};
+
+  grid.insert(0, {10.0f, 10.0f, 20.0f, 20.0f});
+  grid.insert(1, {500.0f, 500.0f, 520.0f, 520.0f});
+
+  // The object spans many cells but is reported only once.
+  grid.insert(2, {50.0f, 50.0f, 450.0f, 450.0f});
+
+  ASSERT_EQ(3, grid.get_object_count());
+
+  auto found = grid.query({0.0f, 0.0f, 300.0f, 300.0f});
+  std::sort(found.begin(), found.end());
+
+  ASSERT_EQ((std::vector<std::size_t>{0, 2}), found);
+}
+
+TEST(ode_visibility_grid, moved_and_removed_objects)
+{
+  ode::visibility_grid grid{{0.0f, 0.0f, 1000.0f, 1000.0f}, 100.0f};
+
+  grid.insert(0, {10.0f, 10.0f, 20.0f, 20.0f});
+  grid.insert(0, {810.0f, 810.0f, 820.0f, 820.0f});
+
+  ASSERT_EQ(1, grid.get_object_count());
+  ASSERT_TRUE(grid.query({0.0f, 0.0f, 100.0f, 100.0f}).empty());
+  ASSERT_EQ(1, grid.query({800.0f, 800.0f, 900.0f, 900.0f}).size());
+
+  grid.remove(0);
+
+  ASSERT_FALSE(grid.contains(0));
+  ASSERT_EQ(0, grid.get_object_count());
+  ASSERT_TRUE(grid.query({800.0f, 800.0f, 900.0f, 900.0f}).empty());
+}
+
+TEST(ode_visibility_grid, objects_outside_area_are_found)
+{
+  ode::visibility_grid grid{{0.0f, 0.0f, 1000.0f, 1000.0f}, 100.0f};
+
+  grid.insert(0, {-500.0f, -500.0f, -400.0f, -400.0f});
+
+  ASSERT_EQ(1, grid.query({-450.0f, -450.0f, -420.0f, -420.0f}).size());
+  ASSERT_TRUE(grid.query({-300.0f, -300.0f, -200.0f, -200.0f}).empty());
+}
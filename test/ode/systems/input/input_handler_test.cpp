@@ -0,0 +1,199 @@
+/// The tests of the input handler and the action bindings.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/input/input_handler.h"
+
+#include <SDL2/SDL.h>
+#include <gtest/gtest.h>
+
+#include "ode/systems/input/action_map.h"
+
+namespace ode::test
+{
+  constexpr std::size_t jump_action = 3;
+  constexpr std::size_t fire_action = 5;
+
+  static SDL_Event make_key_event(
+      const Uint32 type, const SDL_Scancode key, const Uint8 repeat = 0)
+  {
+    SDL_Event event{};
+
+    event.type = type;
+    event.key.keysym.scancode = key;
+    event.key.repeat = repeat;
+
+    return event;
+  }
+
+  static SDL_Event make_button_event(const Uint32 type, const Uint8 button)
+  {
+    SDL_Event event{};
+
+    event.type = type;
+    event.button.button = button;
+
+    return event;
+  }
+} // namespace ode::test
+
+TEST(ode_action_map, inputs_are_bound)
+{
+  ode::action_map map{};
+
+  map.bind(ode::input_device::keyboard, SDL_SCANCODE_SPACE, 1);
+  map.bind(ode::input_device::mouse, SDL_SCANCODE_SPACE, 2);
+
+  ASSERT_EQ(2, map.size());
+  ASSERT_EQ(1, map.find(ode::input_device::keyboard, SDL_SCANCODE_SPACE));
+  ASSERT_EQ(2, map.find(ode::input_device::mouse, SDL_SCANCODE_SPACE));
+  ASSERT_FALSE(map.find(ode::input_device::controller, SDL_SCANCODE_SPACE));
+
+  map.bind(ode::input_device::keyboard, SDL_SCANCODE_SPACE, 4);
+
+  ASSERT_EQ(4, map.find(ode::input_device::keyboard, SDL_SCANCODE_SPACE));
+  ASSERT_TRUE(map.unbind(ode::input_device::keyboard, SDL_SCANCODE_SPACE));
+  ASSERT_FALSE(map.unbind(ode::input_device::keyboard, SDL_SCANCODE_SPACE));
+  ASSERT_EQ(1, map.size());
+}
+
+TEST(ode_input_handler, actions_follow_bound_inputs)
+{
+  ode::input_handler input{};
+
+  input.bind(
+      ode::input_device::keyboard, SDL_SCANCODE_SPACE, ode::test::jump_action);
+  input.bind(
+      ode::input_device::keyboard, SDL_SCANCODE_W, ode::test::jump_action);
+
+  input.handle(ode::test::make_key_event(SDL_KEYDOWN, SDL_SCANCODE_SPACE));
+  input.handle(ode::test::make_key_event(SDL_KEYDOWN, SDL_SCANCODE_W));
+  input.publish();
+
+  const auto& first = input.get_snapshot();
+
+  ASSERT_EQ(1, first.tick);
+  ASSERT_TRUE(first.is_key_down(SDL_SCANCODE_SPACE));
+  ASSERT_TRUE(first.is_down(ode::test::jump_action));
+  ASSERT_TRUE(first.was_pressed(ode::test::jump_action));
+
+  // The action stays active while one of its inputs is held.
+  input.handle(ode::test::make_key_event(SDL_KEYUP, SDL_SCANCODE_SPACE));
+  input.publish();
+
+  ASSERT_TRUE(input.get_snapshot().is_down(ode::test::jump_action));
+  ASSERT_FALSE(input.get_snapshot().was_pressed(ode::test::jump_action));
+  ASSERT_FALSE(input.get_snapshot().was_released(ode::test::jump_action));
+
+  input.handle(ode::test::make_key_event(SDL_KEYUP, SDL_SCANCODE_W));
+  input.publish();
+
+  ASSERT_FALSE(input.get_snapshot().is_down(ode::test::jump_action));
+  ASSERT_TRUE(input.get_snapshot().was_released(ode::test::jump_action));
+}
+
+TEST(ode_input_handler, short_presses_are_not_lost)
+{
+  ode::input_handler input{};
+
+  input.bind(ode::input_device::mouse, SDL_BUTTON_LEFT, ode::test::fire_action);
+
+  input.handle(
+      ode::test::make_button_event(SDL_MOUSEBUTTONDOWN, SDL_BUTTON_LEFT));
+  input.handle(
+      ode::test::make_button_event(SDL_MOUSEBUTTONUP, SDL_BUTTON_LEFT));
+  input.publish();
+
+  const auto& snapshot = input.get_snapshot();
+
+  ASSERT_FALSE(snapshot.is_down(ode::test::fire_action));
+  ASSERT_TRUE(snapshot.was_pressed(ode::test::fire_action));
+  ASSERT_TRUE(snapshot.was_released(ode::test::fire_action));
+}
+
+TEST(ode_input_handler, repeats_and_rebinding_keep_counts)
+{
+  ode::input_handler input{};
+
+  input.handle(ode::test::make_key_event(SDL_KEYDOWN, SDL_SCANCODE_A));
+  input.handle(ode::test::make_key_event(SDL_KEYDOWN, SDL_SCANCODE_A, 1));
+
+  // Binding a held key presses the action once.
+  input.bind(ode::input_device::keyboard, SDL_SCANCODE_A, 0);
+  input.publish();
+
+  ASSERT_TRUE(input.get_snapshot().is_down(0));
+  ASSERT_TRUE(input.get_snapshot().was_pressed(0));
+
+  input.unbind(ode::input_device::keyboard, SDL_SCANCODE_A);
+  input.publish();
+
+  ASSERT_FALSE(input.get_snapshot().is_down(0));
+
+  input.handle(ode::test::make_key_event(SDL_KEYUP, SDL_SCANCODE_A));
+  input.publish();
+
+  ASSERT_FALSE(input.get_snapshot().is_key_down(SDL_SCANCODE_A));
+  ASSERT_FALSE(input.get_snapshot().was_released(0));
+}
+
+TEST(ode_input_handler, unbinding_a_held_key_releases_the_action)
+{
+  ode::input_handler input{};
+
+  input.bind(ode::input_device::keyboard, SDL_SCANCODE_SPACE, 0);
+  input.bind(ode::input_device::keyboard, SDL_SCANCODE_W, 0);
+  input.handle(ode::test::make_key_event(SDL_KEYDOWN, SDL_SCANCODE_SPACE));
+  input.publish();
+
+  ASSERT_TRUE(input.get_snapshot().is_down(0));
+
+  // The other key of the action isn't held, so unbinding it changes nothing.
+  input.unbind(ode::input_device::keyboard, SDL_SCANCODE_W);
+  input.publish();
+
+  ASSERT_TRUE(input.get_snapshot().is_down(0));
+  ASSERT_FALSE(input.get_snapshot().was_released(0));
+
+  input.unbind(ode::input_device::keyboard, SDL_SCANCODE_SPACE);
+  input.publish();
+
+  ASSERT_TRUE(input.get_snapshot().is_key_down(SDL_SCANCODE_SPACE));
+  ASSERT_FALSE(input.get_snapshot().is_down(0));
+  ASSERT_TRUE(input.get_snapshot().was_released(0));
+  ASSERT_FALSE(input.get_snapshot().was_pressed(0));
+}
+
+TEST(ode_input_handler, published_snapshots_are_not_modified)
+{
+  ode::input_handler input{};
+
+  SDL_Event motion{};
+
+  motion.type = SDL_MOUSEMOTION;
+  motion.motion.x = 10;
+  motion.motion.y = 20;
+  motion.motion.xrel = 3;
+  motion.motion.yrel = -2;
+
+  input.handle(motion);
+  input.publish();
+
+  const auto& snapshot = input.get_snapshot();
+
+  input.handle(motion);
+
+  ASSERT_EQ(10, snapshot.mouse_x);
+  ASSERT_EQ(3, snapshot.mouse_dx);
+  ASSERT_EQ(-2, snapshot.mouse_dy);
+
+  input.publish();
+
+  // The movement is collected per tick.
+  ASSERT_EQ(3, input.get_snapshot().mouse_dx);
+  ASSERT_EQ(2, input.get_snapshot().tick);
+  ASSERT_EQ(1, snapshot.tick);
+}
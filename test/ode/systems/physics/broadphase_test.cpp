@@ -0,0 +1,96 @@
+/// The tests of the broadphases.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/physics/broadphase.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace ode::test
+{
+  static bool operator<(const body_pair& a, const body_pair& b)
+  {
+    return a.first < b.first || (a.first == b.first && a.second < b.second);
+  }
+
+  static std::vector<body_pair> find_pairs(
+      const std::vector<rectangle>& bounds)
+  {
+    std::vector<body_pair> pairs{};
+
+    for (std::uint32_t i = 0; i < bounds.size(); ++i)
+    {
+      for (auto j = i + 1; j < bounds.size(); ++j)
+      {
+        if (intersects(bounds[i], bounds[j]))
+        {
+          pairs.push_back({i, j});
+        }
+      }
+    }
+
+    return pairs;
+  }
+} // namespace ode::test
+
+TEST(ode_broadphase, overlapping_bodies_are_paired)
+{
+  ode::broadphase phase{};
+
+  phase.update({
+      {0.0f, 0.0f, 10.0f, 10.0f},
+      {100.0f, 0.0f, 110.0f, 10.0f},
+      {5.0f, 5.0f, 15.0f, 15.0f},
+      {5.0f, 50.0f, 15.0f, 60.0f},
+      {10.0f, 0.0f, 20.0f, 10.0f}});
+
+  auto pairs = phase.get_pairs();
+  std::sort(pairs.begin(), pairs.end(), ode::test::operator<);
+
+  // The bodies that only touch each other aren't paired.
+  ASSERT_EQ(
+      (std::vector<ode::body_pair>{{0, 2}, {2, 4}}), pairs);
+}
+
+TEST(ode_broadphase, moving_bodies_match_brute_force)
+{
+  std::mt19937 engine{7};
+  std::uniform_real_distribution<float> position{0.0f, 500.0f};
+  std::uniform_real_distribution<float> movement{-8.0f, 8.0f};
+
+  std::vector<ode::rectangle> bounds(400);
+
+  for (auto& b : bounds)
+  {
+    const auto x = position(engine);
+    const auto y = position(engine);
+    b = {x, y, x + 12.0f, y + 12.0f};
+  }
+
+  ode::broadphase phase{};
+
+  for (int step = 0; step < 10; ++step)
+  {
+    for (auto& b : bounds)
+    {
+      const auto dx = movement(engine);
+      const auto dy = movement(engine);
+      b = {b.left + dx, b.top + dy, b.right + dx, b.bottom + dy};
+    }
+
+    phase.update(bounds);
+
+    auto pairs = phase.get_pairs();
+    std::sort(pairs.begin(), pairs.end(), ode::test::operator<);
+
+    ASSERT_EQ(ode::test::find_pairs(bounds), pairs);
+  }
+}
@@ -0,0 +1,126 @@
+/// The tests of the collision maps.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/physics/collision_map.h"
+
+#include <gtest/gtest.h>
+
+TEST(ode_collision_map, tiles_are_set)
+{
+  ode::collision_map map{100, 4, 16.0f, 16.0f};
+
+  map.set_solid(70, 2, true);
+  map.set_solid(3, 1, true);
+  map.set_solid(3, 1, false);
+
+  ASSERT_TRUE(map.is_solid(70, 2));
+  ASSERT_FALSE(map.is_solid(3, 1));
+  ASSERT_FALSE(map.is_solid(71, 2));
+
+  // The area outside of the map is solid.
+  ASSERT_TRUE(map.is_solid(-1, 0));
+  ASSERT_TRUE(map.is_solid(100, 0));
+  ASSERT_TRUE(map.is_solid(0, 4));
+}
+
+TEST(ode_collision_map, layers_and_areas_are_added)
+{
+  ode::collision_map map{8, 8, 16.0f, 16.0f};
+  ode::tile_layer layer{8, 8};
+
+  layer.set(1, 2, 5);
+  map.add_layer(layer);
+
+  // The area lies on the borders of the tiles, so only the tiles inside it
+  // become solid.
+  map.add_area({64.0f, 64.0f, 96.0f, 80.0f});
+
+  ASSERT_TRUE(map.is_solid(1, 2));
+  ASSERT_TRUE(map.is_solid(4, 4));
+  ASSERT_TRUE(map.is_solid(5, 4));
+  ASSERT_FALSE(map.is_solid(6, 4));
+  ASSERT_FALSE(map.is_solid(4, 5));
+  ASSERT_FALSE(map.is_solid(3, 4));
+
+  ASSERT_TRUE(map.overlaps({20.0f, 40.0f, 24.0f, 44.0f}));
+  ASSERT_FALSE(map.overlaps({32.0f, 32.0f, 64.0f, 64.0f}));
+}
+
+TEST(ode_collision_map, sweep_stops_at_wall)
+{
+  ode::collision_map map{10, 10, 16.0f, 16.0f};
+
+  for (int y = 0; y < 10; ++y)
+  {
+    map.set_solid(5, y, true);
+  }
+
+  const auto r = map.sweep({16.0f, 16.0f, 32.0f, 32.0f}, 100.0f, 10.0f);
+
+  ASSERT_TRUE(r.hit);
+  ASSERT_FLOAT_EQ(0.48f, r.time);
+  ASSERT_EQ(-1, r.normal_x);
+  ASSERT_EQ(0, r.normal_y);
+  ASSERT_FLOAT_EQ(64.0f, r.x);
+  ASSERT_FLOAT_EQ(20.8f, r.y);
+
+  const auto clear = map.sweep({16.0f, 16.0f, 32.0f, 32.0f}, 20.0f, 0.0f);
+
+  ASSERT_FALSE(clear.hit);
+  ASSERT_FLOAT_EQ(36.0f, clear.x);
+  ASSERT_FLOAT_EQ(16.0f, clear.y);
+}
+
+TEST(ode_collision_map, sweep_hits_diagonal_tile)
+{
+  ode::collision_map map{10, 10, 16.0f, 16.0f};
+
+  map.set_solid(3, 3, true);
+
+  const auto r = map.sweep({16.0f, 16.0f, 32.0f, 32.0f}, 40.0f, 40.0f);
+
+  ASSERT_TRUE(r.hit);
+  ASSERT_FLOAT_EQ(0.4f, r.time);
+  ASSERT_FLOAT_EQ(32.0f, r.x);
+  ASSERT_FLOAT_EQ(32.0f, r.y);
+}
+
+TEST(ode_collision_map, move_slides_along_floor)
+{
+  ode::collision_map map{10, 10, 16.0f, 16.0f};
+
+  for (int x = 0; x < 10; ++x)
+  {
+    map.set_solid(x, 5, true);
+  }
+
+  const auto r = map.move({0.0f, 48.0f, 16.0f, 64.0f}, 30.0f, 100.0f);
+
+  ASSERT_TRUE(r.hit);
+  ASSERT_EQ(0, r.normal_x);
+  ASSERT_EQ(-1, r.normal_y);
+  ASSERT_FLOAT_EQ(30.0f, r.x);
+  ASSERT_FLOAT_EQ(64.0f, r.y);
+
+  // The box rests on the floor, so it moves along it in the next step.
+  const auto next = map.move({r.x, r.y, r.x + 16.0f, r.y + 16.0f}, 5.0f, 5.0f);
+
+  ASSERT_FLOAT_EQ(35.0f, next.x);
+  ASSERT_FLOAT_EQ(64.0f, next.y);
+}
+
+TEST(ode_collision_map, map_edges_stop_movement)
+{
+  ode::collision_map map{4, 4, 16.0f, 16.0f};
+
+  const auto r = map.move({8.0f, 8.0f, 24.0f, 24.0f}, -1000.0f, 1000.0f);
+
+  ASSERT_FLOAT_EQ(0.0f, r.x);
+  ASSERT_FLOAT_EQ(48.0f, r.y);
+  ASSERT_EQ(1, r.normal_x);
+  ASSERT_EQ(-1, r.normal_y);
+}
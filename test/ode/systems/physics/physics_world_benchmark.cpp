@@ -0,0 +1,74 @@
+/// The benchmarks of the physics worlds.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/physics/physics_world.h"
+
+#include <random>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+static void ode_physics_world_step(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const int size = 1000;
+  const float tile_size = 16.0f;
+
+  std::mt19937 engine{1};
+  std::bernoulli_distribution solid{0.1};
+  std::uniform_real_distribution<float> position{0.0f, size * tile_size};
+  std::uniform_real_distribution<float> speed{-120.0f, 120.0f};
+
+  ode::collision_map map{size, size, tile_size, tile_size};
+
+  for (int y = 0; y < size; ++y)
+  {
+    for (int x = 0; x < size; ++x)
+    {
+      if (solid(engine))
+      {
+        map.set_solid(x, y, true);
+      }
+    }
+  }
+
+  ode::physics_world world{std::move(map)};
+
+  while (world.get_body_count() < count)
+  {
+    const auto x = position(engine);
+    const auto y = position(engine);
+    const ode::rectangle bounds{x, y, x + 12.0f, y + 12.0f};
+
+    if (!world.get_map().overlaps(bounds))
+    {
+      world.add_body(bounds, {speed(engine), speed(engine)});
+    }
+  }
+
+  for (auto _ : state)
+  {
+    // The bodies that have stopped are sent off again so that all of them
+    // keep moving.
+    for (std::size_t i = 0; i < world.get_body_count(); ++i)
+    {
+      const auto& v = world.get_velocity(i);
+
+      if (0.0f == v.x || 0.0f == v.y)
+      {
+        world.set_velocity(i, {speed(engine), speed(engine)});
+      }
+    }
+
+    world.step(1.0f / 60.0f);
+    benchmark::DoNotOptimize(world.get_pairs().size());
+  }
+
+  state.counters["pairs"] = static_cast<double>(world.get_pairs().size());
+}
+
+BENCHMARK(ode_physics_world_step)->Arg(1000)->Arg(10000);
@@ -0,0 +1,115 @@
+/// The benchmarks of the spatial grids.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/spatial_grid.h"
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace ode::test
+{
+  static std::vector<spatial_entry> make_benchmark_entries(
+      const std::size_t count, const float world_size)
+  {
+    std::mt19937 engine{1};
+    std::uniform_real_distribution<float> position{0.0f, world_size};
+    std::vector<spatial_entry> entries{};
+
+    entries.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      entries.push_back(
+          {static_cast<std::uint32_t>(i), position(engine), position(engine)});
+    }
+
+    return entries;
+  }
+} // namespace ode::test
+
+static void ode_spatial_grid_rebuild(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const float world_size = 100000.0f;
+  const auto entries = ode::test::make_benchmark_entries(count, world_size);
+
+  ode::spatial_grid grid{{0.0f, 0.0f, world_size, world_size}, 64.0f};
+
+  for (auto _ : state)
+  {
+    grid.rebuild(entries);
+  }
+
+  state.SetItemsProcessed(
+      static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(ode_spatial_grid_rebuild)->Arg(10000)->Arg(1000000);
+
+static void ode_spatial_grid_rebuild_parallel(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const float world_size = 100000.0f;
+  const auto entries = ode::test::make_benchmark_entries(count, world_size);
+
+  ode::job_system jobs{};
+  ode::spatial_grid grid{{0.0f, 0.0f, world_size, world_size}, 64.0f};
+
+  for (auto _ : state)
+  {
+    grid.rebuild(entries, jobs);
+  }
+
+  state.SetItemsProcessed(
+      static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(ode_spatial_grid_rebuild_parallel)->Arg(1000000)->UseRealTime();
+
+static void ode_spatial_grid_query_radius(benchmark::State& state)
+{
+  const float world_size = 100000.0f;
+  const auto entries = ode::test::make_benchmark_entries(1000000, world_size);
+
+  ode::spatial_grid grid{{0.0f, 0.0f, world_size, world_size}, 64.0f};
+  grid.rebuild(entries);
+
+  std::vector<std::uint32_t> ids{};
+  std::size_t i = 0;
+
+  for (auto _ : state)
+  {
+    const auto& e = entries[i++ % entries.size()];
+    grid.query_radius(e.x, e.y, 256.0f, ids);
+    benchmark::DoNotOptimize(ids.data());
+  }
+}
+
+BENCHMARK(ode_spatial_grid_query_radius);
+
+static void ode_spatial_grid_query_nearest(benchmark::State& state)
+{
+  const float world_size = 100000.0f;
+  const auto entries = ode::test::make_benchmark_entries(1000000, world_size);
+
+  ode::spatial_grid grid{{0.0f, 0.0f, world_size, world_size}, 64.0f};
+  grid.rebuild(entries);
+
+  std::vector<std::uint32_t> ids{};
+  std::size_t i = 0;
+
+  for (auto _ : state)
+  {
+    const auto& e = entries[i++ % entries.size()];
+    grid.query_nearest(e.x, e.y, 8, ids);
+    benchmark::DoNotOptimize(ids.data());
+  }
+}
+
+BENCHMARK(ode_spatial_grid_query_nearest);
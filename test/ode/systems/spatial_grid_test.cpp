@@ -0,0 +1,154 @@
+/// The tests of the spatial grids.
+/// \file
+/// \author Antti Kivi
+/// \date 19 October 2026
+/// \copyright Copyright (c) 2026 Antti Kivi.
+/// Licensed under the Effective Elegy Licence.
+
+#include "ode/systems/spatial_grid.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace ode::test
+{
+  static std::vector<spatial_entry> make_entries(const std::size_t count)
+  {
+    std::mt19937 engine{7};
+
+    // Some of the objects are outside of the bounds of the grids.
+    std::uniform_real_distribution<float> position{-50.0f, 1050.0f};
+    std::vector<spatial_entry> entries{};
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      entries.push_back(
+          {static_cast<std::uint32_t>(i), position(engine), position(engine)});
+    }
+
+    return entries;
+  }
+
+  static std::vector<std::uint32_t> sorted(std::vector<std::uint32_t> ids)
+  {
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+} // namespace ode::test
+
+TEST(ode_spatial_grid, empty_grid)
+{
+  ode::spatial_grid grid{{0.0f, 0.0f, 1000.0f, 500.0f}, 64.0f};
+  std::vector<std::uint32_t> ids{1, 2};
+
+  grid.rebuild({});
+  grid.query_radius(10.0f, 10.0f, 100.0f, ids);
+
+  ASSERT_EQ(16 * 8, grid.get_cell_count());
+  ASSERT_EQ(0, grid.get_entry_count());
+  ASSERT_TRUE(ids.empty());
+}
+
+TEST(ode_spatial_grid, area_and_radius_queries)
+{
+  const auto entries = ode::test::make_entries(2000);
+
+  ode::spatial_grid grid{{0.0f, 0.0f, 1000.0f, 1000.0f}, 40.0f};
+  grid.rebuild(entries);
+
+  const ode::rectangle area{-20.0f, 130.0f, 410.0f, 620.0f};
+  std::vector<std::uint32_t> expected{};
+  std::vector<std::uint32_t> ids{};
+
+  for (const auto& e : entries)
+  {
+    if (area.left <= e.x && e.x <= area.right && area.top <= e.y &&
+        e.y <= area.bottom)
+    {
+      expected.push_back(e.id);
+    }
+  }
+
+  grid.query_area(area, ids);
+
+  ASSERT_EQ(2000, grid.get_entry_count());
+  ASSERT_EQ(expected, ode::test::sorted(ids));
+
+  expected.clear();
+
+  for (const auto& e : entries)
+  {
+    const float dx = e.x - 990.0f;
+    const float dy = e.y - 15.0f;
+
+    if (dx * dx + dy * dy <= 150.0f * 150.0f)
+    {
+      expected.push_back(e.id);
+    }
+  }
+
+  grid.query_radius(990.0f, 15.0f, 150.0f, ids);
+
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected, ode::test::sorted(ids));
+}
+
+TEST(ode_spatial_grid, nearest_query)
+{
+  const auto entries = ode::test::make_entries(3000);
+
+  ode::spatial_grid grid{{0.0f, 0.0f, 1000.0f, 1000.0f}, 25.0f};
+  grid.rebuild(entries);
+
+  const std::pair<float, float> points[] = {
+      {500.0f, 500.0f}, {0.0f, 999.0f}, {-300.0f, 400.0f}, {1200.0f, -90.0f}};
+
+  for (const auto& [x, y] : points)
+  {
+    auto by_distance = entries;
+
+    std::sort(
+        by_distance.begin(),
+        by_distance.end(),
+        [x = x, y = y](const auto& a, const auto& b) {
+          const float da = (a.x - x) * (a.x - x) + (a.y - y) * (a.y - y);
+          const float db = (b.x - x) * (b.x - x) + (b.y - y) * (b.y - y);
+          return da < db;
+        });
+
+    std::vector<std::uint32_t> ids{};
+    grid.query_nearest(x, y, 10, ids);
+
+    ASSERT_EQ(10, ids.size());
+
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      ASSERT_EQ(by_distance[i].id, ids[i]);
+    }
+  }
+}
+
+TEST(ode_spatial_grid, parallel_rebuild_matches_serial)
+{
+  const auto entries = ode::test::make_entries(100000);
+
+  ode::job_system jobs{3};
+  ode::spatial_grid serial{{0.0f, 0.0f, 1000.0f, 1000.0f}, 2.0f};
+  ode::spatial_grid parallel{{0.0f, 0.0f, 1000.0f, 1000.0f}, 2.0f};
+
+  serial.rebuild(entries);
+  parallel.rebuild(entries, jobs);
+
+  std::vector<std::uint32_t> a{};
+  std::vector<std::uint32_t> b{};
+
+  serial.query_area({100.0f, 100.0f, 300.0f, 200.0f}, a);
+  parallel.query_area({100.0f, 100.0f, 300.0f, 200.0f}, b);
+
+  ASSERT_EQ(250000, serial.get_cell_count());
+  ASSERT_FALSE(a.empty());
+  ASSERT_EQ(a, b);
+}